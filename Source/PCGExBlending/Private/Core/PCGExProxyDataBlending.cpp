@@ -55,85 +55,85 @@ namespace PCGExBlending
 		C->SetVoid(TargetIndex, ValC.GetRaw());
 	}
 
-	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, const double Weight) const
+	namespace ProxyBlendRange
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
+		// Blends a scope chunk by chunk, A and B read and C written through proxy ranges instead of one virtual call per value.
+		// Chunks with masked out values go one value at a time, since a range write would overwrite the masked ones.
+		template <typename T, typename FWeightFn>
+		void BlendScopeTyped(const FProxyDataBlender& Blender, const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, FWeightFn&& GetWeight)
 		{
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
+			constexpr int32 ChunkSize = PCGExData::IBufferProxy::RangeChunkSize;
+
+			TArray<T, TInlineAllocator<ChunkSize>> ValuesA;
+			TArray<T, TInlineAllocator<ChunkSize>> ValuesB;
+			TArray<T, TInlineAllocator<ChunkSize>> ValuesC;
+			ValuesA.SetNum(FMath::Min(ChunkSize, Scope.Count));
+			ValuesB.SetNum(ValuesA.Num());
+			ValuesC.SetNum(ValuesA.Num());
+
+			for (int32 Offset = 0; Offset < Scope.Count; Offset += ChunkSize)
+			{
+				const int32 Start = Scope.Start + Offset;
+				const int32 Num = FMath::Min(ChunkSize, Scope.Count - Offset);
+
+				bool bWholeChunk = true;
+				if (!Mask.IsEmpty()) { for (int32 i = 0; i < Num && bWholeChunk; i++) { bWholeChunk = Mask[Offset + i] != 0; } }
+
+				if (bWholeChunk)
+				{
+					Blender.A->GetRangeVoid(Start, Num, ValuesA.GetData());
+					Blender.B->GetRangeVoid(Start, Num, ValuesB.GetData());
+					for (int32 i = 0; i < Num; i++) { Blender.Operation->Blend(&ValuesA[i], &ValuesB[i], GetWeight(Offset + i), &ValuesC[i]); }
+					Blender.C->SetRangeVoid(Start, Num, ValuesC.GetData());
+					continue;
+				}
+
+				for (int32 i = 0; i < Num; i++)
+				{
+					if (!Mask[Offset + i]) { continue; }
+
+					Blender.A->GetVoid(Start + i, &ValuesA[i]);
+					Blender.B->GetVoid(Start + i, &ValuesB[i]);
+
+					Blender.Operation->Blend(&ValuesA[i], &ValuesB[i], GetWeight(Offset + i), &ValuesC[i]);
+					Blender.C->SetVoid(Start + i, &ValuesC[i]);
+				}
+			}
+		}
 
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weight, ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
+		template <typename FWeightFn>
+		void BlendScope(const FProxyDataBlender& Blender, const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, FWeightFn&& GetWeight)
+		{
+			if (!Blender.Operation || !Blender.A || !Blender.C || Scope.Count <= 0) { return; }
+
+#define PCGEX_TPL(_TYPE, _NAME, ...) case EPCGMetadataTypes::_NAME: BlendScopeTyped<_TYPE>(Blender, Scope, Mask, GetWeight); break;
+			switch (Blender.UnderlyingType)
+			{
+			PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_TPL)
+			default: break;
+			}
+#undef PCGEX_TPL
 		}
 	}
 
-	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
+	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, const double Weight) const
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
+		ProxyBlendRange::BlendScope(*this, Scope, {}, [Weight](const int32) { return Weight; });
+	}
 
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[Index - Scope.Start], ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
+	{
+		ProxyBlendRange::BlendScope(*this, Scope, {}, [Weights](const int32 i) { return Weights[i]; });
 	}
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			if (!Mask[Index - Scope.Start]) { continue; }
-
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weight, ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		ProxyBlendRange::BlendScope(*this, Scope, Mask, [Weight](const int32) { return Weight; });
 	}
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, TArrayView<const double> Weights) const
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			const int32 i = Index - Scope.Start;
-			if (!Mask[i]) { continue; }
-
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[i], ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		ProxyBlendRange::BlendScope(*this, Scope, Mask, [Weights](const int32 i) { return Weights[i]; });
 	}
 
 	PCGEx::FOpStats FProxyDataBlender::BeginMultiBlend(const int32 TargetIndex)
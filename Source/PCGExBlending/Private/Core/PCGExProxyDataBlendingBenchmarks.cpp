@@ -0,0 +1,227 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBlendingCommon.h"
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExProxyDataBlending.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExDataBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGExProxyData.h"
+#include "Data/PCGPointArrayData.h"
+#include "Metadata/PCGMetadata.h"
+#include "Types/PCGExTypeOps.h"
+#include "Types/PCGExTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Attribute blending throughput, e.g. pcgex.Bench.Run Filter=Blending.* Scales=100000+1000000
+namespace PCGExBlending
+{
+	namespace Benchmark
+	{
+		const FName ScalarName = FName("Scalar");
+		const FName VectorName = FName("Vector");
+		const FName IntName = FName("Int");
+		const FName FloatName = FName("Float");
+
+		// One blended value, captured from Path on both sides; WorkingType overrides the captured one when set
+		struct FChannel
+		{
+			FString Path;
+			EPCGMetadataTypes WorkingType = EPCGMetadataTypes::Unknown;
+		};
+
+		// Members are released in reverse order, the context goes last
+		struct FScene
+		{
+			TSharedPtr<PCGExData::Benchmark::FContextFixture> Fixture;
+			TSharedPtr<PCGExData::FFacade> Facade;
+			TArray<TSharedPtr<FProxyDataBlender>> Blenders;
+		};
+
+		// Blends the given channels of the input into the duplicated output, A = input, B = current output
+		static TSharedPtr<FScene> MakeScene(const int32 InNum, const TArray<FChannel>& InChannels)
+		{
+			TSharedPtr<FScene> Scene = MakeShared<FScene>();
+			Scene->Fixture = MakeShared<PCGExData::Benchmark::FContextFixture>();
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, InNum);
+
+			UPCGPointArrayData* Data = Scene->Fixture->MakePointData(Positions);
+			FPCGMetadataAttribute<double>* Scalar = Data->Metadata->CreateAttribute<double>(ScalarName, 0, true, true);
+			FPCGMetadataAttribute<FVector>* Vector = Data->Metadata->CreateAttribute<FVector>(VectorName, FVector::ZeroVector, true, true);
+			FPCGMetadataAttribute<int32>* Int = Data->Metadata->CreateAttribute<int32>(IntName, 0, true, true);
+			FPCGMetadataAttribute<float>* Float = Data->Metadata->CreateAttribute<float>(FloatName, 0, true, true);
+
+			const TConstPCGValueRange<int64> Entries = Data->GetConstMetadataEntryValueRange();
+			const TPCGValueRange<float> Densities = Data->GetDensityValueRange();
+			for (int32 i = 0; i < InNum; i++)
+			{
+				Scalar->SetValue(Entries[i], Positions[i].X);
+				Vector->SetValue(Entries[i], Positions[i]);
+				Int->SetValue(Entries[i], static_cast<int32>(Positions[i].Y));
+				Float->SetValue(Entries[i], static_cast<float>(Positions[i].Z));
+				Densities[i] = static_cast<float>(i % 7) / 7.f;
+			}
+
+			const TSharedPtr<PCGExData::FPointIO> PointIO = Scene->Fixture->MakePointIO(Data, PCGExData::EIOInit::Duplicate);
+			if (!PointIO) { return nullptr; }
+
+			Scene->Facade = MakeShared<PCGExData::FFacade>(PointIO.ToSharedRef());
+
+			for (const FChannel& Channel : InChannels)
+			{
+				PCGExData::FProxyDescriptor A(Scene->Facade, PCGExData::EProxyRole::Read);
+				PCGExData::FProxyDescriptor B(Scene->Facade, PCGExData::EProxyRole::Read);
+				if (!A.Capture(Scene->Fixture->Get(), Channel.Path, PCGExData::EIOSide::In)) { return nullptr; }
+				if (!B.CaptureStrict(Scene->Fixture->Get(), Channel.Path, PCGExData::EIOSide::Out)) { return nullptr; }
+
+				if (Channel.WorkingType != EPCGMetadataTypes::Unknown)
+				{
+					A.WorkingType = Channel.WorkingType;
+					B.WorkingType = Channel.WorkingType;
+				}
+
+				PCGExData::FProxyDescriptor C = B;
+				C.Role = PCGExData::EProxyRole::Write;
+
+				TSharedPtr<FProxyDataBlender> Blender = CreateProxyBlender(Scene->Fixture->Get(), EPCGExABBlendingType::Lerp, A, B, C);
+				if (!Blender) { return nullptr; }
+
+				Scene->Blenders.Add(Blender);
+			}
+
+			return Scene;
+		}
+
+		static PCGExBenchmark::FKernel MakeBlendKernel(const int32 Scale, const bool bScope)
+		{
+			TSharedPtr<FScene> Scene = MakeScene(Scale, {{ScalarName.ToString()}, {VectorName.ToString()}});
+			if (!Scene) { return nullptr; }
+
+			if (bScope)
+			{
+				return [Scene, Scale]()
+				{
+					for (const TSharedPtr<FProxyDataBlender>& Blender : Scene->Blenders) { Blender->BlendScope(PCGExMT::FScope(0, Scale), 0.5); }
+				};
+			}
+
+			return [Scene, Scale]()
+			{
+				for (const TSharedPtr<FProxyDataBlender>& Blender : Scene->Blenders) { for (int32 i = 0; i < Scale; i++) { Blender->Blend(i, i, i, 0.5); } }
+			};
+		}
+	}
+
+	static PCGExBenchmark::FPairRegistrar BenchBlend(
+		TEXT("Blending.Lerp"), TEXT("Lerps a double & a vector attribute over N points"),
+		{TEXT("PerPoint"), TEXT("one point at a time")}, {TEXT("Scope"), TEXT("through attribute proxy ranges")}, &Benchmark::MakeBlendKernel);
+
+	static PCGExBenchmark::FCheckRegistrar CheckBlendScope(
+		TEXT("Blending.Scope"), TEXT("Blending a scope through proxy ranges writes the same values as blending it one point at a time"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			// Not a multiple of the range chunk size, so every scope ends on a partial chunk
+			constexpr int32 NumPoints = PCGExData::IBufferProxy::RangeChunkSize * 3 + 37;
+
+			// Same-type attributes, converted working types, a sub-selection & a point property
+			const TArray<Benchmark::FChannel> Channels = {
+				{Benchmark::ScalarName.ToString()},
+				{Benchmark::VectorName.ToString()},
+				{Benchmark::IntName.ToString()},
+				{Benchmark::IntName.ToString(), EPCGMetadataTypes::Double},
+				{Benchmark::FloatName.ToString(), EPCGMetadataTypes::Vector},
+				{Benchmark::VectorName.ToString() + TEXT(".Y")},
+				{TEXT("$Density")}};
+
+			// Outputs are compared through their current values, i.e what has been written so far
+			auto ValuesMatch = [&](const PCGExData::IBufferProxy& Range, const PCGExData::IBufferProxy& PerValue, const int32 Index)
+			{
+				PCGExTypes::FScopedTypedValue RangeValue(Range.WorkingType);
+				PCGExTypes::FScopedTypedValue PerValueValue(PerValue.WorkingType);
+				Range.GetCurrentVoid(Index, RangeValue.GetRaw());
+				PerValue.GetCurrentVoid(Index, PerValueValue.GetRaw());
+				return FMemory::Memcmp(RangeValue.GetRaw(), PerValueValue.GetRaw(), PCGExTypeOps::FTypeOpsRegistry::Get(Range.WorkingType)->GetTypeSize()) == 0;
+			};
+
+			// Range reads against per-value reads, over a scope starting mid-chunk
+			if (const TSharedPtr<Benchmark::FScene> Scene = Benchmark::MakeScene(NumPoints, Channels);
+				Context.Test(Scene.IsValid(), TEXT("Couldn't build the range read scene")))
+			{
+				const PCGExMT::FScope Scope(5, NumPoints - 5);
+				for (int32 c = 0; c < Channels.Num(); c++)
+				{
+					for (const TSharedPtr<PCGExData::IBufferProxy>& Proxy : {Scene->Blenders[c]->A, Scene->Blenders[c]->B})
+					{
+						const int32 TypeSize = PCGExTypeOps::FTypeOpsRegistry::Get(Proxy->WorkingType)->GetTypeSize();
+
+						TArray<uint8> RangeValues;
+						RangeValues.SetNumZeroed(Scope.Count * TypeSize);
+						Proxy->GetRangeVoid(Scope.Start, Scope.Count, RangeValues.GetData());
+
+						int32 NumMismatches = 0;
+						PCGExTypes::FScopedTypedValue Value(Proxy->WorkingType);
+						for (int32 i = 0; i < Scope.Count; i++)
+						{
+							Proxy->GetVoid(Scope.Start + i, Value.GetRaw());
+							if (FMemory::Memcmp(RangeValues.GetData() + i * TypeSize, Value.GetRaw(), TypeSize) != 0) { NumMismatches++; }
+						}
+
+						Context.Test(NumMismatches == 0, TEXT("%s: %d range reads differ from per-value reads"), *Channels[c].Path, NumMismatches);
+					}
+				}
+			}
+
+			// Blends the same scope on two identical scenes, through BlendScope on one & Blend on the other
+			auto CheckScope = [&](const TCHAR* Label, const PCGExMT::FScope& Scope, const bool bMask, const bool bWeights)
+			{
+				const TSharedPtr<Benchmark::FScene> RangeScene = Benchmark::MakeScene(NumPoints, Channels);
+				const TSharedPtr<Benchmark::FScene> PerValueScene = Benchmark::MakeScene(NumPoints, Channels);
+				if (!Context.Test(RangeScene && PerValueScene, TEXT("%s: couldn't build the scenes"), Label)) { return; }
+
+				// Whole chunks, a chunk with gaps and a masked out last point, so both the range & the per-value fallback run
+				TArray<int8> Mask;
+				TArray<double> Weights;
+				Mask.SetNumUninitialized(Scope.Count);
+				Weights.SetNumUninitialized(Scope.Count);
+				for (int32 i = 0; i < Scope.Count; i++)
+				{
+					Mask[i] = (i / PCGExData::IBufferProxy::RangeChunkSize == 1 && i % 3 == 0) || i == Scope.Count - 1 ? 0 : 1;
+					Weights[i] = static_cast<double>(i % 11) / 10.0;
+				}
+
+				for (int32 c = 0; c < Channels.Num(); c++)
+				{
+					const FProxyDataBlender& Range = *RangeScene->Blenders[c];
+					const FProxyDataBlender& PerValue = *PerValueScene->Blenders[c];
+
+					if (bMask && bWeights) { Range.BlendScope(Scope, Mask, Weights); }
+					else if (bMask) { Range.BlendScope(Scope, Mask, 0.25); }
+					else if (bWeights) { Range.BlendScope(Scope, Weights); }
+					else { Range.BlendScope(Scope, 0.25); }
+
+					for (int32 i = 0; i < Scope.Count; i++)
+					{
+						if (bMask && !Mask[i]) { continue; }
+						PerValue.Blend(Scope.Start + i, Scope.Start + i, Scope.Start + i, bWeights ? Weights[i] : 0.25);
+					}
+
+					// Points outside the scope or masked out must be left alone on both sides
+					int32 NumMismatches = 0;
+					for (int32 i = 0; i < NumPoints; i++) { if (!ValuesMatch(*Range.C, *PerValue.C, i)) { NumMismatches++; } }
+
+					Context.Test(NumMismatches == 0, TEXT("%s, %s: %d of %d points differ between the range & per-value blends"), Label, *Channels[c].Path, NumMismatches, NumPoints);
+				}
+			};
+
+			CheckScope(TEXT("Weight"), PCGExMT::FScope(0, NumPoints), false, false);
+			CheckScope(TEXT("Weights"), PCGExMT::FScope(13, NumPoints - 20), false, true);
+			CheckScope(TEXT("Mask"), PCGExMT::FScope(5, NumPoints - 5), true, false);
+			CheckScope(TEXT("Mask & Weights"), PCGExMT::FScope(1, PCGExData::IBufferProxy::RangeChunkSize * 2 + 3), true, true);
+		});
+}
+
+#endif
@@ -40,6 +40,7 @@ public class PCGExCollections : ModuleRules
 				"PCGExCore",
 				"PCGExProperties",
 				"PCGExFilters",
+				"PCGExBlending",
 				"PCGExFoundations",
 				"PCGExElementsBridges",
 			}
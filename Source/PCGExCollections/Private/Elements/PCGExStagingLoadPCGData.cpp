@@ -4,6 +4,7 @@
 #include "Elements/PCGExStagingLoadPCGData.h"
 
 #include "PCGDataAsset.h"
+#include "PCGExLog.h"
 #include "PCGParamData.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -16,13 +17,74 @@
 #include "Data/PCGVolumeData.h"
 #include "Data/PCGLandscapeData.h"
 #include "Collections/PCGExPCGDataAssetCollection.h"
+#include "Core/PCGExDiagnostics.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/Utils/PCGExDataForward.h"
+#include "Helpers/PCGExArrayHelpers.h"
 #include "Helpers/PCGExRandomHelpers.h"
+#include "Utils/PCGExPointIOMerger.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPCGDataAssetLoaderElement"
 #define PCGEX_NAMESPACE PCGDataAssetLoader
 
+#pragma region FPCGExPCGDataAssetCache
+
+FPCGExPCGDataAssetCache& FPCGExPCGDataAssetCache::Get()
+{
+	static FPCGExPCGDataAssetCache Instance;
+	return Instance;
+}
+
+UPCGDataAsset* FPCGExPCGDataAssetCache::Find(const FSoftObjectPath& InPath) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const FEntry* Entry = Entries.Find(InPath);
+	return Entry ? Entry->Asset.Get() : nullptr;
+}
+
+void FPCGExPCGDataAssetCache::Add(const TArray<TPair<FSoftObjectPath, UPCGDataAsset*>>& InAssets, const TSharedPtr<FStreamableHandle>& InHandle)
+{
+	FWriteScopeLock WriteLock(Lock);
+	for (const TPair<FSoftObjectPath, UPCGDataAsset*>& Pair : InAssets)
+	{
+		FEntry& Entry = Entries.FindOrAdd(Pair.Key);
+		Entry.Asset = Pair.Value;
+		Entry.Handle = InHandle;
+	}
+}
+
+void FPCGExPCGDataAssetCache::Flush()
+{
+	TArray<TSharedPtr<FStreamableHandle>> Handles;
+
+	{
+		FWriteScopeLock WriteLock(Lock);
+		TSet<FStreamableHandle*> Unique;
+		for (const TPair<FSoftObjectPath, FEntry>& Pair : Entries)
+		{
+			bool bAlreadyInSet = false;
+			Unique.Add(Pair.Value.Handle.Get(), &bAlreadyInSet);
+			if (!bAlreadyInSet) { Handles.Add(Pair.Value.Handle); }
+		}
+		Entries.Empty();
+	}
+
+	PCGExHelpers::SafeReleaseHandles(Handles);
+}
+
+int32 FPCGExPCGDataAssetCache::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Entries.Num();
+}
+
+static PCGExDiagnostics::FRegistrar DiagnosticsPCGDataAssetCache(
+	TEXT("PCGDataAssetCache"), TEXT("PCGDataAssets kept loaded by Staging : Load PCGData; flushing releases them"),
+	[]() { return FString::Printf(TEXT("%d assets kept loaded."), FPCGExPCGDataAssetCache::Get().Num()); },
+	[]() { FPCGExPCGDataAssetCache::Get().Flush(); });
+
+#pragma endregion
+
 #pragma region FPCGExSharedAssetPool
 
 FPCGExSharedAssetPool::~FPCGExSharedAssetPool()
@@ -52,47 +114,65 @@ void FPCGExSharedAssetPool::LoadAllAssets(const TSharedPtr<PCGExMT::FTaskManager
 		return;
 	}
 
-	// Collect unique paths from all entries
+	// Collect unique paths from all entries, resolving those still cached from previous executions
 	TSharedPtr<TSet<FSoftObjectPath>> PathsToLoad = MakeShared<TSet<FSoftObjectPath>>();
 	for (const auto& Pair : EntryMap)
 	{
-		if (Pair.Value && Pair.Value->Staging.Path.IsValid())
+		if (!Pair.Value || !Pair.Value->Staging.Path.IsValid()) { continue; }
+
+		if (bUseCache)
 		{
-			PathsToLoad->Add(Pair.Value->Staging.Path);
+			if (UPCGDataAsset* CachedAsset = FPCGExPCGDataAssetCache::Get().Find(Pair.Value->Staging.Path))
+			{
+				LoadedAssets.Add(Pair.Value, CachedAsset);
+				continue;
+			}
 		}
+
+		PathsToLoad->Add(Pair.Value->Staging.Path);
 	}
 
 	if (PathsToLoad->IsEmpty())
 	{
-		OnLoadEnd(false);
+		OnLoadEnd(!LoadedAssets.IsEmpty());
 		return;
 	}
 
 	PCGExHelpers::Load(
 		TaskManager,
 		[PathsToLoad]() { return PathsToLoad->Array(); },
-		[PCGEX_ASYNC_THIS_CAPTURE, OnLoadEnd](const bool bSuccess, TSharedPtr<FStreamableHandle> StreamableHandle)
+		[PCGEX_ASYNC_THIS_CAPTURE, PathsToLoad, OnLoadEnd](const bool bSuccess, TSharedPtr<FStreamableHandle> StreamableHandle)
 		{
 			PCGEX_ASYNC_THIS
-			This->LoadHandle = StreamableHandle;
 
 			if (bSuccess)
 			{
+				TArray<TPair<FSoftObjectPath, UPCGDataAsset*>> NewlyLoaded;
+
 				// Map loaded assets back to entries
 				for (const auto& Pair : This->EntryMap)
 				{
-					if (Pair.Value && Pair.Value->Staging.Path.IsValid())
+					if (Pair.Value && Pair.Value->Staging.Path.IsValid() && PathsToLoad->Contains(Pair.Value->Staging.Path))
 					{
 						TSoftObjectPtr<UPCGDataAsset> SoftPtr(Pair.Value->Staging.Path);
 						if (UPCGDataAsset* LoadedAsset = SoftPtr.Get())
 						{
 							This->LoadedAssets.Add(Pair.Value, LoadedAsset);
+							NewlyLoaded.Emplace(Pair.Value->Staging.Path, LoadedAsset);
 						}
 					}
 				}
+
+				// The cache owns the handle from now on, it must outlive this pool
+				if (This->bUseCache && StreamableHandle) { FPCGExPCGDataAssetCache::Get().Add(NewlyLoaded, StreamableHandle); }
+				else { This->LoadHandle = StreamableHandle; }
+			}
+			else
+			{
+				This->LoadHandle = StreamableHandle;
 			}
 
-			OnLoadEnd(bSuccess);
+			OnLoadEnd(bSuccess || !This->LoadedAssets.IsEmpty());
 		});
 }
 
@@ -311,7 +391,7 @@ namespace PCGExPCGDataAssetLoader
 
 #pragma region FPCGExPCGDataAssetLoaderContext
 
-void FPCGExPCGDataAssetLoaderContext::RegisterOutput(const FPCGTaggedData& InTaggedData, bool bAddPinTag, const int32 InIndex)
+void FPCGExPCGDataAssetLoaderContext::RegisterOutput(const FPCGTaggedData& InTaggedData, bool bAddPinTag, const FIntPoint& InOrder, const bool bSpatial)
 {
 	if (!InTaggedData.Data) { return; }
 
@@ -333,11 +413,11 @@ void FPCGExPCGDataAssetLoaderContext::RegisterOutput(const FPCGTaggedData& InTag
 	{
 		FWriteScopeLock WriteLock(OutputLock);
 		OutputByPin.FindOrAdd(TargetPin).Add(LocalOutputData);
-		OutputIndices.Add(InTaggedData.Data->GetUniqueID(), InIndex);
+		OutputOrders.Add(InTaggedData.Data->GetUniqueID(), FIntVector(bSpatial, InOrder.X, InOrder.Y));
 	}
 }
 
-void FPCGExPCGDataAssetLoaderContext::RegisterNonSpatialData(const FPCGTaggedData& InTaggedData, const int32 InIndex)
+void FPCGExPCGDataAssetLoaderContext::RegisterNonSpatialData(const FPCGTaggedData& InTaggedData, const FIntPoint& InOrder)
 {
 	if (!InTaggedData.Data) { return; }
 
@@ -356,7 +436,7 @@ void FPCGExPCGDataAssetLoaderContext::RegisterNonSpatialData(const FPCGTaggedDat
 		if (bAlreadyInSet) { return; }
 
 		// Non-spatial goes to appropriate pin, with Pin: tag if going to default
-		RegisterOutput(InTaggedData, true, InIndex * -1);
+		RegisterOutput(InTaggedData, true, InOrder, false);
 	}
 }
 
@@ -416,8 +496,17 @@ bool FPCGExPCGDataAssetLoaderElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	if (Settings->bInstanced)
+	{
+		PCGEX_VALIDATE_NAME(Settings->InstanceIndexAttributeName)
+		Context->CarryOverDetails.Init();
+	}
+
+	Context->StartTime = FPlatformTime::Seconds();
+
 	// Setup shared asset pool
 	Context->SharedAssetPool = MakeShared<FPCGExSharedAssetPool>();
+	Context->SharedAssetPool->bUseCache = Settings->bCacheLoadedAssets;
 	Context->CustomPinNames.Reserve(Settings->CustomOutputPins.Num());
 
 	// Build custom pin name set for fast lookup
@@ -445,6 +534,7 @@ bool FPCGExPCGDataAssetLoaderElement::AdvanceWork(FPCGExContext* InContext, cons
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry) { return true; },
 			[&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
 			{
+				NewBatch->bRequiresWriteStep = Settings->bInstanced;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not find any points to process."));
@@ -456,7 +546,14 @@ bool FPCGExPCGDataAssetLoaderElement::AdvanceWork(FPCGExContext* InContext, cons
 	// Stage outputs from all pins
 	for (auto& Pair : Context->OutputByPin)
 	{
-		Pair.Value.Sort([&](const FPCGTaggedData& A, const FPCGTaggedData& B) { return Context->OutputIndices[A.Data->GetUniqueID()] < Context->OutputIndices[A.Data->GetUniqueID()]; });
+		Pair.Value.Sort(
+			[&](const FPCGTaggedData& A, const FPCGTaggedData& B)
+			{
+				const FIntVector& OA = Context->OutputOrders[A.Data->GetUniqueID()];
+				const FIntVector& OB = Context->OutputOrders[B.Data->GetUniqueID()];
+				if (OA.X != OB.X) { return OA.X < OB.X; }
+				return OA.Y != OB.Y ? OA.Y < OB.Y : OA.Z < OB.Z;
+			});
 		Context->OutputData.TaggedData.Append(Pair.Value);
 	}
 
@@ -494,6 +591,16 @@ bool FPCGExPCGDataAssetLoaderElement::AdvanceWork(FPCGExContext* InContext, cons
 		PinIndex++;
 	}
 
+	if (Settings->bLogStats)
+	{
+		int32 NumOutputs = 0;
+		for (const auto& Pair : Context->OutputByPin) { NumOutputs += Pair.Value.Num(); }
+
+		UE_LOG(
+			LogPCGEx, Log, TEXT("Load PCGData: %d outputs (%d instanced) in %.3fs. %d assets cached across executions."),
+			NumOutputs, Context->NumInstancedOutputs, FPlatformTime::Seconds() - Context->StartTime, FPCGExPCGDataAssetCache::Get().Num());
+	}
+
 	return Context->TryComplete();
 }
 
@@ -597,12 +704,50 @@ namespace PCGExPCGDataAssetLoader
 		return true;
 	}
 
+	bool FProcessor::CanInstance(const FPCGTaggedData& InTaggedData) const
+	{
+		const UPCGBasePointData* PointData = Cast<UPCGBasePointData>(InTaggedData.Data);
+		if (!PointData || PointData->IsEmpty()) { return false; }
+
+		// Cluster data must keep one Vtx/Edges pair per staged point
+		static const FString ClusterTagPrefix = TEXT("PCGEx/Cluster:");
+		for (const FString& Tag : InTaggedData.Tags) { if (Tag.StartsWith(ClusterTagPrefix)) { return false; } }
+
+		return true;
+	}
+
+	void FProcessor::InstanceTaggedData(const FPCGTaggedData& InTaggedData, const TArray<int32>& InInstances)
+	{
+		const UPCGBasePointData* SourceData = Cast<UPCGBasePointData>(InTaggedData.Data);
+		const TWeakPtr<FPCGContextHandle> ContextHandle = PointDataFacade->Source->GetContextHandle();
+
+		const TSharedPtr<PCGExData::FPointIO> SourceIO = MakeShared<PCGExData::FPointIO>(ContextHandle, SourceData);
+		SourceIO->SetInfos(0, NAME_None);
+
+		const TSharedPtr<PCGExData::FPointIO> OutputIO = MakeShared<PCGExData::FPointIO>(ContextHandle, SourceData);
+		OutputIO->SetInfos(0, NAME_None);
+		if (!OutputIO->InitializeOutput(PCGExData::EIOInit::New)) { return; }
+
+		PCGEX_MAKE_SHARED(Output, FInstancedOutput)
+		Output->Source = InTaggedData;
+		Output->Instances = InInstances;
+		Output->Facade = MakeShared<PCGExData::FFacade>(OutputIO.ToSharedRef());
+
+		// Every instance is a consecutive block of the output, filled in parallel by the merger
+		Output->Merger = MakeShared<FPCGExPointIOMerger>(Output->Facade.ToSharedRef());
+		for (int32 i = 0; i < InInstances.Num(); i++) { Output->Merger->Append(SourceIO); }
+		Output->Merger->MergeAsync(TaskManager, &Context->CarryOverDetails);
+
+		InstancedOutputs.Add(Output);
+		FPlatformAtomics::InterlockedIncrement(&Context->NumInstancedOutputs);
+	}
+
 	FSpatialTransformResult FProcessor::ProcessTaggedData(int32 PointIndex, const FTransform& TargetTransform, const FPCGTaggedData& InTaggedData, FClusterIdRemapper& ClusterRemapper)
 	{
 		UPCGData* Data = const_cast<UPCGData*>(InTaggedData.Data.Get());
 		if (!Data) { return FSpatialTransformResult(); }
 
-		const int32 OutIdx = BatchIndex * 1000000 + PointIndex;
+		const FIntPoint OutOrder(BatchIndex, PointIndex);
 
 		// Check if this is spatial data
 		UPCGSpatialData* SpatialData = Cast<UPCGSpatialData>(Data);
@@ -610,7 +755,7 @@ namespace PCGExPCGDataAssetLoader
 		if (!SpatialData)
 		{
 			// Non-spatial data: register once per unique asset (not per point)
-			Context->RegisterNonSpatialData(InTaggedData, OutIdx);
+			Context->RegisterNonSpatialData(InTaggedData, OutOrder);
 			return FSpatialTransformResult();
 		}
 
@@ -669,7 +814,7 @@ namespace PCGExPCGDataAssetLoader
 		}
 
 		// Register output (Pin: tag added only for default "Out" pin)
-		Context->RegisterOutput(OutputData, true, OutIdx);
+		Context->RegisterOutput(OutputData, true, OutOrder);
 		return TransformResult;
 	}
 
@@ -714,6 +859,10 @@ namespace PCGExPCGDataAssetLoader
 		TArray<TSharedPtr<PCGExMT::FTask>> Tasks;
 		Tasks.Reserve(NumPoints);
 
+		// Staged points grouped by asset, in order of first appearance
+		TArray<UPCGDataAsset*> InstancedAssets;
+		TMap<UPCGDataAsset*, TArray<int32>> InstancesPerAsset;
+
 		for (int32 Index = 0; Index < NumPoints; Index++)
 		{
 			if (!PointFilterCache[Index]) { continue; }
@@ -725,6 +874,17 @@ namespace PCGExPCGDataAssetLoader
 			UPCGDataAsset* DataAsset = Context->SharedAssetPool->GetAsset(EntryHash);
 			if (!DataAsset) { continue; }
 
+			if (Settings->bInstanced)
+			{
+				TArray<int32>* Instances = InstancesPerAsset.Find(DataAsset);
+				if (!Instances)
+				{
+					InstancedAssets.Add(DataAsset);
+					Instances = &InstancesPerAsset.Add(DataAsset);
+				}
+				Instances->Add(Index);
+			}
+
 			const FTransform& TargetTransform = InTransforms[Index];
 
 			// Create cluster ID remapper for this point - all data within this point
@@ -740,12 +900,27 @@ namespace PCGExPCGDataAssetLoader
 				// Apply tag filtering
 				if (!PassesTagFilter(TaggedData)) { continue; }
 
+				// Concatenated below, once per asset
+				if (Settings->bInstanced && CanInstance(TaggedData)) { continue; }
+
 				// Process the data (cluster remapper ensures paired data gets consistent new IDs)
 				FSpatialTransformResult Result = ProcessTaggedData(Index, TargetTransform, TaggedData, ClusterRemapper);
 				if (Result.Task) { Tasks.Add(Result.Task); }
 			}
 		}
 
+		for (UPCGDataAsset* DataAsset : InstancedAssets)
+		{
+			const TArray<int32>& Instances = InstancesPerAsset[DataAsset];
+			for (const FPCGTaggedData& TaggedData : DataAsset->Data.GetAllInputs())
+			{
+				if (Settings->bMergeEmbeddedCollectionMaps && TaggedData.Pin == FName(TEXT("CollectionMap"))) { continue; }
+				if (!PassesTagFilter(TaggedData) || !CanInstance(TaggedData)) { continue; }
+
+				InstanceTaggedData(TaggedData, Instances);
+			}
+		}
+
 		if (!Tasks.IsEmpty())
 		{
 			PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, TransformTasks)
@@ -753,6 +928,62 @@ namespace PCGExPCGDataAssetLoader
 		}
 	}
 
+	void FProcessor::Write()
+	{
+		if (InstancedOutputs.IsEmpty()) { return; }
+
+		TConstPCGValueRange<FTransform> StagedTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+
+		for (const TSharedPtr<FInstancedOutput>& Output : InstancedOutputs)
+		{
+			const int32 NumSourcePoints = Cast<UPCGBasePointData>(Output->Source.Data)->GetNumPoints();
+			const TArray<int32>& Instances = Output->Instances;
+
+			UPCGBasePointData* OutPointData = Output->Facade->GetOut();
+			OutPointData->AllocateProperties(Settings->bRefreshSeeds ? EPCGPointNativeProperties::Transform | EPCGPointNativeProperties::Seed : EPCGPointNativeProperties::Transform);
+
+			TPCGValueRange<FTransform> OutTransforms = OutPointData->GetTransformValueRange(false);
+			TPCGValueRange<int32> OutSeeds = Settings->bRefreshSeeds ? OutPointData->GetSeedValueRange(false) : TPCGValueRange<int32>();
+
+			const TSharedPtr<PCGExData::TBuffer<int32>> InstanceIndexWriter = Output->Facade->GetWritable<int32>(Settings->InstanceIndexAttributeName, -1, false, PCGExData::EBufferInit::New);
+
+			// Merged copies are still in asset space; move each block under its staged point
+			PCGEX_PARALLEL_FOR(
+				Instances.Num(),
+				const int32 PointIndex = Instances[i];
+				const FTransform& TargetTransform = StagedTransforms[PointIndex];
+				const int32 Start = i * NumSourcePoints;
+				for (int32 j = Start; j < Start + NumSourcePoints; j++)
+				{
+					OutTransforms[j] *= TargetTransform;
+					InstanceIndexWriter->SetValue(j, PointIndex);
+					if (Settings->bRefreshSeeds) { OutSeeds[j] = PCGExRandomHelpers::ComputeSpatialSeed(OutTransforms[j].GetLocation()); }
+				}
+			)
+
+			if (ForwardHandler && !ForwardHandler->IsEmpty())
+			{
+				TArray<int32> Indices;
+				for (int32 i = 0; i < Instances.Num(); i++)
+				{
+					PCGExArrayHelpers::ArrayOfIndices(Indices, NumSourcePoints, i * NumSourcePoints);
+					ForwardHandler->Forward(Instances[i], Output->Facade, Indices);
+				}
+			}
+
+			Output->Facade->WriteFastest(TaskManager);
+
+			FPCGTaggedData OutputData;
+			OutputData.Data = OutPointData;
+			OutputData.Pin = Output->Source.Pin;
+			OutputData.Tags = Output->Source.Tags;
+
+			if (Settings->bForwardInputTags) { PointDataFacade->Source->Tags->DumpTo(OutputData.Tags); }
+
+			Context->RegisterOutput(OutputData, true, FIntPoint(BatchIndex, Instances[0]));
+		}
+	}
+
 	void FBatch::CompleteWork()
 	{
 		// Create a token to hold execution in its current state
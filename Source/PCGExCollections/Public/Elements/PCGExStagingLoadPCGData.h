@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExFilterCommon.h"
 #include "Core/PCGExPointsProcessor.h"
+#include "Data/Utils/PCGExDataFilterDetails.h"
 #include "Data/Utils/PCGExDataForwardDetails.h"
 #include "Factories/PCGExFactories.h"
 #include "Fitting/PCGExFitting.h"
@@ -21,6 +22,7 @@ class UPCGPolyLineData;
 class UPCGSplineData;
 class UPCGDataAsset;
 class UPCGExPCGDataAssetCollection;
+class FPCGExPointIOMerger;
 struct FPCGExPCGDataAssetCollectionEntry;
 
 namespace PCGExPCGDataAssetLoader
@@ -94,6 +96,26 @@ public:
 	/** If enabled, will not output empty data, even if they have possibly meaningful @Data attributes */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	bool bOmitEmptyData = true;
+
+	/**
+	 * If enabled, point data spawned from the same asset are concatenated into a single output per input,
+	 * instead of one output per staged point. Cluster data and non-point spatial data are still output once per staged point.
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	bool bInstanced = false;
+
+	/** Name of the attribute that stores the index of the staged point each instanced point was spawned from. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bInstanced"))
+	FName InstanceIndexAttributeName = FName("InstanceIndex");
+
+	/** If enabled, loaded assets are kept in memory after execution so later executions don't load them again.
+	 * Use the "pcgex.Diagnostics Flush Filter=PCGDataAssetCache" console command to release them. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bCacheLoadedAssets = false;
+
+	/** If enabled, logs how many data were output and how long it took. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bLogStats = false;
 	
 	/** If enabled, only spawn data from the PCGDataAsset that matches these tags. Empty means all data. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Filtering", meta = (PCG_Overridable))
@@ -129,6 +151,38 @@ public:
 	bool bQuietInvalidEntryWarnings = false;
 };
 
+/**
+ * Keeps PCGDataAssets loaded by Staging : Load PCGData alive across executions,
+ * so re-executing a graph resolves them without going through the streamable manager again.
+ */
+class PCGEXCOLLECTIONS_API FPCGExPCGDataAssetCache
+{
+protected:
+	mutable FRWLock Lock;
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UPCGDataAsset> Asset;
+		TSharedPtr<FStreamableHandle> Handle; // Shared by every asset loaded in the same request
+	};
+
+	TMap<FSoftObjectPath, FEntry> Entries;
+
+public:
+	static FPCGExPCGDataAssetCache& Get();
+
+	/** @return the cached asset, or nullptr if it isn't cached or was unloaded in the meantime */
+	UPCGDataAsset* Find(const FSoftObjectPath& InPath) const;
+
+	/** Takes over a load handle, keeping its assets loaded until flushed */
+	void Add(const TArray<TPair<FSoftObjectPath, UPCGDataAsset*>>& InAssets, const TSharedPtr<FStreamableHandle>& InHandle);
+
+	/** Releases every cached asset */
+	void Flush();
+
+	int32 Num() const;
+};
+
 /**
  * Shared asset pool for loading PCGDataAssets once across all processors.
  * Uses entry hash (unique to collection/entry pair) as key.
@@ -151,6 +205,9 @@ protected:
 public:
 	using FOnLoadEnd = std::function<void(const bool bSuccess)>;
 
+	/** If enabled, assets are looked up in & handed over to FPCGExPCGDataAssetCache */
+	bool bUseCache = false;
+
 	FPCGExSharedAssetPool() = default;
 	~FPCGExSharedAssetPool();
 
@@ -208,7 +265,7 @@ struct FPCGExPCGDataAssetLoaderContext final : FPCGExPointsProcessorContext
 
 	// Output data organized by pin
 	TMap<FName, TArray<FPCGTaggedData>> OutputByPin;
-	TMap<uint32, int32> OutputIndices;
+	TMap<uint32, FIntVector> OutputOrders; // Non-spatial first, then (BatchIndex, PointIndex)
 	mutable FRWLock OutputLock;
 
 	// Non-spatial data (forwarded once per unique asset, not duplicated)
@@ -218,11 +275,16 @@ struct FPCGExPCGDataAssetLoaderContext final : FPCGExPointsProcessorContext
 	// Merged collection map from embedded CollectionMap entries (when bMergeEmbeddedCollectionMaps)
 	TSharedPtr<PCGExCollections::FPickPacker> MergedMapPacker;
 
+	FPCGExCarryOverDetails CarryOverDetails;
+
+	double StartTime = 0;
+	int32 NumInstancedOutputs = 0;
+
 	/** Register output data to appropriate pin */
-	void RegisterOutput(const FPCGTaggedData& InTaggedData, bool bAddPinTag, const int32 InIndex);
+	void RegisterOutput(const FPCGTaggedData& InTaggedData, bool bAddPinTag, const FIntPoint& InOrder, const bool bSpatial = true);
 
 	/** Register non-spatial data (once per unique asset) */
-	void RegisterNonSpatialData(const FPCGTaggedData& InTaggedData, const int32 InIndex);
+	void RegisterNonSpatialData(const FPCGTaggedData& InTaggedData, const FIntPoint& InOrder);
 
 protected:
 	PCGEX_ELEMENT_BATCH_POINT_DECL
@@ -280,6 +342,17 @@ namespace PCGExPCGDataAssetLoader
 		// Shared counter for generating unique cluster IDs across all points
 		int32 ClusterIdCounter = 0;
 
+		/** Point data of one asset, concatenated for every staged point that spawns it */
+		struct FInstancedOutput
+		{
+			FPCGTaggedData Source;
+			TArray<int32> Instances; // Staged point index of each copy, in output order
+			TSharedPtr<PCGExData::FFacade> Facade;
+			TSharedPtr<FPCGExPointIOMerger> Merger;
+		};
+
+		TArray<TSharedPtr<FInstancedOutput>> InstancedOutputs;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -291,11 +364,18 @@ namespace PCGExPCGDataAssetLoader
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
+		virtual void Write() override;
 
 	protected:
 		/** Check if tagged data passes tag filters */
 		bool PassesTagFilter(const FPCGTaggedData& InTaggedData) const;
 
+		/** Check if tagged data can be concatenated across staged points */
+		bool CanInstance(const FPCGTaggedData& InTaggedData) const;
+
+		/** Start merging one copy of point data per staged point into a single output */
+		void InstanceTaggedData(const FPCGTaggedData& InTaggedData, const TArray<int32>& InInstances);
+
 		/** Process a single tagged data item for a point */
 		FSpatialTransformResult ProcessTaggedData(int32 PointIndex, const FTransform& TargetTransform, const FPCGTaggedData& InTaggedData, FClusterIdRemapper& ClusterRemapper);
 
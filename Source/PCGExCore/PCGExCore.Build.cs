@@ -62,6 +62,12 @@ public class PCGExCore : ModuleRules
 			}
 		);
 
+		// Benchmark results & baselines, see PCGExBenchmark.h
+		if (Target.Configuration != UnrealTargetConfiguration.Shipping || Target.bForceCompileDevelopmentAutomationTests)
+		{
+			PrivateDependencyModuleNames.Add("Json");
+		}
+
 
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
@@ -0,0 +1,93 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterBenchmark.h"
+
+#include "PCGExH.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterCommon.h"
+#include "Containers/PCGExIndexLookup.h"
+#include "Core/PCGExBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Cluster build throughput, e.g. pcgex.Bench.Run Filter=Clusters.* Scales=100000+1000000
+namespace PCGExClusters
+{
+	namespace Benchmark
+	{
+		TSharedPtr<FCluster> FGridCluster::Build() const
+		{
+			TSharedPtr<FCluster> NewCluster = MakeShared<FCluster>(VtxIO, EdgesIO, MakeShared<PCGEx::FIndexLookup>(Side * Side));
+			if (!NewCluster->BuildFrom(EndpointsLookup, nullptr)) { return nullptr; }
+			return NewCluster;
+		}
+
+		int32 FGridCluster::GetNodeIndex(const int32 X, const int32 Y) const
+		{
+			return Cluster->NodeIndexLookup->Get(Y * Side + X);
+		}
+
+		TSharedPtr<FGridCluster> MakeGridCluster(const int32 NumVtx, const double Jitter, const int32 Seed, const bool bBuild)
+		{
+			TSharedPtr<FGridCluster> Grid = MakeShared<FGridCluster>();
+
+			const int32 Side = Grid->Side = FMath::Max(2, FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumVtx))));
+			const int32 NumPoints = Side * Side;
+
+			Grid->VtxData.Reset(NewObject<UPCGPointArrayData>());
+			Grid->VtxData->SetNumPoints(NumPoints);
+			Grid->VtxData->AllocateProperties(EPCGPointNativeProperties::Transform);
+
+			FRandomStream Random(Seed);
+			TPCGValueRange<FTransform> Transforms = Grid->VtxData->GetTransformValueRange(false);
+			for (int i = 0; i < NumPoints; i++)
+			{
+				FVector Offset = FVector::ZeroVector;
+				if (Jitter > 0) { Offset = FVector(Random.FRandRange(-1, 1), Random.FRandRange(-1, 1), Random.FRandRange(-1, 1)) * (Jitter * 100); }
+				Transforms[i].SetLocation(FVector(i % Side, i / Side, 0) * 100 + Offset);
+			}
+
+			TArray<int64> Endpoints;
+			Endpoints.Reserve(NumPoints * 2);
+			for (int i = 0; i < NumPoints; i++)
+			{
+				if (i % Side + 1 < Side) { Endpoints.Add(static_cast<int64>(PCGEx::H64(i, i + 1))); }
+				if (i / Side + 1 < Side) { Endpoints.Add(static_cast<int64>(PCGEx::H64(i, i + Side))); }
+			}
+
+			Grid->EdgeData.Reset(NewObject<UPCGPointArrayData>());
+			Grid->EdgeData->SetNumPoints(Endpoints.Num());
+			Grid->EdgeData->AllocateProperties(EPCGPointNativeProperties::MetadataEntry);
+
+			FPCGMetadataAttribute<int64>* EndpointsAttribute = Grid->EdgeData->Metadata->CreateAttribute<int64>(Labels::Attr_PCGExEdgeIdx, 0, false, true);
+			TPCGValueRange<int64> Entries = Grid->EdgeData->GetMetadataEntryValueRange(false);
+			for (int i = 0; i < Endpoints.Num(); i++)
+			{
+				Entries[i] = Grid->EdgeData->Metadata->AddEntry();
+				EndpointsAttribute->SetValue(Entries[i], Endpoints[i]);
+			}
+
+			Grid->EndpointsLookup.Reserve(NumPoints);
+			for (int i = 0; i < NumPoints; i++) { Grid->EndpointsLookup.Add(i, i); }
+
+			Grid->VtxIO = MakeShared<PCGExData::FPointIO>(TWeakPtr<FPCGContextHandle>(), Grid->VtxData.Get());
+			Grid->EdgesIO = MakeShared<PCGExData::FPointIO>(TWeakPtr<FPCGContextHandle>(), Grid->EdgeData.Get());
+
+			if (bBuild) { Grid->Cluster = Grid->Build(); }
+
+			return Grid;
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchClusterBuild(
+		TEXT("Clusters.Build"), TEXT("Builds a cluster from a grid of N vtx & ~2N edges, reading endpoints from edge metadata"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			return [Grid = Benchmark::MakeGridCluster(Scale, 0, 1337, false)]() { Grid->Build(); };
+		});
+}
+
+#endif
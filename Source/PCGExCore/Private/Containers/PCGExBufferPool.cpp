@@ -0,0 +1,198 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Containers/PCGExBufferPool.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExDiagnostics.h"
+
+namespace PCGEx
+{
+	namespace BufferPool
+	{
+		// Smaller arrays are cheap enough for the regular allocator
+		constexpr int64 MinBlockBytes = 16 * 1024;
+
+		// Idle blocks are looked for at most this often
+		constexpr double TrimInterval = 1;
+
+		FORCEINLINE int32 SizeClass(const int64 InBytes)
+		{
+			return static_cast<int32>(FMath::FloorLog2_64(static_cast<uint64>(InBytes)));
+		}
+	}
+
+	FBufferPool::FBufferPool() = default;
+	FBufferPool::~FBufferPool() = default;
+
+	FBufferPool& FBufferPool::Get()
+	{
+		// Never destroyed; arrays released during static teardown must still find a pool to return to
+		static FBufferPool* Instance = new FBufferPool();
+		return *Instance;
+	}
+
+	bool FBufferPool::IsEnabled()
+	{
+		return !Get().bShutdown && PCGEX_CORE_SETTINGS.bPoolBuffers;
+	}
+
+	bool FBufferPool::CanPool(const int64 InNumBytes)
+	{
+		return InNumBytes >= BufferPool::MinBlockBytes && IsEnabled() && InNumBytes <= static_cast<int64>(PCGEX_CORE_SETTINGS.BufferPoolBudgetMB) * 1024 * 1024;
+	}
+
+	TUniquePtr<FBufferPool::FBlock> FBufferPool::AcquireBlock(const void* InTypeTag, const int64 InNumBytes)
+	{
+		if (InNumBytes < BufferPool::MinBlockBytes || !IsEnabled()) { return nullptr; }
+
+		FScopeLock ScopeLock(&Lock);
+
+		Stats.NumAcquires++;
+
+		// Blocks in the same size class may be slightly too small; anything in the next one is large enough
+		const int32 Class = BufferPool::SizeClass(InNumBytes);
+		for (const int32 CandidateClass : {Class, Class + 1})
+		{
+			TArray<FBlock*>* Bucket = Buckets.Find(FBucketKey(InTypeTag, CandidateClass));
+			if (!Bucket) { continue; }
+
+			for (int32 i = Bucket->Num() - 1; i >= 0; i--)
+			{
+				FBlock* Block = (*Bucket)[i];
+				if (Block->NumBytes < InNumBytes) { continue; }
+
+				Bucket->RemoveAtSwap(i, EAllowShrinking::No);
+				UnlinkUnsafe(Block);
+
+				Stats.NumReuses++;
+				Stats.ReusedBytes += Block->NumBytes;
+				Stats.PooledBytes -= Block->NumBytes;
+				Stats.NumBlocks--;
+
+				return TUniquePtr<FBlock>(Block);
+			}
+		}
+
+		Stats.NumAllocations++;
+		return nullptr;
+	}
+
+	void FBufferPool::ReleaseBlock(TUniquePtr<FBlock>&& InBlock)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		// Shut down since the caller checked; the block & its storage are freed on the way out
+		if (bShutdown) { return; }
+
+		FBlock* Block = InBlock.Release();
+		Block->ReleaseTime = FPlatformTime::Seconds();
+
+		Buckets.FindOrAdd(FBucketKey(Block->TypeTag, BufferPool::SizeClass(Block->NumBytes))).Add(Block);
+		LinkNewestUnsafe(Block);
+
+		Stats.NumReleases++;
+		Stats.NumBlocks++;
+		Stats.PooledBytes += Block->NumBytes;
+		Stats.PeakPooledBytes = FMath::Max(Stats.PeakPooledBytes, Stats.PooledBytes);
+
+		const int64 Budget = static_cast<int64>(PCGEX_CORE_SETTINGS.BufferPoolBudgetMB) * 1024 * 1024;
+		if (Stats.PooledBytes > Budget || Block->ReleaseTime - LastTrimTime > BufferPool::TrimInterval)
+		{
+			TrimUnsafe(Block->ReleaseTime, Budget, PCGEX_CORE_SETTINGS.BufferPoolMaxIdleSeconds);
+		}
+	}
+
+	void FBufferPool::LinkNewestUnsafe(FBlock* InBlock)
+	{
+		InBlock->Older = Newest;
+		InBlock->Newer = nullptr;
+
+		if (Newest) { Newest->Newer = InBlock; }
+		else { Oldest = InBlock; }
+
+		Newest = InBlock;
+	}
+
+	void FBufferPool::UnlinkUnsafe(FBlock* InBlock)
+	{
+		if (InBlock->Older) { InBlock->Older->Newer = InBlock->Newer; }
+		else { Oldest = InBlock->Newer; }
+
+		if (InBlock->Newer) { InBlock->Newer->Older = InBlock->Older; }
+		else { Newest = InBlock->Older; }
+
+		InBlock->Older = nullptr;
+		InBlock->Newer = nullptr;
+	}
+
+	void FBufferPool::FreeBlockUnsafe(FBlock* InBlock)
+	{
+		if (TArray<FBlock*>* Bucket = Buckets.Find(FBucketKey(InBlock->TypeTag, BufferPool::SizeClass(InBlock->NumBytes))))
+		{
+			Bucket->RemoveSingleSwap(InBlock, EAllowShrinking::No);
+		}
+
+		UnlinkUnsafe(InBlock);
+
+		Stats.PooledBytes -= InBlock->NumBytes;
+		Stats.NumBlocks--;
+		Stats.NumEvictions++;
+
+		delete InBlock;
+	}
+
+	void FBufferPool::TrimUnsafe(const double InNow, const int64 InBudget, const double InMaxIdleSeconds)
+	{
+		LastTrimTime = InNow;
+
+		// Blocks are linked in release order, so idle ones & least recently released ones are both at the old end
+		while (Oldest)
+		{
+			const bool bIdle = InMaxIdleSeconds > 0 && InNow - Oldest->ReleaseTime > InMaxIdleSeconds;
+			if (!bIdle && Stats.PooledBytes <= InBudget) { break; }
+
+			FreeBlockUnsafe(Oldest);
+		}
+	}
+
+	void FBufferPool::Trim()
+	{
+		FScopeLock ScopeLock(&Lock);
+		TrimUnsafe(FPlatformTime::Seconds(), static_cast<int64>(PCGEX_CORE_SETTINGS.BufferPoolBudgetMB) * 1024 * 1024, PCGEX_CORE_SETTINGS.BufferPoolMaxIdleSeconds);
+	}
+
+	void FBufferPool::Flush()
+	{
+		FScopeLock ScopeLock(&Lock);
+		while (Oldest) { FreeBlockUnsafe(Oldest); }
+		Buckets.Empty();
+	}
+
+	void FBufferPool::Shutdown()
+	{
+		bShutdown = true;
+		Flush();
+	}
+
+	FBufferPoolStats FBufferPool::GetStats() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return Stats;
+	}
+
+	FString FBufferPool::GetStatsSummary() const
+	{
+		const FBufferPoolStats PoolStats = GetStats();
+		return FString::Printf(
+			TEXT("%d blocks (~%.2f MB, peak ~%.2f MB), %lld acquires, %lld reused (%.1f%%, ~%.2f MB), %lld allocations, %lld releases, %lld evictions."),
+			PoolStats.NumBlocks, static_cast<double>(PoolStats.PooledBytes) / (1024.0 * 1024.0), static_cast<double>(PoolStats.PeakPooledBytes) / (1024.0 * 1024.0),
+			PoolStats.NumAcquires, PoolStats.NumReuses, PoolStats.GetReuseRate() * 100, static_cast<double>(PoolStats.ReusedBytes) / (1024.0 * 1024.0),
+			PoolStats.NumAllocations, PoolStats.NumReleases, PoolStats.NumEvictions);
+	}
+
+	static PCGExDiagnostics::FRegistrar DiagnosticsBufferPool(
+		TEXT("BufferPool"), TEXT("Pooled attribute buffer blocks; flushing frees every pooled buffer"),
+		[]() { return FBufferPool::Get().GetStatsSummary(); },
+		[]() { FBufferPool::Get().Flush(); });
+}
@@ -108,6 +108,12 @@ namespace PCGEx
 		return true;
 	}
 
+	bool FManagedObjects::Contains(const UObject* InObject) const
+	{
+		FReadScopeLock ReadScopeLock(ManagedObjectLock);
+		return ManagedObjects.Contains(const_cast<UObject*>(InObject));
+	}
+
 	void FManagedObjects::Remove(const TArray<FPCGTaggedData>& InTaggedData)
 	{
 		if (IsFlushing()) { return; } // Will be removed anyway
@@ -0,0 +1,432 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PCGExLog.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PCGExBenchmark
+{
+	namespace
+	{
+		FString ResultKey(const FString& InName, const int32 InScale)
+		{
+			return FString::Printf(TEXT("%s@%d"), *InName, InScale);
+		}
+
+		// Nearest-rank percentile over sorted samples
+		double Percentile(const TArray<double>& InSorted, const double InPercent)
+		{
+			const int32 Rank = FMath::CeilToInt32(InPercent * InSorted.Num()) - 1;
+			return InSorted[FMath::Clamp(Rank, 0, InSorted.Num() - 1)];
+		}
+
+		void ParseScales(const FString& InValue, TArray<int32>& OutScales)
+		{
+			// '+' is accepted too since -ExecCmds splits commands on commas
+			TArray<FString> Parts;
+			InValue.Replace(TEXT("+"), TEXT(",")).ParseIntoArray(Parts, TEXT(","));
+
+			OutScales.Reset();
+			for (const FString& Part : Parts) { if (const int32 Scale = FCString::Atoi(*Part); Scale > 0) { OutScales.Add(Scale); } }
+		}
+
+		// Lets CI fail the job rather than grep the log
+		void ExitOnFailureIfUnattended()
+		{
+			if (FApp::IsUnattended()) { FPlatformMisc::RequestExitWithStatus(false, 1); }
+		}
+
+		TAutoConsoleVariable<FString> CVarScales(
+			TEXT("pcgex.Bench.Scales"), TEXT("1000+10000+100000"),
+			TEXT("Scales used by the PCGEx.Perf automation tests"));
+
+		TAutoConsoleVariable<int32> CVarIterations(
+			TEXT("pcgex.Bench.Iterations"), 10,
+			TEXT("Timed iterations used by the PCGEx.Perf automation tests"));
+
+		TAutoConsoleVariable<FString> CVarBaseline(
+			TEXT("pcgex.Bench.Baseline"), TEXT(""),
+			TEXT("Baseline json the PCGEx.Perf automation tests compare against; a test fails when its p50 regresses past the threshold"));
+
+		TAutoConsoleVariable<float> CVarThreshold(
+			TEXT("pcgex.Bench.Threshold"), 0.1f,
+			TEXT("Default p50 regression threshold of the PCGEx.Perf automation tests, as a ratio"));
+	}
+
+	void FRunParams::Parse(const TArray<FString>& Args)
+	{
+		for (const FString& Arg : Args)
+		{
+			FString Key;
+			FString Value;
+			if (!Arg.Split(TEXT("="), &Key, &Value)) { continue; }
+
+			if (Key.Equals(TEXT("Filter"), ESearchCase::IgnoreCase)) { Filter = Value; }
+			else if (Key.Equals(TEXT("Iterations"), ESearchCase::IgnoreCase)) { Iterations = FMath::Max(1, FCString::Atoi(*Value)); }
+			else if (Key.Equals(TEXT("Warmup"), ESearchCase::IgnoreCase)) { WarmupIterations = FMath::Max(0, FCString::Atoi(*Value)); }
+			else if (Key.Equals(TEXT("Out"), ESearchCase::IgnoreCase)) { OutputPath = Value; }
+			else if (Key.Equals(TEXT("Baseline"), ESearchCase::IgnoreCase)) { BaselinePath = Value; }
+			else if (Key.Equals(TEXT("Threshold"), ESearchCase::IgnoreCase)) { RegressionThreshold = FMath::Max(0.0, FCString::Atod(*Value)); }
+			else if (Key.Equals(TEXT("Scales"), ESearchCase::IgnoreCase)) { ParseScales(Value, Scales); }
+		}
+	}
+
+	FRunParams GetDefaultRunParams()
+	{
+		FRunParams Params;
+		ParseScales(CVarScales.GetValueOnAnyThread(), Params.Scales);
+		Params.Iterations = FMath::Max(1, CVarIterations.GetValueOnAnyThread());
+		Params.BaselinePath = CVarBaseline.GetValueOnAnyThread();
+		Params.RegressionThreshold = FMath::Max(0.0, static_cast<double>(CVarThreshold.GetValueOnAnyThread()));
+		return Params;
+	}
+
+#pragma region FRegistry
+
+	FRegistry& FRegistry::Get()
+	{
+		static FRegistry Instance;
+		return Instance;
+	}
+
+	void FRegistry::Register(const FCase& InCase)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Cases.Add(InCase.Name, InCase);
+	}
+
+	void FRegistry::Unregister(const FString& InName)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Cases.Remove(InName);
+	}
+
+	void FRegistry::RegisterCheck(const FCheckCase& InCheck)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Checks.Add(InCheck.Name, InCheck);
+	}
+
+	void FRegistry::UnregisterCheck(const FString& InName)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Checks.Remove(InName);
+	}
+
+	TArray<FCase> FRegistry::GetCases(const FString& InFilter) const
+	{
+		TArray<FCase> Result;
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			for (const TPair<FString, FCase>& Pair : Cases) { if (Pair.Key.MatchesWildcard(InFilter)) { Result.Add(Pair.Value); } }
+		}
+
+		Result.Sort([](const FCase& A, const FCase& B) { return A.Name < B.Name; });
+		return Result;
+	}
+
+	TArray<FCheckCase> FRegistry::GetChecks(const FString& InFilter) const
+	{
+		TArray<FCheckCase> Result;
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			for (const TPair<FString, FCheckCase>& Pair : Checks) { if (Pair.Key.MatchesWildcard(InFilter)) { Result.Add(Pair.Value); } }
+		}
+
+		Result.Sort([](const FCheckCase& A, const FCheckCase& B) { return A.Name < B.Name; });
+		return Result;
+	}
+
+	FRegistrar::FRegistrar(const TCHAR* InName, const TCHAR* InDescription, FSetup&& InSetup, const double InThreshold)
+		: Name(InName)
+	{
+		FRegistry::Get().Register(FCase{Name, InDescription, MoveTemp(InSetup), InThreshold});
+	}
+
+	FRegistrar::~FRegistrar()
+	{
+		FRegistry::Get().Unregister(Name);
+	}
+
+	FPairRegistrar::FPairRegistrar(const TCHAR* InName, const TCHAR* InDescription, const FVariant& InReference, const FVariant& InOptimized, FPairSetup&& InSetup, const double InThreshold)
+		: Reference(
+			  *FString::Printf(TEXT("%s.%s"), InName, InReference.Suffix), *FString::Printf(TEXT("%s, %s"), InDescription, InReference.Description),
+			  [InSetup](const int32 InScale) { return InSetup(InScale, false); }, InThreshold),
+		  Optimized(
+			  *FString::Printf(TEXT("%s.%s"), InName, InOptimized.Suffix), *FString::Printf(TEXT("%s, %s"), InDescription, InOptimized.Description),
+			  [Setup = MoveTemp(InSetup)](const int32 InScale) { return Setup(InScale, true); }, InThreshold)
+	{
+	}
+
+	FCheckRegistrar::FCheckRegistrar(const TCHAR* InName, const TCHAR* InDescription, FCheck&& InCheck)
+		: Name(InName)
+	{
+		FRegistry::Get().RegisterCheck(FCheckCase{Name, InDescription, MoveTemp(InCheck)});
+	}
+
+	FCheckRegistrar::~FCheckRegistrar()
+	{
+		FRegistry::Get().UnregisterCheck(Name);
+	}
+
+#pragma endregion
+
+	TArray<FResult> Run(const FRunParams& InParams)
+	{
+		const TArray<FCase> Cases = FRegistry::Get().GetCases(InParams.Filter);
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx benchmarks : %d cases matching '%s', %d iterations (+%d warmup)"), Cases.Num(), *InParams.Filter, InParams.Iterations, InParams.WarmupIterations);
+
+		TArray<FResult> Results;
+		TArray<double> Samples;
+
+		for (const FCase& Case : Cases)
+		{
+			for (const int32 Scale : InParams.Scales)
+			{
+				const FKernel Kernel = Case.Setup(Scale);
+				if (!Kernel) { continue; }
+
+				for (int i = 0; i < InParams.WarmupIterations; i++) { Kernel(); }
+
+				Samples.Reset(InParams.Iterations);
+				for (int i = 0; i < InParams.Iterations; i++)
+				{
+					const double Start = FPlatformTime::Seconds();
+					Kernel();
+					Samples.Add((FPlatformTime::Seconds() - Start) * 1e3);
+				}
+
+				Samples.Sort();
+
+				FResult& Result = Results.Emplace_GetRef();
+				Result.Name = Case.Name;
+				Result.Scale = Scale;
+				Result.NumSamples = Samples.Num();
+				Result.Min = Samples[0];
+				Result.Max = Samples.Last();
+				Result.P50 = Percentile(Samples, 0.5);
+				Result.P90 = Percentile(Samples, 0.9);
+				Result.P99 = Percentile(Samples, 0.99);
+				Result.Threshold = Case.Threshold;
+
+				for (const double Sample : Samples) { Result.Mean += Sample; }
+				Result.Mean /= Samples.Num();
+
+				UE_LOG(
+					LogPCGEx, Log, TEXT("  %-32s %9d | p50 %10.3fms | p90 %10.3fms | p99 %10.3fms | min %10.3fms | max %10.3fms"),
+					*Case.Name, Scale, Result.P50, Result.P90, Result.P99, Result.Min, Result.Max);
+			}
+		}
+
+		return Results;
+	}
+
+	TArray<FCheckContext> RunChecks(const FString& InFilter)
+	{
+		const TArray<FCheckCase> Checks = FRegistry::Get().GetChecks(InFilter);
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx checks : %d cases matching '%s'"), Checks.Num(), *InFilter);
+
+		TArray<FCheckContext> Results;
+		Results.Reserve(Checks.Num());
+
+		for (const FCheckCase& Check : Checks)
+		{
+			FCheckContext& Context = Results.Emplace_GetRef();
+			Context.Name = Check.Name;
+			Check.Check(Context);
+
+			if (Context.Passed())
+			{
+				UE_LOG(LogPCGEx, Log, TEXT("  %-32s %6d checks | passed"), *Check.Name, Context.NumChecks);
+				continue;
+			}
+
+			UE_LOG(LogPCGEx, Error, TEXT("  %-32s %6d checks | %d FAILED"), *Check.Name, Context.NumChecks, Context.NumFailures);
+			for (const FString& Failure : Context.Failures) { UE_LOG(LogPCGEx, Error, TEXT("      %s"), *Failure); }
+		}
+
+		return Results;
+	}
+
+	bool WriteResults(const TArray<FResult>& InResults, const FString& InPath)
+	{
+		const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("version"), 1);
+		Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+		Root->SetStringField(TEXT("configuration"), LexToString(FApp::GetBuildConfiguration()));
+		Root->SetNumberField(TEXT("cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		Root->SetStringField(TEXT("date"), FDateTime::UtcNow().ToIso8601());
+
+		TArray<TSharedPtr<FJsonValue>> Entries;
+		Entries.Reserve(InResults.Num());
+
+		for (const FResult& Result : InResults)
+		{
+			const TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("name"), Result.Name);
+			Entry->SetNumberField(TEXT("scale"), Result.Scale);
+			Entry->SetNumberField(TEXT("samples"), Result.NumSamples);
+			Entry->SetNumberField(TEXT("min_ms"), Result.Min);
+			Entry->SetNumberField(TEXT("mean_ms"), Result.Mean);
+			Entry->SetNumberField(TEXT("p50_ms"), Result.P50);
+			Entry->SetNumberField(TEXT("p90_ms"), Result.P90);
+			Entry->SetNumberField(TEXT("p99_ms"), Result.P99);
+			Entry->SetNumberField(TEXT("max_ms"), Result.Max);
+			Entries.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+
+		Root->SetArrayField(TEXT("results"), Entries);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(Json, *InPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("PCGEx benchmarks : could not write '%s'"), *InPath);
+			return false;
+		}
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx benchmarks : %d results written to '%s'"), InResults.Num(), *InPath);
+		return true;
+	}
+
+	int32 CompareToBaseline(const TArray<FResult>& InResults, const FString& InBaselinePath, const double InThreshold, TArray<FString>* OutRegressions)
+	{
+		FString Json;
+		TSharedPtr<FJsonObject> Root;
+
+		if (!FFileHelper::LoadFileToString(Json, *InBaselinePath)
+			|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root)
+			|| !Root.IsValid())
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("PCGEx benchmarks : could not read baseline '%s'"), *InBaselinePath);
+			return -1;
+		}
+
+		TMap<FString, double> Baseline;
+		const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+		if (Root->TryGetArrayField(TEXT("results"), Entries))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *Entries)
+			{
+				const TSharedPtr<FJsonObject>* Entry = nullptr;
+				if (!Value->TryGetObject(Entry)) { continue; }
+
+				FString Name;
+				int32 Scale = 0;
+				double P50 = 0;
+				if ((*Entry)->TryGetStringField(TEXT("name"), Name)
+					&& (*Entry)->TryGetNumberField(TEXT("scale"), Scale)
+					&& (*Entry)->TryGetNumberField(TEXT("p50_ms"), P50))
+				{
+					Baseline.Add(ResultKey(Name, Scale), P50);
+				}
+			}
+		}
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx benchmarks : comparing p50 against '%s' (threshold %.0f%%)"), *InBaselinePath, InThreshold * 100);
+
+		int32 NumRegressions = 0;
+		for (const FResult& Result : InResults)
+		{
+			const double* Reference = Baseline.Find(ResultKey(Result.Name, Result.Scale));
+			if (!Reference)
+			{
+				UE_LOG(LogPCGEx, Log, TEXT("  %-32s %9d | new"), *Result.Name, Result.Scale);
+				continue;
+			}
+
+			const double Ratio = *Reference > 0 ? Result.P50 / *Reference : 1;
+			const double Threshold = Result.Threshold >= 0 ? Result.Threshold : InThreshold;
+
+			if (Ratio > 1 + Threshold)
+			{
+				NumRegressions++;
+				const FString Line = FString::Printf(TEXT("%s@%d : %.3fms -> %.3fms, %+.1f%% past the %.0f%% threshold"), *Result.Name, Result.Scale, *Reference, Result.P50, (Ratio - 1) * 100, Threshold * 100);
+				UE_LOG(LogPCGEx, Error, TEXT("  %-32s %9d | %10.3fms -> %10.3fms | %+.1f%% REGRESSION"), *Result.Name, Result.Scale, *Reference, Result.P50, (Ratio - 1) * 100);
+				if (OutRegressions) { OutRegressions->Add(Line); }
+			}
+			else
+			{
+				UE_LOG(LogPCGEx, Log, TEXT("  %-32s %9d | %10.3fms -> %10.3fms | %+.1f%%%s"), *Result.Name, Result.Scale, *Reference, Result.P50, (Ratio - 1) * 100, Ratio < 1 - Threshold ? TEXT(" improved") : TEXT(""));
+			}
+		}
+
+		return NumRegressions;
+	}
+
+	void MakePositions(TArray<FVector>& OutPositions, const int32 InNum, const bool b3D, const double InExtent, const int32 InSeed)
+	{
+		FRandomStream Random(InSeed);
+		OutPositions.SetNumUninitialized(InNum);
+		for (FVector& P : OutPositions) { P = FVector(Random.FRandRange(0, InExtent), Random.FRandRange(0, InExtent), b3D ? Random.FRandRange(0, InExtent) : 0); }
+	}
+
+	static void RunBenchmarks(const TArray<FString>& Args)
+	{
+		FRunParams Params;
+		Params.Parse(Args);
+
+		const TArray<FResult> Results = Run(Params);
+
+		WriteResults(Results, Params.OutputPath.IsEmpty() ? FPaths::ProfilingDir() / TEXT("PCGExBenchmarks.json") : Params.OutputPath);
+		if (!Params.BaselinePath.IsEmpty() && CompareToBaseline(Results, Params.BaselinePath, Params.RegressionThreshold) != 0) { ExitOnFailureIfUnattended(); }
+	}
+
+	static void RunCheckCases(const TArray<FString>& Args)
+	{
+		FString Filter = TEXT("*");
+		for (const FString& Arg : Args)
+		{
+			FString Key;
+			FString Value;
+			if (Arg.Split(TEXT("="), &Key, &Value) && Key.Equals(TEXT("Filter"), ESearchCase::IgnoreCase)) { Filter = Value; }
+		}
+
+		for (const FCheckContext& Context : RunChecks(Filter))
+		{
+			if (!Context.Passed())
+			{
+				ExitOnFailureIfUnattended();
+				return;
+			}
+		}
+	}
+
+	static void ListBenchmarks()
+	{
+		for (const FCase& Case : FRegistry::Get().GetCases()) { UE_LOG(LogPCGEx, Log, TEXT("  %-32s %s"), *Case.Name, *Case.Description); }
+		for (const FCheckCase& Check : FRegistry::Get().GetChecks()) { UE_LOG(LogPCGEx, Log, TEXT("  %-32s [check] %s"), *Check.Name, *Check.Description); }
+	}
+
+	static FAutoConsoleCommandWithArgs CommandBenchRun(
+		TEXT("pcgex.Bench.Run"),
+		TEXT("Runs registered PCGEx benchmarks. Args: [Filter=*] [Scales=1000+10000+100000] [Iterations=10] [Warmup=1] [Out=<path.json>] [Baseline=<path.json>] [Threshold=0.1]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmarks));
+
+	static FAutoConsoleCommandWithArgs CommandBenchCheck(
+		TEXT("pcgex.Bench.Check"),
+		TEXT("Runs registered PCGEx correctness checks. Args: [Filter=*]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunCheckCases));
+
+	static FAutoConsoleCommand CommandBenchList(
+		TEXT("pcgex.Bench.List"),
+		TEXT("Lists registered PCGEx benchmarks and checks."),
+		FConsoleCommandDelegate::CreateStatic(&ListBenchmarks));
+}
+
+#endif
@@ -0,0 +1,82 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// One automation test per registered benchmark case, compared against the pcgex.Bench.Baseline cvar when set
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FPCGExPerfTest, "PCGEx.Perf",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FPCGExPerfTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const PCGExBenchmark::FCase& Case : PCGExBenchmark::FRegistry::Get().GetCases())
+	{
+		OutBeautifiedNames.Add(Case.Name);
+		OutTestCommands.Add(Case.Name);
+	}
+}
+
+bool FPCGExPerfTest::RunTest(const FString& Parameters)
+{
+	PCGExBenchmark::FRunParams Params = PCGExBenchmark::GetDefaultRunParams();
+	Params.Filter = Parameters;
+
+	const TArray<PCGExBenchmark::FResult> Results = PCGExBenchmark::Run(Params);
+	if (!TestTrue(TEXT("Case ran at least one scale"), !Results.IsEmpty())) { return false; }
+
+	for (const PCGExBenchmark::FResult& Result : Results)
+	{
+		AddInfo(FString::Printf(TEXT("%s@%d : p50 %.3fms, p90 %.3fms, p99 %.3fms"), *Result.Name, Result.Scale, Result.P50, Result.P90, Result.P99));
+	}
+
+	if (Params.BaselinePath.IsEmpty()) { return true; }
+
+	TArray<FString> Regressions;
+	const int32 NumRegressions = PCGExBenchmark::CompareToBaseline(Results, Params.BaselinePath, Params.RegressionThreshold, &Regressions);
+
+	if (NumRegressions < 0)
+	{
+		AddError(FString::Printf(TEXT("Could not read baseline '%s'"), *Params.BaselinePath));
+		return false;
+	}
+
+	for (const FString& Regression : Regressions) { AddError(Regression); }
+	return NumRegressions == 0;
+}
+
+// One automation test per registered check case
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FPCGExChecksTest, "PCGEx.Checks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+void FPCGExChecksTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const PCGExBenchmark::FCheckCase& Check : PCGExBenchmark::FRegistry::Get().GetChecks())
+	{
+		OutBeautifiedNames.Add(Check.Name);
+		OutTestCommands.Add(Check.Name);
+	}
+}
+
+bool FPCGExChecksTest::RunTest(const FString& Parameters)
+{
+	const TArray<PCGExBenchmark::FCheckContext> Results = PCGExBenchmark::RunChecks(Parameters);
+	if (!TestTrue(TEXT("Check case is registered"), !Results.IsEmpty())) { return false; }
+
+	bool bPassed = true;
+	for (const PCGExBenchmark::FCheckContext& Context : Results)
+	{
+		for (const FString& Failure : Context.Failures) { AddError(Failure); }
+		if (Context.NumFailures > Context.Failures.Num()) { AddError(FString::Printf(TEXT("... and %d more failures"), Context.NumFailures - Context.Failures.Num())); }
+		bPassed &= Context.Passed();
+	}
+
+	return bPassed;
+}
+
+#endif
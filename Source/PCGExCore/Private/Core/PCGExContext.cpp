@@ -9,6 +9,7 @@
 #include "Factories/PCGExInstancedFactory.h"
 #include "PCGExCoreMacros.h"
 #include "Core/PCGExMT.h"
+#include "Core/PCGExProfiler.h"
 #include "Helpers/PCGExStreamingHelpers.h"
 #include "PCGManagedResource.h"
 #include "Engine/AssetManager.h"
@@ -199,6 +200,7 @@ void FPCGExContext::ReadyForExecution()
 void FPCGExContext::SetState(const PCGExCommon::ContextState StateId)
 {
 	CurrentState.store(StateId.GetComparisonIndex().ToUnstableInt(), std::memory_order_release);
+	if (Profile) { Profile->EnterState(StateId); }
 }
 
 void FPCGExContext::Done()
@@ -227,6 +229,7 @@ bool FPCGExContext::DriveAdvanceWork(const UPCGExSettings* InSettings)
 	do
 	{
 		bPendingAsyncWorkEnd.store(false, std::memory_order_release);
+		PCGExProfiler::FScopedEvent DriveEvent(Profile, PCGExProfiler::EEventKind::Drive, FName("AdvanceWork"));
 		bResult = ElementHandle->AdvanceWork(this, InSettings);
 	}
 	while (bPendingAsyncWorkEnd.load(std::memory_order_acquire));
@@ -306,6 +309,8 @@ void FPCGExContext::OnComplete()
 		StagedData.Empty();
 	}
 
+	if (Profile) { Profile->Finish(false); }
+
 	// Unpause allows the PCG scheduler to collect our outputs and mark the node complete.
 	UnpauseContext();
 }
@@ -467,6 +472,8 @@ bool FPCGExContext::CancelExecution(const FString& InReason)
 		OutputData.Reset();
 		if (bPropagateAbortedExecution) { OutputData.bCancelExecution = true; }
 
+		if (Profile) { Profile->Finish(true); }
+
 		UnpauseContext();
 	}
 
@@ -0,0 +1,125 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExDiagnostics.h"
+
+#include "PCGExLog.h"
+#include "HAL/IConsoleManager.h"
+
+namespace PCGExDiagnostics
+{
+#pragma region FRegistry
+
+	FRegistry& FRegistry::Get()
+	{
+		static FRegistry Instance;
+		return Instance;
+	}
+
+	void FRegistry::Register(const FSource& InSource)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Sources.Add(InSource.Name, InSource);
+	}
+
+	void FRegistry::Unregister(const FString& InName)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Sources.Remove(InName);
+	}
+
+	TArray<FSource> FRegistry::GetSources(const FString& InFilter) const
+	{
+		TArray<FSource> Result;
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			for (const TPair<FString, FSource>& Pair : Sources) { if (Pair.Key.MatchesWildcard(InFilter)) { Result.Add(Pair.Value); } }
+		}
+
+		Result.Sort([](const FSource& A, const FSource& B) { return A.Name < B.Name; });
+		return Result;
+	}
+
+	void FRegistry::LogStats(const FString& InFilter) const
+	{
+		// Summaries are gathered outside of the registry lock, sources take their own
+		const TArray<FSource> Matching = GetSources(InFilter);
+		if (Matching.IsEmpty())
+		{
+			UE_LOG(LogPCGEx, Log, TEXT("PCGEx diagnostics : no source matching '%s'."), *InFilter);
+			return;
+		}
+
+		for (const FSource& Source : Matching) { UE_LOG(LogPCGEx, Log, TEXT("  %-20s %s"), *Source.Name, *Source.GetSummary()); }
+	}
+
+	int32 FRegistry::Flush(const FString& InFilter) const
+	{
+		int32 NumFlushed = 0;
+		for (const FSource& Source : GetSources(InFilter))
+		{
+			if (!Source.Flush) { continue; }
+			Source.Flush();
+			NumFlushed++;
+		}
+
+		return NumFlushed;
+	}
+
+	FRegistrar::FRegistrar(const TCHAR* InName, const TCHAR* InDescription, FGetSummary&& InGetSummary, FFlush&& InFlush)
+		: Name(InName)
+	{
+		FRegistry::Get().Register(FSource{Name, InDescription, MoveTemp(InGetSummary), MoveTemp(InFlush)});
+	}
+
+	FRegistrar::~FRegistrar()
+	{
+		FRegistry::Get().Unregister(Name);
+	}
+
+#pragma endregion
+
+	void Execute(const TArray<FString>& Args)
+	{
+		FString Action = TEXT("Stats");
+		FString Filter = TEXT("*");
+
+		for (const FString& Arg : Args)
+		{
+			FString Key;
+			FString Value;
+			if (Arg.Split(TEXT("="), &Key, &Value))
+			{
+				if (Key.Equals(TEXT("Filter"), ESearchCase::IgnoreCase)) { Filter = Value; }
+			}
+			else
+			{
+				Action = Arg;
+			}
+		}
+
+		if (Action.Equals(TEXT("Stats"), ESearchCase::IgnoreCase))
+		{
+			FRegistry::Get().LogStats(Filter);
+		}
+		else if (Action.Equals(TEXT("Flush"), ESearchCase::IgnoreCase))
+		{
+			const int32 NumFlushed = FRegistry::Get().Flush(Filter);
+			UE_LOG(LogPCGEx, Log, TEXT("PCGEx diagnostics : flushed %d source(s) matching '%s'."), NumFlushed, *Filter);
+		}
+		else if (Action.Equals(TEXT("List"), ESearchCase::IgnoreCase))
+		{
+			for (const FSource& Source : FRegistry::Get().GetSources(Filter)) { UE_LOG(LogPCGEx, Log, TEXT("  %-20s %s%s"), *Source.Name, *Source.Description, Source.Flush ? TEXT("") : TEXT(" (no flush)")); }
+		}
+		else
+		{
+			UE_LOG(LogPCGEx, Warning, TEXT("PCGEx diagnostics : unknown action '%s', expected Stats, Flush or List."), *Action);
+		}
+	}
+
+	static FAutoConsoleCommandWithArgs CommandDiagnostics(
+		TEXT("pcgex.Diagnostics"),
+		TEXT("Reports or flushes PCGEx shared caches & pools. Args: [Stats|Flush|List] [Filter=*], e.g. pcgex.Diagnostics Flush Filter=SpatialIndex"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Execute));
+}
@@ -0,0 +1,59 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExDiagnostics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Diagnostics registry behavior, e.g. pcgex.Bench.Check Filter=Diagnostics.*
+namespace PCGExDiagnostics
+{
+	static PCGExBenchmark::FCheckRegistrar CheckRegistry(
+		TEXT("Diagnostics.Registry"), TEXT("Sources register for the lifetime of their registrar, and stats & flushes only reach the ones matching the filter"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			FRegistry& Registry = FRegistry::Get();
+
+			// Shipped caches register themselves at static init
+			for (const TCHAR* Name : {TEXT("BufferPool"), TEXT("ReadBuffers"), TEXT("SpatialIndex")})
+			{
+				const TArray<FSource> Sources = Registry.GetSources(Name);
+				if (!Context.Test(Sources.Num() == 1, TEXT("%s isn't registered"), Name)) { continue; }
+				Context.Test(static_cast<bool>(Sources[0].GetSummary), TEXT("%s has no summary"), Name);
+				Context.Test(static_cast<bool>(Sources[0].Flush), TEXT("%s can't be flushed"), Name);
+			}
+
+			int32 NumFlushA = 0;
+			int32 NumFlushB = 0;
+
+			{
+				// Registered out of order, listing is sorted
+				FRegistrar RegistrarB(TEXT("DiagnosticsCheck.B"), TEXT("Flushable"), []() { return FString(TEXT("B")); }, [&]() { NumFlushB++; });
+				FRegistrar RegistrarA(TEXT("DiagnosticsCheck.A"), TEXT("Flushable"), []() { return FString(TEXT("A")); }, [&]() { NumFlushA++; });
+				FRegistrar RegistrarC(TEXT("DiagnosticsCheck.C"), TEXT("Not flushable"), []() { return FString(TEXT("C")); });
+
+				const TArray<FSource> Sources = Registry.GetSources(TEXT("DiagnosticsCheck.*"));
+				if (Context.Test(Sources.Num() == 3, TEXT("%d sources matching DiagnosticsCheck.*, expected 3"), Sources.Num()))
+				{
+					Context.Test(Sources[0].Name == TEXT("DiagnosticsCheck.A") && Sources[1].Name == TEXT("DiagnosticsCheck.B") && Sources[2].Name == TEXT("DiagnosticsCheck.C"), TEXT("Sources aren't sorted by name"));
+					Context.Test(Sources[0].GetSummary() == TEXT("A"), TEXT("Summary doesn't come from its own source"));
+				}
+
+				Context.Test(Registry.GetSources(TEXT("DiagnosticsCheck.B")).Num() == 1, TEXT("Exact filter doesn't match a single source"));
+
+				int32 NumFlushed = Registry.Flush(TEXT("DiagnosticsCheck.A"));
+				Context.Test(NumFlushed == 1 && NumFlushA == 1 && NumFlushB == 0, TEXT("Filtered flush reached %d sources (A %d, B %d), expected A only"), NumFlushed, NumFlushA, NumFlushB);
+
+				NumFlushed = Registry.Flush(TEXT("DiagnosticsCheck.*"));
+				Context.Test(NumFlushed == 2 && NumFlushA == 2 && NumFlushB == 1, TEXT("Wildcard flush reached %d sources (A %d, B %d), expected A & B, skipping C"), NumFlushed, NumFlushA, NumFlushB);
+
+				Context.Test(Registry.Flush(TEXT("DiagnosticsCheck.Missing")) == 0, TEXT("Flush with no matching source flushed something"));
+			}
+
+			Context.Test(Registry.GetSources(TEXT("DiagnosticsCheck.*")).IsEmpty(), TEXT("Sources outlived their registrar"));
+			Context.Test(Registry.Flush(TEXT("DiagnosticsCheck.*")) == 0 && NumFlushA == 2 && NumFlushB == 1, TEXT("Unregistered sources were flushed"));
+		});
+}
+
+#endif
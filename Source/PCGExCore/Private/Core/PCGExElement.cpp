@@ -5,6 +5,7 @@
 
 #include "PCGExCoreSettingsCache.h"
 #include "Core/PCGExContext.h"
+#include "Core/PCGExProfiler.h"
 #include "Factories/PCGExInstancedFactory.h"
 #include "Core/PCGExSettings.h"
 #include "Details/PCGExWaitMacros.h"
@@ -41,19 +42,26 @@ bool IPCGExElement::AdvancePreparation(FPCGExContext* Context, const UPCGExSetti
 	// returning false to yield to the scheduler in the meantime.
 	if (Context->IsState(PCGExCommon::States::State_Preparation))
 	{
-		if (!Boot(Context)) { return Context->CancelExecution(FString()); }
+		{
+			PCGExProfiler::FScopedEvent BootEvent(Context->Profile, PCGExProfiler::EEventKind::Phase, FName("Boot"));
+			if (!Boot(Context)) { return Context->CancelExecution(FString()); }
+		}
 
 		for (UPCGExInstancedFactory* Op : Context->InternalOperations) { Op->RegisterAssetDependencies(Context); }
 
 		Context->RegisterAssetDependencies();
 		if (Context->HasAssetRequirements() && Context->LoadAssets()) { return false; }
 
+		PCGExProfiler::FScopedEvent PostLoadEvent(Context->Profile, PCGExProfiler::EEventKind::Phase, FName("PostLoadAssetsDependencies"));
 		PostLoadAssetsDependencies(Context);
 	}
 
 	PCGEX_ON_ASYNC_STATE_READY(PCGExCommon::States::State_LoadingAssetDependencies)
 	{
-		PostLoadAssetsDependencies(Context);
+		{
+			PCGExProfiler::FScopedEvent PostLoadEvent(Context->Profile, PCGExProfiler::EEventKind::Phase, FName("PostLoadAssetsDependencies"));
+			PostLoadAssetsDependencies(Context);
+		}
 		PCGEX_EXECUTION_CHECK_C(Context)
 	}
 
@@ -62,9 +70,12 @@ bool IPCGExElement::AdvancePreparation(FPCGExContext* Context, const UPCGExSetti
 		PCGEX_EXECUTION_CHECK_C(Context)
 	}
 
-	if (!PostBoot(Context))
 	{
-		return Context->CancelExecution(TEXT("There was a problem during post-data preparation."));
+		PCGExProfiler::FScopedEvent PostBootEvent(Context->Profile, PCGExProfiler::EEventKind::Phase, FName("PostBoot"));
+		if (!PostBoot(Context))
+		{
+			return Context->CancelExecution(TEXT("There was a problem during post-data preparation."));
+		}
 	}
 
 	Context->ReadyForExecution();
@@ -94,6 +105,7 @@ FPCGContext* IPCGExElement::Initialize(const FPCGInitializeElementParams& InPara
 	}
 
 	Context->ElementHandle = this;
+	Context->Profile = PCGExProfiler::BeginNode(Context, Settings);
 
 	if (Context->bCleanupConsumableAttributes)
 	{
@@ -203,9 +215,15 @@ bool IPCGExElement::ExecuteInternal(FPCGContext* Context) const
 	constexpr float LONG_SLEEP_MS = 0.005f;
 	constexpr int LONG_SLEEP_THRESHOLD = 1000;
 	int WaitCounter = 0;
+	double WaitStart = 0;
+	double WaitSeconds = 0;
 
 	while (!InContext->DriveAdvanceWork(InSettings))
 	{
+		// Only time spent yielding & sleeping counts as waiting, drives have their own events
+		const double IterationStart = InContext->Profile ? FPlatformTime::Seconds() : 0;
+		if (WaitCounter == 0) { WaitStart = IterationStart; }
+
 		if (WaitCounter < SPIN_PHASE_ITERATIONS)
 		{
 			FPlatformProcess::YieldThread();
@@ -224,8 +242,12 @@ bool IPCGExElement::ExecuteInternal(FPCGContext* Context) const
 			FPlatformProcess::SleepNoStats(LONG_SLEEP_MS);
 		}
 		++WaitCounter;
+
+		if (InContext->Profile) { WaitSeconds += FPlatformTime::Seconds() - IterationStart; }
 	}
 
+	if (InContext->Profile && WaitCounter > 0) { InContext->Profile->AddEvent(PCGExProfiler::EEventKind::Wait, FName("SpinWait"), WaitStart, WaitSeconds, WaitCounter); }
+
 	return true;
 }
 
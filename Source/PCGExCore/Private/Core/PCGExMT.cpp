@@ -7,6 +7,7 @@
 #include "Tasks/Task.h"
 #include "Async/Async.h"
 #include "Core/PCGExContext.h"
+#include "Core/PCGExProfiler.h"
 #include "PCGExLog.h"
 #include "PCGExSettingsCacheBody.h"
 #include "Core/PCGExSettings.h"
@@ -464,6 +465,7 @@ namespace PCGExMT
 			if (TryTransitionState(EAsyncHandleState::Idle, EAsyncHandleState::Running))
 			{
 				PCGEX_MANAGER_LOG(LogTemp, Warning, TEXT("FTaskManager::Start"));
+				if (Context->Profile) { Context->Profile->BeginAsync(); }
 				return true;
 			}
 		}
@@ -610,7 +612,17 @@ namespace PCGExMT
 
 				if (Task->Start())
 				{
+					const TSharedPtr<PCGExProfiler::FNodeProfile>& Profile = SharedContext.Get()->Profile;
+					const double TaskStart = Profile ? FPlatformTime::Seconds() : 0;
+
 					Task->ExecuteTask(Manager);
+
+					if (Profile)
+					{
+						const TSharedPtr<IAsyncHandleGroup> Parent = Task->Group.Pin();
+						Profile->AddTask(Parent ? Parent->GroupName : FName("Task"), TaskStart, FPlatformTime::Seconds() - TaskStart);
+					}
+
 					Task->Complete();
 				}
 			}
@@ -625,6 +637,8 @@ namespace PCGExMT
 		// Clear registries
 		ClearRegistry();
 
+		if (Context->Profile) { Context->Profile->EndAsync(); }
+
 		// For the manager, we DON'T call parent notification (there is no parent)
 		// We call OnEndCallback directly, which notifies the context
 
@@ -830,6 +844,7 @@ namespace PCGExMT
 		if (!TaskGroup->IsAvailable()) { return; }
 
 		TaskGroup->ExecScopeIteration(Scope, bPrepareOnly);
+		if (const TSharedPtr<PCGExProfiler::FNodeProfile>& Profile = TaskManager->GetContext()->Profile) { Profile->AddScope(Scope.Count); }
 
 		// When NumIterations != -1, this task chains into the next scope sequentially.
 		// This is used for forced single-threaded execution: instead of launching all
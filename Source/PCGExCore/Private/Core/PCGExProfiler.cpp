@@ -0,0 +1,528 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExProfiler.h"
+
+#include "PCGComponent.h"
+#include "PCGExLog.h"
+#include "PCGSettings.h"
+#include "Core/PCGExContext.h"
+#include "Data/PCGExPointIO.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace PCGExProfiler
+{
+	namespace
+	{
+		bool GEnabled = false;
+		int32 GMaxEventsPerNode = 250000;
+		int32 GMaxProfiles = 10000;
+
+		FAutoConsoleVariableRef CVarProfilerEnabled(
+			TEXT("pcgex.Profiler.Enabled"), GEnabled,
+			TEXT("Records per-node execution profiles for every PCGEx node executed while enabled. See pcgex.Profiler.Export."));
+
+		FAutoConsoleVariableRef CVarProfilerMaxEvents(
+			TEXT("pcgex.Profiler.MaxEventsPerNode"), GMaxEventsPerNode,
+			TEXT("Maximum number of timed events (states, tasks...) kept per node execution. Counters are unaffected."));
+
+		FAutoConsoleVariableRef CVarProfilerMaxProfiles(
+			TEXT("pcgex.Profiler.MaxProfiles"), GMaxProfiles,
+			TEXT("Maximum number of node executions kept; the oldest ones are discarded first."));
+
+		struct FSession
+		{
+			FRWLock Lock;
+			TArray<TSharedPtr<FNodeProfile>> Profiles;
+			int64 NumDroppedProfiles = 0;
+			double Origin = FPlatformTime::Seconds();
+			std::atomic<int32> ExecutionCounter{0};
+		};
+
+		FSession& GetSession()
+		{
+			static FSession Session;
+			return Session;
+		}
+
+		const TCHAR* KindName(const EEventKind InKind)
+		{
+			switch (InKind)
+			{
+			case EEventKind::State: return TEXT("State");
+			case EEventKind::Phase: return TEXT("Phase");
+			case EEventKind::Drive: return TEXT("Drive");
+			case EEventKind::Async: return TEXT("Async");
+			case EEventKind::Wait: return TEXT("Wait");
+			case EEventKind::Task: return TEXT("Task");
+			case EEventKind::Preload: return TEXT("Preload");
+			default: return TEXT("Unknown");
+			}
+		}
+
+		FString Escape(const FString& InString)
+		{
+			FString Result;
+			Result.Reserve(InString.Len() + 2);
+			for (const TCHAR C : InString)
+			{
+				if (C == TEXT('"') || C == TEXT('\\')) { Result.AppendChar(TEXT('\\')); }
+				if (C < 0x20) { continue; }
+				Result.AppendChar(C);
+			}
+			return Result;
+		}
+
+		FString CSVField(const FString& InString)
+		{
+			if (!InString.Contains(TEXT(",")) && !InString.Contains(TEXT("\""))) { return InString; }
+			return TEXT("\"") + InString.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+		}
+
+		TArray<TSharedPtr<FNodeProfile>> GetProfiles()
+		{
+			FSession& Session = GetSession();
+			FReadScopeLock ReadLock(Session.Lock);
+			return Session.Profiles;
+		}
+
+		// Microseconds since the session started, as Chrome traces expect
+		int64 ToTraceTime(const double InSeconds)
+		{
+			return static_cast<int64>((InSeconds - GetSession().Origin) * 1e6);
+		}
+	}
+
+#pragma region FNodeProfile
+
+	FNodeProfile::FNodeProfile(const FPCGExContext* InContext, const UPCGSettings* InSettings)
+	{
+		// Node objects are named after their settings class and instance, which is what users see in logs
+		NodeName = InSettings ? GetNameSafe(InSettings->GetOuter()) : TEXT("Unknown");
+		if (const UPCGComponent* Component = InContext ? InContext->GetComponent() : nullptr) { SourceName = GetNameSafe(Component->GetOwner()); }
+
+		ExecutionIndex = GetSession().ExecutionCounter.fetch_add(1);
+		StartTime = FPlatformTime::Seconds();
+	}
+
+	void FNodeProfile::AddEvent(const EEventKind InKind, const FName InName, const double InStart, const double InDuration, const int64 InArg)
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		if (Events.Num() >= GMaxEventsPerNode)
+		{
+			++NumDroppedEvents;
+			return;
+		}
+
+		FEvent& Event = Events.Emplace_GetRef();
+		Event.Name = InName;
+		Event.Start = InStart;
+		Event.Duration = InDuration;
+		Event.ThreadId = FPlatformTLS::GetCurrentThreadId();
+		Event.Kind = InKind;
+		Event.Arg = InArg;
+	}
+
+	void FNodeProfile::EnterState(const FName InState)
+	{
+		const double Now = FPlatformTime::Seconds();
+
+		FName PreviousState;
+		double PreviousStart;
+
+		{
+			FWriteScopeLock WriteLock(Lock);
+			if (CurrentState == InState) { return; }
+
+			PreviousState = CurrentState;
+			PreviousStart = CurrentStateStart;
+
+			CurrentState = InState;
+			CurrentStateStart = Now;
+		}
+
+		if (!PreviousState.IsNone()) { AddEvent(EEventKind::State, PreviousState, PreviousStart, Now - PreviousStart); }
+	}
+
+	void FNodeProfile::BeginAsync()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (AsyncStart < 0) { AsyncStart = FPlatformTime::Seconds(); }
+	}
+
+	void FNodeProfile::EndAsync()
+	{
+		double Start;
+
+		{
+			FWriteScopeLock WriteLock(Lock);
+			Start = AsyncStart;
+			AsyncStart = -1;
+		}
+
+		if (Start >= 0) { AddEvent(EEventKind::Async, FName("Async"), Start, FPlatformTime::Seconds() - Start, NumTasks.load()); }
+	}
+
+	void FNodeProfile::AddTask(const FName InName, const double InStart, const double InDuration)
+	{
+		++NumTasks;
+		AddEvent(EEventKind::Task, InName, InStart, InDuration);
+	}
+
+	void FNodeProfile::AddScope(const int32 InCount)
+	{
+		++NumScopes;
+		NumScopeIterations += InCount;
+
+		int32 Current = MinScopeSize.load();
+		while (InCount < Current && !MinScopeSize.compare_exchange_weak(Current, InCount)) {}
+
+		Current = MaxScopeSize.load();
+		while (InCount > Current && !MaxScopeSize.compare_exchange_weak(Current, InCount)) {}
+	}
+
+	void FNodeProfile::AddAttributeIO(const FName InAttribute, const bool bWrite, const int64 InBytes, const double InSeconds)
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		FAttributeIO& IO = Attributes.FindOrAdd(InAttribute);
+		if (bWrite)
+		{
+			IO.BytesWritten += InBytes;
+			IO.WriteSeconds += InSeconds;
+			IO.NumWrites++;
+		}
+		else
+		{
+			IO.BytesRead += InBytes;
+			IO.ReadSeconds += InSeconds;
+			IO.NumReads++;
+		}
+	}
+
+	void FNodeProfile::AddSharedRead(const FName InAttribute, const int64 InBytes)
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		FAttributeIO& IO = Attributes.FindOrAdd(InAttribute);
+		IO.BytesShared += InBytes;
+		IO.NumSharedReads++;
+	}
+
+	void FNodeProfile::Finish(const bool bWasCancelled)
+	{
+		bool bExpected = false;
+		if (!bFinished.compare_exchange_strong(bExpected, true)) { return; }
+
+		EndAsync();
+		EnterState(NAME_None);
+
+		EndTime = FPlatformTime::Seconds();
+		bCancelled = bWasCancelled;
+
+		FSession& Session = GetSession();
+		FWriteScopeLock WriteLock(Session.Lock);
+
+		// Keep the most recent executions only, a profiled session left running would otherwise grow forever
+		const int32 NumExcess = Session.Profiles.Num() + 1 - FMath::Max(1, GMaxProfiles);
+		if (NumExcess > 0)
+		{
+			Session.Profiles.RemoveAt(0, NumExcess, EAllowShrinking::No);
+			Session.NumDroppedProfiles += NumExcess;
+		}
+
+		Session.Profiles.Add(AsShared());
+	}
+
+	double FNodeProfile::GetTotalSeconds(const EEventKind InKind) const
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		double Total = 0;
+		for (const FEvent& Event : Events) { if (Event.Kind == InKind) { Total += Event.Duration; } }
+		return Total;
+	}
+
+#pragma endregion
+
+	FScopedEvent::FScopedEvent(const TSharedPtr<FNodeProfile>& InProfile, const EEventKind InKind, const FName InName, const int64 InArg)
+		: Profile(InProfile), Kind(InKind), Name(InName), Arg(InArg)
+	{
+		if (Profile) { Start = FPlatformTime::Seconds(); }
+	}
+
+	FScopedEvent::~FScopedEvent()
+	{
+		if (Profile) { Profile->AddEvent(Kind, Name, Start, FPlatformTime::Seconds() - Start, Arg); }
+	}
+
+	FScopedAttributeIO::FScopedAttributeIO(const PCGExData::FPointIO& InSource, const FName InAttribute, const bool bInWrite, const int64 InBytes)
+		: Attribute(InAttribute), bWrite(bInWrite), Bytes(InBytes)
+	{
+		if (!IsEnabled()) { return; }
+		if (const FPCGExContext* Context = InSource.GetContext()) { Profile = Context->Profile; }
+		if (Profile) { Start = FPlatformTime::Seconds(); }
+	}
+
+	FScopedAttributeIO::~FScopedAttributeIO()
+	{
+		if (Profile) { Profile->AddAttributeIO(Attribute, bWrite, Bytes, FPlatformTime::Seconds() - Start); }
+	}
+
+	void RecordSharedRead(const PCGExData::FPointIO& InSource, const FName InAttribute, const int64 InBytes)
+	{
+		if (!IsEnabled()) { return; }
+		if (const FPCGExContext* Context = InSource.GetContext(); Context && Context->Profile) { Context->Profile->AddSharedRead(InAttribute, InBytes); }
+	}
+
+	bool IsEnabled()
+	{
+		// -PCGExProfile=<path> enables profiling from the very first execution and exports on exit, for headless runs
+		static const bool bCommandLineParsed = []()
+		{
+			if (FString Path; FParse::Value(FCommandLine::Get(), TEXT("PCGExProfile="), Path) && !Path.IsEmpty())
+			{
+				GEnabled = true;
+				FCoreDelegates::OnPreExit.AddLambda([Path]() { Export(Path); });
+			}
+			return true;
+		}();
+
+		return GEnabled;
+	}
+
+	TSharedPtr<FNodeProfile> BeginNode(const FPCGExContext* InContext, const UPCGSettings* InSettings)
+	{
+		if (!IsEnabled()) { return nullptr; }
+		return MakeShared<FNodeProfile>(InContext, InSettings);
+	}
+
+	bool ExportChromeTrace(const FString& InPath)
+	{
+		const TArray<TSharedPtr<FNodeProfile>> Profiles = GetProfiles();
+
+		FString Json;
+		Json.Reserve(1024 * 1024);
+		Json += TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+		bool bFirst = true;
+		auto Append = [&](const FString& InEvent)
+		{
+			if (!bFirst) { Json += TEXT(",\n"); }
+			bFirst = false;
+			Json += InEvent;
+		};
+
+		int32 AsyncId = 0;
+
+		for (const TSharedPtr<FNodeProfile>& Profile : Profiles)
+		{
+			FReadScopeLock ReadLock(Profile->Lock);
+
+			// One trace "process" per node execution; lane 0 holds the node & its states, tasks go on their actual thread
+			const int32 Pid = Profile->ExecutionIndex + 1;
+			const FString Label = Profile->SourceName.IsEmpty() ? Profile->NodeName : FString::Printf(TEXT("%s (%s)"), *Profile->NodeName, *Profile->SourceName);
+
+			Append(FString::Printf(TEXT("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"%s\"}}"), Pid, *Escape(Label)));
+			Append(FString::Printf(TEXT("{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"sort_index\":%d}}"), Pid, Pid));
+			Append(FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"States\"}}"), Pid));
+
+			FString Attributes;
+			for (const TPair<FName, FAttributeIO>& Pair : Profile->Attributes)
+			{
+				if (!Attributes.IsEmpty()) { Attributes += TEXT(","); }
+				Attributes += FString::Printf(
+					TEXT("\"%s\":{\"read_bytes\":%lld,\"written_bytes\":%lld,\"shared_bytes\":%lld,\"read_ms\":%.3f,\"write_ms\":%.3f}"),
+					*Escape(Pair.Key.ToString()), Pair.Value.BytesRead, Pair.Value.BytesWritten, Pair.Value.BytesShared, Pair.Value.ReadSeconds * 1e3, Pair.Value.WriteSeconds * 1e3);
+			}
+
+			Append(
+				FString::Printf(
+					TEXT("{\"name\":\"%s\",\"cat\":\"Node\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":%d,\"tid\":0,\"args\":{\"cancelled\":%s,\"tasks\":%lld,\"scopes\":%lld,\"scope_iterations\":%lld,\"min_scope\":%d,\"max_scope\":%d,\"dropped_events\":%lld,\"attributes\":{%s}}}"),
+					*Escape(Profile->NodeName), ToTraceTime(Profile->StartTime), static_cast<int64>((Profile->EndTime - Profile->StartTime) * 1e6), Pid,
+					Profile->bCancelled ? TEXT("true") : TEXT("false"), Profile->NumTasks.load(), Profile->NumScopes.load(), Profile->NumScopeIterations.load(),
+					Profile->NumScopes.load() ? Profile->MinScopeSize.load() : 0, Profile->MaxScopeSize.load(), Profile->NumDroppedEvents.load(), *Attributes));
+
+			for (const FEvent& Event : Profile->Events)
+			{
+				const int64 Ts = ToTraceTime(Event.Start);
+				const int64 Dur = static_cast<int64>(Event.Duration * 1e6);
+				const FString Name = Escape(Event.Name.ToString());
+
+				if (Event.Kind == EEventKind::Async || Event.Kind == EEventKind::Preload)
+				{
+					// These overlap each other freely, async slices keep them readable
+					const int32 Id = ++AsyncId;
+					Append(FString::Printf(TEXT("{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"b\",\"id\":%d,\"ts\":%lld,\"pid\":%d,\"tid\":0,\"args\":{\"arg\":%lld}}"), *Name, KindName(Event.Kind), Id, Ts, Pid, Event.Arg));
+					Append(FString::Printf(TEXT("{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"e\",\"id\":%d,\"ts\":%lld,\"pid\":%d,\"tid\":0}"), *Name, KindName(Event.Kind), Id, Ts + Dur, Pid));
+					continue;
+				}
+
+				const uint32 Tid = Event.Kind == EEventKind::State ? 0 : Event.ThreadId;
+				Append(FString::Printf(TEXT("{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":%d,\"tid\":%u,\"args\":{\"arg\":%lld}}"), *Name, KindName(Event.Kind), Ts, Dur, Pid, Tid, Event.Arg));
+			}
+		}
+
+		Json += TEXT("\n]}\n");
+
+		if (!FFileHelper::SaveStringToFile(Json, *InPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("PCGEx profiler : could not write '%s'"), *InPath);
+			return false;
+		}
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx profiler : %d node executions written to '%s'"), Profiles.Num(), *InPath);
+		return true;
+	}
+
+	bool ExportCSV(const FString& InPath)
+	{
+		const TArray<TSharedPtr<FNodeProfile>> Profiles = GetProfiles();
+
+		TArray<FString> Lines;
+		Lines.Add(TEXT("Execution,Node,Source,Kind,Name,StartMs,DurationMs,ThreadId,Arg,BytesRead,BytesWritten,BytesShared"));
+
+		const double Origin = GetSession().Origin;
+
+		for (const TSharedPtr<FNodeProfile>& Profile : Profiles)
+		{
+			FReadScopeLock ReadLock(Profile->Lock);
+
+			const FString Prefix = FString::Printf(TEXT("%d,%s,%s"), Profile->ExecutionIndex, *CSVField(Profile->NodeName), *CSVField(Profile->SourceName));
+
+			int64 TotalRead = 0;
+			int64 TotalWritten = 0;
+			int64 TotalShared = 0;
+			for (const TPair<FName, FAttributeIO>& Pair : Profile->Attributes)
+			{
+				TotalRead += Pair.Value.BytesRead;
+				TotalWritten += Pair.Value.BytesWritten;
+				TotalShared += Pair.Value.BytesShared;
+			}
+
+			// Summary row, Arg is the task count
+			Lines.Add(
+				FString::Printf(
+					TEXT("%s,Node,%s,%.3f,%.3f,0,%lld,%lld,%lld,%lld"), *Prefix, Profile->bCancelled ? TEXT("Cancelled") : TEXT("Completed"),
+					(Profile->StartTime - Origin) * 1e3, (Profile->EndTime - Profile->StartTime) * 1e3, Profile->NumTasks.load(), TotalRead, TotalWritten, TotalShared));
+
+			Lines.Add(FString::Printf(TEXT("%s,Scopes,Count,0,0,0,%lld,0,0,0"), *Prefix, Profile->NumScopes.load()));
+			Lines.Add(FString::Printf(TEXT("%s,Scopes,Iterations,0,0,0,%lld,0,0,0"), *Prefix, Profile->NumScopeIterations.load()));
+			Lines.Add(FString::Printf(TEXT("%s,Scopes,Min,0,0,0,%d,0,0,0"), *Prefix, Profile->NumScopes.load() ? Profile->MinScopeSize.load() : 0));
+			Lines.Add(FString::Printf(TEXT("%s,Scopes,Max,0,0,0,%d,0,0,0"), *Prefix, Profile->MaxScopeSize.load()));
+
+			for (const FEvent& Event : Profile->Events)
+			{
+				Lines.Add(
+					FString::Printf(
+						TEXT("%s,%s,%s,%.3f,%.3f,%u,%lld,0,0,0"), *Prefix, KindName(Event.Kind), *CSVField(Event.Name.ToString()),
+						(Event.Start - Origin) * 1e3, Event.Duration * 1e3, Event.ThreadId, Event.Arg));
+			}
+
+			for (const TPair<FName, FAttributeIO>& Pair : Profile->Attributes)
+			{
+				Lines.Add(
+					FString::Printf(
+						TEXT("%s,Attribute,%s,0,%.3f,0,%d,%lld,%lld,%lld"), *Prefix, *CSVField(Pair.Key.ToString()),
+						(Pair.Value.ReadSeconds + Pair.Value.WriteSeconds) * 1e3, Pair.Value.NumReads + Pair.Value.NumWrites + Pair.Value.NumSharedReads,
+						Pair.Value.BytesRead, Pair.Value.BytesWritten, Pair.Value.BytesShared));
+			}
+		}
+
+		if (!FFileHelper::SaveStringArrayToFile(Lines, *InPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("PCGEx profiler : could not write '%s'"), *InPath);
+			return false;
+		}
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx profiler : %d node executions written to '%s'"), Profiles.Num(), *InPath);
+		return true;
+	}
+
+	bool Export(const FString& InPath)
+	{
+		if (FPaths::GetExtension(InPath).Equals(TEXT("csv"), ESearchCase::IgnoreCase)) { return ExportCSV(InPath); }
+		return ExportChromeTrace(InPath);
+	}
+
+	void LogSummary()
+	{
+		const TArray<TSharedPtr<FNodeProfile>> Profiles = GetProfiles();
+
+		int64 NumDroppedProfiles = 0;
+
+		{
+			FSession& Session = GetSession();
+			FReadScopeLock ReadLock(Session.Lock);
+			NumDroppedProfiles = Session.NumDroppedProfiles;
+		}
+
+		UE_LOG(LogPCGEx, Log, TEXT("PCGEx profiler : %d node executions (%lld older ones discarded, see pcgex.Profiler.MaxProfiles)"), Profiles.Num(), NumDroppedProfiles);
+
+		for (const TSharedPtr<FNodeProfile>& Profile : Profiles)
+		{
+			const double Wall = Profile->EndTime - Profile->StartTime;
+			const double Drive = Profile->GetTotalSeconds(EEventKind::Drive);
+			const double Async = Profile->GetTotalSeconds(EEventKind::Async);
+			const double Wait = Profile->GetTotalSeconds(EEventKind::Wait);
+			const double Preload = Profile->GetTotalSeconds(EEventKind::Preload);
+
+			int64 Read = 0;
+			int64 Written = 0;
+			int64 Shared = 0;
+
+			{
+				FReadScopeLock ReadLock(Profile->Lock);
+				for (const TPair<FName, FAttributeIO>& Pair : Profile->Attributes)
+				{
+					Read += Pair.Value.BytesRead;
+					Written += Pair.Value.BytesWritten;
+					Shared += Pair.Value.BytesShared;
+				}
+			}
+
+			const int64 NumScopes = Profile->NumScopes.load();
+
+			// Idle is time the node was neither running on the scheduler nor waiting on its own tasks, i.e scheduling latency
+			UE_LOG(
+				LogPCGEx, Log, TEXT("  #%d %s%s : %.3fms wall | drive %.3fms, async %.3fms, wait %.3fms, idle %.3fms | %lld tasks, %lld scopes (avg %.0f) | preload %.3fms | %.2f MB read, %.2f MB written, %.2f MB shared"),
+				Profile->ExecutionIndex, *Profile->NodeName, Profile->bCancelled ? TEXT(" (cancelled)") : TEXT(""),
+				Wall * 1e3, Drive * 1e3, Async * 1e3, Wait * 1e3, FMath::Max(0.0, Wall - Drive - Async) * 1e3,
+				Profile->NumTasks.load(), NumScopes, NumScopes ? static_cast<double>(Profile->NumScopeIterations.load()) / static_cast<double>(NumScopes) : 0.0,
+				Preload * 1e3, static_cast<double>(Read) / (1024.0 * 1024.0), static_cast<double>(Written) / (1024.0 * 1024.0), static_cast<double>(Shared) / (1024.0 * 1024.0));
+		}
+	}
+
+	void Reset()
+	{
+		FSession& Session = GetSession();
+		FWriteScopeLock WriteLock(Session.Lock);
+		Session.Profiles.Empty();
+		Session.NumDroppedProfiles = 0;
+	}
+
+	static FAutoConsoleCommandWithArgs CommandProfilerExport(
+		TEXT("pcgex.Profiler.Export"),
+		TEXT("Writes recorded node profiles. Args: <Path> (.json for a Chrome trace, .csv for a flat table; defaults to Saved/Profiling/PCGExProfile.json)"),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				Export(Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / TEXT("PCGExProfile.json"));
+			}));
+
+	static FAutoConsoleCommand CommandProfilerSummary(
+		TEXT("pcgex.Profiler.Summary"),
+		TEXT("Logs a one-line summary of every recorded node profile."),
+		FConsoleCommandDelegate::CreateStatic(&LogSummary));
+
+	static FAutoConsoleCommand CommandProfilerReset(
+		TEXT("pcgex.Profiler.Reset"),
+		TEXT("Discards every recorded node profile."),
+		FConsoleCommandDelegate::CreateStatic(&Reset));
+}
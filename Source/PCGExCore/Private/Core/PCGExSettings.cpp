@@ -34,6 +34,7 @@ void UPCGExSettings::PostEditChangeProperty(struct FPropertyChangedEvent& Proper
 	}
 
 	bCachedSupportsDataStealing = SupportsDataStealing();
+	bCachedSupportsIncrementalExecution = SupportsIncrementalExecution();
 	bCachedSupportsInitPolicy = GetExecutionPolicy() != EPCGExExecutionPolicy::Ignored;
 	
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -44,6 +45,7 @@ void UPCGExSettings::PostLoad()
 {
 	Super::PostLoad();
 	bCachedSupportsDataStealing = SupportsDataStealing();
+	bCachedSupportsIncrementalExecution = SupportsIncrementalExecution();
 	bCachedSupportsInitPolicy = GetExecutionPolicy() != EPCGExExecutionPolicy::Ignored;
 }
 
@@ -71,6 +73,17 @@ bool UPCGExSettings::SupportsDataStealing() const
 	return false;
 }
 
+bool UPCGExSettings::SupportsIncrementalExecution() const
+{
+	return false;
+}
+
+bool UPCGExSettings::WantsIncrementalExecution() const
+{
+	// Stolen inputs are modified in place, they can't be told apart from their previous state
+	return SupportsIncrementalExecution() && IncrementalExecution == EPCGExOptionState::Enabled && StealData != EPCGExOptionState::Enabled;
+}
+
 bool UPCGExSettings::ShouldCache() const
 {
 	if (!IsCacheable()) { return false; }
@@ -21,6 +21,44 @@ namespace PCGExData
 #undef PCGEX_FN
 		}
 
+		// Field is a template parameter so the per-type field switch folds away, leaving a plain loop
+		template <typename T, PCGExTypeOps::ESingleField Field>
+		void ExtractFieldLoop(const T* RESTRICT Values, const int32 Count, double* RESTRICT OutValues)
+		{
+			for (int32 i = 0; i < Count; i++) { OutValues[i] = PCGExTypeOps::FTypeOps<T>::ExtractField(&Values[i], Field); }
+		}
+
+		template <typename T>
+		void ExtractFieldRange(const void* Values, const int32 Count, const PCGExTypeOps::ESingleField Field, double* OutValues)
+		{
+			const T* TypedValues = static_cast<const T*>(Values);
+
+#define PCGEX_FIELD_LOOP(_FIELD) case PCGExTypeOps::ESingleField::_FIELD: ExtractFieldLoop<T, PCGExTypeOps::ESingleField::_FIELD>(TypedValues, Count, OutValues); break;
+			switch (Field)
+			{
+			PCGEX_FIELD_LOOP(X)
+			PCGEX_FIELD_LOOP(Y)
+			PCGEX_FIELD_LOOP(Z)
+			PCGEX_FIELD_LOOP(W)
+			PCGEX_FIELD_LOOP(Length)
+			PCGEX_FIELD_LOOP(SquaredLength)
+			PCGEX_FIELD_LOOP(Volume)
+			PCGEX_FIELD_LOOP(Sum)
+			}
+#undef PCGEX_FIELD_LOOP
+		}
+
+		FExtractFieldRangeFn GetExtractFieldRangeFn(EPCGMetadataTypes Type)
+		{
+#define PCGEX_FN(_TYPE, _NAME, ...) case EPCGMetadataTypes::_NAME: return &ExtractFieldRange<_TYPE>;
+			switch (Type)
+			{
+			PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_FN)
+			default: return nullptr;
+			}
+#undef PCGEX_FN
+		}
+
 		FInjectFieldFn GetInjectFieldFn(EPCGMetadataTypes Type)
 		{
 #define PCGEX_FN(_TYPE, _NAME, ...) case EPCGMetadataTypes::_NAME: return &PCGExTypeOps::FTypeOps<_TYPE>::InjectField;
@@ -102,6 +140,7 @@ namespace PCGExData
 
 		// Cache field operation function pointers
 		ExtractFieldFromReal = SubSelectionImpl::GetExtractFieldFn(RealType);
+		ExtractFieldRangeFromReal = SubSelectionImpl::GetExtractFieldRangeFn(RealType);
 		InjectFieldToReal = SubSelectionImpl::GetInjectFieldFn(RealType);
 		ExtractFieldFromWorking = SubSelectionImpl::GetExtractFieldFn(WorkingType);
 		InjectFieldToWorking = SubSelectionImpl::GetInjectFieldFn(WorkingType);
@@ -123,6 +162,13 @@ namespace PCGExData
 		ConvertDoubleToWorking = PCGExTypeOps::FConversionTable::GetConversionFn(EPCGMetadataTypes::Double, WorkingType);
 		ConvertRealToDouble = PCGExTypeOps::FConversionTable::GetConversionFn(RealType, EPCGMetadataTypes::Double);
 		ConvertDoubleToReal = PCGExTypeOps::FConversionTable::GetConversionFn(EPCGMetadataTypes::Double, RealType);
+
+		// Cache range conversion functions
+		ConvertRealToWorkingRange = PCGExTypeOps::FConversionTable::GetRangeConversionFn(RealType, WorkingType);
+		ConvertDoubleToWorkingRange = PCGExTypeOps::FConversionTable::GetRangeConversionFn(EPCGMetadataTypes::Double, WorkingType);
+
+		RealTypeSize = RealOps ? RealOps->GetTypeSize() : 0;
+		WorkingTypeSize = WorkingOps ? WorkingOps->GetTypeSize() : 0;
 	}
 
 	bool FCachedSubSelection::AppliesToSourceRead() const
@@ -197,6 +243,52 @@ namespace PCGExData
 		if (ConvertRealToWorking) { ConvertRealToWorking(Source, OutValue); }
 	}
 
+	void FCachedSubSelection::ApplyGetRange(const void* Source, void* OutValues, const int32 Count) const
+	{
+		if (Count <= 0) { return; }
+
+		if (!bIsValid || !AppliesToSourceRead())
+		{
+			// No applicable sub-selection - just convert
+			if (ConvertRealToWorkingRange) { ConvertRealToWorkingRange(Source, OutValues, Count); }
+			return;
+		}
+
+		const uint8* SourceBytes = static_cast<const uint8*>(Source);
+		uint8* OutBytes = static_cast<uint8*>(OutValues);
+
+		// Handle field extraction, the common case (.X, .Length, ...)
+		if (bIsFieldSet && !bIsComponentSet && ExtractFieldRangeFromReal)
+		{
+			if (WorkingType == EPCGMetadataTypes::Double)
+			{
+				ExtractFieldRangeFromReal(Source, Count, Field, static_cast<double*>(OutValues));
+				return;
+			}
+
+			if (!ConvertDoubleToWorkingRange) { return; }
+
+			// Extract into a small double scratch, then convert it to WorkingType in one go
+			constexpr int32 ChunkSize = 256;
+			double FieldValues[ChunkSize];
+
+			for (int32 Offset = 0; Offset < Count; Offset += ChunkSize)
+			{
+				const int32 Num = FMath::Min(ChunkSize, Count - Offset);
+				ExtractFieldRangeFromReal(SourceBytes + static_cast<SIZE_T>(Offset) * RealTypeSize, Num, Field, FieldValues);
+				ConvertDoubleToWorkingRange(FieldValues, OutBytes + static_cast<SIZE_T>(Offset) * WorkingTypeSize, Num);
+			}
+
+			return;
+		}
+
+		// Axis & component selections - value by value
+		for (int32 i = 0; i < Count; i++)
+		{
+			ApplyGet(SourceBytes + static_cast<SIZE_T>(i) * RealTypeSize, OutBytes + static_cast<SIZE_T>(i) * WorkingTypeSize);
+		}
+	}
+
 	void FCachedSubSelection::ApplySet(void* Target, const void* Source) const
 	{
 		if (!bIsValid || !AppliesToTargetWrite())
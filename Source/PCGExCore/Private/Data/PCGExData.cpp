@@ -8,10 +8,16 @@
 #include "PCGExH.h"
 #include "PCGExLog.h"
 #include "PCGExSettingsCacheBody.h"
+#include "Containers/PCGExBufferPool.h"
+#include "Containers/PCGExManagedObjects.h"
+#include "Core/PCGExContext.h"
+#include "Core/PCGExProfiler.h"
 #include "Data/PCGExDataHelpers.h"
 #include "Data/PCGExAttributeBroadcaster.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
+#include "Data/PCGExReadBufferRegistry.h"
+#include "Data/PCGExSpatialIndexRegistry.h"
 #include "Data/PCGPointData.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Metadata/Accessors/PCGAttributeAccessorHelpers.h"
@@ -121,6 +127,12 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		this->UnderlyingDomain = EDomainType::Elements;
 	}
 
+	template <typename T>
+	TArrayBuffer<T>::~TArrayBuffer()
+	{
+		PCGEx::FBufferPool::Get().Release(InHashes);
+	}
+
 	template <typename T>
 	TSharedPtr<TArray<T>> TArrayBuffer<T>::GetInValues() { return InValues; }
 
@@ -175,6 +187,13 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	template <typename T>
 	void TArrayBuffer<T>::SetValue(const int32 Index, const T& Value) { *(OutValues->GetData() + Index) = Value; }
 
+	template <typename T>
+	void TArrayBuffer<T>::SetValues(const int32 Start, TArrayView<const T> Values)
+	{
+		const int32 Count = Values.Num();
+		for (int i = 0; i < Count; i++) { *(OutValues->GetData() + (Start + i)) = Values[i]; }
+	}
+
 	template <typename T>
 	PCGExValueHash TArrayBuffer<T>::ReadValueHash(const int32 Index)
 	{
@@ -195,10 +214,10 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		if (InValues) { return; }
 
 		const int32 NumReadValue = Source->GetIn()->GetNumPoints();
-		InValues = MakeShared<TArray<T>>();
+		InValues = PCGEx::FBufferPool::MakeArray<T>(NumReadValue);
 		PCGExArrayHelpers::InitArray(InValues, NumReadValue);
 
-		if (bCacheValueHashes) { InHashes.Init(0, NumReadValue); }
+		if (bCacheValueHashes) { PCGEx::FBufferPool::Get().Init<PCGExValueHash>(InHashes, 0, NumReadValue); }
 
 		InAttribute = Attribute;
 		TypedInAttribute = Attribute ? static_cast<const FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
@@ -206,13 +225,53 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		bSparseBuffer = bScoped;
 	}
 
+	// Whole reads of an input can be shared with other buffers, unless the reading node created that input
+	// or stole it, and may still write to it
+	static bool CanShareInValues(const FPointIO& InSource)
+	{
+		if (!FReadBufferRegistry::IsEnabled() || !InSource.GetIn()) { return false; }
+
+		const FPCGExContext* Context = InSource.GetContext();
+		if (!Context) { return true; }
+		if (Context->bWantsDataStealing && InSource.GetOut() == InSource.GetIn()) { return false; }
+		return !Context->ManagedObjects || !Context->ManagedObjects->Contains(InSource.GetIn());
+	}
+
+	template <typename T>
+	bool TArrayBuffer<T>::InitFromSharedValues(const FReadBufferKey& InKey, const FPCGMetadataAttributeBase* Attribute, const bool bRequireMinMax)
+	{
+		check(!InValues)
+
+		TSharedPtr<TArray<T>> SharedValues = FReadBufferRegistry::Get().Find<T>(InKey, bRequireMinMax, this->Min, this->Max);
+		if (!SharedValues) { return false; }
+
+		const int32 NumReadValue = Source->GetIn()->GetNumPoints();
+		if (SharedValues->Num() != NumReadValue) { return false; }
+
+		InValues = SharedValues;
+		if (bCacheValueHashes)
+		{
+			PCGEx::FBufferPool::Get().Init<PCGExValueHash>(InHashes, 0, NumReadValue);
+			ComputeValueHashes(PCGExMT::FScope(0, NumReadValue));
+		}
+
+		InAttribute = Attribute;
+		TypedInAttribute = Attribute ? static_cast<const FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
+
+		bSparseBuffer = false;
+		bReadComplete = true;
+
+		PCGExProfiler::RecordSharedRead(*Source, this->Identifier.Name, static_cast<int64>(NumReadValue) * sizeof(T));
+		return true;
+	}
+
 	template <typename T>
 	void TArrayBuffer<T>::InitForWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init)
 	{
 		if (OutValues) { return; }
 
-		OutValues = MakeShared<TArray<T>>();
-		OutValues->Init(InDefaultValue, Source->GetOut()->GetNumPoints());
+		OutValues = PCGEx::FBufferPool::MakeArray<T>();
+		PCGEx::FBufferPool::Get().Init(*OutValues, InDefaultValue, Source->GetOut()->GetNumPoints());
 
 		OutAttribute = Attribute;
 		TypedOutAttribute = Attribute ? static_cast<FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
@@ -234,7 +293,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 
 		if (bReadComplete)
 		{
-			if (InHashes.Num() != InValues->Num()) { InHashes.Init(0, InValues->Num()); }
+			if (InHashes.Num() != InValues->Num()) { PCGEx::FBufferPool::Get().Init<PCGExValueHash>(InHashes, 0, InValues->Num()); }
 			Fetch(PCGExMT::FScope(0, InValues->Num()));
 		}
 	}
@@ -294,15 +353,26 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			return false;
 		}
 
+		FReadBufferKey SharedKey;
+		const bool bShared = !bScoped && CanShareInValues(*Source);
+		if (bShared)
+		{
+			SharedKey = FReadBufferKey(Source->GetIn(), this->GetTypeId(), PCGExMetaHelpers::GetSelectorFromIdentifier(Identifier).ToString());
+			if (InitFromSharedValues(SharedKey, TypedInAttribute, false)) { return true; }
+		}
+
 		InitForReadInternal(bScoped, TypedInAttribute);
 
 		// Non-scoped buffers bulk-read all values upfront. Scoped buffers leave
 		// the array allocated but empty; values are fetched on-demand per scope.
 		if (!bSparseBuffer && !bReadComplete)
 		{
+			PCGExProfiler::FScopedAttributeIO ProfileIO(*Source, this->Identifier.Name, false, static_cast<int64>(InValues->Num()) * sizeof(T));
 			TArrayView<T> InRange = MakeArrayView(InValues->GetData(), InValues->Num());
 			InAccessor->GetRange<T>(InRange, 0, *Source->GetInKeys());
 			bReadComplete = true;
+
+			if (bShared) { FReadBufferRegistry::Get().Register<T>(SharedKey, InValues, false, this->Min, this->Max); }
 		}
 
 		return true;
@@ -346,13 +416,28 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			return false;
 		}
 
+		FReadBufferKey SharedKey;
+		const bool bShared = !bScoped && CanShareInValues(*Source);
+		if (bShared)
+		{
+			SharedKey = FReadBufferKey(Source->GetIn(), this->GetTypeId(), InSelector.ToString());
+			if (InitFromSharedValues(SharedKey, InternalBroadcaster->GetAttribute(), bCaptureMinMax))
+			{
+				InternalBroadcaster.Reset();
+				return true;
+			}
+		}
+
 		InitForReadInternal(bScoped, InternalBroadcaster->GetAttribute());
 
 		if (!bSparseBuffer && !bReadComplete)
 		{
+			PCGExProfiler::FScopedAttributeIO ProfileIO(*Source, this->Identifier.Name, false, static_cast<int64>(InValues->Num()) * sizeof(T));
 			InternalBroadcaster->GrabAndDump(*InValues, bCaptureMinMax, this->Min, this->Max);
 			bReadComplete = true;
 			InternalBroadcaster.Reset();
+
+			if (bShared) { FReadBufferRegistry::Get().Register<T>(SharedKey, InValues, bCaptureMinMax, this->Min, this->Max); }
 		}
 
 		return true;
@@ -454,6 +539,14 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		// in StageOutput won't delete data we just wrote.
 		SharedContext.Get()->AddProtectedAttributeName(TypedOutAttribute->Name);
 
+		// Writing in place, values & indexes shared from that input are stale now
+		if (Source->GetOut() == Source->GetIn())
+		{
+			FReadBufferRegistry::Get().Invalidate(Source->GetIn());
+			FSpatialIndexRegistry::Get().Invalidate(Source->GetIn());
+		}
+
+		PCGExProfiler::FScopedAttributeIO ProfileIO(*Source, TypedOutAttribute->Name, true, static_cast<int64>(OutValues->Num()) * sizeof(T));
 		TArrayView<const T> View = MakeArrayView(OutValues->GetData(), OutValues->Num());
 		OutAccessor->SetRange<T>(View, 0, *Source->GetOutKeys(bEnsureValidKeys).Get());
 	}
@@ -462,6 +555,8 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	void TArrayBuffer<T>::Fetch(const PCGExMT::FScope& Scope)
 	{
 		if (!IsSparse() || bReadComplete || !IsEnabled()) { return; }
+
+		PCGExProfiler::FScopedAttributeIO ProfileIO(*Source, this->Identifier.Name, false, static_cast<int64>(Scope.Count) * sizeof(T));
 		if (InternalBroadcaster) { InternalBroadcaster->Fetch(*InValues, Scope); }
 
 		if (TUniquePtr<const IPCGAttributeAccessor> InAccessor = PCGAttributeAccessorHelpers::CreateConstAccessor(TypedInAttribute, Source->GetIn()->Metadata); InAccessor.IsValid())
@@ -478,6 +573,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	{
 		InValues.Reset();
 		OutValues.Reset();
+		PCGEx::FBufferPool::Get().Release(InHashes);
 		InternalBroadcaster.Reset();
 	}
 
@@ -553,6 +649,16 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		if (bReadFromOutput) { InValue = Value; }
 	}
 
+	template <typename T>
+	void TSingleValueBuffer<T>::SetValues(const int32 Start, TArrayView<const T> Values)
+	{
+		if (Values.IsEmpty()) { return; }
+
+		FWriteScopeLock WriteScopeLock(BufferLock);
+		OutValue = Values.Last();
+		if (bReadFromOutput) { InValue = OutValue; }
+	}
+
 	template <typename T>
 	bool TSingleValueBuffer<T>::InitForRead(const EIOSide InSide, const bool bScoped)
 	{
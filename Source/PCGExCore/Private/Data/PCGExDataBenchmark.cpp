@@ -0,0 +1,57 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/PCGExDataBenchmark.h"
+
+#include "Containers/PCGExManagedObjects.h"
+#include "Core/PCGExContext.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExData::Benchmark
+{
+	FContextFixture::FContextFixture()
+		: Context(MakeUnique<FPCGExContext>())
+	{
+	}
+
+	FContextFixture::~FContextFixture()
+	{
+		Context.Reset();
+	}
+
+	UPCGPointArrayData* FContextFixture::MakePointData(const TConstArrayView<FVector> InPositions) const
+	{
+		UPCGPointArrayData* Data = Context->ManagedObjects->New<UPCGPointArrayData>();
+		Data->SetNumPoints(InPositions.Num());
+		Data->AllocateProperties(EPCGPointNativeProperties::Transform | EPCGPointNativeProperties::MetadataEntry);
+
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+		TPCGValueRange<int64> Entries = Data->GetMetadataEntryValueRange(false);
+		for (int32 i = 0; i < InPositions.Num(); i++)
+		{
+			Transforms[i].SetLocation(InPositions[i]);
+			Entries[i] = Data->Metadata->AddEntry();
+		}
+
+		return Data;
+	}
+
+	void FContextFixture::AddInput(const UPCGData* InData, const FName InPin) const
+	{
+		FPCGTaggedData& TaggedData = Context->InputData.TaggedData.Emplace_GetRef();
+		TaggedData.Data = InData;
+		TaggedData.Pin = InPin;
+	}
+
+	TSharedPtr<FPointIO> FContextFixture::MakePointIO(const UPCGBasePointData* InData, const EIOInit InitOut) const
+	{
+		TSharedPtr<FPointIO> PointIO = MakeShared<FPointIO>(Context->GetOrCreateHandle(), InData);
+		if (!PointIO->InitializeOutput(InitOut)) { return nullptr; }
+		return PointIO;
+	}
+}
+
+#endif
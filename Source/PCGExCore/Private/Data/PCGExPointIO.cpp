@@ -8,11 +8,64 @@
 #include "Core/PCGExContext.h"
 #include "PCGParamData.h"
 #include "Data/PCGExDataTags.h"
+#include "Data/PCGExReadBufferRegistry.h"
+#include "Data/PCGExSpatialIndexRegistry.h"
 #include "Data/PCGPointData.h"
 #include "Helpers/PCGExArrayHelpers.h"
 
 namespace PCGExData
 {
+	namespace StealGuard
+	{
+		struct FGuarded
+		{
+			FRWLock Lock;
+			TMap<const UPCGData*, int32> Counts;
+		};
+
+		static FGuarded& Get()
+		{
+			static FGuarded Guarded;
+			return Guarded;
+		}
+	}
+
+	FStealGuard::FStealGuard(const UPCGData* InData)
+	{
+		Reset(InData);
+	}
+
+	FStealGuard::~FStealGuard()
+	{
+		Reset();
+	}
+
+	void FStealGuard::Reset(const UPCGData* InData)
+	{
+		if (InData == Data) { return; }
+
+		StealGuard::FGuarded& Guarded = StealGuard::Get();
+		FWriteScopeLock WriteLock(Guarded.Lock);
+
+		if (Data)
+		{
+			int32& Count = Guarded.Counts.FindChecked(Data);
+			if (--Count == 0) { Guarded.Counts.Remove(Data); }
+		}
+
+		Data = InData;
+		if (Data) { Guarded.Counts.FindOrAdd(Data)++; }
+	}
+
+	bool FStealGuard::IsGuarded(const UPCGData* InData)
+	{
+		if (!InData) { return false; }
+
+		StealGuard::FGuarded& Guarded = StealGuard::Get();
+		FReadScopeLock ReadLock(Guarded.Lock);
+		return Guarded.Counts.Contains(InData);
+	}
+
 #pragma region FPointIO
 
 	FPointIO::FPointIO(const TWeakPtr<FPCGContextHandle>& InContextHandle)
@@ -76,8 +129,8 @@ namespace PCGExData
 
 		LastInit = InitOut;
 
-		// Destroy previous output if it's our own (not the forwarded input).
-		if (IsValid(Out) && Out != In)
+		// Destroy previous output if it's our own (not the forwarded input, nor reused data).
+		if (IsValid(Out) && Out != In && !bReusedOutput)
 		{
 			SharedContext.Get()->ManagedObjects->Destroy(Out);
 			Out = nullptr;
@@ -85,6 +138,7 @@ namespace PCGExData
 
 		OutKeys.Reset();
 		bMutable = false;
+		bReusedOutput = false;
 
 		// NoInit: read-only, no output will be produced.
 		if (InitOut == EIOInit::NoInit)
@@ -97,7 +151,18 @@ namespace PCGExData
 		if (InitOut == EIOInit::Forward)
 		{
 			check(In);
+
+			// Guarded data is still handed out as-is elsewhere, stealing it would change it for everyone; steal a copy instead
+			if (SharedContext.Get()->bWantsDataStealing && FStealGuard::IsGuarded(In)) { return InitializeOutput(EIOInit::Duplicate); }
+
 			Out = const_cast<UPCGBasePointData*>(In);
+
+			// Stolen data is modified in place, without a new pointer or unique ID to tell cached reads & indexes apart
+			if (SharedContext.Get()->bWantsDataStealing)
+			{
+				FReadBufferRegistry::Get().Invalidate(In);
+				FSpatialIndexRegistry::Get().Invalidate(In);
+			}
 			return true;
 		}
 
@@ -137,9 +202,55 @@ namespace PCGExData
 			Out = SharedContext.Get()->ManagedObjects->DuplicateData<UPCGBasePointData>(In);
 		}
 
+		// Inherit: same points as the input, but nothing is copied up front.
+		// Metadata is parented to the input's, and native properties are too where spatial data inheritance is supported;
+		// only the properties & attributes written afterward get allocated on the output.
+		if (InitOut == EIOInit::Inherit)
+		{
+			check(In)
+
+			UObject* GenericInstance = SharedContext.Get()->ManagedObjects->New<UObject>(GetTransientPackage(), In->GetClass());
+			if (!GenericInstance) { return false; }
+
+			Out = Cast<UPCGBasePointData>(GenericInstance);
+			check(Out)
+
+			InheritInput();
+		}
+
 		return Out != nullptr;
 	}
 
+	void FPointIO::ReuseOutput(UPCGBasePointData* InData)
+	{
+		PCGEX_SHARED_CONTEXT_VOID(ContextHandle)
+
+		if (IsValid(Out) && Out != In && !bReusedOutput) { SharedContext.Get()->ManagedObjects->Destroy(Out); }
+
+		// NoInit so a later InitializeOutput never recycles the reused data in place
+		LastInit = EIOInit::NoInit;
+		OutKeys.Reset();
+		bMutable = false;
+		bReusedOutput = true;
+		Out = InData;
+	}
+
+	void FPointIO::InheritInput()
+	{
+		FPCGInitializeFromDataParams InitializeFromDataParams(In);
+		InitializeFromDataParams.bInheritSpatialData = true;
+		Out->InitializeFromDataWithParams(InitializeFromDataParams);
+
+		const int32 NumPoints = In->GetNumPoints();
+		if (Out->GetNumPoints() == NumPoints) { return; }
+
+		// No spatial data inheritance for this data type, points have to be copied.
+		// Metadata entries still point into the parent metadata, so attribute values remain shared.
+		PCGExPointArrayDataHelpers::InitEmptyNativeProperties(In, Out);
+		Out->SetNumPoints(NumPoints);
+		In->CopyPropertiesTo(Out, 0, 0, NumPoints, In->GetAllocatedProperties());
+	}
+
 	const UPCGBasePointData* FPointIO::GetOutIn(EIOSide& OutSide) const
 	{
 		if (Out)
@@ -504,7 +615,7 @@ namespace PCGExData
 			// Managed: we created this data, context must prevent GC until output is consumed.
 			// Mutable: we own this data and can clean up consumable attributes on it.
 			const EStaging Staging =
-				(Out != In ? EStaging::Managed : EStaging::None) |
+				(Out != In && !bReusedOutput ? EStaging::Managed : EStaging::None) |
 				(bMutable ? EStaging::Mutable : EStaging::None) |
 				(bPinless ? EStaging::Pinless : EStaging::None);
 
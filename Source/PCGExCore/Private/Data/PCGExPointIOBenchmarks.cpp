@@ -0,0 +1,52 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExContext.h"
+#include "Data/PCGExDataBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Point IO output initialization, e.g. pcgex.Bench.Check Filter=Data.*
+namespace PCGExData
+{
+	static PCGExBenchmark::FCheckRegistrar CheckStealGuard(
+		TEXT("Data.StealGuard"), TEXT("Stealing guarded data outputs a copy of it, and unguarded data as-is"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			const Benchmark::FContextFixture Fixture;
+			Fixture.Get()->bWantsDataStealing = true;
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, 64);
+			UPCGPointArrayData* Data = Fixture.MakePointData(Positions);
+
+			{
+				const FStealGuard Guard(Data);
+
+				{
+					// Data stays guarded until its last guard is gone
+					const FStealGuard OtherGuard(Data);
+				}
+
+				Context.Test(FStealGuard::IsGuarded(Data), TEXT("Data lost its guard when another one was released"));
+
+				const TSharedPtr<FPointIO> Stolen = Fixture.MakePointIO(Data, EIOInit::Forward);
+				if (Context.Test(Stolen.IsValid(), TEXT("Guarded data couldn't be stolen")))
+				{
+					const UPCGBasePointData* Out = Stolen->GetOut();
+					Context.Test(Out && Out != Data, TEXT("Guarded data was stolen as-is"));
+					Context.Test(Out && Out->GetNumPoints() == Data->GetNumPoints(), TEXT("Guarded data wasn't stolen as a copy"));
+				}
+			}
+
+			Context.Test(!FStealGuard::IsGuarded(Data), TEXT("Data is still guarded after its guards were released"));
+
+			const TSharedPtr<FPointIO> Stolen = Fixture.MakePointIO(Data, EIOInit::Forward);
+			Context.Test(Stolen && Stolen->GetOut() == Data, TEXT("Unguarded data wasn't stolen as-is"));
+		});
+}
+
+#endif
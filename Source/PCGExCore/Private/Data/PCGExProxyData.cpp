@@ -174,10 +174,13 @@ namespace PCGExData
 		  , WorkingType(InWorkingType == EPCGMetadataTypes::Unknown ? InRealType : InWorkingType)
 		  , WorkingToReal(PCGExTypeOps::FConversionTable::GetConversionFn(InWorkingType == EPCGMetadataTypes::Unknown ? InRealType : InWorkingType, InRealType))
 		  , RealToWorking(PCGExTypeOps::FConversionTable::GetConversionFn(InRealType, InWorkingType == EPCGMetadataTypes::Unknown ? InRealType : InWorkingType))
+		  , WorkingToRealRange(PCGExTypeOps::FConversionTable::GetRangeConversionFn(InWorkingType == EPCGMetadataTypes::Unknown ? InRealType : InWorkingType, InRealType))
+		  , RealToWorkingRange(PCGExTypeOps::FConversionTable::GetRangeConversionFn(InRealType, InWorkingType == EPCGMetadataTypes::Unknown ? InRealType : InWorkingType))
 	{
 		// Get type ops from registry
 		RealOps = PCGExTypeOps::FTypeOpsRegistry::Get(RealType);
 		WorkingOps = PCGExTypeOps::FTypeOpsRegistry::Get(WorkingType);
+		WorkingTypeSize = WorkingOps ? WorkingOps->GetTypeSize() : 0;
 
 		// Cache whether working type needs lifecycle management
 		bWorkingTypeNeedsLifecycle = TypeTraits::NeedsLifecycleManagement(WorkingType);
@@ -199,6 +202,91 @@ namespace PCGExData
 		// Default: no-op. Override in property proxies.
 	}
 
+	void IBufferProxy::GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		uint8* OutBytes = static_cast<uint8*>(OutValues);
+		for (int32 i = 0; i < Count; i++) { GetVoid(Start + i, OutBytes + static_cast<SIZE_T>(i) * WorkingTypeSize); }
+	}
+
+	void IBufferProxy::SetRangeVoid(const int32 Start, const int32 Count, const void* Values) const
+	{
+		const uint8* InBytes = static_cast<const uint8*>(Values);
+		for (int32 i = 0; i < Count; i++) { SetVoid(Start + i, InBytes + static_cast<SIZE_T>(i) * WorkingTypeSize); }
+	}
+
+	namespace ProxyRange
+	{
+		template <typename T_WORKING>
+		void GetAs(const IBufferProxy& Proxy, const int32 Start, const int32 Count, const EPCGMetadataTypes ToType, void* OutValues)
+		{
+			const PCGExTypeOps::ITypeOpsBase* ToOps = PCGExTypeOps::FTypeOpsRegistry::Get(ToType);
+			const PCGExTypeOps::FConvertRangeFn Convert = PCGExTypeOps::FConversionTable::GetRangeConversionFn(Proxy.WorkingType, ToType);
+			if (!ToOps || !Convert) { return; }
+
+			const int32 ToSize = ToOps->GetTypeSize();
+			uint8* OutBytes = static_cast<uint8*>(OutValues);
+
+			constexpr int32 ChunkSize = IBufferProxy::RangeChunkSize;
+			TArray<T_WORKING, TInlineAllocator<ChunkSize>> Chunk;
+			Chunk.SetNum(FMath::Min(ChunkSize, Count));
+
+			for (int32 Offset = 0; Offset < Count; Offset += ChunkSize)
+			{
+				const int32 Num = FMath::Min(ChunkSize, Count - Offset);
+				Proxy.GetRangeVoid(Start + Offset, Num, Chunk.GetData());
+				Convert(Chunk.GetData(), OutBytes + static_cast<SIZE_T>(Offset) * ToSize, Num);
+			}
+		}
+
+		template <typename T_WORKING>
+		void SetFrom(const IBufferProxy& Proxy, const int32 Start, const int32 Count, const EPCGMetadataTypes FromType, const void* Values)
+		{
+			const PCGExTypeOps::ITypeOpsBase* FromOps = PCGExTypeOps::FTypeOpsRegistry::Get(FromType);
+			const PCGExTypeOps::FConvertRangeFn Convert = PCGExTypeOps::FConversionTable::GetRangeConversionFn(FromType, Proxy.WorkingType);
+			if (!FromOps || !Convert) { return; }
+
+			const int32 FromSize = FromOps->GetTypeSize();
+			const uint8* InBytes = static_cast<const uint8*>(Values);
+
+			constexpr int32 ChunkSize = IBufferProxy::RangeChunkSize;
+			TArray<T_WORKING, TInlineAllocator<ChunkSize>> Chunk;
+			Chunk.SetNum(FMath::Min(ChunkSize, Count));
+
+			for (int32 Offset = 0; Offset < Count; Offset += ChunkSize)
+			{
+				const int32 Num = FMath::Min(ChunkSize, Count - Offset);
+				Convert(InBytes + static_cast<SIZE_T>(Offset) * FromSize, Chunk.GetData(), Num);
+				Proxy.SetRangeVoid(Start + Offset, Num, Chunk.GetData());
+			}
+		}
+	}
+
+	void IBufferProxy::GetRangeAs(const int32 Start, const int32 Count, const EPCGMetadataTypes ToType, void* OutValues) const
+	{
+		if (Count <= 0) { return; }
+
+#define PCGEX_TPL(_TYPE, _NAME, ...) case EPCGMetadataTypes::_NAME: ProxyRange::GetAs<_TYPE>(*this, Start, Count, ToType, OutValues); break;
+		switch (WorkingType)
+		{
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_TPL)
+		default: break;
+		}
+#undef PCGEX_TPL
+	}
+
+	void IBufferProxy::SetRangeFrom(const int32 Start, const int32 Count, const EPCGMetadataTypes FromType, const void* Values) const
+	{
+		if (Count <= 0) { return; }
+
+#define PCGEX_TPL(_TYPE, _NAME, ...) case EPCGMetadataTypes::_NAME: ProxyRange::SetFrom<_TYPE>(*this, Start, Count, FromType, Values); break;
+		switch (WorkingType)
+		{
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_TPL)
+		default: break;
+		}
+#undef PCGEX_TPL
+	}
+
 	// Converting read implementations - Now using FScopedTypedValue for safety
 #define PCGEX_CONVERTING_READ_IMPL(_TYPE, _NAME, ...) \
 	_TYPE IBufferProxy::ReadAs##_NAME(const int32 Index) const \
@@ -42,6 +42,24 @@ namespace PCGExData
 		else { *(Buffer->GetData() + Index) = *static_cast<const T_REAL*>(Value); }
 	}
 
+	template <typename T_REAL>
+	void TRawBufferProxy<T_REAL>::GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(Buffer);
+
+		// Identity kernel when types match
+		RealToWorkingRange(Buffer->GetData() + Start, OutValues, Count);
+	}
+
+	template <typename T_REAL>
+	void TRawBufferProxy<T_REAL>::SetRangeVoid(const int32 Start, const int32 Count, const void* Values) const
+	{
+		check(Buffer);
+
+		// Identity kernel when types match
+		WorkingToRealRange(Values, Buffer->GetData() + Start, Count);
+	}
+
 	template <typename T_REAL>
 	PCGExValueHash TRawBufferProxy<T_REAL>::ReadValueHash(const int32 Index) const
 	{
@@ -132,6 +150,74 @@ namespace PCGExData
 		}
 	}
 
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(Buffer);
+		if (Count <= 0) { return; }
+
+		if (!bWantsSubSelection && RealType == WorkingType)
+		{
+			// Same type - read straight into the output
+			Buffer->Read(Start, TArrayView<T_REAL>(static_cast<T_REAL*>(OutValues), Count));
+			return;
+		}
+
+		uint8* OutBytes = static_cast<uint8*>(OutValues);
+
+		TArray<T_REAL, TInlineAllocator<RangeChunkSize>> Chunk;
+		Chunk.SetNum(FMath::Min(RangeChunkSize, Count));
+
+		for (int32 Offset = 0; Offset < Count; Offset += RangeChunkSize)
+		{
+			const int32 Num = FMath::Min(RangeChunkSize, Count - Offset);
+			Buffer->Read(Start + Offset, TArrayView<T_REAL>(Chunk.GetData(), Num));
+
+			void* ChunkOut = OutBytes + static_cast<SIZE_T>(Offset) * WorkingTypeSize;
+			if (bWantsSubSelection) { CachedSubSelection.ApplyGetRange(Chunk.GetData(), ChunkOut, Num); }
+			else { RealToWorkingRange(Chunk.GetData(), ChunkOut, Num); }
+		}
+	}
+
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::SetRangeVoid(const int32 Start, const int32 Count, const void* Values) const
+	{
+		check(Buffer);
+		if (Count <= 0) { return; }
+
+		if (!bWantsSubSelection && RealType == WorkingType)
+		{
+			// Same type - write straight from the input
+			Buffer->SetValues(Start, TArrayView<const T_REAL>(static_cast<const T_REAL*>(Values), Count));
+			return;
+		}
+
+		const uint8* InBytes = static_cast<const uint8*>(Values);
+
+		TArray<T_REAL, TInlineAllocator<RangeChunkSize>> Chunk;
+		Chunk.SetNum(FMath::Min(RangeChunkSize, Count));
+
+		for (int32 Offset = 0; Offset < Count; Offset += RangeChunkSize)
+		{
+			const int32 Num = FMath::Min(RangeChunkSize, Count - Offset);
+			const TArrayView<T_REAL> ChunkView(Chunk.GetData(), Num);
+			const uint8* ChunkIn = InBytes + static_cast<SIZE_T>(Offset) * WorkingTypeSize;
+
+			if (bWantsSubSelection)
+			{
+				// Sub-selection only writes part of each value, so the chunk starts from the current output values
+				Buffer->GetValues(Start + Offset, ChunkView);
+				for (int32 i = 0; i < Num; i++) { CachedSubSelection.ApplySet(&Chunk[i], ChunkIn + static_cast<SIZE_T>(i) * WorkingTypeSize); }
+			}
+			else
+			{
+				WorkingToRealRange(ChunkIn, Chunk.GetData(), Num);
+			}
+
+			Buffer->SetValues(Start + Offset, TArrayView<const T_REAL>(Chunk.GetData(), Num));
+		}
+	}
+
 	template <typename T_REAL>
 	TSharedPtr<IBuffer> TAttributeBufferProxy<T_REAL>::GetBuffer() const
 	{
@@ -281,6 +367,117 @@ namespace PCGExData
 		}
 	}
 
+	template <typename T, typename FGetFn>
+	void FPointPropertyProxy::GetPropertyRange(const int32 Start, const int32 Count, void* OutValues, FGetFn&& GetFn) const
+	{
+		if (!bWantsSubSelection && PropertyRealType == WorkingType)
+		{
+			T* TypedOut = static_cast<T*>(OutValues);
+			for (int32 i = 0; i < Count; i++) { TypedOut[i] = GetFn(Start + i); }
+			return;
+		}
+
+		uint8* OutBytes = static_cast<uint8*>(OutValues);
+
+		TArray<T, TInlineAllocator<RangeChunkSize>> Chunk;
+		Chunk.SetNum(FMath::Min(RangeChunkSize, Count));
+
+		for (int32 Offset = 0; Offset < Count; Offset += RangeChunkSize)
+		{
+			const int32 Num = FMath::Min(RangeChunkSize, Count - Offset);
+			for (int32 i = 0; i < Num; i++) { Chunk[i] = GetFn(Start + Offset + i); }
+
+			void* ChunkOut = OutBytes + static_cast<SIZE_T>(Offset) * WorkingTypeSize;
+			if (bWantsSubSelection) { CachedSubSelection.ApplyGetRange(Chunk.GetData(), ChunkOut, Num); }
+			else { RealToWorkingRange(Chunk.GetData(), ChunkOut, Num); }
+		}
+	}
+
+	void FPointPropertyProxy::GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(Data);
+		if (Count <= 0) { return; }
+
+		// Resolve the property & its value range once for the whole range
+		switch (Property)
+		{
+		case EPCGPointProperties::Density:
+			{
+				const TConstPCGValueRange<float> Densities = Data->GetConstDensityValueRange();
+				GetPropertyRange<float>(Start, Count, OutValues, [&](const int32 i) { return Densities[i]; });
+			}
+			break;
+		case EPCGPointProperties::BoundsMin:
+			{
+				const TConstPCGValueRange<FVector> BoundsMin = Data->GetConstBoundsMinValueRange();
+				GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return BoundsMin[i]; });
+			}
+			break;
+		case EPCGPointProperties::BoundsMax:
+			{
+				const TConstPCGValueRange<FVector> BoundsMax = Data->GetConstBoundsMaxValueRange();
+				GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return BoundsMax[i]; });
+			}
+			break;
+		case EPCGPointProperties::Extents:
+			GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return Data->GetExtents(i); });
+			break;
+		case EPCGPointProperties::Color:
+			{
+				const TConstPCGValueRange<FVector4> Colors = Data->GetConstColorValueRange();
+				GetPropertyRange<FVector4>(Start, Count, OutValues, [&](const int32 i) { return Colors[i]; });
+			}
+			break;
+		case EPCGPointProperties::Position:
+			{
+				const TConstPCGValueRange<FTransform> Transforms = Data->GetConstTransformValueRange();
+				GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return Transforms[i].GetLocation(); });
+			}
+			break;
+		case EPCGPointProperties::Rotation:
+			{
+				const TConstPCGValueRange<FTransform> Transforms = Data->GetConstTransformValueRange();
+				GetPropertyRange<FQuat>(Start, Count, OutValues, [&](const int32 i) { return Transforms[i].GetRotation(); });
+			}
+			break;
+		case EPCGPointProperties::Scale:
+			{
+				const TConstPCGValueRange<FTransform> Transforms = Data->GetConstTransformValueRange();
+				GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return Transforms[i].GetScale3D(); });
+			}
+			break;
+		case EPCGPointProperties::Transform:
+			{
+				const TConstPCGValueRange<FTransform> Transforms = Data->GetConstTransformValueRange();
+				GetPropertyRange<FTransform>(Start, Count, OutValues, [&](const int32 i) { return Transforms[i]; });
+			}
+			break;
+		case EPCGPointProperties::Steepness:
+			{
+				const TConstPCGValueRange<float> Steepness = Data->GetConstSteepnessValueRange();
+				GetPropertyRange<float>(Start, Count, OutValues, [&](const int32 i) { return Steepness[i]; });
+			}
+			break;
+		case EPCGPointProperties::LocalCenter:
+			GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return Data->GetLocalCenter(i); });
+			break;
+		case EPCGPointProperties::LocalSize:
+			GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return Data->GetLocalSize(i); });
+			break;
+		case EPCGPointProperties::ScaledLocalSize:
+			GetPropertyRange<FVector>(Start, Count, OutValues, [&](const int32 i) { return Data->GetScaledLocalSize(i); });
+			break;
+		case EPCGPointProperties::Seed:
+			{
+				const TConstPCGValueRange<int32> Seeds = Data->GetConstSeedValueRange();
+				GetPropertyRange<int32>(Start, Count, OutValues, [&](const int32 i) { return Seeds[i]; });
+			}
+			break;
+		default: IBufferProxy::GetRangeVoid(Start, Count, OutValues);
+			break;
+		}
+	}
+
 	void FPointPropertyProxy::InitForRole(EProxyRole InRole)
 	{
 		if (InRole == EProxyRole::Write && Data)
@@ -401,6 +598,18 @@ namespace PCGExData
 		}
 	}
 
+	template <typename T_CONST>
+	void TConstantProxy<T_CONST>::GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		if (Count <= 0) { return; }
+
+		// Resolve the constant once, then replicate it
+		GetVoid(Start, OutValues);
+
+		uint8* OutBytes = static_cast<uint8*>(OutValues);
+		for (int32 i = 1; i < Count; i++) { WorkingOps->Copy(OutValues, OutBytes + static_cast<SIZE_T>(i) * WorkingTypeSize); }
+	}
+
 	template <typename T_CONST>
 	bool TConstantProxy<T_CONST>::Validate(const FProxyDescriptor& InDescriptor) const
 	{
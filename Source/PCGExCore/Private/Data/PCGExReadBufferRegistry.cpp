@@ -0,0 +1,84 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/PCGExReadBufferRegistry.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExDiagnostics.h"
+#include "Data/PCGData.h"
+
+namespace PCGExData
+{
+	FReadBufferKey::FReadBufferKey(const UPCGData* InData, const EPCGMetadataTypes InType, const FString& InSelector)
+		: Data(InData), DataUID(InData ? InData->GetUniqueID() : 0), Type(InType), Selector(InSelector)
+	{
+	}
+
+	FReadBufferRegistry& FReadBufferRegistry::Get()
+	{
+		static FReadBufferRegistry Instance;
+		return Instance;
+	}
+
+	bool FReadBufferRegistry::IsEnabled()
+	{
+		return PCGEX_CORE_SETTINGS.bShareReadBuffers;
+	}
+
+	void FReadBufferRegistry::OnHit(const int64 InBytes) const
+	{
+		++NumHits;
+		SharedBytes += InBytes;
+	}
+
+	void FReadBufferRegistry::TrimUnsafe()
+	{
+		for (auto It = Entries.CreateIterator(); It; ++It) { if (!It->Value->IsValid()) { It.RemoveCurrent(); } }
+	}
+
+	void FReadBufferRegistry::Invalidate(const UPCGData* InData)
+	{
+		if (!InData) { return; }
+
+		FWriteScopeLock WriteLock(Lock);
+		for (auto It = Entries.CreateIterator(); It; ++It) { if (It->Key.Data == InData) { It.RemoveCurrent(); } }
+	}
+
+	void FReadBufferRegistry::Trim()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		TrimUnsafe();
+	}
+
+	FReadBufferStats FReadBufferRegistry::GetStats() const
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		FReadBufferStats Stats;
+		Stats.NumRegistered = NumRegistered;
+		Stats.NumHits = NumHits;
+		Stats.SharedBytes = SharedBytes;
+
+		for (const TPair<FReadBufferKey, TSharedPtr<IEntry>>& Pair : Entries)
+		{
+			if (!Pair.Value->IsValid()) { continue; }
+			Stats.NumEntries++;
+			Stats.LiveBytes += Pair.Value->NumBytes;
+		}
+
+		return Stats;
+	}
+
+	FString FReadBufferRegistry::GetStatsSummary() const
+	{
+		const FReadBufferStats Stats = GetStats();
+		return FString::Printf(
+			TEXT("%d live entries (~%.2f MB), %lld registered, %lld hits, ~%.2f MB of reads avoided."),
+			Stats.NumEntries, static_cast<double>(Stats.LiveBytes) / (1024.0 * 1024.0), Stats.NumRegistered, Stats.NumHits, static_cast<double>(Stats.SharedBytes) / (1024.0 * 1024.0));
+	}
+
+	static PCGExDiagnostics::FRegistrar DiagnosticsReadBuffers(
+		TEXT("ReadBuffers"), TEXT("Read buffers shared across facades of the same data; flushing drops expired entries"),
+		[]() { return FReadBufferRegistry::Get().GetStatsSummary(); },
+		[]() { FReadBufferRegistry::Get().Trim(); });
+}
@@ -0,0 +1,184 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBVH.h"
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExContext.h"
+#include "Core/PCGExMTCommon.h"
+#include "Data/PCGBasePointData.h"
+#include "Data/PCGExDataBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGExSpatialIndexRegistry.h"
+#include "Data/PCGPointArrayData.h"
+#include "Math/OBB/PCGExOBBCollection.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Utils/PCGPointOctree.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Engine point octree vs. shared point-center BVH, meant to be run at large scales, e.g. pcgex.Bench.Run Filter=Spatial.PointIndex.* Scales=1000000+10000000
+namespace PCGExData
+{
+	namespace PointIndexBenchmark
+	{
+		constexpr int32 NumQueries = 100000;
+		constexpr double Extent = 10000;
+		constexpr double TargetHitsPerQuery = 32;
+
+		static TStrongObjectPtr<UPCGPointArrayData> MakeData(const int32 InNum)
+		{
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, InNum, true, Extent);
+
+			TStrongObjectPtr<UPCGPointArrayData> Data(NewObject<UPCGPointArrayData>());
+			Data->SetNumPoints(InNum);
+			Data->AllocateProperties(EPCGPointNativeProperties::Transform);
+
+			TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+			for (int32 i = 0; i < InNum; i++) { Transforms[i].SetLocation(Positions[i]); }
+
+			return Data;
+		}
+
+		static double GetQueryExtent(const int32 InNum)
+		{
+			return 0.5 * Extent * FMath::Pow(TargetHitsPerQuery / FMath::Max(1, InNum), 1.0 / 3.0);
+		}
+
+		// Points moved well outside of their original extent, so an index built before the move can't find them
+		const FVector MoveOffset = FVector(Extent * 10, 0, 0);
+
+		static TSharedPtr<const PCGExMath::OBB::FCollection> GetOrientedBounds(const TSharedPtr<FPointIO>& InIO)
+		{
+			return FSpatialIndexRegistry::Get().FindOrBuild<PCGExMath::OBB::FCollection>(
+				InIO->GetIn(), ESpatialIndexKind::OrientedBounds, static_cast<uint32>(EPCGExPointBoundsSource::ScaledBounds), [&](int64& OutMemoryBytes)
+				{
+					TSharedPtr<PCGExMath::OBB::FCollection> Collection = MakeShared<PCGExMath::OBB::FCollection>();
+					Collection->BuildFrom(InIO, EPCGExPointBoundsSource::ScaledBounds);
+					return Collection;
+				});
+		}
+	}
+
+	static PCGExBenchmark::FCheckRegistrar CheckIndexInvalidation(
+		TEXT("Spatial.IndexRegistry.Invalidation"), TEXT("Shared octrees, BVHs & OBB collections over data stolen & moved in place are rebuilt instead of reused"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			if (!FSpatialIndexRegistry::IsEnabled()) { return; }
+
+			FSpatialIndexRegistry& Registry = FSpatialIndexRegistry::Get();
+			const PCGExData::Benchmark::FContextFixture Fixture;
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, 256, true, PointIndexBenchmark::Extent);
+			UPCGPointArrayData* Data = Fixture.MakePointData(Positions);
+
+			const TSharedPtr<FPointIO> Reader = Fixture.MakePointIO(Data);
+			if (!Context.Test(Reader.IsValid(), TEXT("Point IO setup failed"))) { return; }
+
+			const TSharedPtr<const PCGExOctree::FItemOctree> Octree = Registry.GetPointOctree(Data, ESpatialIndexKind::PointCenter);
+			const TSharedPtr<const PCGExBVH::FItemBVH> BVH = Registry.GetPointBVH(Data);
+			const TSharedPtr<const PCGExMath::OBB::FCollection> OBBs = PointIndexBenchmark::GetOrientedBounds(Reader);
+
+			Context.Test(Registry.GetPointOctree(Data, ESpatialIndexKind::PointCenter) == Octree, TEXT("Octree wasn't shared before the data changed"));
+			Context.Test(Registry.GetPointBVH(Data) == BVH, TEXT("BVH wasn't shared before the data changed"));
+			Context.Test(PointIndexBenchmark::GetOrientedBounds(Reader) == OBBs, TEXT("OBB collection wasn't shared before the data changed"));
+
+			// Stealing forwards the input as the output, then moves its points in place; pointer & unique ID stay the same
+			Fixture.Get()->bWantsDataStealing = true;
+			const TSharedPtr<FPointIO> Stolen = Fixture.MakePointIO(Data, EIOInit::Forward);
+			if (!Context.Test(Stolen && Stolen->GetOut() == Data, TEXT("Data wasn't forwarded"))) { return; }
+
+			TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+			for (FTransform& Transform : Transforms) { Transform.AddToTranslation(PointIndexBenchmark::MoveOffset); }
+
+			const FVector Moved = Positions[0] + PointIndexBenchmark::MoveOffset;
+			const FBoxCenterAndExtent Query(Moved, FVector(1));
+			auto Finds = [&](const PCGExOctree::FItemOctree& InOctree)
+			{
+				bool bFound = false;
+				InOctree.FindElementsWithBoundsTest(Query, [&](const PCGExOctree::FItem& Item) { bFound |= Item.Index == 0; });
+				return bFound;
+			};
+
+			const TSharedPtr<const PCGExOctree::FItemOctree> Rebuilt = Registry.GetPointOctree(Data, ESpatialIndexKind::PointCenter);
+			if (Context.Test(Rebuilt && Rebuilt != Octree, TEXT("Octree over stolen data was reused")))
+			{
+				Context.Test(Finds(*Rebuilt) && !Finds(*Octree), TEXT("Rebuilt octree doesn't reflect the moved points"));
+			}
+
+			auto FindsInBVH = [&](const PCGExBVH::FItemBVH& InBVH)
+			{
+				bool bFound = false;
+				InBVH.FindElementsWithBoundsTest(Query, [&](const int32 Index) { bFound |= Index == 0; });
+				return bFound;
+			};
+
+			const TSharedPtr<const PCGExBVH::FItemBVH> RebuiltBVH = Registry.GetPointBVH(Data);
+			if (Context.Test(RebuiltBVH && RebuiltBVH != BVH, TEXT("BVH over stolen data was reused")))
+			{
+				Context.Test(FindsInBVH(*RebuiltBVH) && !FindsInBVH(*BVH), TEXT("Rebuilt BVH doesn't reflect the moved points"));
+			}
+
+			const TSharedPtr<const PCGExMath::OBB::FCollection> RebuiltOBBs = PointIndexBenchmark::GetOrientedBounds(Reader);
+			if (Context.Test(RebuiltOBBs && RebuiltOBBs != OBBs, TEXT("OBB collection over stolen data was reused")))
+			{
+				Context.Test(RebuiltOBBs->GetWorldBounds().IsInsideOrOn(Moved) && !OBBs->GetWorldBounds().IsInsideOrOn(Moved), TEXT("Rebuilt OBB collection doesn't reflect the moved points"));
+			}
+		});
+
+	// The reference is the same single-threaded build UPCGBasePointData::GetPointOctree runs on first access
+	static PCGExBenchmark::FPairRegistrar BenchPointIndexBuild(
+		TEXT("Spatial.PointIndex.Build"), TEXT("Builds a point index over N points"),
+		{TEXT("EngineOctree"), TEXT("engine point octree")}, {TEXT("BVH"), TEXT("shared point-center BVH")},
+		[](const int32 Scale, const bool bBVH) -> PCGExBenchmark::FKernel
+		{
+			TStrongObjectPtr<UPCGPointArrayData> Data = PointIndexBenchmark::MakeData(Scale);
+
+			if (bBVH) { return [Data]() { const TSharedPtr<PCGExBVH::FItemBVH> BVH = BuildPointCenterBVH(Data.Get()); }; }
+
+			return [Data]()
+			{
+				const FBox Bounds = Data->GetBounds();
+				PCGPointOctree::FPointOctree Octree(Bounds.GetCenter(), Bounds.GetExtent().Length());
+				for (int32 i = 0; i < Data->GetNumPoints(); i++) { Octree.AddElement(PCGPointOctree::FPointRef(Data.Get(), i)); }
+			};
+		});
+
+	static PCGExBenchmark::FPairRegistrar BenchPointIndexQuery(
+		TEXT("Spatial.PointIndex.Query"), TEXT("100k parallel box queries (~32 hits each) against a point index of N points"),
+		{TEXT("EngineOctree"), TEXT("engine point octree")}, {TEXT("BVH"), TEXT("shared point-center BVH")},
+		[](const int32 Scale, const bool bBVH) -> PCGExBenchmark::FKernel
+		{
+			TStrongObjectPtr<UPCGPointArrayData> Data = PointIndexBenchmark::MakeData(Scale);
+
+			TArray<FVector> Queries;
+			PCGExBenchmark::MakePositions(Queries, PointIndexBenchmark::NumQueries, true, PointIndexBenchmark::Extent, 7);
+
+			if (bBVH)
+			{
+				return [BVH = BuildPointCenterBVH(Data.Get()), Queries = MoveTemp(Queries), QueryExtent = PointIndexBenchmark::GetQueryExtent(Scale)]()
+				{
+					PCGEX_PARALLEL_FOR(
+						Queries.Num(),
+						int32 Hits = 0;
+						BVH->FindElementsWithBoundsTest(FBoxCenterAndExtent(Queries[i], FVector(QueryExtent)), [&](const int32 Index) { Hits++; });
+					)
+				};
+			}
+
+			(void)Data->GetPointOctree();
+
+			return [Data, Queries = MoveTemp(Queries), QueryExtent = PointIndexBenchmark::GetQueryExtent(Scale)]()
+			{
+				const PCGPointOctree::FPointOctree& Octree = Data->GetPointOctree();
+				PCGEX_PARALLEL_FOR(
+					Queries.Num(),
+					int32 Hits = 0;
+					Octree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Queries[i], FVector(QueryExtent)), [&](const PCGPointOctree::FPointRef& PointRef) { Hits++; });
+				)
+			};
+		});
+}
+
+#endif
@@ -0,0 +1,222 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/PCGExSpatialIndexRegistry.h"
+
+#include "PCGExBVH.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExDiagnostics.h"
+#include "Data/PCGBasePointData.h"
+#include "Data/PCGExPointElements.h"
+#include "Math/PCGExMathBounds.h"
+#include "Utils/PCGValueRange.h"
+
+namespace PCGExData
+{
+	FSpatialIndexKey::FSpatialIndexKey(const UPCGData* InData, const ESpatialIndexKind InKind, const uint32 InVariant)
+		: Data(InData), DataUID(InData ? InData->GetUniqueID() : 0), Kind(InKind), Variant(InVariant)
+	{
+	}
+
+	TSharedPtr<PCGExBVH::FItemBVH> BuildPointCenterBVH(const UPCGBasePointData* InData)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExData::BuildPointCenterBVH);
+
+		const TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
+
+		TSharedPtr<PCGExBVH::FItemBVH> BVH = MakeShared<PCGExBVH::FItemBVH>();
+		BVH->Build(
+			InData->GetNumPoints(), [&](const int32 Index, FBox& OutBounds)
+			{
+				const FVector Location = Transforms[Index].GetLocation();
+				OutBounds = FBox(Location, Location);
+				return true;
+			});
+
+		return BVH;
+	}
+
+	FSpatialIndexRegistry& FSpatialIndexRegistry::Get()
+	{
+		static FSpatialIndexRegistry Instance;
+		return Instance;
+	}
+
+	bool FSpatialIndexRegistry::IsEnabled()
+	{
+		return PCGEX_CORE_SETTINGS.bShareSpatialIndexes;
+	}
+
+	TSharedPtr<const PCGExOctree::FItemOctree> FSpatialIndexRegistry::GetPointOctree(const UPCGBasePointData* InData, const ESpatialIndexKind InKind, const uint8 InBoundsSource)
+	{
+		check(InKind == ESpatialIndexKind::PointCenter || InKind == ESpatialIndexKind::PointBounds)
+
+		const uint32 Variant = InKind == ESpatialIndexKind::PointBounds ? InBoundsSource : 0;
+
+		return FindOrBuild<PCGExOctree::FItemOctree>(
+			InData, InKind, Variant, [&](int64& OutMemoryBytes)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(FSpatialIndexRegistry::BuildPointOctree);
+
+				const int32 NumPoints = InData->GetNumPoints();
+				const EPCGExPointBoundsSource BoundsSource = InKind == ESpatialIndexKind::PointCenter ? EPCGExPointBoundsSource::Center : static_cast<EPCGExPointBoundsSource>(InBoundsSource);
+				const FBox Bounds = PCGExMath::GetBounds(InData, BoundsSource);
+
+				TSharedPtr<PCGExOctree::FItemOctree> Octree = MakeShared<PCGExOctree::FItemOctree>(Bounds.GetCenter(), (Bounds.GetExtent() + FVector(10)).Length());
+
+				if (InKind == ESpatialIndexKind::PointCenter)
+				{
+					const TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
+					for (int i = 0; i < NumPoints; i++) { Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(Transforms[i].GetLocation(), FVector::ZeroVector, 0))); }
+				}
+				else
+				{
+					for (int i = 0; i < NumPoints; i++)
+					{
+						const FConstPoint Point(InData, i);
+						Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(PCGExMath::GetLocalBounds(Point, BoundsSource).TransformBy(Point.GetTransform()))));
+					}
+				}
+
+				// Items plus roughly one node per leaf worth of overhead
+				OutMemoryBytes = static_cast<int64>(NumPoints) * sizeof(PCGExOctree::FItem) * 3 / 2;
+
+				return Octree;
+			});
+	}
+
+	TSharedPtr<const PCGExBVH::FItemBVH> FSpatialIndexRegistry::GetPointBVH(const UPCGBasePointData* InData)
+	{
+		return FindOrBuild<PCGExBVH::FItemBVH>(
+			InData, ESpatialIndexKind::PointCenterBVH, 0, [&](int64& OutMemoryBytes)
+			{
+				TSharedPtr<PCGExBVH::FItemBVH> BVH = BuildPointCenterBVH(InData);
+				OutMemoryBytes = static_cast<int64>(BVH->GetAllocatedSize());
+				return BVH;
+			});
+	}
+
+	void FSpatialIndexRegistry::OnHit(IEntry& InEntry) const
+	{
+		InEntry.LastAccess = ++AccessCounter;
+		++NumHits;
+		SavedMicroseconds += static_cast<int64>(InEntry.BuildSeconds * 1e6);
+	}
+
+	TSharedPtr<FSpatialIndexRegistry::IEntry> FSpatialIndexRegistry::Register(const FSpatialIndexKey& InKey, const TSharedPtr<IEntry>& InEntry)
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		NumBuilds++;
+		BuildSeconds += InEntry->BuildSeconds;
+
+		if (const TSharedPtr<IEntry>* Existing = Entries.Find(InKey); Existing && (*Existing)->Data.IsValid())
+		{
+			// Someone else built the same index in the meantime; keep theirs so every consumer shares a single instance
+			NumRedundantBuilds++;
+			(*Existing)->LastAccess = ++AccessCounter;
+			return *Existing;
+		}
+
+		InEntry->LastAccess = ++AccessCounter;
+		if (const TSharedPtr<IEntry>* Stale = Entries.Find(InKey)) { MemoryBytes -= (*Stale)->MemoryBytes; }
+
+		Entries.Add(InKey, InEntry);
+		MemoryBytes += InEntry->MemoryBytes;
+
+		TrimUnsafe(static_cast<int64>(PCGEX_CORE_SETTINGS.SpatialIndexCacheBudgetMB) * 1024 * 1024);
+
+		return InEntry;
+	}
+
+	void FSpatialIndexRegistry::TrimUnsafe(const int64 InBudget)
+	{
+		// Stale entries first; their data is gone so they can never be hit again
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Value->Data.IsValid()) { continue; }
+			MemoryBytes -= It->Value->MemoryBytes;
+			NumEvictions++;
+			It.RemoveCurrent();
+		}
+
+		if (MemoryBytes <= InBudget) { return; }
+
+		// Then least recently used entries no one currently holds
+		TArray<TPair<uint64, FSpatialIndexKey>> Candidates;
+		Candidates.Reserve(Entries.Num());
+		for (const TPair<FSpatialIndexKey, TSharedPtr<IEntry>>& Pair : Entries)
+		{
+			if (Pair.Value->IsInUse()) { continue; }
+			Candidates.Emplace(Pair.Value->LastAccess.load(), Pair.Key);
+		}
+
+		Candidates.Sort([](const TPair<uint64, FSpatialIndexKey>& A, const TPair<uint64, FSpatialIndexKey>& B) { return A.Key < B.Key; });
+
+		for (const TPair<uint64, FSpatialIndexKey>& Candidate : Candidates)
+		{
+			if (MemoryBytes <= InBudget) { break; }
+
+			TSharedPtr<IEntry> Removed;
+			if (!Entries.RemoveAndCopyValue(Candidate.Value, Removed)) { continue; }
+
+			MemoryBytes -= Removed->MemoryBytes;
+			NumEvictions++;
+		}
+	}
+
+	void FSpatialIndexRegistry::Invalidate(const UPCGData* InData)
+	{
+		if (!InData) { return; }
+
+		FWriteScopeLock WriteLock(Lock);
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Key.Data != InData) { continue; }
+			MemoryBytes -= It->Value->MemoryBytes;
+			NumEvictions++;
+			It.RemoveCurrent();
+		}
+	}
+
+	void FSpatialIndexRegistry::Trim()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		TrimUnsafe(static_cast<int64>(PCGEX_CORE_SETTINGS.SpatialIndexCacheBudgetMB) * 1024 * 1024);
+	}
+
+	void FSpatialIndexRegistry::Flush()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		TrimUnsafe(0);
+	}
+
+	FSpatialIndexStats FSpatialIndexRegistry::GetStats() const
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		FSpatialIndexStats Stats;
+		Stats.NumEntries = Entries.Num();
+		Stats.NumBuilds = NumBuilds;
+		Stats.NumHits = NumHits;
+		Stats.NumRedundantBuilds = NumRedundantBuilds;
+		Stats.NumEvictions = NumEvictions;
+		Stats.BuildSeconds = BuildSeconds;
+		Stats.SavedSeconds = static_cast<double>(SavedMicroseconds.load()) * 1e-6;
+		Stats.MemoryBytes = MemoryBytes;
+		return Stats;
+	}
+
+	FString FSpatialIndexRegistry::GetStatsSummary() const
+	{
+		const FSpatialIndexStats Stats = GetStats();
+		return FString::Printf(
+			TEXT("%d entries (~%.2f MB), %lld builds (%lld redundant), %lld hits, %lld evictions. %.3fs spent building, ~%.3fs saved."),
+			Stats.NumEntries, static_cast<double>(Stats.MemoryBytes) / (1024.0 * 1024.0), Stats.NumBuilds, Stats.NumRedundantBuilds, Stats.NumHits, Stats.NumEvictions, Stats.BuildSeconds, Stats.SavedSeconds);
+	}
+
+	static PCGExDiagnostics::FRegistrar DiagnosticsSpatialIndex(
+		TEXT("SpatialIndex"), TEXT("Spatial indexes shared across nodes; flushing drops every index not currently in use"),
+		[]() { return FSpatialIndexRegistry::Get().GetStatsSummary(); },
+		[]() { FSpatialIndexRegistry::Get().Flush(); });
+}
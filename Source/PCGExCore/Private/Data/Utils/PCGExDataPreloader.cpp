@@ -7,6 +7,7 @@
 
 #include "PCGExSettingsCacheBody.h"
 #include "Core/PCGExContext.h"
+#include "Core/PCGExProfiler.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGBasePointData.h"
 #include "Types/PCGExTypeTraits.h"
@@ -191,6 +192,7 @@ template PCGEXCORE_API void FFacadePreloader::Register<_TYPE>(FPCGExContext* InC
 	bool FFacadePreloader::StartLoading(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const TSharedPtr<PCGExMT::IAsyncHandleGroup>& InParentHandle)
 	{
 		ContextHandle = TaskManager->GetContext()->GetOrCreateHandle();
+		LoadingStartTime = FPlatformTime::Seconds();
 
 		TSharedPtr<FFacade> SourceFacade = GetDataFacade();
 		if (!SourceFacade) { return false; }
@@ -255,6 +257,11 @@ template PCGEXCORE_API void FFacadePreloader::Register<_TYPE>(FPCGExContext* InC
 		PCGEX_SHARED_CONTEXT_VOID(ContextHandle)
 		bLoaded = true;
 
+		if (const TSharedPtr<PCGExProfiler::FNodeProfile>& Profile = SharedContext.Get()->Profile; Profile && !IsEmpty())
+		{
+			Profile->AddEvent(PCGExProfiler::EEventKind::Preload, FName("Preload"), LoadingStartTime, FPlatformTime::Seconds() - LoadingStartTime, Num());
+		}
+
 		if (TSharedPtr<FFacade> InternalFacade = GetDataFacade()) { InternalFacade->MarkCurrentBuffersReadAsComplete(); }
 		if (OnCompleteCallback) { OnCompleteCallback(); }
 	}
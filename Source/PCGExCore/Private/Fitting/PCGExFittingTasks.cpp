@@ -7,49 +7,47 @@
 #include "Data/PCGExPointIO.h"
 #include "Fitting/PCGExFitting.h"
 
-namespace PCGExFitting::Tasks
+namespace PCGExFitting
 {
-	FTransformPointIO::FTransformPointIO(const int32 InTaskIndex, const TSharedPtr<PCGExData::FPointIO>& InPointIO, const TSharedPtr<PCGExData::FPointIO>& InToBeTransformedIO, FPCGExTransformDetails* InTransformDetails, bool bAllocate)
-		: FPCGExIndexedTask(InTaskIndex), PointIO(InPointIO), ToBeTransformedIO(InToBeTransformedIO), TransformDetails(InTransformDetails)
-	{
-	}
-
-	void FTransformPointIO::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
+	FBox GetFittingBounds(const UPCGBasePointData* InData, const FPCGExTransformDetails& InTransformDetails)
 	{
-		UPCGBasePointData* OutPointData = ToBeTransformedIO->GetOut();
-		TPCGValueRange<FTransform> OutTransforms = OutPointData->GetTransformValueRange();
-		FTransform TargetTransform = FTransform::Identity;
-
+		const TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
 		FBox PointBounds = FBox(ForceInit);
-		FVector Translation = FVector::ZeroVector;
 
-		if (!TransformDetails->bIgnoreBounds)
+		if (!InTransformDetails.bIgnoreBounds)
 		{
-			for (int i = 0; i < OutTransforms.Num(); i++) { PointBounds += OutPointData->GetLocalBounds(i).TransformBy(OutTransforms[i]); }
+			for (int i = 0; i < Transforms.Num(); i++) { PointBounds += InData->GetLocalBounds(i).TransformBy(Transforms[i]); }
 		}
 		else
 		{
-			for (const FTransform& Pt : OutTransforms) { PointBounds += Pt.GetLocation(); }
+			for (const FTransform& Pt : Transforms) { PointBounds += Pt.GetLocation(); }
 		}
 
-		PointBounds = PointBounds.ExpandBy(0.1); // Avoid NaN
-		TransformDetails->ComputeTransform(TaskIndex, TargetTransform, PointBounds, Translation);
+		return PointBounds.ExpandBy(0.1); // Avoid NaN
+	}
+
+	void TransformRange(const FPCGExTransformDetails& InTransformDetails, const int32 TargetIndex, FBox InBounds, TPCGValueRange<FTransform>& Transforms, const int32 Start, const int32 Count)
+	{
+		FTransform TargetTransform = FTransform::Identity;
+		FVector Translation = FVector::ZeroVector;
+
+		InTransformDetails.ComputeTransform(TargetIndex, TargetTransform, InBounds, Translation);
 
-		const int Strategy = (TransformDetails->bInheritRotation ? 2 : 0)
-			+ (TransformDetails->bInheritScale ? 1 : 0);
+		const int Strategy = (InTransformDetails.bInheritRotation ? 2 : 0)
+			+ (InTransformDetails.bInheritScale ? 1 : 0);
 
 		switch (Strategy)
 		{
 		case 3: // Inherit rotation + inherit scale
 			PCGEX_PARALLEL_FOR(
-				OutTransforms.Num(),
-				OutTransforms[i] *= TargetTransform;
+				Count,
+				Transforms[Start + i] *= TargetTransform;
 			)
 			break;
 		case 2: // Inherit rotation only
 			PCGEX_PARALLEL_FOR(
-				OutTransforms.Num(),
-				FTransform& Transform = OutTransforms[i];
+				Count,
+				FTransform& Transform = Transforms[Start + i];
 				FQuat OriginalRot = Transform.GetRotation();
 				Transform *= TargetTransform;
 				Transform.SetRotation(OriginalRot);
@@ -57,8 +55,8 @@ namespace PCGExFitting::Tasks
 			break;
 		case 1: // Inherit scale only
 			PCGEX_PARALLEL_FOR(
-				OutTransforms.Num(),
-				FTransform& Transform = OutTransforms[i];
+				Count,
+				FTransform& Transform = Transforms[Start + i];
 				FVector OriginalScale = Transform.GetScale3D();
 				Transform *= TargetTransform;
 				Transform.SetScale3D(OriginalScale);
@@ -66,11 +64,39 @@ namespace PCGExFitting::Tasks
 			break;
 		default:
 			PCGEX_PARALLEL_FOR(
-				OutTransforms.Num(),
-				FTransform& Transform = OutTransforms[i];
+				Count,
+				FTransform& Transform = Transforms[Start + i];
 				Transform.SetLocation(TargetTransform.TransformPosition(Transform.GetLocation()));
 			)
 			break;
 		}
 	}
 }
+
+namespace PCGExFitting::Tasks
+{
+	FTransformPointIO::FTransformPointIO(const int32 InTaskIndex, const TSharedPtr<PCGExData::FPointIO>& InPointIO, const TSharedPtr<PCGExData::FPointIO>& InToBeTransformedIO, FPCGExTransformDetails* InTransformDetails, const bool bInAllocate)
+		: FPCGExIndexedTask(InTaskIndex), PointIO(InPointIO), ToBeTransformedIO(InToBeTransformedIO), TransformDetails(InTransformDetails), bAllocate(bInAllocate)
+	{
+	}
+
+	void FTransformPointIO::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
+	{
+		UPCGBasePointData* OutPointData = ToBeTransformedIO->GetOut();
+
+		if (bAllocate)
+		{
+			// Output only inherits its transforms from the input so far; give it its own copy
+			const TConstPCGValueRange<FTransform> InTransforms = ToBeTransformedIO->GetIn()->GetConstTransformValueRange();
+			OutPointData->AllocateProperties(EPCGPointNativeProperties::Transform);
+			TPCGValueRange<FTransform> OwnTransforms = OutPointData->GetTransformValueRange(false);
+			PCGEX_PARALLEL_FOR(
+				OwnTransforms.Num(),
+				OwnTransforms[i] = InTransforms[i];
+			)
+		}
+
+		TPCGValueRange<FTransform> OutTransforms = OutPointData->GetTransformValueRange();
+		TransformRange(*TransformDetails, TaskIndex, GetFittingBounds(OutPointData, *TransformDetails), OutTransforms, 0, OutTransforms.Num());
+	}
+}
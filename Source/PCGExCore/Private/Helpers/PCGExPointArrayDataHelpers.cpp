@@ -6,7 +6,9 @@
 #include "CoreMinimal.h"
 
 #include "PCGContext.h"
+#include "PCGExLog.h"
 #include "Data/PCGPointArrayData.h"
+#include "Metadata/PCGMetadata.h"
 #include "Core/PCGExMTCommon.h"
 #include "Helpers/PCGExArrayHelpers.h"
 
@@ -172,4 +174,46 @@ template PCGEXCORE_API void ReorderValueRange<_TYPE>(TPCGValueRange<_TYPE>& InRa
 
 		return OutFlags;
 	}
+
+	SIZE_T GetNativePropertiesSize(const EPCGPointNativeProperties Properties)
+	{
+		SIZE_T Size = 0;
+
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::Transform)) { Size += sizeof(FTransform); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::Density)) { Size += sizeof(float); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::BoundsMin)) { Size += sizeof(FVector); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::BoundsMax)) { Size += sizeof(FVector); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::Color)) { Size += sizeof(FVector4); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::Steepness)) { Size += sizeof(float); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::Seed)) { Size += sizeof(int32); }
+		if (EnumHasAnyFlags(Properties, EPCGPointNativeProperties::MetadataEntry)) { Size += sizeof(int64); }
+
+		return Size;
+	}
+
+	void FCopyStats::Start()
+	{
+		StartTime = FPlatformTime::Seconds();
+	}
+
+	void FCopyStats::Add(const UPCGBasePointData* InSource, const EPCGPointNativeProperties Properties, const bool bCopiesAttributes, const int32 NumInstances)
+	{
+		const int64 NumCopiedPoints = static_cast<int64>(InSource->GetNumPoints()) * NumInstances;
+
+		FPlatformAtomics::InterlockedAdd(&NumCopies, NumInstances);
+		FPlatformAtomics::InterlockedAdd(&NumPoints, NumCopiedPoints);
+		FPlatformAtomics::InterlockedAdd(&PropertiesBytes, NumCopiedPoints * static_cast<int64>(GetNativePropertiesSize(Properties)));
+
+		if (bCopiesAttributes && InSource->Metadata)
+		{
+			FPlatformAtomics::InterlockedAdd(&NumAttributeValues, NumCopiedPoints * InSource->Metadata->GetAttributeCount());
+		}
+	}
+
+	void FCopyStats::Log(const TCHAR* InLabel) const
+	{
+		UE_LOG(
+			LogPCGEx, Log, TEXT("%s : %d copies, %lld points, %.2f MB of point properties allocated, %lld attribute values copied, %.3fs."),
+			InLabel, NumCopies, NumPoints, static_cast<double>(PropertiesBytes) / (1024.0 * 1024.0), NumAttributeValues, FPlatformTime::Seconds() - StartTime);
+	}
 }
@@ -10,11 +10,114 @@
 #include "Math/Geo/PCGExPrimtives.h"
 #include "ThirdParty/Delaunator/include/delaunator.hpp"
 #include "Async/ParallelFor.h"
+#include "Core/PCGExMTCommon.h"
 #include "Math/Geo/PCGExGeo.h"
 #include "Math/PCGExProjectionDetails.h"
 
 namespace PCGExMath::Geo
 {
+	void SortUniqueEdges(TArray<uint64>& Edges, const int32 NumVertices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay::SortUniqueEdges);
+
+		const int32 NumEdges = Edges.Num();
+		const int32 NumBuckets = FMath::Clamp(NumEdges / 4096, 1, 512);
+
+		if (NumBuckets == 1 || NumVertices <= 0)
+		{
+			Edges.Sort();
+			int32 WriteIndex = 0;
+			for (int32 i = 0; i < NumEdges; i++) { if (!WriteIndex || Edges[WriteIndex - 1] != Edges[i]) { Edges[WriteIndex++] = Edges[i]; } }
+			Edges.SetNum(WriteIndex);
+			return;
+		}
+
+		// H64U keeps the highest vertex in the upper bits, so buckets over that vertex are already in order relative to each other
+		const uint64 Span = static_cast<uint64>(NumVertices);
+		auto GetBucket = [&](const uint64 Edge) { return static_cast<int32>(static_cast<uint64>(PCGEx::H64A(Edge)) * NumBuckets / Span); };
+
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumBuckets + 1);
+		for (const uint64 Edge : Edges) { Offsets[GetBucket(Edge) + 1]++; }
+		for (int32 b = 0; b < NumBuckets; b++) { Offsets[b + 1] += Offsets[b]; }
+
+		TArray<uint64> Sorted;
+		Sorted.SetNumUninitialized(NumEdges);
+
+		{
+			TArray<int32> Cursors(Offsets.GetData(), NumBuckets);
+			for (const uint64 Edge : Edges) { Sorted[Cursors[GetBucket(Edge)]++] = Edge; }
+		}
+
+		Edges.Empty();
+
+		TArray<int32> NumUnique;
+		NumUnique.SetNumUninitialized(NumBuckets);
+
+		PCGEX_PARALLEL_FOR(
+			NumBuckets,
+			uint64* Bucket = Sorted.GetData() + Offsets[i];
+			const int32 Num = Offsets[i + 1] - Offsets[i];
+
+			Algo::Sort(TArrayView<uint64>(Bucket, Num));
+
+			int32 WriteIndex = 0;
+			for (int32 r = 0; r < Num; r++) { if (!WriteIndex || Bucket[WriteIndex - 1] != Bucket[r]) { Bucket[WriteIndex++] = Bucket[r]; } }
+			NumUnique[i] = WriteIndex;
+		)
+
+		int32 WriteIndex = 0;
+		for (int32 b = 0; b < NumBuckets; b++)
+		{
+			if (WriteIndex != Offsets[b]) { FMemory::Memmove(Sorted.GetData() + WriteIndex, Sorted.GetData() + Offsets[b], NumUnique[b] * sizeof(uint64)); }
+			WriteIndex += NumUnique[b];
+		}
+
+		Sorted.SetNum(WriteIndex);
+		Edges = MoveTemp(Sorted);
+	}
+
+	namespace
+	{
+		// Spreads the lower 21 bits of Value so there are two zero bits between each of them
+		FORCEINLINE uint64 SplitBy3(const uint32 Value)
+		{
+			uint64 X = Value & 0x1FFFFF;
+			X = (X | X << 32) & 0x1F00000000FFFFull;
+			X = (X | X << 16) & 0x1F0000FF0000FFull;
+			X = (X | X << 8) & 0x100F00F00F00F00Full;
+			X = (X | X << 4) & 0x10C30C30C30C30C3ull;
+			X = (X | X << 2) & 0x1249249249249249ull;
+			return X;
+		}
+
+		// Keeps the edges of a sorted unique array that are not in another sorted unique array
+		void RemoveSortedEdges(TArray<uint64>& Edges, const TArray<uint64>& Removed)
+		{
+			int32 WriteIndex = 0;
+			int32 r = 0;
+			for (int32 i = 0; i < Edges.Num(); i++)
+			{
+				const uint64 Edge = Edges[i];
+				while (r < Removed.Num() && Removed[r] < Edge) { r++; }
+				if (r < Removed.Num() && Removed[r] == Edge) { continue; }
+				Edges[WriteIndex++] = Edge;
+			}
+			Edges.SetNum(WriteIndex);
+		}
+
+		template <typename T>
+		void GatherLongestEdges(const TArray<T>& Sites, const TArrayView<FVector>& Positions, TArray<uint64>& OutEdges)
+		{
+			OutEdges.SetNumUninitialized(Sites.Num());
+			PCGEX_PARALLEL_FOR(
+				Sites.Num(),
+				GetLongestEdge(Positions, Sites[i].Vtx, OutEdges[i]);
+			)
+			SortUniqueEdges(OutEdges, Positions.Num());
+		}
+	}
+
 	FDelaunaySite2::FDelaunaySite2(const UE::Geometry::FIndex3i& InVtx, const UE::Geometry::FIndex3i& InAdjacency, const int32 InId)
 		: Id(InId)
 	{
@@ -23,6 +126,8 @@ namespace PCGExMath::Geo
 			Vtx[i] = InVtx[i];
 			Neighbors[i] = InAdjacency[i];
 		}
+
+		UpdateOnHull();
 	}
 
 	FDelaunaySite2::FDelaunaySite2(const int32 A, const int32 B, const int32 C, const int32 InId)
@@ -41,22 +146,10 @@ namespace PCGExMath::Geo
 
 	uint64 FDelaunaySite2::GetSharedEdge(const FDelaunaySite2* Other) const
 	{
+		for (int i = 0; i < 3; i++) { if (Neighbors[i] == Other->Id) { return GetEdge(i); } }
 		return Other->ContainsEdge(PCGEx::H64U(Vtx[0], Vtx[1])) ? PCGEx::H64U(Vtx[0], Vtx[1]) : Other->ContainsEdge(PCGEx::H64U(Vtx[0], Vtx[2])) ? PCGEx::H64U(Vtx[0], Vtx[2]) : PCGEx::H64U(Vtx[1], Vtx[2]);
 	}
 
-	void FDelaunaySite2::PushAdjacency(const int32 SiteId)
-	{
-		for (int32& i : Neighbors)
-		{
-			if (i == -1)
-			{
-				i = SiteId;
-				bOnHull = i != 2;
-				break;
-			}
-		}
-	}
-
 	TDelaunay2::~TDelaunay2()
 	{
 		Clear();
@@ -75,63 +168,43 @@ namespace PCGExMath::Geo
 	{
 		Clear();
 
-		if (const int32 NumPositions = Positions.Num(); Positions.IsEmpty() || NumPositions <= 2) { return false; }
-
-		TMap<uint64, int32> EdgeMap;
+		const int32 NumPositions = Positions.Num();
+		if (Positions.IsEmpty() || NumPositions <= 2) { return false; }
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunator::Triangulate);
 
-			IsValid = true;
-			// Build adjacency by matching shared edges between triangles.
-			// First occurrence of an edge records the owning site in EdgeMap.
-			// Second occurrence means two triangles share that edge, so they become neighbors.
-			// Unmatched edges (still in EdgeMap after all sites) are convex hull edges.
-			auto PushEdge = [&](FDelaunaySite2& Site, const uint64 Edge)
-			{
-				bool bIsAlreadySet = false;
-				DelaunayEdges.Add(Edge, &bIsAlreadySet);
-				if (bIsAlreadySet)
-				{
-					if (int32 Idx = -1; EdgeMap.RemoveAndCopyValue(Edge, Idx))
-					{
-						FDelaunaySite2& OtherSite = Sites[Idx];
-						OtherSite.PushAdjacency(Site.Id);
-						Site.PushAdjacency(OtherSite.Id);
-					}
-				}
-				else
-				{
-					EdgeMap.Add(Edge, Site.Id);
-				}
-			};
-
+			// Both triangulators provide per-edge adjacency natively, so sites are filled directly from their flat outputs
 			if (PCGEX_CORE_SETTINGS.bUseDelaunator)
 			{
-				std::vector<double> OutVector(Positions.Num() * 2);
+				std::vector<double> OutVector(NumPositions * 2);
 				ProjectionDetails.Project(Positions, OutVector);
 
 				delaunator::Delaunator d(OutVector);
 
 				if (d.runtime_error) { return false; }
 
-				const int32 NumTriangles = d.triangles.size();
+				const int32 NumSites = static_cast<int32>(d.triangles.size() / 3);
 
-				if (!NumTriangles) { return false; }
+				if (!NumSites) { return false; }
 
-				const int32 NumSites = NumTriangles / 3;
-				DelaunayEdges.Reserve(NumSites);
-				Sites.Reserve(NumSites);
-				EdgeMap.Reserve(NumSites);
+				Sites.SetNumUninitialized(NumSites);
 
-				int32 s = 0;
-				for (std::size_t i = 0; i < NumTriangles; i += 3)
-				{
-					FDelaunaySite2& Site = Sites.Emplace_GetRef(d.triangles[i], d.triangles[i + 1], d.triangles[i + 2], s++);
-					PushEdge(Site, Site.AB());
-					PushEdge(Site, Site.BC());
-					PushEdge(Site, Site.AC());
-				}
+				PCGEX_PARALLEL_FOR(
+					NumSites,
+					const std::size_t e = static_cast<std::size_t>(i) * 3;
+					FDelaunaySite2& Site = Sites[i];
+					Site = FDelaunaySite2(d.triangles[e], d.triangles[e + 1], d.triangles[e + 2], i);
+
+					// Half-edge e + k goes from Vtx[k] to Vtx[k + 1]; its twin lives in triangle twin / 3
+					for (int k = 0; k < 3; k++)
+					{
+						const std::size_t Twin = d.halfedges[e + k];
+						Site.Neighbors[k] = Twin == delaunator::INVALID_INDEX ? -1 : static_cast<int32>(Twin / 3);
+					}
+
+					Site.UpdateOnHull();
+				)
 			}
 			else
 			{
@@ -141,81 +214,77 @@ namespace PCGExMath::Geo
 				UE::Geometry::FDelaunay2 Delaunay2;
 				if (!Delaunay2.Triangulate(OutVector)) { return false; }
 
-				TArray<UE::Geometry::FIndex3i> Triangles = Delaunay2.GetTriangles();
-				const int32 NumTriangles = Triangles.Num();
+				TArray<UE::Geometry::FIndex3i> Triangles;
+				TArray<UE::Geometry::FIndex3i> Adjacency;
+				Delaunay2.GetTrianglesAndAdjacency(Triangles, Adjacency);
 
-				if (!NumTriangles) { return false; }
+				const int32 NumSites = Triangles.Num();
 
-				const int32 NumSites = NumTriangles / 3;
-				DelaunayEdges.Reserve(NumSites);
-				Sites.Reserve(NumSites);
-				EdgeMap.Reserve(NumSites);
+				if (!NumSites) { return false; }
 
-				int32 s = 0;
-				for (const UE::Geometry::FIndex3i& T : Triangles)
-				{
-					FDelaunaySite2& Site = Sites.Emplace_GetRef(T.A, T.B, T.C, s++);
-					PushEdge(Site, Site.AB());
-					PushEdge(Site, Site.BC());
-					PushEdge(Site, Site.AC());
-				}
+				Sites.SetNumUninitialized(NumSites);
+				PCGEX_PARALLEL_FOR(
+					NumSites,
+					Sites[i] = FDelaunaySite2(Triangles[i], Adjacency[i], i);
+				)
 			}
+		}
 
-			DelaunayEdges.Shrink();
-			DelaunayHull.Reserve(DelaunayEdges.Num() / 3);
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::FindEdges);
+
+			// Every half-edge, then sort-unique so shared edges collapse into one
+			const int32 NumSites = Sites.Num();
+			DelaunayEdges.SetNumUninitialized(NumSites * 3);
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				const FDelaunaySite2& Site = Sites[i];
+				for (int k = 0; k < 3; k++) { DelaunayEdges[i * 3 + k] = Site.GetEdge(k); }
+			)
+
+			SortUniqueEdges(DelaunayEdges, NumPositions);
 		}
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::FillHullSites);
 
+			DelaunayHull.Init(false, NumPositions);
 			for (const FDelaunaySite2& Site : Sites)
 			{
-				if (Site.bOnHull)
-				{
-					// Push edges that are still waiting to be matched
-					if (EdgeMap.Contains(Site.AB()))
-					{
-						DelaunayHull.Add(Site.Vtx[0]);
-						DelaunayHull.Add(Site.Vtx[1]);
-					}
+				if (!Site.bOnHull) { continue; }
 
-					if (EdgeMap.Contains(Site.BC()))
-					{
-						DelaunayHull.Add(Site.Vtx[1]);
-						DelaunayHull.Add(Site.Vtx[2]);
-					}
-
-					if (EdgeMap.Contains(Site.AC()))
-					{
-						DelaunayHull.Add(Site.Vtx[0]);
-						DelaunayHull.Add(Site.Vtx[2]);
-					}
+				// Edges without a twin are hull edges
+				for (int k = 0; k < 3; k++)
+				{
+					if (Site.Neighbors[k] != -1) { continue; }
+					DelaunayHull[Site.Vtx[k]] = true;
+					DelaunayHull[Site.Vtx[(k + 1) % 3]] = true;
 				}
 			}
 		}
 
+		IsValid = true;
 		return IsValid;
 	}
 
+	SIZE_T TDelaunay2::GetAllocatedSize() const
+	{
+		return Sites.GetAllocatedSize() + DelaunayEdges.GetAllocatedSize() + DelaunayHull.GetAllocatedSize();
+	}
+
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-		}
+		TArray<uint64> LongestEdges;
+		GatherLongestEdges(Sites, Positions, LongestEdges);
+		RemoveSortedEdges(DelaunayEdges, LongestEdges);
 	}
 
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
-		}
+		TArray<uint64> SortedLongestEdges;
+		GatherLongestEdges(Sites, Positions, SortedLongestEdges);
+		RemoveSortedEdges(DelaunayEdges, SortedLongestEdges);
+		LongestEdges.Append(SortedLongestEdges);
 	}
 
 	void TDelaunay2::GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
@@ -238,14 +307,13 @@ namespace PCGExMath::Geo
 			OutMerged.Add(NextIndex);
 			VisitedSites[NextIndex] = true;
 
-			const FDelaunaySite2* Site = (Sites.GetData() + NextIndex);
+			const FDelaunaySite2& Site = Sites[NextIndex];
 
 			for (int i = 0; i < 3; i++)
 			{
-				const int32 OtherIndex = Site->Neighbors[i];
+				const int32 OtherIndex = Site.Neighbors[i];
 				if (OtherIndex == -1 || VisitedSites[OtherIndex]) { continue; }
-				const FDelaunaySite2* NeighborSite = Sites.GetData() + OtherIndex;
-				if (const uint64 SharedEdge = Site->GetSharedEdge(NeighborSite); EdgeConnectors.Contains(SharedEdge))
+				if (const uint64 SharedEdge = Site.GetEdge(i); EdgeConnectors.Contains(SharedEdge))
 				{
 					OutUEdges.Add(SharedEdge);
 					Stack.Add(OtherIndex);
@@ -262,17 +330,12 @@ namespace PCGExMath::Geo
 		for (int i = 0; i < 4; i++)
 		{
 			Vtx[i] = InVtx[i];
-			Faces[i] = 0;
+			Neighbors[i] = -1;
 		}
 
 		Algo::Sort(Vtx);
 	}
 
-	void FDelaunaySite3::ComputeFaces()
-	{
-		for (int i = 0; i < 4; i++) { Faces[i] = PCGEx::UH3(Vtx[MTX[i][0]], Vtx[MTX[i][1]], Vtx[MTX[i][2]]); }
-	}
-
 	TDelaunay3::~TDelaunay3()
 	{
 		Clear();
@@ -287,24 +350,210 @@ namespace PCGExMath::Geo
 		IsValid = false;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	void TDelaunay3::ComputeInsertionOrder(const TArrayView<FVector>& Positions)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::ComputeInsertionOrder);
+
+		const int32 NumPositions = Positions.Num();
+
+		FBox Bounds(ForceInit);
+		for (const FVector& P : Positions) { Bounds += P; }
+
+		// Rounds double in size, the last one holding about half the points; each round gets 5 bits above a 54bit Morton code
+		const int32 NumRounds = FMath::Clamp(FMath::FloorLog2(static_cast<uint32>(FMath::Max(1, NumPositions / 64))) + 1, 1, 31);
+		constexpr double GridMax = static_cast<double>((1 << 18) - 1);
+		const FVector Size = Bounds.GetSize();
+		const FVector Scale(
+			Size.X > 0 ? GridMax / Size.X : 0,
+			Size.Y > 0 ? GridMax / Size.Y : 0,
+			Size.Z > 0 ? GridMax / Size.Z : 0);
+
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(NumPositions);
+
+		PCGEX_PARALLEL_FOR(
+			NumPositions,
+			// Deterministic coin flips, so the same input always yields the same triangulation
+			const uint32 Coins = FCrc::MemCrc32(&i, sizeof(int32)) | (1u << 31);
+			const uint64 Round = static_cast<uint64>(NumRounds - 1 - FMath::Min(static_cast<int32>(FMath::CountTrailingZeros(Coins)), NumRounds - 1));
+			const FVector Cell = (Positions[i] - Bounds.Min) * Scale;
+			Keys[i] = Round << 54 |
+				SplitBy3(static_cast<uint32>(FMath::Clamp(Cell.X, 0.0, GridMax))) |
+				SplitBy3(static_cast<uint32>(FMath::Clamp(Cell.Y, 0.0, GridMax))) << 1 |
+				SplitBy3(static_cast<uint32>(FMath::Clamp(Cell.Z, 0.0, GridMax))) << 2;
+		)
+
+		InsertionOrder.SetNumUninitialized(NumPositions);
+		for (int32 i = 0; i < NumPositions; i++) { InsertionOrder[i] = i; }
+		InsertionOrder.Sort([&](const int32 A, const int32 B) { return Keys[A] == Keys[B] ? A < B : Keys[A] < Keys[B]; });
+	}
+
+	bool TDelaunay3::Process(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull, const bool bComputeEdges)
+	{
+		Clear();
+
+		const int32 NumPositions = Positions.Num();
+		if (Positions.IsEmpty() || NumPositions <= 3) { return false; }
+
+		TArray<FIntVector4> Tetrahedra;
+
+		if (bSpatialInsertionOrder)
+		{
+			if (InsertionOrder.Num() != NumPositions) { ComputeInsertionOrder(Positions); }
+
+			TArray<FVector> OrderedPositions;
+			OrderedPositions.SetNumUninitialized(NumPositions);
+			PCGEX_PARALLEL_FOR(
+				NumPositions,
+				OrderedPositions[i] = Positions[InsertionOrder[i]];
+			)
+
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::Triangulate);
+
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+			if (!Tetrahedralization.Triangulate(OrderedPositions)) { return false; }
+
+			Tetrahedra = Tetrahedralization.GetTetrahedra();
+		}
+		else
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::Triangulate);
+
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+			if (!Tetrahedralization.Triangulate(Positions)) { return false; }
+
+			Tetrahedra = Tetrahedralization.GetTetrahedra();
 		}
+
+		const int32 NumSites = Tetrahedra.Num();
+		if (!NumSites) { return false; }
+
+		Sites.SetNumUninitialized(NumSites);
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::FindEdges);
+
+			if (bComputeEdges) { DelaunayEdges.SetNumUninitialized(NumSites * 6); }
+
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				FDelaunaySite3& Site = Sites[i];
+
+				if (bSpatialInsertionOrder)
+				{
+					const FIntVector4& T = Tetrahedra[i];
+					Site = FDelaunaySite3(FIntVector4(InsertionOrder[T.X], InsertionOrder[T.Y], InsertionOrder[T.Z], InsertionOrder[T.W]), i);
+				}
+				else
+				{
+					Site = FDelaunaySite3(Tetrahedra[i], i);
+				}
+
+				if (!bComputeEdges) { return; }
+
+				uint64* Edges = DelaunayEdges.GetData() + i * 6;
+				for (int a = 0; a < 4; a++) { for (int b = a + 1; b < 4; b++) { *Edges++ = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]); } }
+			)
+
+			Tetrahedra.Empty();
+			if (bComputeEdges) { SortUniqueEdges(DelaunayEdges, NumPositions); }
+		}
+
+		if (bComputeAdjacency || bComputeHull) { ComputeAdjacency(NumPositions); }
+
+		if (bComputeHull)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::FillHull);
+
+			DelaunayHull.Init(false, NumPositions);
+			for (FDelaunaySite3& Site : Sites)
+			{
+				for (int f = 0; f < 4; f++)
+				{
+					if (Site.Neighbors[f] != -1) { continue; }
+					for (int fi = 0; fi < 3; fi++) { DelaunayHull[Site.Vtx[MTX[f][fi]]] = true; }
+					Site.bOnHull = true;
+				}
+			}
+		}
+
+		IsValid = true;
+		return IsValid;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	void TDelaunay3::ComputeAdjacency(const int32 NumPositions)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::ComputeAdjacency);
+
+		// Faces are bucketed by their lowest vertex, then matched on their two other vertices.
+		// Site vertices are sorted, so MTX faces come out sorted as well; an interior face shows up exactly twice.
+		const int32 NumSites = Sites.Num();
+		const int32 NumFaces = NumSites * 4;
+
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumPositions + 1);
+		for (const FDelaunaySite3& Site : Sites) { for (int f = 0; f < 4; f++) { Offsets[Site.Vtx[MTX[f][0]] + 1]++; } }
+		for (int32 v = 0; v < NumPositions; v++) { Offsets[v + 1] += Offsets[v]; }
+
+		TArray<int32> Faces; // Site * 4 + Face
+		Faces.SetNumUninitialized(NumFaces);
+
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
+			TArray<int32> Cursors(Offsets.GetData(), NumPositions);
+			for (int32 s = 0; s < NumSites; s++)
+			{
+				const FDelaunaySite3& Site = Sites[s];
+				for (int f = 0; f < 4; f++) { Faces[Cursors[Site.Vtx[MTX[f][0]]]++] = s * 4 + f; }
+			}
 		}
+
+		auto GetFaceKey = [&](const int32 Face)
+		{
+			const FDelaunaySite3& Site = Sites[Face >> 2];
+			const int32 f = Face & 3;
+			return PCGEx::H64(Site.Vtx[MTX[f][1]], Site.Vtx[MTX[f][2]]);
+		};
+
+		PCGEX_PARALLEL_FOR(
+			NumPositions,
+			const int32 Start = Offsets[i];
+			const int32 Num = Offsets[i + 1] - Start;
+			if (Num < 2) { return; }
+
+			TArrayView<int32> Bucket(Faces.GetData() + Start, Num);
+			Algo::Sort(Bucket, [&](const int32 A, const int32 B) { return GetFaceKey(A) < GetFaceKey(B); });
+
+			for (int32 j = 1; j < Num; j++)
+			{
+				const int32 A = Bucket[j - 1];
+				const int32 B = Bucket[j];
+				if (GetFaceKey(A) != GetFaceKey(B)) { continue; }
+
+				// Each face slot belongs to a single bucket, so these writes never overlap
+				Sites[A >> 2].Neighbors[A & 3] = B >> 2;
+				Sites[B >> 2].Neighbors[B & 3] = A >> 2;
+				j++;
+			}
+		)
+	}
+
+	SIZE_T TDelaunay3::GetAllocatedSize() const
+	{
+		return Sites.GetAllocatedSize() + DelaunayEdges.GetAllocatedSize() + DelaunayHull.GetAllocatedSize();
+	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	{
+		TArray<uint64> LongestEdges;
+		GatherLongestEdges(Sites, Positions, LongestEdges);
+		RemoveSortedEdges(DelaunayEdges, LongestEdges);
+	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	{
+		TArray<uint64> SortedLongestEdges;
+		GatherLongestEdges(Sites, Positions, SortedLongestEdges);
+		RemoveSortedEdges(DelaunayEdges, SortedLongestEdges);
+		LongestEdges.Append(SortedLongestEdges);
 	}
 }
@@ -0,0 +1,172 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "Math/Geo/PCGExDelaunay.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Triangulation throughput, e.g. pcgex.Bench.Run Filter=Geo.Delaunay* Scales=100000+1000000
+// and insertion order equivalence, e.g. pcgex.Bench.Check Filter=Geo.Delaunay*
+namespace PCGExMath::Geo
+{
+	namespace DelaunayBenchmark
+	{
+		template <bool bSpatialInsertionOrder, bool bCachedOrder>
+		static PCGExBenchmark::FKernel MakeDelaunay3Kernel(const int32 Scale)
+		{
+			if (Scale < 4) { return nullptr; }
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, Scale);
+
+			TSharedPtr<TDelaunay3> Delaunay = MakeShared<TDelaunay3>();
+			Delaunay->bSpatialInsertionOrder = bSpatialInsertionOrder;
+
+			if constexpr (bCachedOrder)
+			{
+				// Computes the insertion order once, then times a small jitter as between two relaxation iterations, with the order reused
+				Delaunay->Process(Positions, true, true);
+
+				FRandomStream Random(42);
+				for (FVector& P : Positions) { P += Random.VRand() * Random.FRandRange(0, 1); }
+			}
+
+			return [Positions = MoveTemp(Positions), Delaunay]() mutable
+			{
+				if constexpr (!bCachedOrder) { Delaunay->InsertionOrder.Reset(); }
+				Delaunay->Process(Positions, true, true);
+			};
+		}
+
+		// Site indices sorted by vertices; sites keep their vertices sorted, so equal tetrahedra line up
+		static void SortSites(const TDelaunay3& InDelaunay, TArray<int32>& OutOrder)
+		{
+			const TArray<FDelaunaySite3>& Sites = InDelaunay.Sites;
+			OutOrder.SetNumUninitialized(Sites.Num());
+			for (int32 i = 0; i < Sites.Num(); i++) { OutOrder[i] = i; }
+			OutOrder.Sort(
+				[&](const int32 A, const int32 B)
+				{
+					for (int k = 0; k < 4; k++) { if (Sites[A].Vtx[k] != Sites[B].Vtx[k]) { return Sites[A].Vtx[k] < Sites[B].Vtx[k]; } }
+					return false;
+				});
+		}
+
+		// Same tetrahedra, same neighbors across every face, same edges & hull
+		static void CompareTetrahedralizations(PCGExBenchmark::FCheckContext& Context, const TCHAR* Label, const TDelaunay3& Expected, const TDelaunay3& Actual)
+		{
+			if (!Context.Test(Expected.Sites.Num() == Actual.Sites.Num(), TEXT("%s : %d tetrahedra, %d expected"), Label, Actual.Sites.Num(), Expected.Sites.Num())) { return; }
+
+			TArray<int32> ExpectedOrder;
+			TArray<int32> ActualOrder;
+			SortSites(Expected, ExpectedOrder);
+			SortSites(Actual, ActualOrder);
+
+			TArray<int32> ActualToExpected;
+			ActualToExpected.SetNumUninitialized(Actual.Sites.Num());
+
+			for (int32 i = 0; i < ExpectedOrder.Num(); i++)
+			{
+				const FDelaunaySite3& E = Expected.Sites[ExpectedOrder[i]];
+				const FDelaunaySite3& A = Actual.Sites[ActualOrder[i]];
+				if (!Context.Test(FMemory::Memcmp(E.Vtx, A.Vtx, sizeof(E.Vtx)) == 0, TEXT("%s : tetrahedron (%d, %d, %d, %d) has no match"), Label, A.Vtx[0], A.Vtx[1], A.Vtx[2], A.Vtx[3])) { return; }
+				ActualToExpected[ActualOrder[i]] = ExpectedOrder[i];
+			}
+
+			for (const FDelaunaySite3& A : Actual.Sites)
+			{
+				const FDelaunaySite3& E = Expected.Sites[ActualToExpected[A.Id]];
+				for (int f = 0; f < 4; f++)
+				{
+					const int32 Neighbor = A.Neighbors[f] == -1 ? -1 : ActualToExpected[A.Neighbors[f]];
+					Context.Test(Neighbor == E.Neighbors[f], TEXT("%s : tetrahedron (%d, %d, %d, %d) face %d neighbor differs"), Label, A.Vtx[0], A.Vtx[1], A.Vtx[2], A.Vtx[3], f);
+				}
+			}
+
+			Context.Test(Expected.DelaunayEdges == Actual.DelaunayEdges, TEXT("%s : edges differ"), Label);
+			Context.Test(Expected.DelaunayHull == Actual.DelaunayHull, TEXT("%s : hull differs"), Label);
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchDelaunay2(
+		TEXT("Geo.Delaunay2D"), TEXT("2D Delaunay triangulation of N points"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			if (Scale < 3) { return nullptr; }
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, Scale, false);
+
+			return [Positions = MoveTemp(Positions)]() mutable
+			{
+				const FPCGExGeo2DProjectionDetails ProjectionDetails;
+				TDelaunay2 Delaunay;
+				Delaunay.Process(Positions, ProjectionDetails);
+			};
+		});
+
+	static PCGExBenchmark::FRegistrar BenchDelaunay3(TEXT("Geo.Delaunay3D"), TEXT("3D Delaunay tetrahedralization of N points, BRIO insertion order"), &DelaunayBenchmark::MakeDelaunay3Kernel<true, false>);
+	static PCGExBenchmark::FRegistrar BenchDelaunay3InputOrder(TEXT("Geo.Delaunay3D.InputOrder"), TEXT("3D Delaunay tetrahedralization of N points, input insertion order"), &DelaunayBenchmark::MakeDelaunay3Kernel<false, false>);
+	static PCGExBenchmark::FRegistrar BenchDelaunay3CachedOrder(TEXT("Geo.Delaunay3D.CachedOrder"), TEXT("3D Delaunay tetrahedralization of N slightly moved points, reusing the previous insertion order"), &DelaunayBenchmark::MakeDelaunay3Kernel<true, true>);
+
+	static PCGExBenchmark::FCheckRegistrar CheckDelaunay3InsertionOrder(
+		TEXT("Geo.Delaunay3D.InsertionOrder"), TEXT("BRIO & cached insertion orders yield the tetrahedra, adjacency, edges and hull of input order insertion"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			for (const int32 Seed : {1337, 42})
+			{
+				TArray<FVector> Positions;
+				PCGExBenchmark::MakePositions(Positions, 4096, true, 10000, Seed);
+
+				TDelaunay3 Reference;
+				Reference.bSpatialInsertionOrder = false;
+				if (!Context.Test(Reference.Process(Positions, true, true), TEXT("Seed %d : input order tetrahedralization failed"), Seed)) { continue; }
+
+				// Adjacency as the hashed face lookup used to find it, against the bucketed one; values are Site * 4 + Face
+				TMap<FIntVector, int32> OpenFaces;
+				OpenFaces.Reserve(Reference.Sites.Num() * 2);
+				for (const FDelaunaySite3& Site : Reference.Sites)
+				{
+					for (int f = 0; f < 4; f++)
+					{
+						const FIntVector Face(Site.Vtx[MTX[f][0]], Site.Vtx[MTX[f][1]], Site.Vtx[MTX[f][2]]);
+						int32 Other = -1;
+						if (!OpenFaces.RemoveAndCopyValue(Face, Other))
+						{
+							OpenFaces.Add(Face, Site.Id * 4 + f);
+							continue;
+						}
+
+						const int32 OtherSite = Other >> 2;
+						Context.Test(Site.Neighbors[f] == OtherSite && Reference.Sites[OtherSite].Neighbors[Other & 3] == Site.Id, TEXT("Seed %d : sites %d & %d share a face but aren't neighbors"), Seed, OtherSite, Site.Id);
+					}
+				}
+
+				for (const TPair<FIntVector, int32>& Face : OpenFaces)
+				{
+					Context.Test(Reference.Sites[Face.Value >> 2].Neighbors[Face.Value & 3] == -1, TEXT("Seed %d : site %d has a neighbor across a hull face"), Seed, Face.Value >> 2);
+				}
+
+				TDelaunay3 Spatial;
+				if (Context.Test(Spatial.Process(Positions, true, true), TEXT("Seed %d : BRIO tetrahedralization failed"), Seed))
+				{
+					DelaunayBenchmark::CompareTetrahedralizations(Context, *FString::Printf(TEXT("Seed %d, BRIO"), Seed), Reference, Spatial);
+				}
+
+				// Slightly moved points, as between two relaxation iterations; the spatial one keeps its insertion order
+				FRandomStream Random(Seed);
+				for (FVector& P : Positions) { P += Random.VRand() * Random.FRandRange(0, 1); }
+
+				const TArray<int32> PreviousOrder = Spatial.InsertionOrder;
+				if (!Context.Test(Reference.Process(Positions, true, true), TEXT("Seed %d : input order tetrahedralization of moved points failed"), Seed)) { continue; }
+				if (!Context.Test(Spatial.Process(Positions, true, true), TEXT("Seed %d : cached order tetrahedralization failed"), Seed)) { continue; }
+
+				Context.Test(Spatial.InsertionOrder == PreviousOrder, TEXT("Seed %d : insertion order wasn't reused"), Seed);
+				DelaunayBenchmark::CompareTetrahedralizations(Context, *FString::Printf(TEXT("Seed %d, cached order"), Seed), Reference, Spatial);
+			}
+		});
+}
+
+#endif
@@ -0,0 +1,233 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/Geo/PCGExPolygonGrid.h"
+
+#include "GeomTools.h"
+
+namespace PCGExMath::Geo
+{
+	namespace PolygonGrid
+	{
+		// Relative sine under which a point is considered on a line
+		constexpr double Epsilon = 1e-6;
+
+		FORCEINLINE double Orient(const FVector2D& A, const FVector2D& B, const FVector2D& P)
+		{
+			return (B.X - A.X) * (P.Y - A.Y) - (B.Y - A.Y) * (P.X - A.X);
+		}
+
+		// Whether P is too close to the line through A & B to trust the sign of Orient(A, B, P)
+		FORCEINLINE bool IsNearlyOnLine(const double InOrient, const FVector2D& A, const FVector2D& B, const FVector2D& P)
+		{
+			return FMath::Square(InOrient) <= FMath::Square(Epsilon) * FVector2D::DistSquared(A, B) * FVector2D::DistSquared(A, P);
+		}
+
+		struct FCrossing
+		{
+			int32 Row;
+			double X;
+			int32 Sign;
+		};
+	}
+
+	FPolygonInclusionGrid::FPolygonInclusionGrid(const TArray<FVector2D>& InPolygon, const double InCellsPerEdge)
+		: Vertices(InPolygon)
+	{
+		const int32 NumVertices = Vertices.Num();
+		if (NumVertices < 3) { return; }
+
+		FBox2D Bounds(ForceInit);
+		for (const FVector2D& V : Vertices) { Bounds += V; }
+
+		// Pad a bit so that points on the bounds land in a cell without leaning on clamping
+		const FVector2D Size = Bounds.GetSize();
+		const double Pad = FMath::Max(1e-4, FMath::Max(Size.X, Size.Y) * 1e-6);
+		Bounds = Bounds.ExpandBy(Pad);
+
+		const FVector2D PaddedSize = Bounds.GetSize();
+		const double TargetCells = FMath::Max(1.0, NumVertices * InCellsPerEdge);
+		const double Aspect = PaddedSize.X / PaddedSize.Y;
+
+		NumX = FMath::Clamp(FMath::RoundToInt32(FMath::Sqrt(TargetCells * Aspect)), 1, MaxCellsPerAxis);
+		NumY = FMath::Clamp(FMath::RoundToInt32(TargetCells / NumX), 1, MaxCellsPerAxis);
+
+		Origin = Bounds.Min;
+		CellSize = FVector2D(PaddedSize.X / NumX, PaddedSize.Y / NumY);
+		InvCellSize = FVector2D(1 / CellSize.X, 1 / CellSize.Y);
+
+		BuildCellEdges();
+		BuildCellWindings();
+	}
+
+	void FPolygonInclusionGrid::BuildCellEdges()
+	{
+		const int32 NumVertices = Vertices.Num();
+		const int32 NumCells = GetNumCells();
+
+		// Visits the cells each edge overlaps, row by row, using the x-range the edge covers within that row
+		auto ForEachEdgeCell = [&](auto&& Func)
+		{
+			const FVector2D Margin = CellSize * 1e-6;
+
+			for (int32 e = 0; e < NumVertices; e++)
+			{
+				const FVector2D& A = Vertices[e];
+				const FVector2D& B = Vertices[(e + 1) % NumVertices];
+
+				const int32 RowStart = GetCellY(FMath::Min(A.Y, B.Y) - Margin.Y);
+				const int32 RowEnd = GetCellY(FMath::Max(A.Y, B.Y) + Margin.Y);
+
+				const double DY = B.Y - A.Y;
+
+				for (int32 Row = RowStart; Row <= RowEnd; Row++)
+				{
+					double MinX = FMath::Min(A.X, B.X);
+					double MaxX = FMath::Max(A.X, B.X);
+
+					if (FMath::Abs(DY) > UE_DOUBLE_SMALL_NUMBER)
+					{
+						// Clip the edge to the row slab
+						const double Y0 = Origin.Y + Row * CellSize.Y;
+						const double T0 = FMath::Clamp((Y0 - A.Y) / DY, 0.0, 1.0);
+						const double T1 = FMath::Clamp((Y0 + CellSize.Y - A.Y) / DY, 0.0, 1.0);
+						const double X0 = A.X + (B.X - A.X) * T0;
+						const double X1 = A.X + (B.X - A.X) * T1;
+						MinX = FMath::Min(X0, X1);
+						MaxX = FMath::Max(X0, X1);
+					}
+
+					const int32 ColStart = GetCellX(MinX - Margin.X);
+					const int32 ColEnd = GetCellX(MaxX + Margin.X);
+					for (int32 Col = ColStart; Col <= ColEnd; Col++) { Func(Row * NumX + Col, e); }
+				}
+			}
+		};
+
+		CellStarts.Init(0, NumCells + 1);
+		ForEachEdgeCell([&](const int32 Cell, const int32 Edge) { CellStarts[Cell + 1]++; });
+		for (int32 i = 0; i < NumCells; i++) { CellStarts[i + 1] += CellStarts[i]; }
+
+		CellEdges.SetNumUninitialized(CellStarts[NumCells]);
+
+		TArray<int32> Cursors(CellStarts.GetData(), NumCells);
+		ForEachEdgeCell([&](const int32 Cell, const int32 Edge) { CellEdges[Cursors[Cell]++] = Edge; });
+	}
+
+	void FPolygonInclusionGrid::BuildCellWindings()
+	{
+		const int32 NumVertices = Vertices.Num();
+
+		// Crossings of each row's center line, with the same half-open rule as the winding number test
+		TArray<PolygonGrid::FCrossing> Crossings;
+		Crossings.Reserve(NumVertices * 2);
+
+		for (int32 e = 0; e < NumVertices; e++)
+		{
+			const FVector2D& A = Vertices[e];
+			const FVector2D& B = Vertices[(e + 1) % NumVertices];
+			if (A.Y == B.Y) { continue; }
+
+			const int32 Sign = B.Y > A.Y ? 1 : -1;
+			const double MinY = FMath::Min(A.Y, B.Y);
+			const double MaxY = FMath::Max(A.Y, B.Y);
+
+			const int32 RowStart = GetCellY(MinY);
+			const int32 RowEnd = GetCellY(MaxY);
+
+			for (int32 Row = RowStart; Row <= RowEnd; Row++)
+			{
+				const double Y = Origin.Y + (Row + 0.5) * CellSize.Y;
+				if (Y < MinY || Y >= MaxY) { continue; }
+				Crossings.Add({Row, A.X + (Y - A.Y) * (B.X - A.X) / (B.Y - A.Y), Sign});
+			}
+		}
+
+		Crossings.Sort([](const PolygonGrid::FCrossing& L, const PolygonGrid::FCrossing& R) { return L.Row == R.Row ? L.X > R.X : L.Row < R.Row; });
+
+		CellWindings.Init(0, GetNumCells());
+
+		const double Tolerance = CellSize.X * PolygonGrid::Epsilon;
+		int32 c = 0;
+
+		for (int32 Row = 0; Row < NumY; Row++)
+		{
+			// Sweep from the right; a center's winding number is the sum of crossings strictly to its right
+			int32 Winding = 0;
+
+			for (int32 Col = NumX - 1; Col >= 0; Col--)
+			{
+				const double X = Origin.X + (Col + 0.5) * CellSize.X;
+				bool bAmbiguous = false;
+
+				while (c < Crossings.Num() && Crossings[c].Row == Row && Crossings[c].X > X - Tolerance)
+				{
+					if (Crossings[c].X < X + Tolerance) { bAmbiguous = true; }
+					Winding += Crossings[c].Sign;
+					c++;
+				}
+
+				// A crossing right at the center was counted, yet may be on either side; let the reference test decide in there
+				CellWindings[Row * NumX + Col] = bAmbiguous ? AmbiguousWinding : Winding;
+			}
+
+			while (c < Crossings.Num() && Crossings[c].Row == Row) { c++; }
+		}
+	}
+
+	bool FPolygonInclusionGrid::IsInside(const FVector2D& Point) const
+	{
+		if (!IsValid()) { return FGeomTools2D::IsPointInPolygon(Point, Vertices); }
+
+		const int32 Col = GetCellX(Point.X);
+		const int32 Row = GetCellY(Point.Y);
+		const int32 Cell = Row * NumX + Col;
+
+		const int32 CenterWinding = CellWindings[Cell];
+		if (CenterWinding == AmbiguousWinding) { return FGeomTools2D::IsPointInPolygon(Point, Vertices); }
+
+		const int32 Start = CellStarts[Cell];
+		const int32 End = CellStarts[Cell + 1];
+		if (Start == End) { return CenterWinding != 0; }
+
+		const FVector2D Center = GetCellCenter(Col, Row);
+		const int32 NumVertices = Vertices.Num();
+
+		// Winding changes between the point and the cell center; only edges overlapping the cell can separate them
+		int32 Delta = 0;
+
+		for (int32 i = Start; i < End; i++)
+		{
+			const int32 e = CellEdges[i];
+			const FVector2D& A = Vertices[e];
+			const FVector2D& B = Vertices[e + 1 < NumVertices ? e + 1 : 0];
+
+			const double SP = PolygonGrid::Orient(A, B, Point);
+			const double SQ = PolygonGrid::Orient(A, B, Center);
+			const bool bPOn = PolygonGrid::IsNearlyOnLine(SP, A, B, Point);
+			const bool bQOn = PolygonGrid::IsNearlyOnLine(SQ, A, B, Center);
+
+			if (!bPOn && !bQOn && (SP > 0) == (SQ > 0)) { continue; }
+
+			const double TA = PolygonGrid::Orient(Point, Center, A);
+			const double TB = PolygonGrid::Orient(Point, Center, B);
+			const bool bAOn = PolygonGrid::IsNearlyOnLine(TA, Point, Center, A);
+			const bool bBOn = PolygonGrid::IsNearlyOnLine(TB, Point, Center, B);
+
+			if (!bAOn && !bBOn && (TA > 0) == (TB > 0)) { continue; }
+
+			// Touching an edge or a vertex, the crossing can't be counted reliably
+			if (bPOn || bQOn || bAOn || bBOn) { return FGeomTools2D::IsPointInPolygon(Point, Vertices); }
+
+			// Crossing toward the left side of an edge raises the winding number by one
+			Delta += SQ > 0 ? 1 : -1;
+		}
+
+		return CenterWinding - Delta != 0;
+	}
+
+	SIZE_T FPolygonInclusionGrid::GetAllocatedSize() const
+	{
+		return Vertices.GetAllocatedSize() + CellStarts.GetAllocatedSize() + CellEdges.GetAllocatedSize() + CellWindings.GetAllocatedSize();
+	}
+}
@@ -0,0 +1,152 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "GeomTools.h"
+#include "Core/PCGExBenchmark.h"
+#include "Math/Geo/PCGExPolygonGrid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExMath::Geo
+{
+	namespace PolygonGridBenchmark
+	{
+		constexpr int32 NumQueries = 10000;
+		constexpr double Radius = 10000;
+
+		// Star-shaped, non-convex polygon with InNum vertices
+		static void MakePolygon(TArray<FVector2D>& OutPolygon, const int32 InNum)
+		{
+			FRandomStream Random(1337);
+
+			OutPolygon.SetNumUninitialized(FMath::Max(3, InNum));
+			for (int32 i = 0; i < OutPolygon.Num(); i++)
+			{
+				const double Angle = UE_TWO_PI * i / OutPolygon.Num();
+				OutPolygon[i] = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius * Random.FRandRange(0.5, 1);
+			}
+		}
+
+		static void MakeQueries(TArray<FVector2D>& OutQueries)
+		{
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, NumQueries, false, Radius * 2);
+
+			OutQueries.SetNumUninitialized(NumQueries);
+			for (int32 i = 0; i < NumQueries; i++) { OutQueries[i] = FVector2D(Positions[i]) - FVector2D(Radius); }
+		}
+	}
+
+	// Scale is the number of polygon vertices; each run classifies the same set of queries
+	static PCGExBenchmark::FKernel MakeInclusionKernel(const int32 Scale, const bool bGrid)
+	{
+		TArray<FVector2D> Polygon;
+		PolygonGridBenchmark::MakePolygon(Polygon, Scale);
+
+		TArray<FVector2D> Queries;
+		PolygonGridBenchmark::MakeQueries(Queries);
+
+		if (bGrid)
+		{
+			return [Grid = MakeShared<FPolygonInclusionGrid>(Polygon), Queries = MoveTemp(Queries), NumInside = 0]() mutable
+			{
+				NumInside = 0;
+				for (const FVector2D& Query : Queries) { NumInside += Grid->IsInside(Query); }
+			};
+		}
+
+		return [Polygon = MoveTemp(Polygon), Queries = MoveTemp(Queries), NumInside = 0]() mutable
+		{
+			NumInside = 0;
+			for (const FVector2D& Query : Queries) { NumInside += FGeomTools2D::IsPointInPolygon(Query, Polygon); }
+		};
+	}
+
+	static PCGExBenchmark::FKernel MakeGridBuildKernel(const int32 Scale)
+	{
+		TArray<FVector2D> Polygon;
+		PolygonGridBenchmark::MakePolygon(Polygon, Scale);
+
+		return [Polygon = MoveTemp(Polygon)]() { const FPolygonInclusionGrid Grid(Polygon); };
+	}
+
+	static PCGExBenchmark::FPairRegistrar BenchPolygonInclusion(
+		TEXT("Geo.PolygonInclusion"), TEXT("10k point-in-polygon tests against an N-vertex polygon"),
+		{TEXT("Reference"), TEXT("edge walk")}, {TEXT("Grid"), TEXT("inclusion grid")}, &MakeInclusionKernel);
+
+	static PCGExBenchmark::FRegistrar BenchPolygonGridBuild(TEXT("Geo.PolygonInclusion.GridBuild"), TEXT("Inclusion grid build for an N-vertex polygon"), &MakeGridBuildKernel);
+
+	static PCGExBenchmark::FCheckRegistrar CheckPolygonInclusion(
+		TEXT("Geo.PolygonInclusion"), TEXT("Inclusion grid answers exactly like the edge walk, including on edges & vertices"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			auto Compare = [&](const TCHAR* InLabel, const TArray<FVector2D>& InPolygon, const TArray<FVector2D>& InQueries)
+			{
+				const FPolygonInclusionGrid Grid(InPolygon);
+				if (!Context.Test(Grid.IsValid(), TEXT("%s : grid is invalid"), InLabel)) { return; }
+
+				int32 NumInside = 0;
+				int32 ExpectedInside = 0;
+				for (int32 i = 0; i < InQueries.Num(); i++)
+				{
+					const bool bExpected = FGeomTools2D::IsPointInPolygon(InQueries[i], InPolygon);
+					const bool bInside = Grid.IsInside(InQueries[i]);
+					NumInside += bInside;
+					ExpectedInside += bExpected;
+					Context.Test(bInside == bExpected, TEXT("%s : query %d (%f, %f) is %s, edge walk says %s"), InLabel, i, InQueries[i].X, InQueries[i].Y, bInside ? TEXT("inside") : TEXT("outside"), bExpected ? TEXT("inside") : TEXT("outside"));
+				}
+
+				// Guards against a fixture that never or always hits the polygon
+				Context.Test(ExpectedInside > 0 && ExpectedInside < InQueries.Num(), TEXT("%s : %d of %d queries inside"), InLabel, ExpectedInside, InQueries.Num());
+				Context.Test(NumInside == ExpectedInside, TEXT("%s : %d queries inside, edge walk finds %d"), InLabel, NumInside, ExpectedInside);
+			};
+
+			// Random queries, then every vertex and points along every edge
+			auto AddBoundaryQueries = [](const TArray<FVector2D>& InPolygon, TArray<FVector2D>& OutQueries)
+			{
+				for (int32 i = 0; i < InPolygon.Num(); i++)
+				{
+					const FVector2D& A = InPolygon[i];
+					const FVector2D& B = InPolygon[(i + 1) % InPolygon.Num()];
+					OutQueries.Add(A);
+					for (const double Alpha : {0.25, 0.5, 0.75}) { OutQueries.Add(FMath::Lerp(A, B, Alpha)); }
+				}
+			};
+
+			for (const int32 NumVertices : {3, 16, 1000, 4000})
+			{
+				TArray<FVector2D> Polygon;
+				PolygonGridBenchmark::MakePolygon(Polygon, NumVertices);
+
+				TArray<FVector2D> Queries;
+				PolygonGridBenchmark::MakeQueries(Queries);
+				AddBoundaryQueries(Polygon, Queries);
+
+				Compare(*FString::Printf(TEXT("Star, %d vertices"), NumVertices), Polygon, Queries);
+			}
+
+			// Axis-aligned comb, queried on a lattice that lands exactly on its edges, vertices and teeth gaps
+			{
+				constexpr int32 NumTeeth = 8;
+
+				TArray<FVector2D> Comb;
+				Comb.Add(FVector2D(0, 0));
+				Comb.Add(FVector2D(NumTeeth * 2, 0));
+				for (int32 t = NumTeeth - 1; t >= 0; t--)
+				{
+					Comb.Add(FVector2D(t * 2 + 2, 4));
+					Comb.Add(FVector2D(t * 2 + 1, 4));
+					Comb.Add(FVector2D(t * 2 + 1, 1));
+					Comb.Add(FVector2D(t * 2, 1));
+				}
+
+				TArray<FVector2D> Queries;
+				for (int32 x = -2; x <= NumTeeth * 4 + 2; x++) { for (int32 y = -2; y <= 10; y++) { Queries.Add(FVector2D(x * 0.5, y * 0.5)); } }
+				AddBoundaryQueries(Comb, Queries);
+
+				Compare(TEXT("Comb"), Comb, Queries);
+			}
+		});
+}
+
+#endif
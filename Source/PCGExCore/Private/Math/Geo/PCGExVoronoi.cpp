@@ -4,6 +4,7 @@
 #include "Math/Geo/PCGExVoronoi.h"
 
 #include "CoreMinimal.h"
+#include "Core/PCGExMTCommon.h"
 #include "Helpers/PCGExArrayHelpers.h"
 
 #include "Math/Geo/PCGExDelaunay.h"
@@ -30,36 +31,45 @@ namespace PCGExMath::Geo
 		IsValid = false;
 	}
 
-	bool TVoronoi2::Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	bool TVoronoi2::ProcessSites(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
 	{
-		Clear();
-
 		Delaunay = MakeShared<TDelaunay2>();
 		if (!Delaunay->Process(Positions, ProjectionDetails))
 		{
 			Clear();
-			return IsValid;
+			return false;
 		}
 
-		const int32 NumSites = Delaunay->Sites.Num();
+		const TArray<FDelaunaySite2>& Sites = Delaunay->Sites;
+		const int32 NumSites = Sites.Num();
 		PCGExArrayHelpers::InitArray(Circumcenters, NumSites);
 		PCGExArrayHelpers::InitArray(Centroids, NumSites);
 
-		for (FDelaunaySite2& Site : Delaunay->Sites)
-		{
-			GetCircumcenter(Positions, Site.Vtx, Circumcenters[Site.Id]);
-			GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
+		PCGEX_PARALLEL_FOR(
+			NumSites,
+			GetCircumcenter(Positions, Sites[i].Vtx, Circumcenters[i]);
+			GetCentroid(Positions, Sites[i].Vtx, Centroids[i]);
+		)
 
+		// Each adjacency is seen from both sites; keep it once, from its lowest site
+		VoronoiEdges.Reserve(NumSites * 3 / 2);
+		for (const FDelaunaySite2& Site : Sites)
+		{
 			for (int i = 0; i < 3; i++)
 			{
-				const int32 AdjacentIdx = Site.Neighbors[i];
-
-				if (AdjacentIdx == -1) { continue; }
-
-				VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx));
+				if (const int32 AdjacentIdx = Site.Neighbors[i]; AdjacentIdx > Site.Id) { VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx)); }
 			}
 		}
 
+		return true;
+	}
+
+	bool TVoronoi2::Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	{
+		Clear();
+
+		if (!ProcessSites(Positions, ProjectionDetails)) { return IsValid; }
+
 		IsValid = true;
 		return IsValid;
 	}
@@ -68,38 +78,11 @@ namespace PCGExMath::Geo
 	{
 		Clear();
 
-		Delaunay = MakeShared<TDelaunay2>();
-		if (!Delaunay->Process(Positions, ProjectionDetails))
-		{
-			Clear();
-			return IsValid;
-		}
+		if (!ProcessSites(Positions, ProjectionDetails)) { return IsValid; }
 
-		const int32 NumSites = Delaunay->Sites.Num();
-		PCGExArrayHelpers::InitArray(Circumcenters, NumSites);
-		PCGExArrayHelpers::InitArray(Centroids, NumSites);
+		const int32 NumSites = Circumcenters.Num();
 		WithinBounds.Init(true, NumSites);
-
-		for (FDelaunaySite2& Site : Delaunay->Sites)
-		{
-			FVector CC = FVector::ZeroVector;
-
-			GetCircumcenter(Positions, Site.Vtx, CC);
-			Circumcenters[Site.Id] = CC;
-
-			WithinBounds[Site.Id] = Bounds.IsInside(CC);
-
-			GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
-
-			for (int i = 0; i < 3; i++)
-			{
-				const int32 AdjacentIdx = Site.Neighbors[i];
-
-				if (AdjacentIdx == -1) { continue; }
-
-				VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx));
-			}
-		}
+		for (int32 i = 0; i < NumSites; i++) { WithinBounds[i] = Bounds.IsInside(Circumcenters[i]); }
 
 		IsValid = true;
 		return IsValid;
@@ -110,30 +93,8 @@ namespace PCGExMath::Geo
 		Clear();
 		Metric = InMetric;
 
-		Delaunay = MakeShared<TDelaunay2>();
-		if (!Delaunay->Process(Positions, ProjectionDetails))
-		{
-			Clear();
-			return IsValid;
-		}
-
-		const int32 NumSites = Delaunay->Sites.Num();
-		PCGExArrayHelpers::InitArray(Circumcenters, NumSites);
-		PCGExArrayHelpers::InitArray(Centroids, NumSites);
-
-		for (FDelaunaySite2& Site : Delaunay->Sites)
-		{
-			// Store 3D versions for backwards compatibility
-			GetCircumcenter(Positions, Site.Vtx, Circumcenters[Site.Id]);
-			GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
-
-			for (int i = 0; i < 3; i++)
-			{
-				const int32 AdjacentIdx = Site.Neighbors[i];
-				if (AdjacentIdx == -1) { continue; }
-				VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx));
-			}
-		}
+		// Circumcenters & centroids are stored in 3D for backwards compatibility
+		if (!ProcessSites(Positions, ProjectionDetails)) { return IsValid; }
 
 		IsValid = true;
 		BuildMetricOutput(Positions, ProjectionDetails, CellCenterMethod, nullptr, nullptr);
@@ -145,31 +106,8 @@ namespace PCGExMath::Geo
 		Clear();
 		Metric = InMetric;
 
-		Delaunay = MakeShared<TDelaunay2>();
-		if (!Delaunay->Process(Positions, ProjectionDetails))
-		{
-			Clear();
-			return IsValid;
-		}
-
-		const int32 NumSites = Delaunay->Sites.Num();
-		PCGExArrayHelpers::InitArray(Circumcenters, NumSites);
-		PCGExArrayHelpers::InitArray(Centroids, NumSites);
-		WithinBounds.Init(true, NumSites);
-
-		for (FDelaunaySite2& Site : Delaunay->Sites)
-		{
-			// Store 3D versions for backwards compatibility
-			GetCircumcenter(Positions, Site.Vtx, Circumcenters[Site.Id]);
-			GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
-
-			for (int i = 0; i < 3; i++)
-			{
-				const int32 AdjacentIdx = Site.Neighbors[i];
-				if (AdjacentIdx == -1) { continue; }
-				VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx));
-			}
-		}
+		// Circumcenters & centroids are stored in 3D for backwards compatibility
+		if (!ProcessSites(Positions, ProjectionDetails)) { return IsValid; }
 
 		IsValid = true;
 		// BuildMetricOutput will compute final positions and check bounds after unprojection
@@ -344,13 +282,15 @@ namespace PCGExMath::Geo
 	void TVoronoi3::Clear()
 	{
 		Delaunay.Reset();
+		VoronoiEdges.Empty();
+		Circumspheres.Empty();
 		Centroids.Empty();
 		IsValid = false;
 	}
 
 	bool TVoronoi3::Process(const TArrayView<FVector>& Positions)
 	{
-		IsValid = false;
+		Clear();
 		Delaunay = MakeShared<TDelaunay3>();
 
 		if (!Delaunay->Process<true, false>(Positions))
@@ -359,28 +299,28 @@ namespace PCGExMath::Geo
 			return IsValid;
 		}
 
-		const int32 NumSites = Delaunay->Sites.Num();
+		const TArray<FDelaunaySite3>& Sites = Delaunay->Sites;
+		const int32 NumSites = Sites.Num();
 		PCGExArrayHelpers::InitArray(Circumspheres, NumSites);
 		PCGExArrayHelpers::InitArray(Centroids, NumSites);
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(GeoVoronoi::FindVoronoiEdges);
 
-			for (FDelaunaySite3& Site : Delaunay->Sites)
-			{
-				FindSphereFrom4Points(Positions, Site.Vtx, Circumspheres[Site.Id]);
-				GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
-			}
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				FindSphereFrom4Points(Positions, Sites[i].Vtx, Circumspheres[i]);
+				GetCentroid(Positions, Sites[i].Vtx, Centroids[i]);
+			)
 
-			for (const TPair<uint32, uint64>& AdjacencyPair : Delaunay->Adjacency)
+			// Each shared face is seen from both sites; keep it once, from its lowest site
+			VoronoiEdges.Reserve(NumSites * 2);
+			for (const FDelaunaySite3& Site : Sites)
 			{
-				int32 A = -1;
-				int32 B = -1;
-				PCGEx::NH64(AdjacencyPair.Value, A, B);
-
-				if (A == -1 || B == -1) { continue; }
-
-				VoronoiEdges.Add(PCGEx::H64U(A, B));
+				for (int i = 0; i < 4; i++)
+				{
+					if (const int32 AdjacentIdx = Site.Neighbors[i]; AdjacentIdx > Site.Id) { VoronoiEdges.Add(PCGEx::H64U(Site.Id, AdjacentIdx)); }
+				}
 			}
 		}
 
@@ -0,0 +1,292 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/OBB/PCGExOBBBatch.h"
+
+namespace PCGExMath::OBB
+{
+	namespace Batch
+	{
+		constexpr int32 L = FBatchStore::Lanes;
+
+		FORCEINLINE bool AnyAlive(const bool (&Alive)[L])
+		{
+			bool bAny = false;
+			for (int32 l = 0; l < L; l++) { bAny |= Alive[l]; }
+			return bAny;
+		}
+
+		// Pads the last block by repeating its last index; padded lanes are computed but never written out
+		FORCEINLINE int32 LoadIndices(TConstArrayView<int32> Indices, const int32 Base, int32 (&OutIdx)[L])
+		{
+			const int32 Count = FMath::Min(L, Indices.Num() - Base);
+			for (int32 l = 0; l < L; l++) { OutIdx[l] = Indices[Base + FMath::Min(l, Count - 1)]; }
+			return Count;
+		}
+
+		FORCEINLINE void Write(const bool (&Alive)[L], const int32 Count, uint8* OutResults)
+		{
+			for (int32 l = 0; l < Count; l++) { OutResults[l] = Alive[l]; }
+		}
+	}
+
+	void FBatchStore::Reserve(const int32 Count)
+	{
+		for (TArray<double>& Channel : Channels) { Channel.Reserve(Count); }
+	}
+
+	void FBatchStore::SetNumUninitialized(const int32 Count)
+	{
+		for (TArray<double>& Channel : Channels) { Channel.SetNumUninitialized(Count); }
+	}
+
+	void FBatchStore::Add(const FOBB& Box)
+	{
+		for (TArray<double>& Channel : Channels) { Channel.AddUninitialized(); }
+		Set(Num() - 1, Box);
+	}
+
+	void FBatchStore::Set(const int32 Index, const FOBB& Box)
+	{
+		const FVector& Origin = Box.Bounds.Origin;
+		const FVector& Extents = Box.Bounds.Extents;
+		const FVector X = Box.Orientation.GetAxisX();
+		const FVector Y = Box.Orientation.GetAxisY();
+		const FVector Z = Box.Orientation.GetAxisZ();
+		const FQuat& Q = Box.Orientation.Rotation;
+
+		const double Values[NumChannels] = {
+			Origin.X, Origin.Y, Origin.Z,
+			Extents.X, Extents.Y, Extents.Z,
+			Box.Bounds.Radius,
+			X.X, X.Y, X.Z,
+			Y.X, Y.Y, Y.Z,
+			Z.X, Z.Y, Z.Z,
+			Q.X, Q.Y, Q.Z, Q.W
+		};
+
+		for (int32 c = 0; c < NumChannels; c++) { Channels[c][Index] = Values[c]; }
+	}
+
+	void FBatchStore::Reset()
+	{
+		for (TArray<double>& Channel : Channels) { Channel.Reset(); }
+	}
+
+	void FBatchStore::TestOverlaps(const FOBB& Query, TConstArrayView<int32> Indices, uint8* OutResults, const bool bExpanded, const float Expansion) const
+	{
+		// Stored entries are A and the query is B, as in TestOverlap(GetOBB(i), Query); see SATOverlap for the reference
+		using namespace Batch;
+
+		const FVector AxesB[3] = {Query.Orientation.GetAxisX(), Query.Orientation.GetAxisY(), Query.Orientation.GetAxisZ()};
+		const FVector& EB = Query.Bounds.Extents;
+		const FVector& OB = Query.Bounds.Origin;
+		const float RadiusB = Query.Bounds.Radius;
+		const double Pad = bExpanded ? static_cast<double>(Expansion) : 0;
+
+		for (int32 Base = 0; Base < Indices.Num(); Base += L)
+		{
+			int32 Idx[L];
+			const int32 Count = LoadIndices(Indices, Base, Idx);
+
+			double D[3][L];
+			double EA[3][L];
+			double AxesA[3][3][L];
+			bool Alive[L];
+
+			for (int32 l = 0; l < L; l++)
+			{
+				const int32 i = Idx[l];
+				D[0][l] = OB.X - Channels[OriginX][i];
+				D[1][l] = OB.Y - Channels[OriginY][i];
+				D[2][l] = OB.Z - Channels[OriginZ][i];
+				EA[0][l] = Channels[ExtentX][i] + Pad;
+				EA[1][l] = Channels[ExtentY][i] + Pad;
+				EA[2][l] = Channels[ExtentZ][i] + Pad;
+				for (int32 a = 0; a < 3; a++) { for (int32 c = 0; c < 3; c++) { AxesA[a][c][l] = Channels[AxisXX + a * 3 + c][i]; } }
+			}
+
+			// Sphere rejection
+			for (int32 l = 0; l < L; l++)
+			{
+				const float RadiusA = bExpanded ? FMath::Sqrt(EA[0][l] * EA[0][l] + EA[1][l] * EA[1][l] + EA[2][l] * EA[2][l]) : static_cast<float>(Channels[Radius][Idx[l]]);
+				const float Combined = RadiusA + RadiusB;
+				Alive[l] = FMath::Square(D[0][l]) + FMath::Square(D[1][l]) + FMath::Square(D[2][l]) <= Combined * Combined;
+			}
+
+			if (!AnyAlive(Alive))
+			{
+				Write(Alive, Count, OutResults + Base);
+				continue;
+			}
+
+			float R[3][3][L];
+			float AbsR[3][3][L];
+			double DA[3][L];
+			double DB[3][L];
+
+			for (int32 l = 0; l < L; l++)
+			{
+				for (int32 a = 0; a < 3; a++)
+				{
+					DA[a][l] = D[0][l] * AxesA[a][0][l] + D[1][l] * AxesA[a][1][l] + D[2][l] * AxesA[a][2][l];
+					DB[a][l] = D[0][l] * AxesB[a].X + D[1][l] * AxesB[a].Y + D[2][l] * AxesB[a].Z;
+
+					for (int32 b = 0; b < 3; b++)
+					{
+						R[a][b][l] = AxesA[a][0][l] * AxesB[b].X + AxesA[a][1][l] * AxesB[b].Y + AxesA[a][2][l] * AxesB[b].Z;
+						AbsR[a][b][l] = FMath::Abs(R[a][b][l]) + KINDA_SMALL_NUMBER;
+					}
+				}
+			}
+
+			// A's axes
+			for (int32 a = 0; a < 3; a++)
+			{
+				for (int32 l = 0; l < L; l++)
+				{
+					const float ra = EA[a][l];
+					const float rb = EB.X * AbsR[a][0][l] + EB.Y * AbsR[a][1][l] + EB.Z * AbsR[a][2][l];
+					Alive[l] &= !(FMath::Abs(DA[a][l]) > ra + rb);
+				}
+			}
+
+			// B's axes
+			for (int32 b = 0; b < 3; b++)
+			{
+				for (int32 l = 0; l < L; l++)
+				{
+					const float ra = EA[0][l] * AbsR[0][b][l] + EA[1][l] * AbsR[1][b][l] + EA[2][l] * AbsR[2][b][l];
+					const float rb = EB[b];
+					Alive[l] &= !(FMath::Abs(DB[b][l]) > ra + rb);
+				}
+			}
+
+			if (!AnyAlive(Alive))
+			{
+				Write(Alive, Count, OutResults + Base);
+				continue;
+			}
+
+			// Cross products; Ai x Bj
+			for (int32 a = 0; a < 3; a++)
+			{
+				const int32 a1 = (a + 1) % 3;
+				const int32 a2 = (a + 2) % 3;
+
+				for (int32 b = 0; b < 3; b++)
+				{
+					const int32 b1 = (b + 1) % 3;
+					const int32 b2 = (b + 2) % 3;
+
+					for (int32 l = 0; l < L; l++)
+					{
+						const float ra = EA[a1][l] * AbsR[a2][b][l] + EA[a2][l] * AbsR[a1][b][l];
+						const float rb = EB[b1] * AbsR[a][b2][l] + EB[b2] * AbsR[a][b1][l];
+						Alive[l] &= !(FMath::Abs(DA[a2][l] * R[a1][b][l] - DA[a1][l] * R[a2][b][l]) > ra + rb);
+					}
+				}
+			}
+
+			Write(Alive, Count, OutResults + Base);
+		}
+	}
+
+	void FBatchStore::TestPoints(const FVector& Point, TConstArrayView<int32> Indices, uint8* OutResults, const bool bExpanded, const float Expansion) const
+	{
+		// Same unrotation as FQuat::UnrotateVector, see PointInside for the reference
+		using namespace Batch;
+
+		for (int32 Base = 0; Base < Indices.Num(); Base += L)
+		{
+			int32 Idx[L];
+			const int32 Count = LoadIndices(Indices, Base, Idx);
+
+			bool Alive[L];
+
+			for (int32 l = 0; l < L; l++)
+			{
+				const int32 i = Idx[l];
+
+				const FVector V(Point.X - Channels[OriginX][i], Point.Y - Channels[OriginY][i], Point.Z - Channels[OriginZ][i]);
+				const FVector Q(-Channels[QuatX][i], -Channels[QuatY][i], -Channels[QuatZ][i]);
+				const double W = Channels[QuatW][i];
+
+				const FVector TT = 2.f * FVector::CrossProduct(Q, V);
+				const FVector Local = V + (W * TT) + FVector::CrossProduct(Q, TT);
+
+				if (bExpanded)
+				{
+					Alive[l] = FMath::Abs(Local.X) <= Channels[ExtentX][i] + Expansion
+						&& FMath::Abs(Local.Y) <= Channels[ExtentY][i] + Expansion
+						&& FMath::Abs(Local.Z) <= Channels[ExtentZ][i] + Expansion;
+				}
+				else
+				{
+					Alive[l] = FMath::Abs(Local.X) <= Channels[ExtentX][i]
+						&& FMath::Abs(Local.Y) <= Channels[ExtentY][i]
+						&& FMath::Abs(Local.Z) <= Channels[ExtentZ][i];
+				}
+			}
+
+			Write(Alive, Count, OutResults + Base);
+		}
+	}
+
+	void FBatchStore::MaySegmentIntersect(const FVector& Start, const FVector& End, TConstArrayView<int32> Indices, uint8* OutResults) const
+	{
+		// Slab test in each box frame against slightly inflated extents, so rounding can only keep a candidate, never drop one
+		using namespace Batch;
+
+		const double SegmentLength = FVector::Dist(Start, End);
+
+		for (int32 Base = 0; Base < Indices.Num(); Base += L)
+		{
+			int32 Idx[L];
+			const int32 Count = LoadIndices(Indices, Base, Idx);
+
+			double TMin[L];
+			double TMax[L];
+			bool Alive[L];
+
+			for (int32 l = 0; l < L; l++)
+			{
+				TMin[l] = 0;
+				TMax[l] = 1;
+				Alive[l] = true;
+			}
+
+			for (int32 a = 0; a < 3; a++)
+			{
+				for (int32 l = 0; l < L; l++)
+				{
+					const int32 i = Idx[l];
+
+					const double AX = Channels[AxisXX + a * 3][i];
+					const double AY = Channels[AxisXX + a * 3 + 1][i];
+					const double AZ = Channels[AxisXX + a * 3 + 2][i];
+
+					const double S = (Start.X - Channels[OriginX][i]) * AX + (Start.Y - Channels[OriginY][i]) * AY + (Start.Z - Channels[OriginZ][i]) * AZ;
+					const double E = (End.X - Channels[OriginX][i]) * AX + (End.Y - Channels[OriginY][i]) * AY + (End.Z - Channels[OriginZ][i]) * AZ;
+					const double Extent = Channels[ExtentX + a][i];
+					const double Slab = Extent + (Extent + SegmentLength) * 1e-4 + UE_KINDA_SMALL_NUMBER;
+
+					const double Delta = E - S;
+					if (FMath::Abs(Delta) < UE_DOUBLE_SMALL_NUMBER)
+					{
+						Alive[l] &= FMath::Abs(S) <= Slab;
+						continue;
+					}
+
+					const double T0 = (-Slab - S) / Delta;
+					const double T1 = (Slab - S) / Delta;
+					TMin[l] = FMath::Max(TMin[l], FMath::Min(T0, T1));
+					TMax[l] = FMath::Min(TMax[l], FMath::Max(T0, T1));
+					Alive[l] &= TMin[l] <= TMax[l];
+				}
+			}
+
+			Write(Alive, Count, OutResults + Base);
+		}
+	}
+}
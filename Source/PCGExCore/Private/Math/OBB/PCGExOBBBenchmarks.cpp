@@ -0,0 +1,168 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Math/OBB/PCGExOBBBatch.h"
+#include "Math/OBB/PCGExOBBIntersections.h"
+#include "Math/OBB/PCGExOBBTests.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExMath::OBB
+{
+	namespace BatchBenchmark
+	{
+		constexpr int32 NumQueries = 64;
+
+		// Boxes packed densely enough that a good share of pairs overlap, and some are exactly axis aligned
+		static void MakeBoxes(TArray<FOBB>& OutBoxes, const int32 InNum, const int32 InSeed)
+		{
+			FRandomStream Random(InSeed);
+			const double Extent = 100 * FMath::Pow(static_cast<double>(FMath::Max(1, InNum)), 1 / 3.0);
+
+			OutBoxes.SetNumUninitialized(InNum);
+			for (int32 i = 0; i < InNum; i++)
+			{
+				const FQuat Rotation = i % 8 == 0 ? FQuat::Identity : FRotator(Random.FRandRange(-180, 180), Random.FRandRange(-180, 180), Random.FRandRange(-180, 180)).Quaternion();
+				const FVector Origin = FVector(Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent));
+				const FVector Extents = FVector(Random.FRandRange(5, 100), Random.FRandRange(5, 100), Random.FRandRange(5, 100));
+				OutBoxes[i] = Factory::FromTransform(FTransform(Rotation, Origin), Extents, i);
+			}
+		}
+
+		static void MakeStore(const TArray<FOBB>& InBoxes, FBatchStore& OutStore, TArray<int32>& OutIndices)
+		{
+			OutStore.Reserve(InBoxes.Num());
+			OutIndices.SetNumUninitialized(InBoxes.Num());
+			for (int32 i = 0; i < InBoxes.Num(); i++)
+			{
+				OutStore.Add(InBoxes[i]);
+				OutIndices[i] = i;
+			}
+		}
+	}
+
+	// Scale is the number of candidates each of the NumQueries queries is tested against
+	static PCGExBenchmark::FKernel MakeOverlapKernel(const int32 Scale, const bool bBatch)
+	{
+		TArray<FOBB> Boxes;
+		BatchBenchmark::MakeBoxes(Boxes, Scale, 1337);
+
+		TArray<FOBB> Queries;
+		BatchBenchmark::MakeBoxes(Queries, BatchBenchmark::NumQueries, 42);
+
+		TArray<uint8> Results;
+		Results.SetNumUninitialized(Scale);
+
+		if (bBatch)
+		{
+			TSharedPtr<FBatchStore> Store = MakeShared<FBatchStore>();
+			TArray<int32> Indices;
+			BatchBenchmark::MakeStore(Boxes, *Store, Indices);
+
+			return [Queries = MoveTemp(Queries), Store, Indices = MoveTemp(Indices), Results = MoveTemp(Results)]() mutable
+			{
+				for (const FOBB& Query : Queries) { Store->TestOverlaps(Query, Indices, Results.GetData()); }
+			};
+		}
+
+		return [Boxes = MoveTemp(Boxes), Queries = MoveTemp(Queries), Results = MoveTemp(Results)]() mutable
+		{
+			for (const FOBB& Query : Queries) { for (int32 i = 0; i < Boxes.Num(); i++) { Results[i] = TestOverlap(Boxes[i], Query, EPCGExBoxCheckMode::Box); } }
+		};
+	}
+
+	static PCGExBenchmark::FKernel MakePointKernel(const int32 Scale, const bool bBatch)
+	{
+		TArray<FOBB> Boxes;
+		BatchBenchmark::MakeBoxes(Boxes, Scale, 1337);
+
+		TArray<FVector> Points;
+		PCGExBenchmark::MakePositions(Points, BatchBenchmark::NumQueries);
+
+		TArray<uint8> Results;
+		Results.SetNumUninitialized(Scale);
+
+		if (bBatch)
+		{
+			TSharedPtr<FBatchStore> Store = MakeShared<FBatchStore>();
+			TArray<int32> Indices;
+			BatchBenchmark::MakeStore(Boxes, *Store, Indices);
+
+			return [Points = MoveTemp(Points), Store, Indices = MoveTemp(Indices), Results = MoveTemp(Results)]() mutable
+			{
+				for (const FVector& Point : Points) { Store->TestPoints(Point, Indices, Results.GetData()); }
+			};
+		}
+
+		return [Boxes = MoveTemp(Boxes), Points = MoveTemp(Points), Results = MoveTemp(Results)]() mutable
+		{
+			for (const FVector& Point : Points) { for (int32 i = 0; i < Boxes.Num(); i++) { Results[i] = PointInside(Boxes[i], Point); } }
+		};
+	}
+
+	static PCGExBenchmark::FPairRegistrar BenchOBBOverlap(
+		TEXT("OBB.Overlap"), TEXT("64 OBB queries against N candidates"),
+		{TEXT("Scalar"), TEXT("one SAT test at a time")}, {TEXT("Batch"), TEXT("batched SAT kernel")}, &MakeOverlapKernel);
+
+	static PCGExBenchmark::FPairRegistrar BenchOBBPoint(
+		TEXT("OBB.PointInside"), TEXT("64 points against N candidates"),
+		{TEXT("Scalar"), TEXT("one test at a time")}, {TEXT("Batch"), TEXT("batched kernel")}, &MakePointKernel);
+
+	static PCGExBenchmark::FCheckRegistrar CheckOBBBatch(
+		TEXT("OBB.Batch"), TEXT("Batched OBB kernels against the scalar tests on random boxes"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			constexpr int32 Num = 4096;
+
+			TArray<FOBB> Boxes;
+			BatchBenchmark::MakeBoxes(Boxes, Num, 1337);
+
+			TArray<FOBB> Queries;
+			BatchBenchmark::MakeBoxes(Queries, BatchBenchmark::NumQueries, 42);
+
+			FBatchStore Store;
+			TArray<int32> Indices;
+			BatchBenchmark::MakeStore(Boxes, Store, Indices);
+
+			TArray<uint8> Results;
+			Results.SetNumUninitialized(Num);
+
+			auto Check = [&](const TCHAR* InKernel, const int32 InQuery, const int32 InIndex, const bool bScalar, const bool bBatch)
+			{
+				Context.Test(bScalar == bBatch, TEXT("%s, query %d, box %d (scalar %d, batch %d)"), InKernel, InQuery, InIndex, bScalar, bBatch);
+			};
+
+			constexpr float Expansion = 10;
+
+			for (int32 q = 0; q < Queries.Num(); q++)
+			{
+				const FOBB& Query = Queries[q];
+
+				Store.TestOverlaps(Query, Indices, Results.GetData());
+				for (int32 i = 0; i < Num; i++) { Check(TEXT("Overlap"), q, i, TestOverlap(Boxes[i], Query, EPCGExBoxCheckMode::Box), Results[i]); }
+
+				Store.TestOverlaps(Query, Indices, Results.GetData(), true, Expansion);
+				for (int32 i = 0; i < Num; i++) { Check(TEXT("Overlap (expanded)"), q, i, TestOverlap(Boxes[i], Query, EPCGExBoxCheckMode::ExpandedBox, Expansion), Results[i]); }
+
+				const FVector& Point = Query.Bounds.Origin;
+
+				Store.TestPoints(Point, Indices, Results.GetData());
+				for (int32 i = 0; i < Num; i++) { Check(TEXT("Point"), q, i, TestPoint(Boxes[i], Point, EPCGExBoxCheckMode::Box), Results[i]); }
+
+				Store.TestPoints(Point, Indices, Results.GetData(), true, Expansion);
+				for (int32 i = 0; i < Num; i++) { Check(TEXT("Point (expanded)"), q, i, TestPoint(Boxes[i], Point, EPCGExBoxCheckMode::ExpandedBox, Expansion), Results[i]); }
+
+				// The segment kernel is conservative; it may only report false when the exact test does
+				const FVector End = Point + Query.Orientation.GetAxisX() * 1000;
+				Store.MaySegmentIntersect(Point, End, Indices, Results.GetData());
+				for (int32 i = 0; i < Num; i++)
+				{
+					const bool bScalar = SegmentIntersects(Boxes[i], Point, End);
+					Check(TEXT("Segment"), q, i, bScalar, bScalar && Results[i]);
+				}
+			}
+		});
+}
+
+#endif
@@ -7,16 +7,24 @@
 
 namespace PCGExMath::OBB
 {
+	namespace BatchQuery
+	{
+		using FCandidates = TArray<int32, TInlineAllocator<64>>;
+		using FResults = TArray<uint8, TInlineAllocator<64>>;
+	}
+
 	void FCollection::Reserve(int32 Count)
 	{
 		Bounds.Reserve(Count);
 		Orientations.Reserve(Count);
+		BatchStore.Reserve(Count);
 	}
 
 	void FCollection::Add(const FOBB& Box)
 	{
 		Bounds.Add(Box.Bounds);
 		Orientations.Add(Box.Orientation);
+		BatchStore.Add(Box);
 	}
 
 	void FCollection::Add(const FTransform& Transform, const FBox& LocalBox, int32 Index)
@@ -50,6 +58,7 @@ namespace PCGExMath::OBB
 	{
 		Bounds.Reset();
 		Orientations.Reset();
+		BatchStore.Reset();
 		Octree.Reset();
 		WorldBounds = FBox(ForceInit);
 	}
@@ -117,6 +126,20 @@ namespace PCGExMath::OBB
 		return bFound;
 	}
 
+	bool FCollection::IsPointInsideBatched(const FVector& Point, const bool bExpanded, const float Expansion) const
+	{
+		BatchQuery::FCandidates Candidates;
+		GatherCandidates(FBoxCenterAndExtent(Point, FVector4(Expansion, Expansion, Expansion, Expansion)), Candidates);
+		if (Candidates.IsEmpty()) { return false; }
+
+		BatchQuery::FResults Results;
+		Results.SetNumUninitialized(Candidates.Num());
+		BatchStore.TestPoints(Point, Candidates, Results.GetData(), bExpanded, Expansion);
+
+		for (const uint8 bInside : Results) { if (bInside) { return true; } }
+		return false;
+	}
+
 	void FCollection::FindContaining(const FVector& Point, TArray<int32>& OutIndices, EPCGExBoxCheckMode Mode, float Expansion) const
 	{
 		if (!Octree)
@@ -126,6 +149,19 @@ namespace PCGExMath::OBB
 
 		const FBoxCenterAndExtent QueryBounds(Point, FVector4(Expansion, Expansion, Expansion, Expansion));
 
+		if (IsBatched(Mode))
+		{
+			BatchQuery::FCandidates Candidates;
+			GatherCandidates(QueryBounds, Candidates);
+
+			BatchQuery::FResults Results;
+			Results.SetNumUninitialized(Candidates.Num());
+			BatchStore.TestPoints(Point, Candidates, Results.GetData(), Mode == EPCGExBoxCheckMode::ExpandedBox, Expansion);
+
+			for (int32 i = 0; i < Candidates.Num(); i++) { if (Results[i]) { OutIndices.Add(Bounds[Candidates[i]].Index); } }
+			return;
+		}
+
 		Octree->FindElementsWithBoundsTest(QueryBounds, [&](const PCGExOctree::FItem& Item)
 		{
 			if (TestPoint(GetOBB(Item.Index), Point, Mode, Expansion))
@@ -194,6 +230,19 @@ namespace PCGExMath::OBB
 		const float R = Query.Bounds.Radius + Expansion;
 		const FBoxCenterAndExtent QueryBounds(Query.Bounds.Origin, FVector4(R, R, R, R));
 
+		if (IsBatched(Mode))
+		{
+			BatchQuery::FCandidates Candidates;
+			GatherCandidates(QueryBounds, Candidates);
+
+			BatchQuery::FResults Results;
+			Results.SetNumUninitialized(Candidates.Num());
+			BatchStore.TestOverlaps(Query, Candidates, Results.GetData(), Mode == EPCGExBoxCheckMode::ExpandedBox, Expansion);
+
+			for (int32 i = 0; i < Candidates.Num(); i++) { if (Results[i]) { OutIndices.Add(Bounds[Candidates[i]].Index); } }
+			return;
+		}
+
 		Octree->FindElementsWithBoundsTest(QueryBounds, [&](const PCGExOctree::FItem& Item)
 		{
 			if (TestOverlap(GetOBB(Item.Index), Query, Mode, Expansion))
@@ -210,12 +259,15 @@ namespace PCGExMath::OBB
 			return false;
 		}
 
-		const FBoxCenterAndExtent QueryBounds = IO.GetBounds();
+		BatchQuery::FCandidates Candidates;
+		GatherCandidates(IO.GetBounds(), Candidates);
 
-		Octree->FindElementsWithBoundsTest(QueryBounds, [&](const PCGExOctree::FItem& Item)
-		{
-			ProcessSegment(GetOBB(Item.Index), IO, CloudIndex);
-		});
+		// Cull certain misses before the full intersection
+		BatchQuery::FResults Results;
+		Results.SetNumUninitialized(Candidates.Num());
+		BatchStore.MaySegmentIntersect(IO.Start, IO.End, Candidates, Results.GetData());
+
+		for (int32 i = 0; i < Candidates.Num(); i++) { if (Results[i]) { ProcessSegment(GetOBB(Candidates[i]), IO, CloudIndex); } }
 
 		return !IO.IsEmpty();
 	}
@@ -230,20 +282,16 @@ namespace PCGExMath::OBB
 		FBox SegBox(ForceInit);
 		SegBox += Start;
 		SegBox += End;
-		const FBoxCenterAndExtent QueryBounds(SegBox);
+		BatchQuery::FCandidates Candidates;
+		GatherCandidates(FBoxCenterAndExtent(SegBox), Candidates);
 
-		bool bFound = false;
-		Octree->FindFirstElementWithBoundsTest(QueryBounds, [&](const PCGExOctree::FItem& Item) -> bool
-		{
-			if (SegmentIntersects(GetOBB(Item.Index), Start, End))
-			{
-				bFound = true;
-				return false;
-			}
-			return true;
-		});
+		BatchQuery::FResults Results;
+		Results.SetNumUninitialized(Candidates.Num());
+		BatchStore.MaySegmentIntersect(Start, End, Candidates, Results.GetData());
 
-		return bFound;
+		for (int32 i = 0; i < Candidates.Num(); i++) { if (Results[i] && SegmentIntersects(GetOBB(Candidates[i]), Start, End)) { return true; } }
+
+		return false;
 	}
 
 	void FCollection::ClassifyPoints(TArrayView<const FVector> Points, TBitArray<>& OutInside, EPCGExBoxCheckMode Mode, float Expansion) const
@@ -251,6 +299,15 @@ namespace PCGExMath::OBB
 		const int32 N = Points.Num();
 		OutInside.Init(false, N);
 
+		if (!Octree) { return; }
+
+		if (IsBatched(Mode))
+		{
+			const bool bExpanded = Mode == EPCGExBoxCheckMode::ExpandedBox;
+			for (int32 i = 0; i < N; i++) { OutInside[i] = IsPointInsideBatched(Points[i], bExpanded, Expansion); }
+			return;
+		}
+
 		for (int32 i = 0; i < N; i++)
 		{
 			OutInside[i] = IsPointInside(Points[i], Mode, Expansion);
@@ -262,6 +319,15 @@ namespace PCGExMath::OBB
 		const int32 N = Points.Num();
 		OutIndices.Reserve(N / 4);
 
+		if (!Octree) { return; }
+
+		if (IsBatched(Mode))
+		{
+			const bool bExpanded = Mode == EPCGExBoxCheckMode::ExpandedBox;
+			for (int32 i = 0; i < N; i++) { if (IsPointInsideBatched(Points[i], bExpanded, Expansion)) { OutIndices.Add(i); } }
+			return;
+		}
+
 		for (int32 i = 0; i < N; i++)
 		{
 			if (IsPointInside(Points[i], Mode, Expansion))
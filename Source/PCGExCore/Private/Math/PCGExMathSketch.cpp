@@ -0,0 +1,172 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExMathSketch.h"
+
+namespace PCGExMath
+{
+	FHyperLogLog::FHyperLogLog()
+		: FHyperLogLog(12)
+	{
+	}
+
+	FHyperLogLog::FHyperLogLog(const int32 InPrecision)
+		: Precision(FMath::Clamp(InPrecision, 4, 16))
+	{
+		Registers.Init(0, 1 << Precision);
+	}
+
+	void FHyperLogLog::Merge(const FHyperLogLog& Other)
+	{
+		check(Other.Precision == Precision)
+		for (int32 i = 0; i < Registers.Num(); i++) { Registers[i] = FMath::Max(Registers[i], Other.Registers[i]); }
+	}
+
+	double FHyperLogLog::Estimate() const
+	{
+		const int32 M = Registers.Num();
+		const double DM = M;
+
+		double Alpha = 0.7213 / (1 + 1.079 / DM);
+		if (M == 16) { Alpha = 0.673; }
+		else if (M == 32) { Alpha = 0.697; }
+		else if (M == 64) { Alpha = 0.709; }
+
+		double Sum = 0;
+		int32 NumZeros = 0;
+		for (const uint8 R : Registers)
+		{
+			Sum += FMath::Pow(2.0, -static_cast<double>(R));
+			if (R == 0) { NumZeros++; }
+		}
+
+		const double Raw = Alpha * DM * DM / Sum;
+
+		// Small range correction, linear counting is more accurate there
+		if (Raw <= 2.5 * DM && NumZeros > 0) { return DM * FMath::Loge(DM / static_cast<double>(NumZeros)); }
+
+		return Raw;
+	}
+
+	void FHyperLogLog::Reset()
+	{
+		for (uint8& R : Registers) { R = 0; }
+	}
+
+	FQuantileSketch::FQuantileSketch(const int32 InK)
+		: K(FMath::Max(8, InK))
+	{
+	}
+
+	int32 FQuantileSketch::GetLevelCapacity(const int32 Level) const
+	{
+		const int32 Depth = Levels.Num() - 1 - Level;
+		return FMath::Max(2, FMath::CeilToInt32(K * FMath::Pow(2.0 / 3.0, static_cast<double>(Depth))));
+	}
+
+	int32 FQuantileSketch::GetTotalCapacity() const
+	{
+		int32 Total = 0;
+		for (int32 i = 0; i < Levels.Num(); i++) { Total += GetLevelCapacity(i); }
+		return Total;
+	}
+
+	void FQuantileSketch::Compress()
+	{
+		for (int32 h = 0; h < Levels.Num(); h++)
+		{
+			if (Levels[h].Num() < GetLevelCapacity(h)) { continue; }
+
+			if (h + 1 == Levels.Num()) { Levels.Emplace(); }
+
+			TArray<double>& Level = Levels[h];
+			TArray<double>& NextLevel = Levels[h + 1];
+
+			Level.Sort();
+
+			// Compact an even number of items; an odd leftover stays at this level so total weight is preserved
+			const int32 NumCompacted = Level.Num() & ~1;
+			const int32 Offset = (CompactionCounter++) & 1;
+
+			NextLevel.Reserve(NextLevel.Num() + NumCompacted / 2);
+			for (int32 i = Offset; i < NumCompacted; i += 2) { NextLevel.Add(Level[i]); }
+
+			Level.RemoveAt(0, NumCompacted, EAllowShrinking::No);
+			NumRetained -= NumCompacted / 2;
+
+			return;
+		}
+	}
+
+	void FQuantileSketch::Add(const double Value)
+	{
+		if (Levels.IsEmpty()) { Levels.Emplace(); }
+
+		Levels[0].Add(Value);
+		NumRetained++;
+		N++;
+
+		MinValue = FMath::Min(MinValue, Value);
+		MaxValue = FMath::Max(MaxValue, Value);
+
+		while (NumRetained >= GetTotalCapacity()) { Compress(); }
+	}
+
+	void FQuantileSketch::Merge(const FQuantileSketch& Other)
+	{
+		if (Other.IsEmpty()) { return; }
+
+		if (Levels.Num() < Other.Levels.Num()) { Levels.SetNum(Other.Levels.Num()); }
+		for (int32 h = 0; h < Other.Levels.Num(); h++) { Levels[h].Append(Other.Levels[h]); }
+
+		N += Other.N;
+		NumRetained += Other.NumRetained;
+		MinValue = FMath::Min(MinValue, Other.MinValue);
+		MaxValue = FMath::Max(MaxValue, Other.MaxValue);
+
+		while (NumRetained >= GetTotalCapacity()) { Compress(); }
+	}
+
+	double FQuantileSketch::GetQuantile(const double Q) const
+	{
+		if (N == 0) { return 0; }
+		if (Q <= 0) { return MinValue; }
+		if (Q >= 1) { return MaxValue; }
+
+		TArray<TPair<double, int64>> Weighted;
+		Weighted.Reserve(NumRetained);
+
+		int64 TotalWeight = 0;
+		for (int32 h = 0; h < Levels.Num(); h++)
+		{
+			const int64 Weight = 1ll << h;
+			for (const double V : Levels[h])
+			{
+				Weighted.Emplace(V, Weight);
+				TotalWeight += Weight;
+			}
+		}
+
+		Weighted.Sort([](const TPair<double, int64>& A, const TPair<double, int64>& B) { return A.Key < B.Key; });
+
+		const double Target = Q * static_cast<double>(TotalWeight);
+		int64 Cumulative = 0;
+		for (const TPair<double, int64>& Item : Weighted)
+		{
+			Cumulative += Item.Value;
+			if (static_cast<double>(Cumulative) >= Target) { return Item.Key; }
+		}
+
+		return MaxValue;
+	}
+
+	void FQuantileSketch::Reset()
+	{
+		Levels.Empty();
+		N = 0;
+		NumRetained = 0;
+		CompactionCounter = 0;
+		MinValue = MAX_dbl;
+		MaxValue = MIN_dbl_neg;
+	}
+}
@@ -0,0 +1,403 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExToleranceGrid.h"
+
+#include "Algo/BinarySearch.h"
+#include "Core/PCGExMTCommon.h"
+#include "Data/PCGBasePointData.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExMath
+{
+	namespace ToleranceGrid
+	{
+		constexpr int64 MaxCell = (1ll << FToleranceGrid::CellBits) - 1;
+		constexpr uint64 CellMask = static_cast<uint64>(MaxCell);
+
+		// Parallel rounds stop once a round decides less than 1/StallRatio of what was left undecided
+		constexpr int32 StallRatio = 16;
+		constexpr int32 MaxParallelRounds = 32;
+
+		FORCEINLINE uint64 PackCell(const int64 CX, const int64 CY, const int64 CZ)
+		{
+			return static_cast<uint64>(CX) | (static_cast<uint64>(CY) << FToleranceGrid::CellBits) | (static_cast<uint64>(CZ) << (FToleranceGrid::CellBits * 2));
+		}
+	}
+
+	FToleranceGrid::FToleranceGrid(const FVector& InTolerance, const bool bInComponentWise, const bool bInInclusive)
+		: Tolerance(bInComponentWise ? InTolerance : FVector(InTolerance.X)), bComponentWise(bInComponentWise), bInclusive(bInInclusive)
+	{
+		ToleranceSquared = Tolerance * Tolerance;
+	}
+
+	void FToleranceGrid::Build(TConstArrayView<FVector> InPositions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FToleranceGrid::Build);
+
+		using namespace ToleranceGrid;
+
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+		Indices.Reset();
+		CellKeys.Reset();
+		CellStarts.Reset();
+		CellMap.Reset();
+
+		NumPoints = InPositions.Num();
+		if (!NumPoints)
+		{
+			CellStarts.Add(0);
+			return;
+		}
+
+		FBox Bounds(ForceInit);
+		for (const FVector& Position : InPositions) { Bounds += Position; }
+
+		// Cells are slightly larger than the tolerance so rounding can never push a pair within tolerance two cells apart,
+		// and grow past it only when the bounds would not fit in CellBits per axis
+		const FVector Size = Bounds.GetSize();
+		FVector CellSize;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			CellSize[Axis] = FMath::Max3(Tolerance[Axis] * (1 + 1e-6), Size[Axis] / (MaxCell - 1), UE_SMALL_NUMBER);
+		}
+
+		Origin = Bounds.Min;
+		InvCellSize = FVector::OneVector / CellSize;
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumPoints);
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			const FVector Local = (InPositions[i] - Origin) * InvCellSize;
+			Keys[i] = PCGEx::FIndexKey(
+				i, PackCell(
+					FMath::Clamp<int64>(FMath::FloorToInt64(Local.X), 0, MaxCell),
+					FMath::Clamp<int64>(FMath::FloorToInt64(Local.Y), 0, MaxCell),
+					FMath::Clamp<int64>(FMath::FloorToInt64(Local.Z), 0, MaxCell)));
+		)
+
+		// Stable, so positions within a cell stay in index order
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		X.SetNumUninitialized(NumPoints + Lanes);
+		Y.SetNumUninitialized(NumPoints + Lanes);
+		Z.SetNumUninitialized(NumPoints + Lanes);
+		Indices.SetNumUninitialized(NumPoints + Lanes);
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints + Lanes,
+			const int32 Index = Keys[FMath::Min(i, NumPoints - 1)].Index;
+			const FVector& Position = InPositions[Index];
+			X[i] = Position.X;
+			Y[i] = Position.Y;
+			Z[i] = Position.Z;
+			Indices[i] = Index;
+		)
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (i > 0 && Keys[i].Key == Keys[i - 1].Key) { continue; }
+			CellMap.Add(Keys[i].Key, CellKeys.Num());
+			CellKeys.Add(Keys[i].Key);
+			CellStarts.Add(i);
+		}
+
+		CellStarts.Add(NumPoints);
+	}
+
+	void FToleranceGrid::Build(const UPCGBasePointData* InData)
+	{
+		TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
+
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(Transforms.Num());
+		PCGEX_PARALLEL_FOR(Transforms.Num(), Positions[i] = Transforms[i].GetLocation();)
+
+		Build(Positions);
+	}
+
+	void FToleranceGrid::CountNeighbors(TArrayView<int32> OutCounts, TArrayView<int32> OutLowerCounts) const
+	{
+		check(OutCounts.Num() == NumPoints);
+		check(OutLowerCounts.IsEmpty() || OutLowerCounts.Num() == NumPoints);
+
+		if (bComponentWise)
+		{
+			if (bInclusive) { CountNeighborsImpl<true, true>(OutCounts, OutLowerCounts); }
+			else { CountNeighborsImpl<true, false>(OutCounts, OutLowerCounts); }
+		}
+		else
+		{
+			if (bInclusive) { CountNeighborsImpl<false, true>(OutCounts, OutLowerCounts); }
+			else { CountNeighborsImpl<false, false>(OutCounts, OutLowerCounts); }
+		}
+	}
+
+	void FToleranceGrid::Fuse(TArray<int32>& OutLeaders) const
+	{
+		if (bComponentWise)
+		{
+			if (bInclusive) { FuseImpl<true, true>(OutLeaders); }
+			else { FuseImpl<true, false>(OutLeaders); }
+		}
+		else
+		{
+			if (bInclusive) { FuseImpl<false, true>(OutLeaders); }
+			else { FuseImpl<false, false>(OutLeaders); }
+		}
+	}
+
+	SIZE_T FToleranceGrid::GetAllocatedSize() const
+	{
+		return X.GetAllocatedSize() + Y.GetAllocatedSize() + Z.GetAllocatedSize() + Indices.GetAllocatedSize()
+			+ CellKeys.GetAllocatedSize() + CellStarts.GetAllocatedSize() + CellMap.GetAllocatedSize();
+	}
+
+	void FToleranceGrid::GetNeighborCells(const int32 CellIndex, TArray<int32, TInlineAllocator<27>>& OutCells) const
+	{
+		using namespace ToleranceGrid;
+
+		OutCells.Reset();
+
+		const uint64 Key = CellKeys[CellIndex];
+		const int64 CX = static_cast<int64>(Key & CellMask);
+		const int64 CY = static_cast<int64>((Key >> CellBits) & CellMask);
+		const int64 CZ = static_cast<int64>((Key >> (CellBits * 2)) & CellMask);
+
+		for (int64 NZ = FMath::Max<int64>(0, CZ - 1); NZ <= FMath::Min(MaxCell, CZ + 1); NZ++)
+		{
+			for (int64 NY = FMath::Max<int64>(0, CY - 1); NY <= FMath::Min(MaxCell, CY + 1); NY++)
+			{
+				for (int64 NX = FMath::Max<int64>(0, CX - 1); NX <= FMath::Min(MaxCell, CX + 1); NX++)
+				{
+					if (const int32* Cell = CellMap.Find(PackCell(NX, NY, NZ))) { OutCells.Add(*Cell); }
+				}
+			}
+		}
+	}
+
+	template <bool bInComponentWise, bool bInInclusive, typename FuncType>
+	FORCEINLINE void FToleranceGrid::ForEachWithin(const int32 Slot, const int32 CellIndex, FuncType&& Func) const
+	{
+		// Same arithmetic as FVector::DistSquared / FPCGExFuseDetailsBase::IsWithinToleranceComponentWise, one block of Lanes at a time
+		const double PX = X[Slot];
+		const double PY = Y[Slot];
+		const double PZ = Z[Slot];
+
+		const int32 End = CellStarts[CellIndex + 1];
+
+		for (int32 Base = CellStarts[CellIndex]; Base < End; Base += Lanes)
+		{
+			bool bWithin[Lanes];
+
+			for (int32 l = 0; l < Lanes; l++)
+			{
+				const double DX = X[Base + l] - PX;
+				const double DY = Y[Base + l] - PY;
+				const double DZ = Z[Base + l] - PZ;
+
+				if constexpr (bInComponentWise)
+				{
+					if constexpr (bInInclusive) { bWithin[l] = FMath::Abs(DX) <= Tolerance.X && FMath::Abs(DY) <= Tolerance.Y && FMath::Abs(DZ) <= Tolerance.Z; }
+					else { bWithin[l] = FMath::Abs(DX) < Tolerance.X && FMath::Abs(DY) < Tolerance.Y && FMath::Abs(DZ) < Tolerance.Z; }
+				}
+				else
+				{
+					const double DistSquared = DX * DX + DY * DY + DZ * DZ;
+					if constexpr (bInInclusive) { bWithin[l] = DistSquared <= ToleranceSquared.X; }
+					else { bWithin[l] = DistSquared < ToleranceSquared.X; }
+				}
+			}
+
+			const int32 Count = FMath::Min(Lanes, End - Base);
+			for (int32 l = 0; l < Count; l++) { if (bWithin[l] && !Func(Base + l)) { return; } }
+		}
+	}
+
+	template <bool bInComponentWise, bool bInInclusive>
+	void FToleranceGrid::CountNeighborsImpl(TArrayView<int32> OutCounts, TArrayView<int32> OutLowerCounts) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FToleranceGrid::CountNeighbors);
+
+		const bool bCountLower = !OutLowerCounts.IsEmpty();
+
+		PCGEX_PARALLEL_FOR(
+			GetNumCells(),
+
+			TArray<int32, TInlineAllocator<27>> Neighbors;
+			GetNeighborCells(i, Neighbors);
+
+			for (int32 Slot = CellStarts[i]; Slot < CellStarts[i + 1]; Slot++)
+			{
+				const int32 Index = Indices[Slot];
+				int32 Count = 0;
+				int32 LowerCount = 0;
+
+				for (const int32 Cell : Neighbors)
+				{
+					ForEachWithin<bInComponentWise, bInInclusive>(
+						Slot, Cell, [&](const int32 Other)
+						{
+							if (Other == Slot) { return true; }
+							Count++;
+							LowerCount += Indices[Other] < Index;
+							return true;
+						});
+				}
+
+				OutCounts[Index] = Count;
+				if (bCountLower) { OutLowerCounts[Index] = LowerCount; }
+			}
+		)
+	}
+
+	template <bool bInComponentWise, bool bInInclusive>
+	void FToleranceGrid::FuseImpl(TArray<int32>& OutLeaders) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FToleranceGrid::Fuse);
+
+		using namespace ToleranceGrid;
+
+		const int32 NumCells = GetNumCells();
+
+		OutLeaders.SetNumUninitialized(NumPoints);
+		if (!NumPoints) { return; }
+
+		// A slot is a leader when no lower neighbor is, and a follower as soon as one is.
+		// Decided states are final, so resolving in rounds or sequentially gives the same answer as the greedy insertion.
+		auto Resolve = [&](const TArray<uint8>& InStates, const int32 Slot, const TArray<int32, TInlineAllocator<27>>& Neighbors)
+		{
+			const int32 Index = Indices[Slot];
+			uint8 Result = Leader;
+
+			for (const int32 Cell : Neighbors)
+			{
+				ForEachWithin<bInComponentWise, bInInclusive>(
+					Slot, Cell, [&](const int32 Other)
+					{
+						if (Indices[Other] >= Index) { return true; }
+
+						const uint8 OtherState = InStates[Other];
+						if (OtherState == Leader)
+						{
+							Result = Follower;
+							return false;
+						}
+
+						if (OtherState == Undecided) { Result = Undecided; }
+						return true;
+					});
+
+				if (Result == Follower) { break; }
+			}
+
+			return Result;
+		};
+
+		TArray<uint8> States;
+		States.Init(Undecided, NumPoints + Lanes);
+
+		TArray<uint8> NextStates;
+		int32 NumUndecided = NumPoints;
+
+		for (int32 Round = 0; Round < MaxParallelRounds && NumUndecided > 0; Round++)
+		{
+			NextStates = States;
+			std::atomic<int32> NumDecided(0);
+
+			PCGEX_PARALLEL_FOR(
+				NumCells,
+
+				TArray<int32, TInlineAllocator<27>> Neighbors;
+				int32 LocalDecided = 0;
+
+				for (int32 Slot = CellStarts[i]; Slot < CellStarts[i + 1]; Slot++)
+				{
+					if (States[Slot] != Undecided) { continue; }
+					if (Neighbors.IsEmpty()) { GetNeighborCells(i, Neighbors); }
+
+					const uint8 State = Resolve(States, Slot, Neighbors);
+					if (State == Undecided) { continue; }
+
+					NextStates[Slot] = State;
+					LocalDecided++;
+				}
+
+				if (LocalDecided) { NumDecided += LocalDecided; }
+			)
+
+			Swap(States, NextStates);
+
+			// Chains only resolve one link per round; hand them over to the sequential pass once rounds stop paying off
+			const int32 Decided = NumDecided.load();
+			const int32 Remaining = NumUndecided;
+			NumUndecided -= Decided;
+			if (Decided * StallRatio < Remaining) { break; }
+		}
+
+		if (NumUndecided > 0)
+		{
+			TArray<int32> Pending;
+			Pending.Reserve(NumUndecided);
+			for (int32 Slot = 0; Slot < NumPoints; Slot++) { if (States[Slot] == Undecided) { Pending.Add(Slot); } }
+			Pending.Sort([&](const int32 A, const int32 B) { return Indices[A] < Indices[B]; });
+
+			// In index order, every lower neighbor is already decided
+			TArray<int32, TInlineAllocator<27>> Neighbors;
+			for (const int32 Slot : Pending)
+			{
+				GetNeighborCells(Algo::UpperBound(CellStarts, Slot) - 1, Neighbors);
+				States[Slot] = Resolve(States, Slot, Neighbors);
+				check(States[Slot] != Undecided);
+			}
+		}
+
+		// Followers join the closest lower leader, lowest leader index on ties
+		PCGEX_PARALLEL_FOR(
+			NumCells,
+
+			TArray<int32, TInlineAllocator<27>> Neighbors;
+
+			for (int32 Slot = CellStarts[i]; Slot < CellStarts[i + 1]; Slot++)
+			{
+				const int32 Index = Indices[Slot];
+
+				if (States[Slot] == Leader)
+				{
+					OutLeaders[Index] = Index;
+					continue;
+				}
+
+				if (Neighbors.IsEmpty()) { GetNeighborCells(i, Neighbors); }
+
+				double BestDistSquared = MAX_dbl;
+				int32 BestIndex = INDEX_NONE;
+
+				for (const int32 Cell : Neighbors)
+				{
+					ForEachWithin<bInComponentWise, bInInclusive>(
+						Slot, Cell, [&](const int32 Other)
+						{
+							const int32 OtherIndex = Indices[Other];
+							if (OtherIndex >= Index || States[Other] != Leader) { return true; }
+
+							const double DistSquared = FMath::Square(X[Other] - X[Slot]) + FMath::Square(Y[Other] - Y[Slot]) + FMath::Square(Z[Other] - Z[Slot]);
+							if (DistSquared < BestDistSquared || (DistSquared == BestDistSquared && OtherIndex < BestIndex))
+							{
+								BestDistSquared = DistSquared;
+								BestIndex = OtherIndex;
+							}
+
+							return true;
+						});
+				}
+
+				OutLeaders[Index] = BestIndex;
+			}
+		)
+	}
+}
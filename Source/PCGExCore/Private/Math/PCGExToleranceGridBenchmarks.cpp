@@ -0,0 +1,240 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBVH.h"
+#include "PCGExOctree.h"
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExMTCommon.h"
+#include "Math/PCGExToleranceGrid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Tolerance grid vs. per-point spatial queries on scan-like data, e.g. pcgex.Bench.Run Filter=Spatial.Tolerance.* Scales=1000000+10000000
+namespace PCGExMath
+{
+	namespace ToleranceGridBenchmark
+	{
+		constexpr double Tolerance = 1;
+		constexpr int32 Duplicates = 4;
+
+		// Clusters of Duplicates near-identical positions around random sites, like overlapping scans of the same surface
+		static void MakePositions(TArray<FVector>& OutPositions, const int32 InNum, const int32 InSeed = 1337)
+		{
+			TArray<FVector> Sites;
+			PCGExBenchmark::MakePositions(Sites, FMath::Max(1, InNum / Duplicates), true, 10000, InSeed);
+
+			FRandomStream Random(InSeed);
+			OutPositions.SetNumUninitialized(InNum);
+			for (int32 i = 0; i < InNum; i++)
+			{
+				OutPositions[i] = Sites[Random.RandHelper(Sites.Num())] + Random.GetUnitVector() * Random.FRandRange(0, Tolerance * 0.6);
+			}
+		}
+
+		static TSharedPtr<PCGExBVH::FItemBVH> MakeBVH(const TArray<FVector>& InPositions)
+		{
+			TSharedPtr<PCGExBVH::FItemBVH> BVH = MakeShared<PCGExBVH::FItemBVH>();
+			BVH->Build(InPositions.Num(), [&](const int32 Index, FBox& OutBounds)
+			{
+				OutBounds = FBox(InPositions[Index], InPositions[Index]);
+				return true;
+			});
+			return BVH;
+		}
+
+		static bool IsWithin(const FVector& A, const FVector& B, const FVector& InTolerance, const bool bComponentWise)
+		{
+			if (bComponentWise) { return FMath::Abs(A.X - B.X) < InTolerance.X && FMath::Abs(A.Y - B.Y) < InTolerance.Y && FMath::Abs(A.Z - B.Z) < InTolerance.Z; }
+			return FVector::DistSquared(A, B) < FMath::Square(InTolerance.X);
+		}
+
+		// One point at a time against an octree of leaders, the way FUnionGraph::InsertPoint fuses:
+		// closest leader wins, and of equidistant leaders the first one the octree visits
+		static void ReferenceFuse(const TArray<FVector>& InPositions, const FVector& InTolerance, const bool bComponentWise, TArray<int32>& OutLeaders)
+		{
+			FBox Bounds(InPositions);
+			PCGExOctree::FItemOctree Octree(Bounds.GetCenter(), Bounds.GetExtent().Length() + 1);
+
+			const FVector Extent = bComponentWise ? InTolerance : FVector(InTolerance.X);
+
+			OutLeaders.SetNumUninitialized(InPositions.Num());
+			for (int32 i = 0; i < InPositions.Num(); i++)
+			{
+				const FVector& Position = InPositions[i];
+				double BestDistSquared = MAX_dbl;
+				int32 BestIndex = INDEX_NONE;
+
+				Octree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Position, Extent), [&](const PCGExOctree::FItem& Item)
+				{
+					if (!IsWithin(Position, InPositions[Item.Index], InTolerance, bComponentWise)) { return; }
+
+					const double DistSquared = FVector::DistSquared(Position, InPositions[Item.Index]);
+					if (DistSquared < BestDistSquared)
+					{
+						BestDistSquared = DistSquared;
+						BestIndex = Item.Index;
+					}
+				});
+
+				if (BestIndex != INDEX_NONE)
+				{
+					OutLeaders[i] = BestIndex;
+					continue;
+				}
+
+				OutLeaders[i] = i;
+				Octree.AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(Position, FVector::ZeroVector, 0)));
+			}
+		}
+	}
+
+	static PCGExBenchmark::FKernel MakeCountKernel(const int32 Scale, const bool bGrid)
+	{
+		TArray<FVector> Positions;
+		ToleranceGridBenchmark::MakePositions(Positions, Scale);
+
+		TArray<int32> Counts;
+		Counts.SetNumUninitialized(Scale);
+
+		if (bGrid)
+		{
+			return [Positions = MoveTemp(Positions), Counts = MoveTemp(Counts)]() mutable
+			{
+				FToleranceGrid Grid(FVector(ToleranceGridBenchmark::Tolerance));
+				Grid.Build(Positions);
+				Grid.CountNeighbors(Counts);
+			};
+		}
+
+		return [Positions = MoveTemp(Positions), Counts = MoveTemp(Counts)]() mutable
+		{
+			const TSharedPtr<PCGExBVH::FItemBVH> BVH = ToleranceGridBenchmark::MakeBVH(Positions);
+			PCGEX_PARALLEL_FOR(
+				Positions.Num(),
+				int32 Count = 0;
+				BVH->FindElementsWithinRadius(Positions[i], ToleranceGridBenchmark::Tolerance, [&](const int32 Other) { Count += Other != i; });
+				Counts[i] = Count;
+			)
+		};
+	}
+
+	static PCGExBenchmark::FKernel MakeFuseKernel(const int32 Scale, const bool bGrid)
+	{
+		TArray<FVector> Positions;
+		ToleranceGridBenchmark::MakePositions(Positions, Scale);
+
+		if (bGrid)
+		{
+			return [Positions = MoveTemp(Positions), Leaders = TArray<int32>()]() mutable
+			{
+				FToleranceGrid Grid(FVector(ToleranceGridBenchmark::Tolerance), false, false);
+				Grid.Build(Positions);
+				Grid.Fuse(Leaders);
+			};
+		}
+
+		return [Positions = MoveTemp(Positions), Leaders = TArray<int32>()]() mutable
+		{
+			ToleranceGridBenchmark::ReferenceFuse(Positions, FVector(ToleranceGridBenchmark::Tolerance), false, Leaders);
+		};
+	}
+
+	static PCGExBenchmark::FPairRegistrar BenchCount(
+		TEXT("Spatial.Tolerance.Count"), TEXT("Collocation count over N scan-like points"),
+		{TEXT("BVH"), TEXT("BVH build + one radius query per point")}, {TEXT("Grid"), TEXT("tolerance grid build + count")}, &MakeCountKernel);
+
+	static PCGExBenchmark::FPairRegistrar BenchFuse(
+		TEXT("Spatial.Tolerance.Fuse"), TEXT("Greedy fuse of N scan-like points"),
+		{TEXT("Octree"), TEXT("sequential octree insertion")}, {TEXT("Grid"), TEXT("tolerance grid build + parallel fuse")}, &MakeFuseKernel);
+
+	static PCGExBenchmark::FCheckRegistrar CheckToleranceGrid(
+		TEXT("Spatial.ToleranceGrid"), TEXT("Tolerance grid counts against BVH queries, and grid fuse against sequential octree insertion"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			constexpr int32 Num = 100000;
+
+			TArray<FVector> Positions;
+			ToleranceGridBenchmark::MakePositions(Positions, Num, 42);
+
+			{
+				FToleranceGrid Grid(FVector(ToleranceGridBenchmark::Tolerance));
+				Grid.Build(Positions);
+
+				TArray<int32> Counts;
+				TArray<int32> LowerCounts;
+				Counts.SetNumUninitialized(Num);
+				LowerCounts.SetNumUninitialized(Num);
+				Grid.CountNeighbors(Counts, LowerCounts);
+
+				const TSharedPtr<PCGExBVH::FItemBVH> BVH = ToleranceGridBenchmark::MakeBVH(Positions);
+				for (int32 i = 0; i < Num; i++)
+				{
+					int32 Count = 0;
+					int32 LowerCount = 0;
+					BVH->FindElementsWithinRadius(Positions[i], ToleranceGridBenchmark::Tolerance, [&](const int32 Other)
+					{
+						if (Other == i) { return; }
+						Count++;
+						LowerCount += Other < i;
+					});
+
+					Context.Test(Count == Counts[i], TEXT("Count, point %d (expected %d, got %d)"), i, Count, Counts[i]);
+					Context.Test(LowerCount == LowerCounts[i], TEXT("Lower count, point %d (expected %d, got %d)"), i, LowerCount, LowerCounts[i]);
+				}
+			}
+
+			// Random positions never sit exactly between two leaders, so the result must match insertion exactly
+			for (int32 Mode = 0; Mode < 2; Mode++)
+			{
+				const bool bComponentWise = Mode == 1;
+				const FVector Tolerance = bComponentWise ? FVector(1, 0.5, 2) : FVector(ToleranceGridBenchmark::Tolerance);
+
+				FToleranceGrid Grid(Tolerance, bComponentWise, false);
+				Grid.Build(Positions);
+
+				TArray<int32> Leaders;
+				Grid.Fuse(Leaders);
+
+				TArray<int32> Expected;
+				ToleranceGridBenchmark::ReferenceFuse(Positions, Tolerance, bComponentWise, Expected);
+
+				for (int32 i = 0; i < Num; i++) { Context.Test(Expected[i] == Leaders[i], TEXT("%s, point %d (expected %d, got %d)"), bComponentWise ? TEXT("Fuse (component-wise)") : TEXT("Fuse"), i, Expected[i], Leaders[i]); }
+			}
+
+			// On a shuffled lattice many points are exactly as far from two earlier leaders. The grid takes the lowest leader index,
+			// insertion takes whichever leader its octree visits first; any other difference is an error.
+			{
+				constexpr int32 Side = 24;
+
+				TArray<FVector> Lattice;
+				Lattice.Reserve(Side * Side * Side);
+				for (int32 x = 0; x < Side; x++) { for (int32 y = 0; y < Side; y++) { for (int32 z = 0; z < Side; z++) { Lattice.Add(FVector(x, y, z) * 10); } } }
+
+				FRandomStream Random(7);
+				for (int32 i = Lattice.Num() - 1; i > 0; i--) { Lattice.Swap(i, Random.RandRange(0, i)); }
+
+				const FVector Tolerance(10.5);
+
+				FToleranceGrid Grid(Tolerance, false, false);
+				Grid.Build(Lattice);
+
+				TArray<int32> Leaders;
+				Grid.Fuse(Leaders);
+
+				TArray<int32> Expected;
+				ToleranceGridBenchmark::ReferenceFuse(Lattice, Tolerance, false, Expected);
+
+				for (int32 i = 0; i < Lattice.Num(); i++)
+				{
+					if (Expected[i] == Leaders[i]) { continue; }
+
+					const bool bBothLeaders = Expected[Expected[i]] == Expected[i] && Leaders[Leaders[i]] == Leaders[i];
+					const bool bTie = FVector::DistSquared(Lattice[i], Lattice[Expected[i]]) == FVector::DistSquared(Lattice[i], Lattice[Leaders[i]]);
+
+					Context.Test(bBothLeaders && bTie && Leaders[i] < Expected[i], TEXT("Lattice fuse, point %d (expected %d, got %d), not a leader tie"), i, Expected[i], Leaders[i]);
+				}
+			}
+		});
+}
+
+#endif
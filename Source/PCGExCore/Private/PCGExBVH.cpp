@@ -0,0 +1,366 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBVH.h"
+
+#include <cmath>
+
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExBVH
+{
+	namespace Internal
+	{
+		FORCEINLINE float FloatDown(const double Value)
+		{
+			const float F = static_cast<float>(Value);
+			return static_cast<double>(F) > Value ? std::nextafter(F, -MAX_flt) : F;
+		}
+
+		FORCEINLINE float FloatUp(const double Value)
+		{
+			const float F = static_cast<float>(Value);
+			return static_cast<double>(F) < Value ? std::nextafter(F, MAX_flt) : F;
+		}
+
+		// Spreads the lower 21 bits of Value so there are two zero bits between each of them
+		FORCEINLINE uint64 SplitBy3(const uint32 Value)
+		{
+			uint64 X = Value & 0x1FFFFF;
+			X = (X | X << 32) & 0x1F00000000FFFFull;
+			X = (X | X << 16) & 0x1F0000FF0000FFull;
+			X = (X | X << 8) & 0x100F00F00F00F00Full;
+			X = (X | X << 4) & 0x10C30C30C30C30C3ull;
+			X = (X | X << 2) & 0x1249249249249249ull;
+			return X;
+		}
+
+		struct FMortonItem
+		{
+			uint64 Code;
+			int32 Index;
+
+			FORCEINLINE bool operator<(const FMortonItem& Other) const
+			{
+				return Code == Other.Code ? Index < Other.Index : Code < Other.Code;
+			}
+		};
+	}
+
+#pragma region FBoundsSoA
+
+	void FBoundsSoA::SetNumUninitialized(const int32 InNum)
+	{
+		MinX.SetNumUninitialized(InNum);
+		MinY.SetNumUninitialized(InNum);
+		MinZ.SetNumUninitialized(InNum);
+		MaxX.SetNumUninitialized(InNum);
+		MaxY.SetNumUninitialized(InNum);
+		MaxZ.SetNumUninitialized(InNum);
+	}
+
+	void FBoundsSoA::Set(const int32 Index, const FBox& InBox)
+	{
+		MinX[Index] = Internal::FloatDown(InBox.Min.X);
+		MinY[Index] = Internal::FloatDown(InBox.Min.Y);
+		MinZ[Index] = Internal::FloatDown(InBox.Min.Z);
+		MaxX[Index] = Internal::FloatUp(InBox.Max.X);
+		MaxY[Index] = Internal::FloatUp(InBox.Max.Y);
+		MaxZ[Index] = Internal::FloatUp(InBox.Max.Z);
+	}
+
+	void FBoundsSoA::SetUnion(const int32 Index, const FBoundsSoA& Source, const int32 Start, const int32 End)
+	{
+		float X0 = Source.MinX[Start], Y0 = Source.MinY[Start], Z0 = Source.MinZ[Start];
+		float X1 = Source.MaxX[Start], Y1 = Source.MaxY[Start], Z1 = Source.MaxZ[Start];
+
+		for (int32 i = Start + 1; i < End; i++)
+		{
+			X0 = FMath::Min(X0, Source.MinX[i]);
+			Y0 = FMath::Min(Y0, Source.MinY[i]);
+			Z0 = FMath::Min(Z0, Source.MinZ[i]);
+			X1 = FMath::Max(X1, Source.MaxX[i]);
+			Y1 = FMath::Max(Y1, Source.MaxY[i]);
+			Z1 = FMath::Max(Z1, Source.MaxZ[i]);
+		}
+
+		MinX[Index] = X0;
+		MinY[Index] = Y0;
+		MinZ[Index] = Z0;
+		MaxX[Index] = X1;
+		MaxY[Index] = Y1;
+		MaxZ[Index] = Z1;
+	}
+
+	FBox FBoundsSoA::Get(const int32 Index) const
+	{
+		return FBox(FVector(MinX[Index], MinY[Index], MinZ[Index]), FVector(MaxX[Index], MaxY[Index], MaxZ[Index]));
+	}
+
+	SIZE_T FBoundsSoA::GetAllocatedSize() const
+	{
+		return MinX.GetAllocatedSize() + MinY.GetAllocatedSize() + MinZ.GetAllocatedSize() +
+			MaxX.GetAllocatedSize() + MaxY.GetAllocatedSize() + MaxZ.GetAllocatedSize();
+	}
+
+	void FBoundsSoA::Empty()
+	{
+		MinX.Empty();
+		MinY.Empty();
+		MinZ.Empty();
+		MaxX.Empty();
+		MaxY.Empty();
+		MaxZ.Empty();
+	}
+
+#pragma endregion
+
+#pragma region FQueryBox
+
+	FQueryBox::FQueryBox(const FBox& InBox)
+	{
+		Min[0] = Internal::FloatDown(InBox.Min.X);
+		Min[1] = Internal::FloatDown(InBox.Min.Y);
+		Min[2] = Internal::FloatDown(InBox.Min.Z);
+		Max[0] = Internal::FloatUp(InBox.Max.X);
+		Max[1] = Internal::FloatUp(InBox.Max.Y);
+		Max[2] = Internal::FloatUp(InBox.Max.Z);
+	}
+
+	FQueryBox::FQueryBox(const FBoxCenterAndExtent& InBounds)
+		: FQueryBox(InBounds.GetBox())
+	{
+	}
+
+#pragma endregion
+
+#pragma region FItemBVH
+
+	void FItemBVH::Build(const int32 NumItems, FGetItemBounds GetItemBounds)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FItemBVH::Build);
+
+		Reset();
+		if (NumItems <= 0) { return; }
+
+		TArray<FBox> Boxes;
+		Boxes.SetNumUninitialized(NumItems);
+
+		TArray<int8> Mask;
+		Mask.SetNumUninitialized(NumItems);
+
+		PCGEX_PARALLEL_FOR(
+			NumItems,
+			Mask[i] = GetItemBounds(i, Boxes[i]) && Boxes[i].IsValid;
+		)
+
+		TArray<Internal::FMortonItem> Sorted;
+		Sorted.Reserve(NumItems);
+
+		FBox CenterBounds(ForceInit);
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			if (!Mask[i]) { continue; }
+			Sorted.Add(Internal::FMortonItem{0, i});
+			CenterBounds += Boxes[i].GetCenter();
+		}
+
+		const int32 NumValid = Sorted.Num();
+		if (!NumValid) { return; }
+
+		// Quantize centers on a 2^21 grid per axis
+		constexpr double GridMax = static_cast<double>((1 << 21) - 1);
+		const FVector Origin = CenterBounds.Min;
+		const FVector Size = CenterBounds.GetSize();
+		const FVector Scale(
+			Size.X > 0 ? GridMax / Size.X : 0,
+			Size.Y > 0 ? GridMax / Size.Y : 0,
+			Size.Z > 0 ? GridMax / Size.Z : 0);
+
+		PCGEX_PARALLEL_FOR(
+			NumValid,
+			const FVector Cell = (Boxes[Sorted[i].Index].GetCenter() - Origin) * Scale;
+			Sorted[i].Code =
+			Internal::SplitBy3(static_cast<uint32>(FMath::Clamp(Cell.X, 0.0, GridMax))) |
+			Internal::SplitBy3(static_cast<uint32>(FMath::Clamp(Cell.Y, 0.0, GridMax))) << 1 |
+			Internal::SplitBy3(static_cast<uint32>(FMath::Clamp(Cell.Z, 0.0, GridMax))) << 2;
+		)
+
+		Sorted.Sort();
+
+		Items.SetNumUninitialized(NumValid);
+		ItemBounds.SetNumUninitialized(NumValid);
+
+		PCGEX_PARALLEL_FOR(
+			NumValid,
+			Items[i] = Sorted[i].Index;
+			ItemBounds.Set(i, Boxes[Items[i]]);
+		)
+
+		Boxes.Empty();
+		Sorted.Empty();
+
+		// Level layout; leaves first, up to a single root
+		int32 LevelCount = FMath::DivideAndRoundUp(NumValid, LeafSize);
+		LevelStart.Add(0);
+		LevelStart.Add(LevelCount);
+		while (LevelCount > 1)
+		{
+			LevelCount = FMath::DivideAndRoundUp(LevelCount, BranchingFactor);
+			LevelStart.Add(LevelStart.Last() + LevelCount);
+		}
+
+		BuildNodeBounds(ItemBounds, NodeBounds);
+	}
+
+	void FItemBVH::BuildNodeBounds(const FBoundsSoA& InItemBounds, FBoundsSoA& OutNodeBounds) const
+	{
+		const int32 NumItems = InItemBounds.Num();
+		OutNodeBounds.SetNumUninitialized(LevelStart.Last());
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes(0),
+			OutNodeBounds.SetUnion(i, InItemBounds, i * LeafSize, FMath::Min((i + 1) * LeafSize, NumItems));
+		)
+
+		for (int32 Level = 1; Level < NumLevels(); Level++)
+		{
+			const int32 ChildStart = LevelStart[Level - 1];
+			const int32 NumChildren = NumNodes(Level - 1);
+			const int32 Start = LevelStart[Level];
+
+			PCGEX_PARALLEL_FOR(
+				NumNodes(Level),
+				OutNodeBounds.SetUnion(Start + i, OutNodeBounds, ChildStart + i * BranchingFactor, ChildStart + FMath::Min((i + 1) * BranchingFactor, NumChildren));
+			)
+		}
+	}
+
+	void FItemBVH::Refit(FGetRefitBounds GetItemBounds, FRefitBounds& OutRefit) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FItemBVH::Refit);
+
+		OutRefit.ItemBounds.Empty();
+		OutRefit.NodeBounds.Empty();
+		if (Items.IsEmpty()) { return; }
+
+		OutRefit.ItemBounds.SetNumUninitialized(Items.Num());
+		PCGEX_PARALLEL_FOR(
+			Items.Num(),
+			OutRefit.ItemBounds.Set(i, GetItemBounds(Items[i]));
+		)
+
+		BuildNodeBounds(OutRefit.ItemBounds, OutRefit.NodeBounds);
+	}
+
+	void FItemBVH::Reset()
+	{
+		Items.Empty();
+		ItemBounds.Empty();
+		NodeBounds.Empty();
+		LevelStart.Empty();
+	}
+
+	FBox FItemBVH::GetBounds() const
+	{
+		if (Items.IsEmpty()) { return FBox(ForceInit); }
+		return NodeBounds.Get(NodeBounds.Num() - 1);
+	}
+
+	SIZE_T FItemBVH::GetAllocatedSize() const
+	{
+		return Items.GetAllocatedSize() + ItemBounds.GetAllocatedSize() + NodeBounds.GetAllocatedSize() + LevelStart.GetAllocatedSize();
+	}
+
+	void FItemBVH::FindNearest(const FVector& Position, const int32 K, TArray<int32>& OutIndices, const double MaxDistance) const
+	{
+		TArray<FFound, TInlineAllocator<16>> Found;
+		GatherNearest(Position, K, MaxDistance, Found);
+
+		OutIndices.SetNumUninitialized(Found.Num());
+		for (int32 i = 0; i < Found.Num(); i++) { OutIndices[i] = Items[Found[i].Value]; }
+	}
+
+	int32 FItemBVH::FindNearest(const FVector& Position, double& OutDistSquared, const double MaxDistance) const
+	{
+		TArray<FFound, TInlineAllocator<16>> Found;
+		GatherNearest(Position, 1, MaxDistance, Found);
+
+		if (Found.IsEmpty())
+		{
+			OutDistSquared = MAX_dbl;
+			return -1;
+		}
+
+		OutDistSquared = Found[0].Key;
+		return Items[Found[0].Value];
+	}
+
+	void FItemBVH::GatherNearest(const FVector& Position, const int32 K, const double MaxDistance, TArray<FFound, TInlineAllocator<16>>& Found) const
+	{
+		Found.Reset();
+		if (Items.IsEmpty() || K <= 0) { return; }
+
+		using FOpen = TPair<double, uint64>;
+
+		auto NearestFirst = [](const FOpen& A, const FOpen& B) { return A.Key < B.Key; };
+		auto FurthestFirst = [](const FFound& A, const FFound& B) { return A.Key > B.Key; };
+
+		double Bound = MaxDistance * MaxDistance;
+
+		TArray<FOpen, TInlineAllocator<64>> Open;
+
+		const int32 RootLevel = NumLevels() - 1;
+		Open.HeapPush(FOpen(DistSquared(NodeBounds, LevelStart[RootLevel], Position), static_cast<uint64>(RootLevel) << 32), NearestFirst);
+
+		while (!Open.IsEmpty())
+		{
+			FOpen Current;
+			Open.HeapPop(Current, NearestFirst, EAllowShrinking::No);
+
+			// Nodes are popped in increasing distance, nothing left can beat what we have
+			if (Current.Key > Bound) { break; }
+
+			const int32 Level = static_cast<int32>(Current.Value >> 32);
+			const int32 Node = static_cast<int32>(Current.Value & 0xFFFFFFFF);
+
+			if (Level == 0)
+			{
+				const int32 End = FMath::Min((Node + 1) * LeafSize, Items.Num());
+				for (int32 Slot = Node * LeafSize; Slot < End; Slot++)
+				{
+					const double Dist = DistSquared(ItemBounds, Slot, Position);
+					if (Dist > Bound) { continue; }
+
+					if (Found.Num() < K)
+					{
+						Found.HeapPush(FFound(Dist, Slot), FurthestFirst);
+					}
+					else if (Dist < Found.HeapTop().Key)
+					{
+						FFound Discarded;
+						Found.HeapPop(Discarded, FurthestFirst, EAllowShrinking::No);
+						Found.HeapPush(FFound(Dist, Slot), FurthestFirst);
+					}
+
+					if (Found.Num() == K) { Bound = Found.HeapTop().Key; }
+				}
+				continue;
+			}
+
+			const uint64 ChildLevel = static_cast<uint64>(Level - 1) << 32;
+			const int32 ChildStart = LevelStart[Level - 1];
+			const int32 FirstChild = Node * BranchingFactor;
+			const int32 EndChild = FMath::Min(FirstChild + BranchingFactor, NumNodes(Level - 1));
+			for (int32 Child = FirstChild; Child < EndChild; Child++)
+			{
+				const double Dist = DistSquared(NodeBounds, ChildStart + Child, Position);
+				if (Dist <= Bound) { Open.HeapPush(FOpen(Dist, ChildLevel | static_cast<uint32>(Child)), NearestFirst); }
+			}
+		}
+
+		Found.Sort([&](const FFound& A, const FFound& B) { return A.Key == B.Key ? Items[A.Value] < Items[B.Value] : A.Key < B.Key; });
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,153 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBVH.h"
+#include "PCGExOctree.h"
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExMTCommon.h"
+#include "Algo/BinarySearch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// FItemBVH against the FItemOctree it replaces, e.g. pcgex.Bench.Run Filter=Spatial.* Scales=100000+1000000
+namespace PCGExBVH
+{
+	namespace Benchmark
+	{
+		constexpr double WorldSize = 10000;
+
+		// Box extent that catches ~32 of N uniformly distributed points
+		static double GetQueryExtent(const int32 NumItems)
+		{
+			return 0.5 * WorldSize * FMath::Pow(32.0 / NumItems, 1.0 / 3.0);
+		}
+
+		static TSharedPtr<FItemBVH> MakeBVH(const TArray<FVector>& Positions)
+		{
+			TSharedPtr<FItemBVH> BVH = MakeShared<FItemBVH>();
+			BVH->Build(
+				Positions.Num(), [&](const int32 Index, FBox& OutBounds)
+				{
+					OutBounds = FBox(Positions[Index], Positions[Index]);
+					return true;
+				});
+			return BVH;
+		}
+
+		static TSharedPtr<PCGExOctree::FItemOctree> MakeOctree(const TArray<FVector>& Positions)
+		{
+			TSharedPtr<PCGExOctree::FItemOctree> Octree = MakeShared<PCGExOctree::FItemOctree>(FVector(WorldSize * 0.5), WorldSize);
+			for (int32 i = 0; i < Positions.Num(); i++) { Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(Positions[i], FVector::ZeroVector, 0))); }
+			return Octree;
+		}
+	}
+
+	static PCGExBenchmark::FPairRegistrar BenchBuild(
+		TEXT("Spatial.Build"), TEXT("Builds a spatial index over N points"),
+		{TEXT("Octree"), TEXT("item octree")}, {TEXT("BVH"), TEXT("item BVH")},
+		[](const int32 Scale, const bool bBVH) -> PCGExBenchmark::FKernel
+		{
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, Scale, true, Benchmark::WorldSize);
+
+			if (bBVH) { return [Positions = MoveTemp(Positions)]() { Benchmark::MakeBVH(Positions); }; }
+			return [Positions = MoveTemp(Positions)]() { Benchmark::MakeOctree(Positions); };
+		});
+
+	static PCGExBenchmark::FPairRegistrar BenchQuery(
+		TEXT("Spatial.Query"), TEXT("N parallel box queries (~32 hits each) against a spatial index of N points"),
+		{TEXT("Octree"), TEXT("item octree")}, {TEXT("BVH"), TEXT("item BVH")},
+		[](const int32 Scale, const bool bBVH) -> PCGExBenchmark::FKernel
+		{
+			TArray<FVector> Positions;
+			TArray<FVector> Queries;
+			PCGExBenchmark::MakePositions(Positions, Scale, true, Benchmark::WorldSize);
+			PCGExBenchmark::MakePositions(Queries, Scale, true, Benchmark::WorldSize, 7);
+
+			if (bBVH)
+			{
+				return [BVH = Benchmark::MakeBVH(Positions), Queries = MoveTemp(Queries), QueryExtent = Benchmark::GetQueryExtent(Scale)]()
+				{
+					PCGEX_PARALLEL_FOR(
+						Queries.Num(),
+						int32 Hits = 0;
+						BVH->FindElementsWithBoundsTest(FBoxCenterAndExtent(Queries[i], FVector(QueryExtent)), [&](const int32 Index) { Hits++; });
+					)
+				};
+			}
+
+			return [Octree = Benchmark::MakeOctree(Positions), Queries = MoveTemp(Queries), QueryExtent = Benchmark::GetQueryExtent(Scale)]()
+			{
+				PCGEX_PARALLEL_FOR(
+					Queries.Num(),
+					int32 Hits = 0;
+					Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Queries[i], FVector(QueryExtent)), [&](const PCGExOctree::FItem& Item) { Hits++; });
+				)
+			};
+		});
+
+	static PCGExBenchmark::FRegistrar BenchBVHNearest(
+		TEXT("Spatial.BVH.Nearest"), TEXT("N parallel 8-nearest queries against a BVH of N points"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			if (Scale < 8) { return nullptr; }
+
+			TArray<FVector> Positions;
+			TArray<FVector> Queries;
+			PCGExBenchmark::MakePositions(Positions, Scale, true, Benchmark::WorldSize);
+			PCGExBenchmark::MakePositions(Queries, Scale, true, Benchmark::WorldSize, 7);
+
+			return [BVH = Benchmark::MakeBVH(Positions), Queries = MoveTemp(Queries)]()
+			{
+				PCGEX_PARALLEL_FOR(
+					Queries.Num(),
+					TArray<int32> Nearest;
+					BVH->FindNearest(Queries[i], 8, Nearest);
+				)
+			};
+		});
+
+	static PCGExBenchmark::FCheckRegistrar CheckBVHRefit(
+		TEXT("Spatial.BVH.Refit"), TEXT("Queries against a point-center BVH refitted to uneven boxes find exactly the overlapping boxes"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			constexpr int32 NumItems = 4096;
+			constexpr int32 NumQueries = 256;
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, NumItems, true, Benchmark::WorldSize);
+
+			// Mostly small boxes with a few very large ones, the case a single global query expansion handles worst
+			FRandomStream Random(42);
+			TArray<FBox> Boxes;
+			Boxes.SetNumUninitialized(NumItems);
+			for (int32 i = 0; i < NumItems; i++) { Boxes[i] = FBox(Positions[i], Positions[i]).ExpandBy(FVector(Random.FRandRange(1, 50)) * (i % 64 == 0 ? 40 : 1)); }
+
+			const TSharedPtr<FItemBVH> BVH = Benchmark::MakeBVH(Positions);
+			FRefitBounds Refit;
+			BVH->Refit([&](const int32 Index) { return Boxes[Index]; }, Refit);
+
+			TArray<FVector> Queries;
+			PCGExBenchmark::MakePositions(Queries, NumQueries, true, Benchmark::WorldSize, 7);
+
+			TArray<int32> Found;
+			for (int32 q = 0; q < NumQueries; q++)
+			{
+				const FBox Query = FBox(Queries[q], Queries[q]).ExpandBy(100);
+
+				Found.Reset();
+				BVH->FindElementsWithBoundsTest(Refit, FBoxCenterAndExtent(Query), [&](const int32 Index) { Found.Add(Index); });
+				Found.Sort();
+
+				// Float bounds are rounded outward, so exact double overlaps must all be found
+				for (int32 i = 0; i < NumItems; i++)
+				{
+					if (Boxes[i].Intersect(Query)) { Context.Test(Algo::BinarySearch(Found, i) != INDEX_NONE, TEXT("Query %d misses box %d"), q, i); }
+				}
+
+				for (const int32 Index : Found) { Context.Test(Boxes[Index].ExpandBy(1).Intersect(Query), TEXT("Query %d reports box %d, which is not near it"), q, Index); }
+			}
+		});
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "PCGExCore.h"
 
+#include "Containers/PCGExBufferPool.h"
 
 #if WITH_EDITOR
 
@@ -18,6 +19,19 @@
 
 PCGEX_IMPLEMENT_MODULE(FPCGExCoreModule, PCGExCore)
 
+void FPCGExCoreModule::StartupModule()
+{
+	IPCGExLegacyModuleInterface::StartupModule();
+}
+
+void FPCGExCoreModule::ShutdownModule()
+{
+	// The pool outlives the module, but the blocks it holds shouldn't
+	PCGEx::FBufferPool::Get().Shutdown();
+
+	IPCGExLegacyModuleInterface::ShutdownModule();
+}
+
 #if WITH_EDITOR
 void FPCGExCoreModule::RegisterToEditor(const TSharedPtr<FSlateStyleSet>& InStyle)
 {
@@ -251,9 +251,44 @@ namespace PCGExPaths
 	{
 		const FVector2D ProjectedPoint = FVector2D(Projection.ProjectFlat(WorldPosition));
 		if (!ProjectedBounds.IsInside(ProjectedPoint)) { return false; }
+		if (InclusionGrid) { return InclusionGrid->IsInside(ProjectedPoint); }
 		return FGeomTools2D::IsPointInPolygon(ProjectedPoint, ProjectedPoints);
 	}
 
+	bool FPath::BuildInclusionGrid(const int32 MinPoints)
+	{
+		InclusionGrid.Reset();
+		if (ProjectedPoints.Num() < FMath::Max(3, MinPoints)) { return false; }
+
+		InclusionGrid = MakeUnique<PCGExMath::Geo::FPolygonInclusionGrid>(ProjectedPoints);
+		if (!InclusionGrid->IsValid()) { InclusionGrid.Reset(); }
+
+		return InclusionGrid.IsValid();
+	}
+
+	int32 FPath::ClassifyPoints(const TConstPCGValueRange<FTransform>& InPositions, const PCGExMT::FScope& Scope, TArray<int8>& OutInside) const
+	{
+		check(OutInside.Num() >= Scope.End)
+
+		int32 InsideCount = 0;
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			const FVector2D ProjectedPoint = FVector2D(Projection.ProjectFlat(InPositions[Index].GetLocation()));
+
+			bool bInside = false;
+			if (ProjectedBounds.IsInside(ProjectedPoint))
+			{
+				bInside = InclusionGrid ? InclusionGrid->IsInside(ProjectedPoint) : FGeomTools2D::IsPointInPolygon(ProjectedPoint, ProjectedPoints);
+			}
+
+			OutInside[Index] = bInside;
+			InsideCount += bInside;
+		}
+
+		return InsideCount;
+	}
+
 	bool FPath::Contains(const TConstPCGValueRange<FTransform>& InPositions, const double Tolerance) const
 	{
 		const int32 OtherNumPoints = InPositions.Num();
@@ -275,6 +310,7 @@ namespace PCGExPaths
 
 	void FPath::BuildProjection()
 	{
+		InclusionGrid.Reset();
 		ProjectedPoints.SetNumUninitialized(NumPoints);
 		ProjectedBounds = FBox2D();
 
@@ -301,6 +337,8 @@ namespace PCGExPaths
 		// produce self-intersections on sharp concave corners with large offsets.
 		if (FMath::IsNearlyZero(Offset)) { return; }
 
+		InclusionGrid.Reset();
+
 		const int32 N = ProjectedPoints.Num();
 		if (N < 3)
 		{
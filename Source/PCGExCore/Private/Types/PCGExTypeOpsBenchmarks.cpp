@@ -0,0 +1,92 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Data/PCGExCachedSubSelection.h"
+#include "Types/PCGExTypeOpsImpl.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExTypeOps
+{
+	template <typename T>
+	static TArray<T> MakeBenchmarkValues(const int32 Scale)
+	{
+		FRandomStream Random(1337);
+
+		TArray<T> Values;
+		Values.SetNum(Scale);
+		for (T& Value : Values) { Value = FTypeOps<double>::ConvertTo<T>(Random.FRandRange(-1000, 1000)); }
+
+		return Values;
+	}
+
+	// bRange: one range kernel call for the whole span, otherwise one table call per value
+	template <typename TFrom, typename TTo>
+	static PCGExBenchmark::FKernel MakeConvertKernel(const int32 Scale, const bool bRange)
+	{
+		constexpr EPCGMetadataTypes FromType = PCGExTypes::TTraits<TFrom>::Type;
+		constexpr EPCGMetadataTypes ToType = PCGExTypes::TTraits<TTo>::Type;
+
+		TArray<TTo> Results;
+		Results.SetNum(Scale);
+
+		if (bRange)
+		{
+			return [Values = MakeBenchmarkValues<TFrom>(Scale), Results = MoveTemp(Results)]() mutable
+			{
+				FConversionTable::ConvertRange(FromType, Values.GetData(), ToType, Results.GetData(), Values.Num());
+			};
+		}
+
+		return [Values = MakeBenchmarkValues<TFrom>(Scale), Results = MoveTemp(Results), Convert = FConversionTable::GetConversionFn(FromType, ToType)]() mutable
+		{
+			for (int32 i = 0; i < Values.Num(); i++) { Convert(&Values[i], &Results[i]); }
+		};
+	}
+
+	static PCGExBenchmark::FKernel MakeExtractLengthKernel(const int32 Scale, const bool bRange)
+	{
+		TArray<FVector> Positions;
+		PCGExBenchmark::MakePositions(Positions, Scale);
+
+		TArray<double> Results;
+		Results.SetNumUninitialized(Scale);
+
+		if (bRange)
+		{
+			return [Positions = MoveTemp(Positions), Results = MoveTemp(Results)]() mutable
+			{
+				PCGExData::SubSelectionImpl::GetExtractFieldRangeFn(EPCGMetadataTypes::Vector)(Positions.GetData(), Positions.Num(), ESingleField::Length, Results.GetData());
+			};
+		}
+
+		return [Positions = MoveTemp(Positions), Results = MoveTemp(Results), Extract = PCGExData::SubSelectionImpl::GetExtractFieldFn(EPCGMetadataTypes::Vector)]() mutable
+		{
+			for (int32 i = 0; i < Positions.Num(); i++) { Results[i] = Extract(&Positions[i], ESingleField::Length); }
+		};
+	}
+
+#define PCGEX_CONVERT_BENCH(_FROM, _FROM_NAME, _TO, _TO_NAME) \
+	static PCGExBenchmark::FPairRegistrar BenchConvert##_FROM_NAME##To##_TO_NAME( \
+		TEXT("TypeOps.Convert." #_FROM_NAME "To" #_TO_NAME), TEXT("Conversion of N " #_FROM_NAME " to " #_TO_NAME), \
+		{TEXT("PerValue"), TEXT("one table call per value")}, {TEXT("Range"), TEXT("one range kernel call")}, &MakeConvertKernel<_FROM, _TO>);
+
+	PCGEX_CONVERT_BENCH(double, Double, float, Float)
+	PCGEX_CONVERT_BENCH(float, Float, double, Double)
+	PCGEX_CONVERT_BENCH(int32, Integer32, double, Double)
+	PCGEX_CONVERT_BENCH(double, Double, int32, Integer32)
+	PCGEX_CONVERT_BENCH(FVector, Vector, FVector4, Vector4)
+	PCGEX_CONVERT_BENCH(FVector2D, Vector2, FVector, Vector)
+	PCGEX_CONVERT_BENCH(double, Double, FVector, Vector)
+	PCGEX_CONVERT_BENCH(FVector, Vector, FVector, Vector)
+	PCGEX_CONVERT_BENCH(FQuat, Quaternion, FRotator, Rotator)
+
+#undef PCGEX_CONVERT_BENCH
+
+	static PCGExBenchmark::FPairRegistrar BenchExtractLength(
+		TEXT("TypeOps.ExtractField.VectorLength"), TEXT(".Length extraction of N vectors"),
+		{TEXT("PerValue"), TEXT("one call per value")}, {TEXT("Range"), TEXT("one range call")}, &MakeExtractLengthKernel);
+}
+
+#endif
@@ -31,18 +31,19 @@ namespace PCGExTypeOps
 
 	// FConversionTable Implementation
 	FConvertFn FConversionTable::Table[PCGExTypes::TypesAllocations][PCGExTypes::TypesAllocations] = {};
+	FConvertRangeFn FConversionTable::RangeTable[PCGExTypes::TypesAllocations][PCGExTypes::TypesAllocations] = {};
 	bool FConversionTable::bInitialized = false;
 
 	namespace
 	{
 		// Helper to populate a row of the conversion table
 		template <typename TFrom>
-		void PopulateConversionRow(FConvertFn* Row)
+		void PopulateConversionRow(FConvertFn* Row, FConvertRangeFn* RangeRow)
 		{
 			using namespace ConversionFunctions;
 
 			int32 Idx = 0;
-#define PCGEX_TPL(_TYPE, _NAME, ...) Row[Idx++] = GetConvertFunction<TFrom, _TYPE>();
+#define PCGEX_TPL(_TYPE, _NAME, ...) Row[Idx] = GetConvertFunction<TFrom, _TYPE>(); RangeRow[Idx++] = GetConvertRangeFunction<TFrom, _TYPE>();
 			PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_TPL)
 #undef PCGEX_TPL
 		}
@@ -50,14 +51,14 @@ namespace PCGExTypeOps
 
 	// Populates the N×N type conversion dispatch table (From × To).
 	// Each row is filled by PopulateConversionRow<TFrom> which instantiates
-	// a ConvertFunction<TFrom, TTo> for every supported target type.
+	// a ConvertFunction<TFrom, TTo> and its range counterpart for every supported target type.
 	// Called once at module load via the static FTypeOpsModuleInit below.
 	void FConversionTable::Initialize()
 	{
 		if (bInitialized) { return; }
 
 		int32 Idx = 0;
-#define PCGEX_TPL(_TYPE, _NAME, ...) PopulateConversionRow<_TYPE>(Table[Idx++]);
+#define PCGEX_TPL(_TYPE, _NAME, ...) PopulateConversionRow<_TYPE>(Table[Idx], RangeTable[Idx]); Idx++;
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_TPL)
 #undef PCGEX_TPL
 
@@ -0,0 +1,54 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UPCGPointArrayData;
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+namespace PCGExClusters
+{
+	class FCluster;
+
+	namespace Benchmark
+	{
+		/** Grid cluster fixture for benchmark & check cases, built without any context */
+		struct PCGEXCORE_API FGridCluster
+		{
+			int32 Side = 0;
+
+			TStrongObjectPtr<UPCGPointArrayData> VtxData;
+			TStrongObjectPtr<UPCGPointArrayData> EdgeData;
+
+			TSharedPtr<PCGExData::FPointIO> VtxIO;
+			TSharedPtr<PCGExData::FPointIO> EdgesIO;
+
+			// Vtx hashes are the point indices themselves
+			TMap<uint32, int32> EndpointsLookup;
+
+			TSharedPtr<FCluster> Cluster;
+
+			/** Builds a new cluster from the vtx & edge data */
+			TSharedPtr<FCluster> Build() const;
+
+			int32 GetNodeIndex(const int32 X, const int32 Y) const;
+		};
+
+		/**
+		 * Side x Side grid of at least NumVtx vtx, 100 apart, with an edge between each horizontal & vertical neighbor.
+		 * Jitter moves each vtx randomly by up to that fraction of the spacing, on all axes, so that edge lengths & shortest paths are unique.
+		 */
+		PCGEXCORE_API TSharedPtr<FGridCluster> MakeGridCluster(const int32 NumVtx, const double Jitter = 0, const int32 Seed = 1337, const bool bBuild = true);
+	}
+}
+
+#endif
@@ -0,0 +1,200 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "CoreMinimal.h"
+
+namespace PCGEx
+{
+	struct PCGEXCORE_API FBufferPoolStats
+	{
+		int32 NumBlocks = 0;
+		int64 PooledBytes = 0;
+		int64 PeakPooledBytes = 0;
+		int64 NumAcquires = 0;
+		int64 NumReuses = 0;
+		int64 NumAllocations = 0;
+		int64 NumReleases = 0;
+		int64 NumEvictions = 0;
+		int64 ReusedBytes = 0;
+
+		double GetReuseRate() const { return NumAcquires ? static_cast<double>(NumReuses) / static_cast<double>(NumAcquires) : 0; }
+	};
+
+	/**
+	 * Size-classed pool of array storage, shared by every node.
+	 * Large arrays (buffer values, scoped arrays, search scratch...) hand their allocation back to the pool once done with it
+	 * instead of freeing it, and the next array of the same element type & a similar capacity picks it up.
+	 * Only element types that don't need destruction are pooled, others always go through the regular allocator.
+	 * Pooled bytes are capped by the global settings; least recently released blocks are freed first, as well as blocks that sat idle for too long.
+	 */
+	class PCGEXCORE_API FBufferPool
+	{
+	public:
+		/** Pooled storage, owned by the pool until an array of the same element type picks it up */
+		struct FBlock
+		{
+			virtual ~FBlock() = default;
+
+			const void* TypeTag = nullptr;
+			int64 NumBytes = 0;
+			double ReleaseTime = 0;
+
+			// Release order, oldest first
+			FBlock* Older = nullptr;
+			FBlock* Newer = nullptr;
+		};
+
+	private:
+		/** Keeps the released array itself, so its allocation only ever moves between arrays of the same type */
+		template <typename T>
+		struct TBlock final : FBlock
+		{
+			TArray<T> Array;
+		};
+
+		/** One tag per element type; blocks are only handed back to arrays with the same tag */
+		template <typename T>
+		static const void* GetTypeTag()
+		{
+			static const uint8 Tag = 0;
+			return &Tag;
+		}
+
+	public:
+		static FBufferPool& Get();
+		static bool IsEnabled();
+
+		template <typename T>
+		static constexpr bool IsPoolable() { return std::is_trivially_destructible_v<T>; }
+
+		/** Empties the array and makes sure it can hold at least InNum elements, reusing pooled storage when possible */
+		template <typename T>
+		void Acquire(TArray<T>& OutArray, const int32 InNum)
+		{
+			OutArray.Reset();
+			if (OutArray.Max() >= InNum) { return; }
+
+			if constexpr (IsPoolable<T>())
+			{
+				Release(OutArray);
+				if (const TUniquePtr<FBlock> Block = AcquireBlock(GetTypeTag<T>(), static_cast<int64>(InNum) * sizeof(T)))
+				{
+					OutArray = MoveTemp(static_cast<TBlock<T>*>(Block.Get())->Array);
+					return;
+				}
+			}
+
+			OutArray.Empty(InNum);
+		}
+
+		/** Acquires storage for InNum elements and fills it with a value; unlike TArray::Init, this never shrinks reused storage */
+		template <typename T>
+		void Init(TArray<T>& OutArray, const T& InValue, const int32 InNum)
+		{
+			Acquire(OutArray, InNum);
+
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				OutArray.SetNumUninitialized(InNum);
+				T* Data = OutArray.GetData();
+				for (int32 i = 0; i < InNum; i++) { Data[i] = InValue; }
+			}
+			else
+			{
+				for (int32 i = 0; i < InNum; i++) { OutArray.Add(InValue); }
+			}
+		}
+
+		/** Hands the array storage back to the pool, leaving it empty */
+		template <typename T>
+		void Release(TArray<T>& InArray)
+		{
+			if constexpr (IsPoolable<T>())
+			{
+				InArray.Reset();
+
+				const int64 NumBytes = InArray.GetAllocatedSize();
+				if (CanPool(NumBytes))
+				{
+					TUniquePtr<TBlock<T>> Block = MakeUnique<TBlock<T>>();
+					Block->Array = MoveTemp(InArray);
+					Block->TypeTag = GetTypeTag<T>();
+					Block->NumBytes = NumBytes;
+					ReleaseBlock(MoveTemp(Block));
+				}
+			}
+
+			InArray.Empty();
+		}
+
+		/** A shared array with room for at least InNum elements, whose storage goes back to the pool once the last reference is gone */
+		template <typename T>
+		static TSharedPtr<TArray<T>> MakeArray(const int32 InNum = 0)
+		{
+			if constexpr (IsPoolable<T>())
+			{
+				if (IsEnabled())
+				{
+					TSharedPtr<TArray<T>> Array = MakeShareable(
+						new TArray<T>(), [](TArray<T>* InArray)
+						{
+							Get().Release(*InArray);
+							delete InArray;
+						});
+
+					Get().Acquire(*Array, InNum);
+					return Array;
+				}
+			}
+
+			TSharedPtr<TArray<T>> Array = MakeShared<TArray<T>>();
+			if (InNum > 0) { Array->Reserve(InNum); }
+			return Array;
+		}
+
+		/** Frees blocks idle for longer than the configured delay, then least recently released ones until the budget is respected */
+		void Trim();
+
+		/** Frees every pooled block */
+		void Flush();
+
+		/** Frees every pooled block and stops pooling, released arrays are freed right away from then on; called on module shutdown */
+		void Shutdown();
+
+		FBufferPoolStats GetStats() const;
+		FString GetStatsSummary() const;
+
+	private:
+		FBufferPool();
+		~FBufferPool();
+
+		using FBucketKey = TPair<const void*, int32>;
+
+		static bool CanPool(const int64 InNumBytes);
+
+		TUniquePtr<FBlock> AcquireBlock(const void* InTypeTag, const int64 InNumBytes);
+		void ReleaseBlock(TUniquePtr<FBlock>&& InBlock);
+
+		void LinkNewestUnsafe(FBlock* InBlock);
+		void UnlinkUnsafe(FBlock* InBlock);
+		void FreeBlockUnsafe(FBlock* InBlock);
+		void TrimUnsafe(const double InNow, const int64 InBudget, const double InMaxIdleSeconds);
+
+		mutable FCriticalSection Lock;
+
+		// Blocks are owned by the pool while they sit in a bucket; the LRU list links the same blocks by release time
+		TMap<FBucketKey, TArray<FBlock*>> Buckets;
+		FBlock* Oldest = nullptr;
+		FBlock* Newest = nullptr;
+
+		std::atomic<bool> bShutdown{false};
+
+		double LastTrimTime = 0;
+		FBufferPoolStats Stats;
+	};
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/PCGExBufferPool.h"
 
 namespace PCGEx
 {
@@ -35,9 +36,11 @@ namespace PCGEx
 		explicit FHashLookupArray(const uint64 InitValue, const int32 Size)
 			: FHashLookup(InitValue, Size)
 		{
-			Data.Init(InitValue, Size);
+			FBufferPool::Get().Init(Data, InitValue, Size);
 		}
 
+		virtual ~FHashLookupArray() override { FBufferPool::Get().Release(Data); }
+
 		FORCEINLINE virtual void Set(const int32 At, const uint64 Value) override { Data[At] = Value; }
 		FORCEINLINE virtual uint64 Get(const int32 At) override { return Data[At]; }
 		virtual void Reset() override { for (uint64& V : Data) { V = InternalInitValue; } }
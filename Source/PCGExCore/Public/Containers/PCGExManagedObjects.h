@@ -55,6 +55,7 @@ namespace PCGEx
 		bool Add(UObject* InObject);
 		bool Remove(UObject* InObject);
 		void Remove(const TArray<FPCGTaggedData>& InTaggedData);
+		bool Contains(const UObject* InObject) const;
 
 		void AddExtraStructReferencedObjects(FReferenceCollector& Collector);
 
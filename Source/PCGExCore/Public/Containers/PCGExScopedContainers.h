@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Misc/ScopeRWLock.h"
 #include "Core/PCGExMTCommon.h"
+#include "Containers/PCGExBufferPool.h"
 
 namespace PCGExMT
 {
@@ -217,6 +218,7 @@ namespace PCGExMT
 		}
 	};
 
+	// Per-scope arrays draw their storage from the buffer pool
 	template <typename T>
 	class TScopedArray final : public TSharedFromThis<TScopedArray<T>>
 	{
@@ -226,20 +228,24 @@ namespace PCGExMT
 		explicit TScopedArray(const TArray<FScope>& InScopes, const T InDefaultValue)
 		{
 			Arrays.Reserve(InScopes.Num());
-			for (const FScope& Scope : InScopes) { Arrays[Arrays.Add(MakeShared<TArray<T>>())]->Init(InDefaultValue, Scope.Count); }
+			for (const FScope& Scope : InScopes) { PCGEx::FBufferPool::Get().Init(*Arrays.Add_GetRef(PCGEx::FBufferPool::MakeArray<T>()), InDefaultValue, Scope.Count); }
 		};
 
 		explicit TScopedArray(const TArray<FScope>& InScopes)
 		{
 			Arrays.Reserve(InScopes.Num());
-			for (int i = 0; i < InScopes.Num(); i++) { Arrays.Add(MakeShared<TArray<T>>()); }
+			for (int i = 0; i < InScopes.Num(); i++) { Arrays.Add(PCGEx::FBufferPool::MakeArray<T>()); }
 		};
 
 		~TScopedArray() = default;
 
 		void Reserve(const int32 NumReserve)
 		{
-			for (int i = 0; i < Arrays.Num(); i++) { Arrays[i]->Reserve(NumReserve); }
+			for (int i = 0; i < Arrays.Num(); i++)
+			{
+				if (Arrays[i]->IsEmpty()) { PCGEx::FBufferPool::Get().Acquire(*Arrays[i], NumReserve); }
+				else { Arrays[i]->Reserve(NumReserve); }
+			}
 		}
 
 		FORCEINLINE TSharedPtr<TArray<T>> Get(const FScope& InScope) { return Arrays[InScope.LoopIndex]; }
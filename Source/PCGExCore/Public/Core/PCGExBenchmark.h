@@ -0,0 +1,202 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Headless benchmark suite for PCGEx hot paths.
+ *
+ * Modules register cases with a static FRegistrar; a case builds its synthetic input for a given scale (untimed)
+ * and returns the kernel to time. Run everything with
+ *   pcgex.Bench.Run [Filter=*] [Scales=1000+10000+100000] [Iterations=10] [Out=<path.json>] [Baseline=<path.json>] [Threshold=0.1]
+ * e.g. from a headless editor: -ExecCmds="pcgex.Bench.Run Out=bench.json Baseline=baseline.json, quit".
+ * Results are written as JSON with percentiles; when a baseline is given, p50 regressions past the threshold are logged as errors,
+ * and an unattended run exits with a non-zero status.
+ *
+ * Correctness cases (an optimized path against its reference) register with FCheckRegistrar and run with pcgex.Bench.Check [Filter=*].
+ * Both are also exposed to the automation framework as PCGEx.Perf.<Case> and PCGEx.Checks.<Case>, where the pcgex.Bench.* cvars
+ * provide the scales, iterations, baseline and threshold; e.g. -ExecCmds="Automation RunTests PCGEx.Perf; quit" -unattended.
+ *
+ * Everything here, and every case, only exists in builds with WITH_DEV_AUTOMATION_TESTS; shipping builds carry none of it.
+ */
+namespace PCGExBenchmark
+{
+	/** The timed part of a case. Called once per iteration, must be repeatable. */
+	using FKernel = TFunction<void()>;
+
+	/** Builds the input of a case for the given scale and returns its kernel; an unset kernel skips that scale. */
+	using FSetup = TFunction<FKernel(const int32 InScale)>;
+
+	struct FCase
+	{
+		FString Name;
+		FString Description;
+		FSetup Setup;
+
+		/** Regression threshold of this case, overrides the run's when >= 0; noisy or I/O bound kernels want a looser one */
+		double Threshold = -1;
+	};
+
+	struct PCGEXCORE_API FResult
+	{
+		FString Name;
+		int32 Scale = 0;
+		int32 NumSamples = 0;
+
+		// Milliseconds
+		double Min = 0;
+		double Mean = 0;
+		double P50 = 0;
+		double P90 = 0;
+		double P99 = 0;
+		double Max = 0;
+
+		/** See FCase::Threshold */
+		double Threshold = -1;
+	};
+
+	struct PCGEXCORE_API FRunParams
+	{
+		FString Filter = TEXT("*");
+		TArray<int32> Scales = {1000, 10000, 100000};
+		int32 Iterations = 10;
+		int32 WarmupIterations = 1;
+		FString OutputPath;
+		FString BaselinePath;
+		double RegressionThreshold = 0.1;
+
+		/** Parses Key=Value console arguments, see the namespace doc */
+		void Parse(const TArray<FString>& Args);
+	};
+
+	/** Run parameters from the pcgex.Bench.* cvars, used by the automation tests */
+	PCGEXCORE_API FRunParams GetDefaultRunParams();
+
+	/** Collects the outcome of a correctness case; failures are formatted lazily and only the first few are kept */
+	class PCGEXCORE_API FCheckContext
+	{
+	public:
+		static constexpr int32 MaxReportedFailures = 16;
+
+		FString Name;
+		int32 NumChecks = 0;
+		int32 NumFailures = 0;
+		TArray<FString> Failures;
+
+		template <typename FmtType, typename... Types>
+		bool Test(const bool bCondition, const FmtType& Fmt, Types... Args)
+		{
+			NumChecks++;
+			if (bCondition) { return true; }
+			if (NumFailures++ < MaxReportedFailures) { Failures.Add(FString::Printf(Fmt, Args...)); }
+			return false;
+		}
+
+		bool Passed() const { return NumFailures == 0; }
+	};
+
+	/** Compares an optimized path against its reference on a small synthetic input */
+	using FCheck = TFunction<void(FCheckContext& Context)>;
+
+	struct FCheckCase
+	{
+		FString Name;
+		FString Description;
+		FCheck Check;
+	};
+
+	class PCGEXCORE_API FRegistry
+	{
+	public:
+		static FRegistry& Get();
+
+		void Register(const FCase& InCase);
+		void Unregister(const FString& InName);
+
+		void RegisterCheck(const FCheckCase& InCheck);
+		void UnregisterCheck(const FString& InName);
+
+		/** @return cases whose name matches the wildcard filter, sorted by name */
+		TArray<FCase> GetCases(const FString& InFilter = TEXT("*")) const;
+
+		/** @return check cases whose name matches the wildcard filter, sorted by name */
+		TArray<FCheckCase> GetChecks(const FString& InFilter = TEXT("*")) const;
+
+	private:
+		FRegistry() = default;
+
+		mutable FRWLock Lock;
+		TMap<FString, FCase> Cases;
+		TMap<FString, FCheckCase> Checks;
+	};
+
+	/** Registers a case for as long as it lives; declare them static, next to the code they measure */
+	class PCGEXCORE_API FRegistrar
+	{
+	public:
+		FRegistrar(const TCHAR* InName, const TCHAR* InDescription, FSetup&& InSetup, const double InThreshold = -1);
+		~FRegistrar();
+
+	private:
+		FString Name;
+	};
+
+	/** One side of a FPairRegistrar, appended to the pair's name & description */
+	struct FVariant
+	{
+		const TCHAR* Suffix = nullptr;
+		const TCHAR* Description = nullptr;
+	};
+
+	/** Builds the input of a pair for the given scale and returns the kernel of one side */
+	using FPairSetup = TFunction<FKernel(const int32 InScale, const bool bOptimized)>;
+
+	/**
+	 * Registers an optimized path and the reference it replaces from a single setup, as <Name>.<Reference.Suffix> & <Name>.<Optimized.Suffix>,
+	 * so both sides are always timed on the same input.
+	 */
+	class PCGEXCORE_API FPairRegistrar
+	{
+	public:
+		FPairRegistrar(const TCHAR* InName, const TCHAR* InDescription, const FVariant& InReference, const FVariant& InOptimized, FPairSetup&& InSetup, const double InThreshold = -1);
+
+	private:
+		FRegistrar Reference;
+		FRegistrar Optimized;
+	};
+
+	/** Registers a check case for as long as it lives */
+	class PCGEXCORE_API FCheckRegistrar
+	{
+	public:
+		FCheckRegistrar(const TCHAR* InName, const TCHAR* InDescription, FCheck&& InCheck);
+		~FCheckRegistrar();
+
+	private:
+		FString Name;
+	};
+
+	PCGEXCORE_API TArray<FResult> Run(const FRunParams& InParams);
+
+	/** Runs the matching check cases and logs their failures */
+	PCGEXCORE_API TArray<FCheckContext> RunChecks(const FString& InFilter = TEXT("*"));
+
+	PCGEXCORE_API bool WriteResults(const TArray<FResult>& InResults, const FString& InPath);
+
+	/**
+	 * Logs the delta of every result against the baseline file, using each result's own threshold when it has one.
+	 * @param OutRegressions if set, receives a line per regression
+	 * @return the number of p50 regressions past the threshold, or -1 if the baseline can't be read
+	 */
+	PCGEXCORE_API int32 CompareToBaseline(const TArray<FResult>& InResults, const FString& InBaselinePath, const double InThreshold, TArray<FString>* OutRegressions = nullptr);
+
+	/** Fills positions with a deterministic point cloud in a cube of the given extent; flat on Z unless b3D */
+	PCGEXCORE_API void MakePositions(TArray<FVector>& OutPositions, const int32 InNum, const bool b3D = true, const double InExtent = 10000, const int32 InSeed = 1337);
+}
+
+#endif
@@ -44,6 +44,11 @@ namespace PCGEx
 	class FWorkHandle;
 }
 
+namespace PCGExProfiler
+{
+	class FNodeProfile;
+}
+
 struct PCGEXCORE_API FPCGExContext : FPCGContext
 {
 	friend class IPCGExElement;
@@ -72,6 +77,9 @@ public:
 	bool bScopedAttributeGet = false;
 	bool bPropagateAbortedExecution = false;
 
+	/** Set when the profiler is enabled at initialization time, see PCGExProfiler */
+	TSharedPtr<PCGExProfiler::FNodeProfile> Profile;
+
 	FPCGExContext();
 
 	virtual ~FPCGExContext() override;
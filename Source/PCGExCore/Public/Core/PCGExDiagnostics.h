@@ -0,0 +1,69 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+/**
+ * Single entry point for the process-wide caches & pools PCGEx keeps across executions.
+ *
+ * Each cache registers itself with a static FRegistrar, next to its implementation, and is then covered by
+ *   pcgex.Diagnostics [Stats|Flush|List] [Filter=*]
+ * e.g. "pcgex.Diagnostics Flush Filter=ClusterCache" drops cached cluster outputs only.
+ */
+namespace PCGExDiagnostics
+{
+	/** One-line summary of a cache's current state */
+	using FGetSummary = TFunction<FString()>;
+
+	/** Releases whatever the cache can release; unset when the cache can't be flushed */
+	using FFlush = TFunction<void()>;
+
+	struct FSource
+	{
+		FString Name;
+		FString Description;
+		FGetSummary GetSummary;
+		FFlush Flush;
+	};
+
+	class PCGEXCORE_API FRegistry
+	{
+	public:
+		static FRegistry& Get();
+
+		void Register(const FSource& InSource);
+		void Unregister(const FString& InName);
+
+		/** @return sources whose name matches the wildcard filter, sorted by name */
+		TArray<FSource> GetSources(const FString& InFilter = TEXT("*")) const;
+
+		/** Logs the summary of every matching source */
+		void LogStats(const FString& InFilter = TEXT("*")) const;
+
+		/** Flushes every matching source that supports it, @return how many were flushed */
+		int32 Flush(const FString& InFilter = TEXT("*")) const;
+
+	private:
+		FRegistry() = default;
+
+		mutable FRWLock Lock;
+		TMap<FString, FSource> Sources;
+	};
+
+	/** Registers a source for as long as it lives; declare them static, next to the cache they report */
+	class PCGEXCORE_API FRegistrar
+	{
+	public:
+		FRegistrar(const TCHAR* InName, const TCHAR* InDescription, FGetSummary&& InGetSummary, FFlush&& InFlush = nullptr);
+		~FRegistrar();
+
+	private:
+		FString Name;
+	};
+
+	/** Handles the arguments of pcgex.Diagnostics; the first bare argument is the action, Stats by default */
+	PCGEXCORE_API void Execute(const TArray<FString>& Args);
+}
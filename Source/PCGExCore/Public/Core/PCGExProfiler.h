@@ -0,0 +1,157 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+struct FPCGExContext;
+class UPCGSettings;
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+/**
+ * Opt-in per-node execution profiler.
+ *
+ * Enable with `pcgex.Profiler.Enabled 1`, or start the process with `-PCGExProfile=<path>` to profile from the first
+ * execution and export to <path> on exit. Every PCGEx node executed while enabled records its state timings, task
+ * & scope counts, wait time, buffer preloads, and bytes read/written per attribute, as well as reads served by shared buffers.
+ * Export with `pcgex.Profiler.Export <path>`; .json writes a Chrome trace (chrome://tracing, Perfetto), .csv a flat table.
+ */
+namespace PCGExProfiler
+{
+	/** Kind of a recorded interval, also used as the Chrome trace category */
+	enum class EEventKind : uint8
+	{
+		State   = 0, // Time spent in a context state, until the next state change
+		Phase   = 1, // Explicit preparation phase (Boot, PostBoot...)
+		Drive   = 2, // One AdvanceWork call
+		Async   = 3, // From FTaskManager::Start to its end; the node waits on its tasks
+		Wait    = 4, // Scheduler thread yielding or sleeping in the execution spin-wait loop, drives excluded
+		Task    = 5, // A single task execution
+		Preload = 6, // A facade preloader, from StartLoading to completion
+	};
+
+	struct FEvent
+	{
+		FName Name = NAME_None;
+		double Start = 0;
+		double Duration = 0;
+		uint32 ThreadId = 0;
+		EEventKind Kind = EEventKind::State;
+		int64 Arg = 0;
+	};
+
+	struct FAttributeIO
+	{
+		int64 BytesRead = 0;
+		int64 BytesWritten = 0;
+		int32 NumReads = 0;
+		int32 NumWrites = 0;
+		int64 BytesShared = 0; // Reads served by an already materialized buffer instead of being copied again
+		int32 NumSharedReads = 0;
+		double ReadSeconds = 0;
+		double WriteSeconds = 0;
+	};
+
+	/** Everything recorded during a single node execution. Recording methods are thread-safe. */
+	class PCGEXCORE_API FNodeProfile : public TSharedFromThis<FNodeProfile>
+	{
+	public:
+		FString NodeName;
+		FString SourceName;
+		int32 ExecutionIndex = -1;
+
+		double StartTime = 0;
+		double EndTime = 0;
+		bool bCancelled = false;
+
+		std::atomic<int64> NumTasks{0};
+		std::atomic<int64> NumScopes{0};
+		std::atomic<int64> NumScopeIterations{0};
+		std::atomic<int32> MinScopeSize{MAX_int32};
+		std::atomic<int32> MaxScopeSize{0};
+		std::atomic<int64> NumDroppedEvents{0};
+
+		FNodeProfile(const FPCGExContext* InContext, const UPCGSettings* InSettings);
+
+		void AddEvent(const EEventKind InKind, const FName InName, const double InStart, const double InDuration, const int64 InArg = 0);
+
+		void EnterState(const FName InState);
+		void BeginAsync();
+		void EndAsync();
+
+		void AddTask(const FName InName, const double InStart, const double InDuration);
+		void AddScope(const int32 InCount);
+		void AddAttributeIO(const FName InAttribute, const bool bWrite, const int64 InBytes, const double InSeconds);
+		void AddSharedRead(const FName InAttribute, const int64 InBytes);
+
+		/** Closes the profile and hands it over to the profiler. Only the first call does anything. */
+		void Finish(const bool bWasCancelled);
+
+		double GetTotalSeconds(const EEventKind InKind) const;
+
+		mutable FRWLock Lock;
+		TArray<FEvent> Events;
+		TMap<FName, FAttributeIO> Attributes;
+
+	protected:
+		FName CurrentState = NAME_None;
+		double CurrentStateStart = 0;
+		double AsyncStart = -1;
+		std::atomic<bool> bFinished{false};
+	};
+
+	/** Records an event of the given kind on the profile, if any, when going out of scope */
+	class PCGEXCORE_API FScopedEvent
+	{
+	public:
+		FScopedEvent(const TSharedPtr<FNodeProfile>& InProfile, const EEventKind InKind, const FName InName, const int64 InArg = 0);
+		~FScopedEvent();
+
+	private:
+		TSharedPtr<FNodeProfile> Profile;
+		EEventKind Kind;
+		FName Name;
+		int64 Arg;
+		double Start = 0;
+	};
+
+	/** Records bytes moved between an attribute and a buffer, with the time it took */
+	class PCGEXCORE_API FScopedAttributeIO
+	{
+	public:
+		FScopedAttributeIO(const PCGExData::FPointIO& InSource, const FName InAttribute, const bool bInWrite, const int64 InBytes);
+		~FScopedAttributeIO();
+
+	private:
+		TSharedPtr<FNodeProfile> Profile;
+		FName Attribute;
+		bool bWrite;
+		int64 Bytes;
+		double Start = 0;
+	};
+
+	PCGEXCORE_API bool IsEnabled();
+
+	/** Records a read that was served by shared values, on the profile of the context owning that source, if any */
+	PCGEXCORE_API void RecordSharedRead(const PCGExData::FPointIO& InSource, const FName InAttribute, const int64 InBytes);
+
+	/** @return a new profile for that context if the profiler is enabled, nullptr otherwise */
+	PCGEXCORE_API TSharedPtr<FNodeProfile> BeginNode(const FPCGExContext* InContext, const UPCGSettings* InSettings);
+
+	PCGEXCORE_API bool ExportChromeTrace(const FString& InPath);
+	PCGEXCORE_API bool ExportCSV(const FString& InPath);
+
+	/** Exports to the given path, picking the format from its extension (.json or .csv) */
+	PCGEXCORE_API bool Export(const FString& InPath);
+
+	PCGEXCORE_API void LogSummary();
+	PCGEXCORE_API void Reset();
+}
@@ -41,6 +41,9 @@ protected:
 	
 	UPROPERTY()
 	bool bCachedSupportsInitPolicy = false;
+
+	UPROPERTY()
+	bool bCachedSupportsIncrementalExecution = false;
 	
 	
 	//~Begin UPCGExPointsProcessorSettings
@@ -62,6 +65,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, EditCondition="bCachedSupportsDataStealing", EditConditionHides, HideEditConditionToggle))
 	EPCGExOptionState StealData = EPCGExOptionState::Disabled;
 
+	/** Keep outputs across executions at the finest granularity this node supports (i.e per cluster), and only recompute the parts whose inputs or settings changed.
+	 * Reused outputs are shared with the previous execution, so downstream nodes must not modify their inputs in place. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, EditCondition="bCachedSupportsIncrementalExecution", EditConditionHides, HideEditConditionToggle))
+	EPCGExOptionState IncrementalExecution = EPCGExOptionState::Disabled;
+
 	virtual EPCGExExecutionPolicy GetExecutionPolicy() const { return ExecutionPolicy; }
 
 	/** Forces the execution over a single frame.
@@ -116,6 +124,8 @@ protected:
 	int64 PCGExDataVersion = -1;
 
 	virtual bool SupportsDataStealing() const;
+	virtual bool SupportsIncrementalExecution() const;
+	bool WantsIncrementalExecution() const;
 	virtual bool ShouldCache() const;
 	virtual bool WantsScopedAttributeGet() const;
 	virtual bool WantsBulkInitData() const;
@@ -32,6 +32,9 @@ namespace PCGExData
 	// Extract field value: double = ExtractField(const void* Value, ESingleField Field)
 	using FExtractFieldFn = double (*)(const void* Value, PCGExTypeOps::ESingleField Field);
 
+	// Extract field values of a contiguous range: ExtractFieldRange(const T* Values, int32 Count, ESingleField Field, double* OutValues)
+	using FExtractFieldRangeFn = void (*)(const void* Values, int32 Count, PCGExTypeOps::ESingleField Field, double* OutValues);
+
 	// Inject field value: void InjectField(void* Target, double Value, ESingleField Field)  
 	using FInjectFieldFn = void (*)(void* Target, double Value, PCGExTypeOps::ESingleField Field);
 
@@ -55,6 +58,7 @@ namespace PCGExData
 		static FORCEINLINE FVector ExtractAxisDefault(const void* Value, EPCGExAxis Axis) { return FVector::ForwardVector; }
 
 		PCGEXCORE_API FExtractFieldFn GetExtractFieldFn(EPCGMetadataTypes Type);
+		PCGEXCORE_API FExtractFieldRangeFn GetExtractFieldRangeFn(EPCGMetadataTypes Type);
 		PCGEXCORE_API FInjectFieldFn GetInjectFieldFn(EPCGMetadataTypes Type);
 		PCGEXCORE_API FExtractAxisFn GetExtractAxisFn(EPCGMetadataTypes Type);
 	}
@@ -95,6 +99,7 @@ namespace PCGExData
 
 		// Field operations on RealType
 		FExtractFieldFn ExtractFieldFromReal = nullptr;
+		FExtractFieldRangeFn ExtractFieldRangeFromReal = nullptr;
 		FInjectFieldFn InjectFieldToReal = nullptr;
 
 		// Field operations on WorkingType (for when we need to work with working type directly)
@@ -116,6 +121,14 @@ namespace PCGExData
 		PCGExTypeOps::FConvertFn ConvertRealToDouble = nullptr;
 		PCGExTypeOps::FConvertFn ConvertDoubleToReal = nullptr;
 
+		// Range conversion functions
+		PCGExTypeOps::FConvertRangeFn ConvertRealToWorkingRange = nullptr;
+		PCGExTypeOps::FConvertRangeFn ConvertDoubleToWorkingRange = nullptr;
+
+		// Stride of contiguous ranges
+		int32 RealTypeSize = 0;
+		int32 WorkingTypeSize = 0;
+
 		// Type ops for copy/default operations
 		const PCGExTypeOps::ITypeOpsBase* RealOps = nullptr;
 		const PCGExTypeOps::ITypeOpsBase* WorkingOps = nullptr;
@@ -177,6 +190,18 @@ namespace PCGExData
 		 */
 		void ApplySet(void* Target, const void* Source) const;
 
+		/**
+		 * Apply sub-selection to a contiguous range when reading (Get direction)
+		 * 
+		 * Field extraction & plain conversions run as typed loops over the whole range;
+		 * axis & transform component selections fall back to ApplyGet on each value.
+		 * 
+		 * @param Source Pointer to the first source value (RealType)
+		 * @param OutValues Pointer to the first output value (WorkingType), already constructed
+		 * @param Count Number of values
+		 */
+		void ApplyGetRange(const void* Source, void* OutValues, const int32 Count) const;
+
 		/**
 		 * Get without sub-selection - just convert RealType → WorkingType
 		 */
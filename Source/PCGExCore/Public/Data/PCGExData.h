@@ -49,6 +49,7 @@ class FPCGMetadataAttribute;
 namespace PCGExData
 {
 	struct FAttributeIdentity;
+	struct FReadBufferKey;
 
 	template <typename T>
 	class TAttributeBroadcaster;
@@ -198,6 +199,7 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 
 		// Unsafe set value in output
 		virtual void SetValue(const int32 Index, const T& Value) = 0;
+		virtual void SetValues(const int32 Start, TArrayView<const T> Values) = 0;
 
 		virtual bool InitForRead(const EIOSide InSide = EIOSide::In, const bool bScoped = false) = 0;
 		virtual bool InitForBroadcast(const FPCGAttributePropertyInputSelector& InSelector, const bool bCaptureMinMax = false, const bool bScoped = false, const bool bQuiet = false) = 0;
@@ -255,6 +257,7 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 
 	public:
 		TArrayBuffer(const TSharedRef<FPointIO>& InSource, const FPCGAttributeIdentifier& InIdentifier);
+		virtual ~TArrayBuffer() override;
 
 		virtual bool IsSparse() const override { return bSparseBuffer || InternalBroadcaster; }
 
@@ -274,12 +277,14 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual const void GetValues(const int32 Start, TArrayView<T> OutResults) override;
 
 		virtual void SetValue(const int32 Index, const T& Value) override;
+		virtual void SetValues(const int32 Start, TArrayView<const T> Values) override;
 		virtual PCGExValueHash ReadValueHash(const int32 Index) override;
 
 	protected:
 		virtual void ComputeValueHashes(const PCGExMT::FScope& Scope);
 
 		virtual void InitForReadInternal(const bool bScoped, const FPCGMetadataAttributeBase* Attribute);
+		bool InitFromSharedValues(const FReadBufferKey& InKey, const FPCGMetadataAttributeBase* Attribute, const bool bRequireMinMax);
 		virtual void InitForWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init);
 
 	public:
@@ -330,6 +335,7 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual const void GetValues(const int32 Start, TArrayView<T> OutResults) override;
 
 		virtual void SetValue(const int32 Index, const T& Value) override;
+		virtual void SetValues(const int32 Start, TArrayView<const T> Values) override;
 
 		virtual bool InitForRead(const EIOSide InSide = EIOSide::In, const bool bScoped = false) override;
 		virtual bool InitForBroadcast(const FPCGAttributePropertyInputSelector& InSelector, const bool bCaptureMinMax = false, const bool bScoped = false, const bool bQuiet = false) override;
@@ -0,0 +1,50 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExDataCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+struct FPCGExContext;
+class UPCGData;
+class UPCGBasePointData;
+class UPCGPointArrayData;
+
+namespace PCGExData
+{
+	class FPointIO;
+
+	namespace Benchmark
+	{
+		/**
+		 * Standalone context for benchmark & check cases that need one, without any graph or node:
+		 * inputs can be read from pins, outputs initialized, and every object it creates is managed (rooted) until it is destroyed.
+		 * Point IOs & facades bound to it must be released first.
+		 */
+		class PCGEXCORE_API FContextFixture
+		{
+		public:
+			FContextFixture();
+			~FContextFixture();
+
+			FPCGExContext* Get() const { return Context.Get(); }
+
+			/** Point data with the given positions, managed by the context */
+			UPCGPointArrayData* MakePointData(const TConstArrayView<FVector> InPositions) const;
+
+			/** Adds data to the context inputs, under the given pin */
+			void AddInput(const UPCGData* InData, const FName InPin) const;
+
+			/** Point IO bound to the context, with its output initialized */
+			TSharedPtr<FPointIO> MakePointIO(const UPCGBasePointData* InData, const EIOInit InitOut = EIOInit::NoInit) const;
+
+		private:
+			TUniquePtr<FPCGExContext> Context;
+		};
+	}
+}
+
+#endif
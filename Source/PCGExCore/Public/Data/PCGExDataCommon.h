@@ -37,6 +37,14 @@ enum class EPCGExDataInputValueType : uint8
 	Attribute = 1 UMETA(DisplayName = "@Data", Tooltip="Attribute. Can only read from @Data domain.", ActionIcon="DataAttribute"),
 };
 
+UENUM()
+enum class EPCGExCopyMode : uint8
+{
+	Duplicate = 0 UMETA(DisplayName = "Duplicate", Tooltip="Each copy is a full, independent duplicate of the source."),
+	Shared    = 1 UMETA(DisplayName = "Shared", Tooltip="Each copy shares the source attributes & point properties, and only owns its transforms. Much lighter when copying large data onto many targets."),
+	Merged    = 2 UMETA(DisplayName = "Merged", Tooltip="All copies of a source are written into a single output, with an attribute telling which target each point was copied to."),
+};
+
 UENUM(BlueprintType)
 enum class EPCGExNumericOutput : uint8
 {
@@ -58,6 +66,8 @@ namespace PCGExData
 		Duplicate,
 		//Forward Input Object
 		Forward,
+		// Create Output Object that shares the input's points & metadata, copy-on-write
+		Inherit,
 	};
 
 	enum class EIOSide : uint8
@@ -27,6 +27,29 @@ namespace PCGExData
 
 namespace PCGExData
 {
+	/**
+	 * Marks data that is kept beyond the execution that produced it and handed out as-is to later ones, i.e cached outputs.
+	 * Nodes stealing their inputs never modify marked data in place, forwarding it duplicates it instead.
+	 * Data stays marked for as long as at least one guard holds it.
+	 */
+	class PCGEXCORE_API FStealGuard
+	{
+	public:
+		FStealGuard() = default;
+		explicit FStealGuard(const UPCGData* InData);
+		~FStealGuard();
+
+		FStealGuard(const FStealGuard&) = delete;
+		FStealGuard& operator=(const FStealGuard&) = delete;
+
+		void Reset(const UPCGData* InData = nullptr);
+
+		static bool IsGuarded(const UPCGData* InData);
+
+	private:
+		const UPCGData* Data = nullptr;
+	};
+
 #pragma region FPointIO
 	/**
 	 * 
@@ -40,6 +63,7 @@ namespace PCGExData
 		bool bTransactional = false;
 		bool bMutable = false;
 		bool bPinless = false;
+		bool bReusedOutput = false;
 
 		TWeakPtr<FPCGContextHandle> ContextHandle;
 
@@ -64,6 +88,9 @@ namespace PCGExData
 
 		TSharedPtr<TArray<int32>> IdxMapping;
 
+		/** Parents a freshly created Out to In, see EIOInit::Inherit */
+		void InheritInput();
+
 	public:
 		TSharedPtr<FTags> Tags;
 		int32 IOIndex = 0;
@@ -90,6 +117,13 @@ namespace PCGExData
 
 		bool InitializeOutput(EIOInit InitOut = EIOInit::NoInit);
 
+		/**
+		 * Uses existing data as output instead of initializing a new one, i.e an output kept from a previous execution.
+		 * That data is not owned by this IO : it is treated as read-only and staged without being managed by the context.
+		 */
+		void ReuseOutput(UPCGBasePointData* InData);
+		bool IsReusedOutput() const { return bReusedOutput; }
+
 		template <typename T>
 		bool InitializeOutput(const EIOInit InitOut = EIOInit::NoInit)
 		{
@@ -113,12 +147,14 @@ namespace PCGExData
 
 			LastInit = InitOut;
 
-			if (IsValid(Out) && Out != In)
+			if (IsValid(Out) && Out != In && !bReusedOutput)
 			{
 				SharedContext.Get()->ManagedObjects->Destroy(Out);
 				Out = nullptr;
 			}
 
+			bReusedOutput = false;
+
 			if (InitOut == EIOInit::NoInit)
 			{
 				bMutable = false;
@@ -173,6 +209,20 @@ namespace PCGExData
 				return true;
 			}
 
+			if (InitOut == EIOInit::Inherit)
+			{
+				check(In)
+
+				T* TypedOut = SharedContext.Get()->ManagedObjects->New<T>();
+				if (!TypedOut) { return false; }
+
+				Out = Cast<UPCGBasePointData>(TypedOut);
+				check(Out)
+
+				InheritInput();
+				return true;
+			}
+
 			return InitializeOutput(InitOut);
 		}
 
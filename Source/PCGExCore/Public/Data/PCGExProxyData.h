@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExDataCommon.h"
+#include "Core/PCGExMTCommon.h"
 #include "Types/PCGExTypes.h"
 #include "Data/PCGExSubSelection.h"
 #include "Metadata/PCGAttributePropertySelector.h"
@@ -128,7 +129,13 @@ namespace PCGExData
 		// Cached flag for whether working type needs lifecycle management
 		bool bWorkingTypeNeedsLifecycle = false;
 
+		// Stride of WorkingType ranges
+		int32 WorkingTypeSize = 0;
+
 	public:
+		// Range conversions go through stack scratch of at most this many values
+		static constexpr int32 RangeChunkSize = 64;
+
 		// Point data reference for property proxies
 		UPCGBasePointData* Data = nullptr;
 
@@ -140,6 +147,10 @@ namespace PCGExData
 		const PCGExTypeOps::FConvertFn WorkingToReal;
 		const PCGExTypeOps::FConvertFn RealToWorking;
 
+		// Direct range conversion function pointers (from FConversionTable)
+		const PCGExTypeOps::FConvertRangeFn WorkingToRealRange;
+		const PCGExTypeOps::FConvertRangeFn RealToWorkingRange;
+
 		explicit IBufferProxy(
 			EPCGMetadataTypes InRealType = EPCGMetadataTypes::Unknown,
 			EPCGMetadataTypes InWorkingType = EPCGMetadataTypes::Unknown);
@@ -166,6 +177,13 @@ namespace PCGExData
 		virtual void SetVoid(const int32 Index, const void* Value) const = 0;
 		virtual void GetCurrentVoid(const int32 Index, void* OutValue) const { GetVoid(Index, OutValue); }
 
+		//
+		// Type-erased range access - Count contiguous values starting at Start, laid out as constructed WorkingType values
+		// Defaults go through GetVoid/SetVoid; proxies over contiguous storage override them with bulk conversions.
+		//
+		virtual void GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const;
+		virtual void SetRangeVoid(const int32 Start, const int32 Count, const void* Values) const;
+
 		// Hash computation
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const = 0;
 
@@ -259,6 +277,30 @@ namespace PCGExData
 			return Result;
 		}
 
+		//
+		// Convenience typed range accessors - one conversion kernel per range instead of one indirect call per value
+		//
+
+		template <typename T>
+		void GetRange(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const
+		{
+			constexpr EPCGMetadataTypes RequestedType = PCGExTypes::TTraits<T>::Type;
+			check(OutValues.Num() >= Scope.Count);
+
+			if (RequestedType == WorkingType) { GetRangeVoid(Scope.Start, Scope.Count, OutValues.GetData()); }
+			else { GetRangeAs(Scope.Start, Scope.Count, RequestedType, OutValues.GetData()); }
+		}
+
+		template <typename T>
+		void SetRange(const PCGExMT::FScope& Scope, TArrayView<const T> Values) const
+		{
+			constexpr EPCGMetadataTypes ValueType = PCGExTypes::TTraits<T>::Type;
+			check(Values.Num() >= Scope.Count);
+
+			if (ValueType == WorkingType) { SetRangeVoid(Scope.Start, Scope.Count, Values.GetData()); }
+			else { SetRangeFrom(Scope.Start, Scope.Count, ValueType, Values.GetData()); }
+		}
+
 		// Converting read methods - SAFE versions
 #define PCGEX_CONVERTING_READ(_TYPE, _NAME, ...) virtual _TYPE ReadAs##_NAME(const int32 Index) const;
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERTING_READ)
@@ -269,6 +311,11 @@ namespace PCGExData
 		{
 			return PCGExTypes::FScopedTypedValue(WorkingType);
 		}
+
+	protected:
+		// Range access through WorkingType scratch, for values of another type
+		void GetRangeAs(const int32 Start, const int32 Count, const EPCGMetadataTypes ToType, void* OutValues) const;
+		void SetRangeFrom(const int32 Start, const int32 Count, const EPCGMetadataTypes FromType, const void* Values) const;
 	};
 
 	class PCGEXCORE_API IBufferProxyPool : public TSharedFromThis<IBufferProxyPool>
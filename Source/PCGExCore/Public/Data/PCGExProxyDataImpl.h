@@ -41,6 +41,9 @@ namespace PCGExData
 		virtual void GetVoid(const int32 Index, void* OutValue) const override;
 		virtual void SetVoid(const int32 Index, const void* Value) const override;
 
+		virtual void GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const override;
+		virtual void SetRangeVoid(const int32 Start, const int32 Count, const void* Values) const override;
+
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const override;
 	};
 
@@ -68,6 +71,9 @@ namespace PCGExData
 		virtual void SetVoid(const int32 Index, const void* Value) const override;
 		virtual void GetCurrentVoid(const int32 Index, void* OutValue) const override;
 
+		virtual void GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const override;
+		virtual void SetRangeVoid(const int32 Start, const int32 Count, const void* Values) const override;
+
 		virtual TSharedPtr<IBuffer> GetBuffer() const override;
 		virtual bool EnsureReadable() const override;
 
@@ -96,12 +102,16 @@ namespace PCGExData
 
 		virtual void GetVoid(const int32 Index, void* OutValue) const override;
 		virtual void SetVoid(const int32 Index, const void* Value) const override;
+		virtual void GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const override;
 		virtual void InitForRole(EProxyRole InRole) override;
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const override;
 
 	protected:
 		void GetPropertyValue(const int32 Index, void* OutValue) const;
 		void SetPropertyValue(const int32 Index, const void* Value) const;
+
+		template <typename T, typename FGetFn>
+		void GetPropertyRange(const int32 Start, const int32 Count, void* OutValues, FGetFn&& GetFn) const;
 	};
 
 	//
@@ -142,6 +152,7 @@ namespace PCGExData
 
 		virtual void GetVoid(const int32 Index, void* OutValue) const override;
 		virtual void SetVoid(const int32 Index, const void* Value) const override { check(false); }
+		virtual void GetRangeVoid(const int32 Start, const int32 Count, void* OutValues) const override;
 		virtual bool Validate(const FProxyDescriptor& InDescriptor) const override;
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const override;
 	};
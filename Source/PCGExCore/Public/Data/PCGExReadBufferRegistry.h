@@ -0,0 +1,166 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Metadata/PCGMetadataCommon.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UPCGData;
+
+namespace PCGExData
+{
+	struct PCGEXCORE_API FReadBufferKey
+	{
+		const UPCGData* Data = nullptr;
+		uint32 DataUID = 0;
+		EPCGMetadataTypes Type = EPCGMetadataTypes::Unknown;
+		FString Selector;
+
+		FReadBufferKey() = default;
+		FReadBufferKey(const UPCGData* InData, const EPCGMetadataTypes InType, const FString& InSelector);
+
+		FORCEINLINE bool operator==(const FReadBufferKey& Other) const
+		{
+			return Data == Other.Data && DataUID == Other.DataUID && Type == Other.Type && Selector.Equals(Other.Selector, ESearchCase::CaseSensitive);
+		}
+
+		friend FORCEINLINE uint32 GetTypeHash(const FReadBufferKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.Data), Key.DataUID), HashCombineFast(static_cast<uint32>(Key.Type), GetTypeHash(Key.Selector)));
+		}
+	};
+
+	struct PCGEXCORE_API FReadBufferStats
+	{
+		int32 NumEntries = 0;
+		int64 NumRegistered = 0;
+		int64 NumHits = 0;
+		int64 SharedBytes = 0;
+		int64 LiveBytes = 0;
+	};
+
+	/**
+	 * Shared cache of fully read input buffers.
+	 * This is not an alias of PCG's own storage, which isn't exposed: the first buffer reading a given attribute/property
+	 * of an input still copies it, then registers that copy. Every other buffer reading the same thing as the same type,
+	 * in any node, shares it instead of making its own.
+	 * The registry only keeps weak references; values are freed as soon as the last buffer using them is.
+	 * Shared values are read-only. Data that gets modified in place (stolen inputs, writes to a forwarded input)
+	 * must be invalidated, since its pointer & unique ID don't change.
+	 */
+	class PCGEXCORE_API FReadBufferRegistry
+	{
+		class IEntry
+		{
+		public:
+			virtual ~IEntry() = default;
+
+			TWeakObjectPtr<const UPCGData> Data;
+			int64 NumBytes = 0;
+
+			virtual bool IsValid() const = 0;
+		};
+
+		template <typename T>
+		class TEntry final : public IEntry
+		{
+		public:
+			TWeakPtr<TArray<T>> Values;
+			bool bHasMinMax = false;
+			T Min = T{};
+			T Max = T{};
+
+			virtual bool IsValid() const override { return Data.IsValid() && Values.IsValid(); }
+		};
+
+	public:
+		static FReadBufferRegistry& Get();
+
+		/**
+		 * Finds values previously registered for that key. bRequireMinMax only matches entries that captured their range.
+		 * @return the shared values, or nullptr
+		 */
+		template <typename T>
+		TSharedPtr<TArray<T>> Find(const FReadBufferKey& InKey, const bool bRequireMinMax, T& OutMin, T& OutMax) const
+		{
+			if (!IsEnabled()) { return nullptr; }
+
+			FReadScopeLock ReadLock(Lock);
+
+			const TSharedPtr<IEntry>* Found = Entries.Find(InKey);
+			if (!Found || !(*Found)->Data.IsValid()) { return nullptr; }
+
+			const TEntry<T>* Entry = static_cast<const TEntry<T>*>(Found->Get());
+			if (bRequireMinMax && !Entry->bHasMinMax) { return nullptr; }
+
+			TSharedPtr<TArray<T>> Values = Entry->Values.Pin();
+			if (!Values) { return nullptr; }
+
+			if (Entry->bHasMinMax)
+			{
+				OutMin = Entry->Min;
+				OutMax = Entry->Max;
+			}
+
+			OnHit(Entry->NumBytes);
+			return Values;
+		}
+
+		/** Registers fully read values for that key, unless a live entry that is at least as complete already exists */
+		template <typename T>
+		void Register(const FReadBufferKey& InKey, const TSharedPtr<TArray<T>>& InValues, const bool bHasMinMax, const T& InMin, const T& InMax)
+		{
+			if (!IsEnabled() || !InValues || !InKey.Data) { return; }
+
+			const TSharedPtr<TEntry<T>> NewEntry = MakeShared<TEntry<T>>();
+			NewEntry->Data = InKey.Data;
+			NewEntry->NumBytes = static_cast<int64>(InValues->Num()) * sizeof(T);
+			NewEntry->Values = InValues;
+			NewEntry->bHasMinMax = bHasMinMax;
+			NewEntry->Min = InMin;
+			NewEntry->Max = InMax;
+
+			FWriteScopeLock WriteLock(Lock);
+
+			if (const TSharedPtr<IEntry>* Existing = Entries.Find(InKey); Existing && (*Existing)->IsValid())
+			{
+				if (!bHasMinMax || static_cast<const TEntry<T>*>(Existing->Get())->bHasMinMax) { return; }
+			}
+
+			Entries.Add(InKey, NewEntry);
+			NumRegistered++;
+
+			if (NumRegistered % 256 == 0) { TrimUnsafe(); }
+		}
+
+		/** Drop every entry registered for that data; buffers already sharing its values keep them */
+		void Invalidate(const UPCGData* InData);
+
+		/** Drop entries whose data or values are gone */
+		void Trim();
+
+		FReadBufferStats GetStats() const;
+		FString GetStatsSummary() const;
+
+		static bool IsEnabled();
+
+	private:
+		FReadBufferRegistry() = default;
+
+		void OnHit(const int64 InBytes) const;
+		void TrimUnsafe();
+
+		TMap<FReadBufferKey, TSharedPtr<IEntry>> Entries;
+		mutable FRWLock Lock;
+
+		mutable std::atomic<int64> NumHits{0};
+		mutable std::atomic<int64> SharedBytes{0};
+
+		int64 NumRegistered = 0;
+	};
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "PCGExOctree.h"
+
+class UPCGData;
+class UPCGBasePointData;
+
+namespace PCGExBVH
+{
+	class FItemBVH;
+}
+
+namespace PCGExData
+{
+	/**
+	 * Kind of spatial index stored in the registry.
+	 * Each kind maps to exactly one payload type; Variant disambiguates build parameters within a kind.
+	 */
+	enum class ESpatialIndexKind : uint8
+	{
+		PointCenter    = 0, // PCGExOctree::FItemOctree, zero-extent items at point locations
+		PointBounds    = 1, // PCGExOctree::FItemOctree, items are transformed point bounds (Variant = EPCGExPointBoundsSource)
+		EdgeSegment    = 2, // PCGExOctree::FItemOctree, items are edge segment bounds
+		OrientedBounds = 3, // PCGExMath::OBB::FCollection (Variant = EPCGExPointBoundsSource)
+		PointCenterBVH = 4, // PCGExBVH::FItemBVH, zero-extent items at point locations
+	};
+
+	/** Parallel build of a BVH over point locations; item indices are point indices */
+	PCGEXCORE_API TSharedPtr<PCGExBVH::FItemBVH> BuildPointCenterBVH(const UPCGBasePointData* InData);
+
+	struct PCGEXCORE_API FSpatialIndexKey
+	{
+		const UPCGData* Data = nullptr;
+		uint32 DataUID = 0;
+		ESpatialIndexKind Kind = ESpatialIndexKind::PointCenter;
+		uint32 Variant = 0;
+
+		FSpatialIndexKey() = default;
+		FSpatialIndexKey(const UPCGData* InData, const ESpatialIndexKind InKind, const uint32 InVariant);
+
+		FORCEINLINE bool operator==(const FSpatialIndexKey& Other) const
+		{
+			return Data == Other.Data && DataUID == Other.DataUID && Kind == Other.Kind && Variant == Other.Variant;
+		}
+
+		friend FORCEINLINE uint32 GetTypeHash(const FSpatialIndexKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.Data), Key.DataUID), HashCombineFast(static_cast<uint32>(Key.Kind), Key.Variant));
+		}
+	};
+
+	struct PCGEXCORE_API FSpatialIndexStats
+	{
+		int32 NumEntries = 0;
+		int64 NumBuilds = 0;
+		int64 NumHits = 0;
+		int64 NumRedundantBuilds = 0;
+		int64 NumEvictions = 0;
+		double BuildSeconds = 0;
+		double SavedSeconds = 0;
+		int64 MemoryBytes = 0;
+	};
+
+	/**
+	 * Registry of immutable spatial indexes built over immutable PCG data.
+	 * Nodes working on the same data during an execution share a single index instead of each building their own.
+	 * Indexes are ref-counted through shared pointers; the registry only evicts entries no one holds anymore,
+	 * or whose source data has been destroyed. Payloads are handed out as const and must only be queried.
+	 * Data modified in place (stolen, or written with Out == In) keeps its pointer and unique ID, and must be invalidated.
+	 */
+	class PCGEXCORE_API FSpatialIndexRegistry
+	{
+		class IEntry
+		{
+		public:
+			virtual ~IEntry() = default;
+
+			TWeakObjectPtr<const UPCGData> Data;
+			double BuildSeconds = 0;
+			int64 MemoryBytes = 0;
+			std::atomic<uint64> LastAccess{0};
+
+			virtual bool IsInUse() const = 0;
+		};
+
+		template <typename T>
+		class TEntry final : public IEntry
+		{
+		public:
+			TSharedPtr<const T> Index;
+			virtual bool IsInUse() const override { return Index.GetSharedReferenceCount() > 1; }
+		};
+
+	public:
+		static FSpatialIndexRegistry& Get();
+
+		/**
+		 * Returns the shared index for this data/kind/variant, building it if necessary.
+		 * BuildFn must return a fully built index, and may set OutMemoryBytes to an estimate of its footprint.
+		 * Concurrent requests for the same missing key may both build; only the first one to finish is kept.
+		 */
+		template <typename T>
+		TSharedPtr<const T> FindOrBuild(const UPCGData* InData, const ESpatialIndexKind InKind, const uint32 InVariant, TFunctionRef<TSharedPtr<T>(int64& OutMemoryBytes)> BuildFn)
+		{
+			if (!InData) { return nullptr; }
+
+			const FSpatialIndexKey Key(InData, InKind, InVariant);
+
+			if (IsEnabled())
+			{
+				FReadScopeLock ReadLock(Lock);
+				if (const TSharedPtr<IEntry>* Found = Entries.Find(Key); Found && (*Found)->Data.IsValid())
+				{
+					OnHit(**Found);
+					return static_cast<TEntry<T>*>(Found->Get())->Index;
+				}
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+
+			int64 MemoryBytes = 0;
+			TSharedPtr<const T> NewIndex = BuildFn(MemoryBytes);
+			if (!NewIndex || !IsEnabled()) { return NewIndex; }
+
+			const TSharedPtr<TEntry<T>> NewEntry = MakeShared<TEntry<T>>();
+			NewEntry->Data = InData;
+			NewEntry->Index = NewIndex;
+			NewEntry->MemoryBytes = MemoryBytes;
+			NewEntry->BuildSeconds = FPlatformTime::Seconds() - StartTime;
+
+			const TSharedPtr<IEntry> Registered = Register(Key, NewEntry);
+			return static_cast<TEntry<T>*>(Registered.Get())->Index;
+		}
+
+		/** Point octree over the whole data, for the PointCenter & PointBounds kinds */
+		TSharedPtr<const PCGExOctree::FItemOctree> GetPointOctree(const UPCGBasePointData* InData, const ESpatialIndexKind InKind, const uint8 InBoundsSource = 0);
+
+		/**
+		 * Point-center BVH over the whole data, built in parallel.
+		 * Meant to replace UPCGBasePointData::GetPointOctree for center queries; bounds queries must expand their box by the largest point reach.
+		 */
+		TSharedPtr<const PCGExBVH::FItemBVH> GetPointBVH(const UPCGBasePointData* InData);
+
+		/** Drop every index built over that data, whatever its kind; consumers already holding one keep it */
+		void Invalidate(const UPCGData* InData);
+
+		/** Drop entries whose data is gone, then least recently used idle entries until the memory budget is respected */
+		void Trim();
+
+		/** Drop every idle entry */
+		void Flush();
+
+		FSpatialIndexStats GetStats() const;
+		FString GetStatsSummary() const;
+
+		static bool IsEnabled();
+
+	private:
+		FSpatialIndexRegistry() = default;
+
+		void OnHit(IEntry& InEntry) const;
+		TSharedPtr<IEntry> Register(const FSpatialIndexKey& InKey, const TSharedPtr<IEntry>& InEntry);
+		void TrimUnsafe(const int64 InBudget);
+
+		TMap<FSpatialIndexKey, TSharedPtr<IEntry>> Entries;
+		mutable FRWLock Lock;
+
+		mutable std::atomic<uint64> AccessCounter{0};
+		mutable std::atomic<int64> NumHits{0};
+		mutable std::atomic<int64> SavedMicroseconds{0};
+
+		int64 NumBuilds = 0;
+		int64 NumRedundantBuilds = 0;
+		int64 NumEvictions = 0;
+		double BuildSeconds = 0;
+		int64 MemoryBytes = 0;
+	};
+}
@@ -67,6 +67,7 @@ namespace PCGExData
 		TWeakPtr<FPCGContextHandle> ContextHandle;
 		TWeakPtr<FFacade> InternalDataFacadePtr;
 		bool bLoaded = false;
+		double LoadingStartTime = 0;
 
 	public:
 		TArray<FReadableBufferConfig> BufferConfigs;
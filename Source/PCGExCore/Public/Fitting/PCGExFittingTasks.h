@@ -5,6 +5,9 @@
 
 #include "CoreMinimal.h"
 #include "Core/PCGExMT.h"
+#include "Utils/PCGValueRange.h"
+
+class UPCGBasePointData;
 
 namespace PCGExData
 {
@@ -13,16 +16,33 @@ namespace PCGExData
 
 struct FPCGExTransformDetails;
 
+namespace PCGExFitting
+{
+	/** Bounds of the given points as fitted by FTransformPointIO onto a target */
+	PCGEXCORE_API FBox GetFittingBounds(const UPCGBasePointData* InData, const FPCGExTransformDetails& InTransformDetails);
+
+	/**
+	 * Moves Transforms[Start, Start + Count[ onto the target point at TargetIndex.
+	 * InBounds are the fitting bounds of those transforms, as returned by GetFittingBounds.
+	 */
+	PCGEXCORE_API void TransformRange(const FPCGExTransformDetails& InTransformDetails, const int32 TargetIndex, FBox InBounds, TPCGValueRange<FTransform>& Transforms, const int32 Start, const int32 Count);
+}
+
 namespace PCGExFitting::Tasks
 {
 	class PCGEXCORE_API FTransformPointIO final : public PCGExMT::FPCGExIndexedTask
 	{
 	public:
-		FTransformPointIO(const int32 InTaskIndex, const TSharedPtr<PCGExData::FPointIO>& InPointIO, const TSharedPtr<PCGExData::FPointIO>& InToBeTransformedIO, FPCGExTransformDetails* InTransformDetails, bool bAllocate = false);
+		/**
+		 * @param bInAllocate Set when ToBeTransformedIO was initialized with EIOInit::Inherit;
+		 * its transforms are then materialized from the input before being moved.
+		 */
+		FTransformPointIO(const int32 InTaskIndex, const TSharedPtr<PCGExData::FPointIO>& InPointIO, const TSharedPtr<PCGExData::FPointIO>& InToBeTransformedIO, FPCGExTransformDetails* InTransformDetails, const bool bInAllocate = false);
 
 		TSharedPtr<PCGExData::FPointIO> PointIO;
 		TSharedPtr<PCGExData::FPointIO> ToBeTransformedIO;
 		FPCGExTransformDetails* TransformDetails = nullptr;
+		bool bAllocate = false;
 
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager) override;
 	};
@@ -63,6 +63,33 @@ namespace PCGExPointArrayDataHelpers
 
 	PCGEXCORE_API EPCGPointNativeProperties GetPointNativeProperties(uint8 Flags);
 
+	/** Size in bytes of a single point's worth of the given properties, once allocated */
+	PCGEXCORE_API SIZE_T GetNativePropertiesSize(EPCGPointNativeProperties Properties);
+
+	/**
+	 * Tally of what copying point data cost, for nodes that can report it. Add is thread-safe.
+	 * Attribute values are counted rather than measured, as metadata doesn't expose its footprint.
+	 */
+	struct PCGEXCORE_API FCopyStats
+	{
+		double StartTime = 0;
+		int32 NumCopies = 0;
+		int64 NumPoints = 0;
+		int64 PropertiesBytes = 0;
+		int64 NumAttributeValues = 0;
+
+		void Start();
+
+		/**
+		 * Records NumInstances copies of InSource.
+		 * @param Properties Native properties each copied point allocates
+		 * @param bCopiesAttributes Whether attribute values were copied along, as opposed to shared with the source
+		 */
+		void Add(const UPCGBasePointData* InSource, const EPCGPointNativeProperties Properties, const bool bCopiesAttributes, const int32 NumInstances = 1);
+
+		void Log(const TCHAR* InLabel) const;
+	};
+
 	template <typename T>
 	static void Reverse(TPCGValueRange<T> Range)
 	{
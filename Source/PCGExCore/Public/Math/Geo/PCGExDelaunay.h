@@ -14,6 +14,13 @@ namespace PCGExMath::Geo
 {
 	constexpr static int32 MTX[4][3] = {{0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}};
 
+	/** Sorts edge hashes & removes duplicates, in parallel buckets keyed on the edge's highest vertex index */
+	PCGEXCORE_API void SortUniqueEdges(TArray<uint64>& Edges, const int32 NumVertices);
+
+	/**
+	 * Delaunay triangle.
+	 * Neighbors[i] is the site across the edge Vtx[i] -> Vtx[(i + 1) % 3], or -1 if that edge is on the hull.
+	 */
 	struct PCGEXCORE_API FDelaunaySite2
 	{
 		int32 Vtx[3];
@@ -26,7 +33,9 @@ namespace PCGExMath::Geo
 
 		bool ContainsEdge(const uint64 Edge) const;
 		uint64 GetSharedEdge(const FDelaunaySite2* Other) const;
-		void PushAdjacency(const int32 SiteId);
+
+		FORCEINLINE uint64 GetEdge(const int32 Index) const { return PCGEx::H64U(Vtx[Index], Vtx[(Index + 1) % 3]); }
+		FORCEINLINE void UpdateOnHull() { bOnHull = Neighbors[0] == -1 || Neighbors[1] == -1 || Neighbors[2] == -1; }
 
 		FORCEINLINE uint64 AB() const { return PCGEx::H64U(Vtx[0], Vtx[1]); }
 		FORCEINLINE uint64 BC() const { return PCGEx::H64U(Vtx[1], Vtx[2]); }
@@ -38,8 +47,8 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite2> Sites;
 
-		TSet<uint64> DelaunayEdges;
-		TSet<int32> DelaunayHull;
+		TArray<uint64> DelaunayEdges; // Unique undirected edges, sorted
+		TBitArray<> DelaunayHull;     // One bit per input position
 		bool IsValid = false;
 
 		mutable FRWLock ProcessLock;
@@ -53,22 +62,27 @@ namespace PCGExMath::Geo
 	public:
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
 
+		FORCEINLINE bool IsOnHull(const int32 Index) const { return DelaunayHull.IsValidIndex(Index) && DelaunayHull[Index]; }
+		SIZE_T GetAllocatedSize() const;
+
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges);
 
 		void GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites);
 	};
 
+	/**
+	 * Delaunay tetrahedron, with vertices sorted in ascending order.
+	 * Neighbors[i] is the site sharing the face MTX[i], or -1 if that face is on the hull or adjacency wasn't computed.
+	 */
 	struct PCGEXCORE_API FDelaunaySite3
 	{
-		uint32 Faces[4];
 		int32 Vtx[4];
+		int32 Neighbors[4];
 		int32 Id = -1;
 		int8 bOnHull = 0;
 
 		explicit FDelaunaySite3(const FIntVector4& InVtx, const int32 InId = -1);
-
-		void ComputeFaces();
 	};
 
 	class PCGEXCORE_API TDelaunay3
@@ -76,9 +90,16 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite3> Sites;
 
-		TSet<uint64> DelaunayEdges;
-		TSet<int32> DelaunayHull;
-		TMap<uint32, uint64> Adjacency;
+		TArray<uint64> DelaunayEdges; // Unique undirected edges, sorted
+		TBitArray<> DelaunayHull;     // One bit per input position, only filled when computing the hull
+
+		/**
+		 * Order in which positions are fed to the tetrahedralizer: biased randomized rounds, each sorted along a Morton curve,
+		 * which keeps point location walks short. It survives Clear() and is reused as long as the number of positions doesn't change,
+		 * so repeated calls on points that only moved slightly (e.g. relaxation iterations) skip computing it again.
+		 */
+		TArray<int32> InsertionOrder;
+		bool bSpatialInsertionOrder = true;
 
 		bool IsValid = false;
 
@@ -91,107 +112,17 @@ namespace PCGExMath::Geo
 	protected:
 		void Clear();
 
+		void ComputeInsertionOrder(const TArrayView<FVector>& Positions);
+		void ComputeAdjacency(const int32 NumPositions);
+
 	public:
+		bool Process(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull, const bool bComputeEdges = true);
+
 		template <bool bComputeAdjacency = false, bool bComputeHull = false>
-		bool Process(const TArrayView<FVector>& Positions)
-		{
-			Clear();
-			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
-
-			UE::Geometry::FDelaunay3 Tetrahedralization;
-
-			if (!Tetrahedralization.Triangulate(Positions))
-			{
-				Clear();
-				return false;
-			}
-
-			IsValid = true;
-
-			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
-
-			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
-
-			TSet<uint32> FacesUsage;
-			if constexpr (bComputeAdjacency) { Adjacency.Reserve(NumSites * 4); }
-			if constexpr (bComputeHull) { FacesUsage.Reserve(NumSites); }
-
-			//PCGExArrayHelpers::InitArray(Sites, NumSites);
-			Sites.SetNumUninitialized(NumSites);
-
-			for (int i = 0; i < NumSites; i++)
-			{
-				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
-				FDelaunaySite3& Site = Sites[i];
-
-				for (int a = 0; a < 4; a++)
-				{
-					for (int b = a + 1; b < 4; b++)
-					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
-					}
-				}
-
-				if constexpr (bComputeHull || bComputeAdjacency) { Site.ComputeFaces(); }
-
-				if constexpr (bComputeHull && bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet) { FacesUsage.Remove(FH); }
-
-						if (const uint64* AH = Adjacency.Find(FH)) { Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH))); }
-						else { Adjacency.Add(FH, PCGEx::NH64(-1, i)); }
-					}
-				}
-				else if constexpr (bComputeHull)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet) { FacesUsage.Remove(FH); }
-					}
-				}
-				else if constexpr (bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						if (const uint64* AH = Adjacency.Find(FH)) { Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH))); }
-						else { Adjacency.Add(FH, PCGEx::NH64(-1, i)); }
-					}
-				}
-			}
-
-			if constexpr (bComputeHull)
-			{
-				for (FDelaunaySite3& Site : Sites)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						if (FacesUsage.Contains(Site.Faces[f]))
-						{
-							for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
-							Site.bOnHull = true;
-						}
-					}
-				}
-			}
-
-			FacesUsage.Empty();
-			Tetrahedra.Empty();
-
-			return IsValid;
-		}
+		bool Process(const TArrayView<FVector>& Positions) { return Process(Positions, bComputeAdjacency, bComputeHull); }
+
+		FORCEINLINE bool IsOnHull(const int32 Index) const { return DelaunayHull.IsValidIndex(Index) && DelaunayHull[Index]; }
+		SIZE_T GetAllocatedSize() const;
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges);
@@ -0,0 +1,58 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath::Geo
+{
+	/**
+	 * Point-location grid over a 2D polygon, answering the same non-zero winding test as FGeomTools2D::IsPointInPolygon
+	 * without walking every edge for every query.
+	 * The polygon bounds are split into roughly square cells; each cell knows which edges overlap it and the winding number at its center.
+	 * A query only looks at the edges of its own cell: the winding number changes by one every time the segment from the
+	 * query to the cell center crosses an edge. Cells without edges answer straight away.
+	 * Queries too close to an edge or a vertex to be decided robustly fall back to the reference test.
+	 * The polygon is implicitly closed, like the reference test.
+	 */
+	class PCGEXCORE_API FPolygonInclusionGrid
+	{
+	public:
+		static constexpr int32 MaxCellsPerAxis = 2048;
+
+		explicit FPolygonInclusionGrid(const TArray<FVector2D>& InPolygon, const double InCellsPerEdge = 2);
+
+		bool IsValid() const { return NumX > 0 && NumY > 0; }
+
+		/** Same result as FGeomTools2D::IsPointInPolygon against the polygon the grid was built from */
+		bool IsInside(const FVector2D& Point) const;
+
+		int32 GetNumCells() const { return NumX * NumY; }
+		SIZE_T GetAllocatedSize() const;
+
+	private:
+		FORCEINLINE int32 GetCellX(const double X) const { return FMath::Clamp(FMath::FloorToInt32((X - Origin.X) * InvCellSize.X), 0, NumX - 1); }
+		FORCEINLINE int32 GetCellY(const double Y) const { return FMath::Clamp(FMath::FloorToInt32((Y - Origin.Y) * InvCellSize.Y), 0, NumY - 1); }
+		FORCEINLINE FVector2D GetCellCenter(const int32 X, const int32 Y) const { return Origin + FVector2D(X + 0.5, Y + 0.5) * CellSize; }
+
+		void BuildCellEdges();
+		void BuildCellWindings();
+
+		TArray<FVector2D> Vertices;
+
+		FVector2D Origin = FVector2D::ZeroVector;
+		FVector2D CellSize = FVector2D::UnitVector;
+		FVector2D InvCellSize = FVector2D::UnitVector;
+		int32 NumX = 0;
+		int32 NumY = 0;
+
+		// Edges overlapping each cell, flattened; edge i goes from vertex i to vertex i + 1
+		TArray<int32> CellStarts;
+		TArray<int32> CellEdges;
+
+		// Winding number at each cell center, AmbiguousWinding when the center sits on an edge
+		static constexpr int32 AmbiguousWinding = MIN_int32;
+		TArray<int32> CellWindings;
+	};
+}
@@ -17,7 +17,7 @@ namespace PCGExMath::Geo
 	{
 	public:
 		TSharedPtr<TDelaunay2> Delaunay;
-		TSet<uint64> VoronoiEdges;
+		TArray<uint64> VoronoiEdges; // Unique site-to-site adjacencies
 		TArray<FVector> Circumcenters;
 		TArray<FVector> Centroids;
 
@@ -39,6 +39,9 @@ namespace PCGExMath::Geo
 	protected:
 		void Clear();
 
+		// Triangulates, computes per-site circumcenters & centroids and gathers VoronoiEdges
+		bool ProcessSites(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
+
 		// Build extended output with projection support (projects to 2D, computes circumcenters, unprojects back)
 		void BuildMetricOutput(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, EPCGExCellCenter CellCenterMethod, const FBox* Bounds = nullptr, TBitArray<>* WithinBounds = nullptr);
 
@@ -55,8 +58,7 @@ namespace PCGExMath::Geo
 	{
 	public:
 		TSharedPtr<TDelaunay3> Delaunay;
-		TSet<uint64> VoronoiEdges;
-		TSet<int32> VoronoiHull;
+		TArray<uint64> VoronoiEdges; // Unique site-to-site adjacencies
 		TArray<FSphere> Circumspheres;
 		TArray<FVector> Centroids;
 
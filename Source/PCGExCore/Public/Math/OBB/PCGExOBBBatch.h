@@ -0,0 +1,73 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExOBB.h"
+
+namespace PCGExMath::OBB
+{
+	/**
+	 * Structure-of-arrays copy of a set of OBBs, laid out for batched tests.
+	 * Kernels test one query against a list of entries in fixed blocks of Lanes entries, reading each channel contiguously.
+	 * This is plain scalar code; the fixed-size lane loops leave vectorization to the compiler, which is not guaranteed.
+	 * Each lane runs the exact same arithmetic as the scalar tests (SATOverlap, PointInside...), so batched and scalar
+	 * results are identical; see the OBB.Batch check case.
+	 */
+	class PCGEXCORE_API FBatchStore
+	{
+	public:
+		static constexpr int32 Lanes = 4;
+
+		enum EChannel : uint8
+		{
+			OriginX = 0,
+			OriginY,
+			OriginZ,
+			ExtentX,
+			ExtentY,
+			ExtentZ,
+			Radius,
+			AxisXX,
+			AxisXY,
+			AxisXZ,
+			AxisYX,
+			AxisYY,
+			AxisYZ,
+			AxisZX,
+			AxisZY,
+			AxisZZ,
+			QuatX,
+			QuatY,
+			QuatZ,
+			QuatW,
+			NumChannels
+		};
+
+		void Reserve(const int32 Count);
+		void SetNumUninitialized(const int32 Count);
+		void Add(const FOBB& Box);
+		void Reset();
+
+		/** Overwrites an existing entry; distinct indices can be set concurrently */
+		void Set(const int32 Index, const FOBB& Box);
+
+		FORCEINLINE int32 Num() const { return Channels[OriginX].Num(); }
+
+		/** OutResults[i] = TestOverlap(Entry(Indices[i]), Query, Box or ExpandedBox) */
+		void TestOverlaps(const FOBB& Query, TConstArrayView<int32> Indices, uint8* OutResults, const bool bExpanded = false, const float Expansion = 0.0f) const;
+
+		/** OutResults[i] = TestPoint(Entry(Indices[i]), Point, Box or ExpandedBox) */
+		void TestPoints(const FVector& Point, TConstArrayView<int32> Indices, uint8* OutResults, const bool bExpanded = false, const float Expansion = 0.0f) const;
+
+		/**
+		 * Conservative segment test; OutResults[i] is 0 only when the segment certainly misses Entry(Indices[i]).
+		 * Meant to cull candidates before the exact SegmentIntersects/ProcessSegment.
+		 */
+		void MaySegmentIntersect(const FVector& Start, const FVector& End, TConstArrayView<int32> Indices, uint8* OutResults) const;
+
+	private:
+		TArray<double> Channels[NumChannels];
+	};
+}
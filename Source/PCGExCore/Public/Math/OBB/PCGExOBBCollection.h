@@ -8,6 +8,7 @@
 #include "PCGExOBB.h"
 #include "PCGExOBBTests.h"
 #include "PCGExOBBIntersections.h"
+#include "PCGExOBBBatch.h"
 #include "PCGExOctree.h"
 #include "Math/PCGExMathBounds.h"
 
@@ -34,6 +35,9 @@ namespace PCGExMath::OBB
 		// Cold data - only accessed after spatial culling
 		TArray<FOrientation> Orientations;
 
+		// Structure-of-arrays copy of the above, for batched tests over octree candidates
+		FBatchStore BatchStore;
+
 		TUniquePtr<PCGExOctree::FItemOctree> Octree;
 		FBox WorldBounds = FBox(ForceInit);
 
@@ -64,11 +68,21 @@ namespace PCGExMath::OBB
 		FORCEINLINE FOBB GetOBB(const int32 Index) const { return FOBB(Bounds[Index], Orientations[Index]); }
 
 		FORCEINLINE const FBox& GetWorldBounds() const { return WorldBounds; }
-		FORCEINLINE PCGExOctree::FItemOctree* GetOctree() const { return Octree.Get(); }
+		FORCEINLINE const PCGExOctree::FItemOctree* GetOctree() const { return Octree.Get(); }
 
 		// Raw array access for advanced use
 		FORCEINLINE const TArray<FBounds>& GetBoundsArray() const { return Bounds; }
 		FORCEINLINE const TArray<FOrientation>& GetOrientationsArray() const { return Orientations; }
+		FORCEINLINE const FBatchStore& GetBatchStore() const { return BatchStore; }
+
+		/** Gathers the indices of every entry the octree returns for the query bounds, in octree order */
+		template <typename AllocatorType>
+		void GatherCandidates(const FBoxCenterAndExtent& QueryBounds, TArray<int32, AllocatorType>& OutCandidates) const
+		{
+			OutCandidates.Reset();
+			if (!Octree) { return; }
+			Octree->FindElementsWithBoundsTest(QueryBounds, [&](const PCGExOctree::FItem& Item) { OutCandidates.Add(Item.Index); });
+		}
 
 		// Point queries
 
@@ -181,6 +195,14 @@ namespace PCGExMath::OBB
 		/** Filter to points inside any OBB */
 		void FilterInside(TArrayView<const FVector> Points, TArray<int32>& OutIndices, EPCGExBoxCheckMode Mode = EPCGExBoxCheckMode::Box, float Expansion = 0.0f) const;
 
+	protected:
+		// Sphere modes are cheaper than gathering candidates, everything else goes through the batch store
+		static FORCEINLINE bool IsBatched(const EPCGExBoxCheckMode Mode) { return Mode != EPCGExBoxCheckMode::Sphere && Mode != EPCGExBoxCheckMode::ExpandedSphere; }
+
+		bool IsPointInsideBatched(const FVector& Point, bool bExpanded, float Expansion) const;
+
+	public:
+
 		// Bounds queries
 
 		bool LooseOverlaps(const FBox& Box) const
@@ -0,0 +1,86 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/**
+	 * HyperLogLog distinct-count estimator.
+	 * Fixed memory (2^Precision bytes), mergeable, so each scope can own one and fold them together afterward.
+	 * Expects well-mixed 64bit hashes; use MixHash on weak hashes such as GetTypeHash.
+	 */
+	class PCGEXCORE_API FHyperLogLog
+	{
+	protected:
+		TArray<uint8> Registers;
+		int32 Precision = 12;
+
+	public:
+		FHyperLogLog();
+		explicit FHyperLogLog(const int32 InPrecision);
+
+		static FORCEINLINE uint64 MixHash(uint64 Hash)
+		{
+			// SplitMix64 finalizer
+			Hash += 0x9E3779B97F4A7C15ull;
+			Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+			Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBull;
+			return Hash ^ (Hash >> 31);
+		}
+
+		FORCEINLINE void Add(const uint64 Hash)
+		{
+			const uint32 Index = static_cast<uint32>(Hash >> (64 - Precision));
+			const uint64 Remainder = (Hash << Precision) | (1ull << (Precision - 1));
+			const uint8 Rank = static_cast<uint8>(FMath::CountLeadingZeros64(Remainder) + 1);
+			if (Registers[Index] < Rank) { Registers[Index] = Rank; }
+		}
+
+		void Merge(const FHyperLogLog& Other);
+		double Estimate() const;
+		void Reset();
+
+		FORCEINLINE int32 GetPrecision() const { return Precision; }
+	};
+
+	/**
+	 * KLL-style streaming quantile sketch over doubles.
+	 * Memory is O(K log(N/K)); rank error is roughly 1.65/K.
+	 * Compaction alternates its offset deterministically so identical insertion & merge order yields identical results.
+	 */
+	class PCGEXCORE_API FQuantileSketch
+	{
+	protected:
+		TArray<TArray<double>> Levels;
+		int32 K = 200;
+		int64 N = 0;
+		int32 NumRetained = 0;
+		uint32 CompactionCounter = 0;
+		double MinValue = MAX_dbl;
+		double MaxValue = MIN_dbl_neg;
+
+		int32 GetLevelCapacity(const int32 Level) const;
+		int32 GetTotalCapacity() const;
+		void Compress();
+
+	public:
+		FQuantileSketch() = default;
+		explicit FQuantileSketch(const int32 InK);
+
+		void Add(const double Value);
+		void Merge(const FQuantileSketch& Other);
+
+		/** Approximate value at normalized rank Q (0..1) */
+		double GetQuantile(const double Q) const;
+
+		FORCEINLINE int64 Num() const { return N; }
+		FORCEINLINE bool IsEmpty() const { return N == 0; }
+		FORCEINLINE double Min() const { return MinValue; }
+		FORCEINLINE double Max() const { return MaxValue; }
+
+		void Reset();
+	};
+}
@@ -0,0 +1,92 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPCGBasePointData;
+
+namespace PCGExMath
+{
+	/**
+	 * Uniform hash grid over a set of positions, with cells at least as large as the tolerance, so every pair of positions
+	 * within tolerance of each other sits in the same or in adjacent cells.
+	 * Positions are sorted by cell into a structure-of-arrays copy; neighbor tests run Lanes candidates at a time against a
+	 * whole adjacent cell, and every query runs in parallel over cells.
+	 * Tolerance is either a sphere radius (Tolerance.X) or per-axis, and can be inclusive (<=) or strict (<).
+	 */
+	class PCGEXCORE_API FToleranceGrid
+	{
+	public:
+		static constexpr int32 Lanes = 4;
+		static constexpr int32 CellBits = 21;
+
+		explicit FToleranceGrid(const FVector& InTolerance, const bool bInComponentWise = false, const bool bInInclusive = true);
+
+		void Build(TConstArrayView<FVector> InPositions);
+
+		/** Builds from point centers */
+		void Build(const UPCGBasePointData* InData);
+
+		FORCEINLINE int32 Num() const { return NumPoints; }
+		FORCEINLINE int32 GetNumCells() const { return CellKeys.Num(); }
+
+		/**
+		 * OutCounts[i] is the number of other positions within tolerance of i.
+		 * OutLowerCounts[i], if not empty, only counts those with a lower index than i.
+		 */
+		void CountNeighbors(TArrayView<int32> OutCounts, TArrayView<int32> OutLowerCounts = TArrayView<int32>()) const;
+
+		/**
+		 * Greedy fuse in index order: each position joins the closest earlier leader within tolerance (lowest leader index
+		 * on ties), or becomes a leader itself. OutLeaders[i] is the index of the leader of i, i for leaders.
+		 * Leaders are resolved in parallel rounds, where a position is decided as soon as all its lower neighbors are;
+		 * long chains that stop making progress are finished sequentially. The result does not depend on scheduling.
+		 * Octree insertion (FUnionGraph::InsertPoint) keeps whichever equidistant leader it visits first instead, so the two
+		 * only differ for positions exactly as far from two leaders, e.g. on regular lattices. See the Spatial.ToleranceGrid check.
+		 */
+		void Fuse(TArray<int32>& OutLeaders) const;
+
+		SIZE_T GetAllocatedSize() const;
+
+	private:
+		enum EState : uint8
+		{
+			Undecided = 0,
+			Leader,
+			Follower
+		};
+
+		void GetNeighborCells(const int32 CellIndex, TArray<int32, TInlineAllocator<27>>& OutCells) const;
+
+		template <bool bInComponentWise, bool bInInclusive, typename FuncType>
+		void ForEachWithin(const int32 Slot, const int32 CellIndex, FuncType&& Func) const;
+
+		template <bool bInComponentWise, bool bInInclusive>
+		void CountNeighborsImpl(TArrayView<int32> OutCounts, TArrayView<int32> OutLowerCounts) const;
+
+		template <bool bInComponentWise, bool bInInclusive>
+		void FuseImpl(TArray<int32>& OutLeaders) const;
+
+		FVector Tolerance = FVector::OneVector;
+		FVector ToleranceSquared = FVector::OneVector;
+		bool bComponentWise = false;
+		bool bInclusive = true;
+
+		int32 NumPoints = 0;
+		FVector Origin = FVector::ZeroVector;
+		FVector InvCellSize = FVector::OneVector;
+
+		// Sorted by cell, then by index; padded with Lanes trailing entries so blocks never read out of bounds
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+		TArray<int32> Indices;
+
+		// Packed cell coordinates, and the range of sorted slots in each cell (CellStarts has one trailing entry)
+		TArray<uint64> CellKeys;
+		TArray<int32> CellStarts;
+		TMap<uint64, int32> CellMap;
+	};
+}
@@ -0,0 +1,240 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/GenericOctree.h"
+
+namespace PCGExBVH
+{
+	/**
+	 * Float AABBs laid out as one array per component, so node & item tests stream through contiguous memory.
+	 * Boxes are rounded outward when stored, a float box always contains the double box it was built from.
+	 */
+	struct PCGEXCORE_API FBoundsSoA
+	{
+		TArray<float> MinX;
+		TArray<float> MinY;
+		TArray<float> MinZ;
+		TArray<float> MaxX;
+		TArray<float> MaxY;
+		TArray<float> MaxZ;
+
+		void SetNumUninitialized(const int32 InNum);
+		void Set(const int32 Index, const FBox& InBox);
+
+		/** Writes at Index the union of Source[Start..End[ */
+		void SetUnion(const int32 Index, const FBoundsSoA& Source, const int32 Start, const int32 End);
+
+		FORCEINLINE int32 Num() const { return MinX.Num(); }
+		FBox Get(const int32 Index) const;
+		SIZE_T GetAllocatedSize() const;
+
+		void Empty();
+	};
+
+	/** Query box converted once to float, rounded outward */
+	struct PCGEXCORE_API FQueryBox
+	{
+		float Min[3];
+		float Max[3];
+
+		explicit FQueryBox(const FBox& InBox);
+		explicit FQueryBox(const FBoxCenterAndExtent& InBounds);
+	};
+
+	FORCEINLINE bool Intersects(const FBoundsSoA& Bounds, const int32 Index, const FQueryBox& Query)
+	{
+		return Bounds.MinX[Index] <= Query.Max[0] && Bounds.MaxX[Index] >= Query.Min[0] &&
+			Bounds.MinY[Index] <= Query.Max[1] && Bounds.MaxY[Index] >= Query.Min[1] &&
+			Bounds.MinZ[Index] <= Query.Max[2] && Bounds.MaxZ[Index] >= Query.Min[2];
+	}
+
+	FORCEINLINE double DistSquared(const FBoundsSoA& Bounds, const int32 Index, const FVector& Position)
+	{
+		const double DX = FMath::Max3(static_cast<double>(Bounds.MinX[Index]) - Position.X, 0.0, Position.X - static_cast<double>(Bounds.MaxX[Index]));
+		const double DY = FMath::Max3(static_cast<double>(Bounds.MinY[Index]) - Position.Y, 0.0, Position.Y - static_cast<double>(Bounds.MaxY[Index]));
+		const double DZ = FMath::Max3(static_cast<double>(Bounds.MinZ[Index]) - Position.Z, 0.0, Position.Z - static_cast<double>(Bounds.MaxZ[Index]));
+		return DX * DX + DY * DY + DZ * DZ;
+	}
+
+	/**
+	 * Item & node bounds refitted over the hierarchy of an existing FItemBVH, see FItemBVH::Refit.
+	 * Lets a shared BVH, e.g. one built over point centers, answer queries against bounds that depend on the caller such as
+	 * expanded point boxes: each node grows by what its own items need, rather than every query growing by the largest item.
+	 */
+	struct PCGEXCORE_API FRefitBounds
+	{
+		FBoundsSoA ItemBounds;
+		FBoundsSoA NodeBounds;
+
+		SIZE_T GetAllocatedSize() const { return ItemBounds.GetAllocatedSize() + NodeBounds.GetAllocatedSize(); }
+	};
+
+	/**
+	 * Static linear BVH over indexed boxes.
+	 * Items are sorted along a 63bit Morton curve, grouped in leaves of LeafSize, and each upper level
+	 * groups BranchingFactor consecutive nodes of the level below. Since the hierarchy is implicit, the whole
+	 * structure is a handful of flat arrays; it cannot be edited once built, rebuild it instead.
+	 *
+	 * Query methods mirror TOctree2 naming so use-sites can switch between the two;
+	 * callbacks receive the item index that was given to Build instead of an item struct.
+	 * Queries are const & thread-safe.
+	 */
+	class PCGEXCORE_API FItemBVH
+	{
+	public:
+		static constexpr int32 LeafSize = 8;
+		static constexpr int32 BranchingFactor = 4;
+
+		/** Called in parallel with each index in [0, NumItems[; return false to leave that index out of the BVH */
+		using FGetItemBounds = TFunctionRef<bool(const int32 Index, FBox& OutBounds)>;
+
+		/** Called in parallel with each index that made it into the BVH; must return a valid box */
+		using FGetRefitBounds = TFunctionRef<FBox(const int32 Index)>;
+
+		FItemBVH() = default;
+
+		void Build(const int32 NumItems, FGetItemBounds GetItemBounds);
+		void Reset();
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+
+		FBox GetBounds() const;
+		SIZE_T GetAllocatedSize() const;
+
+		/** Computes new bounds for every item and node while keeping the hierarchy as built. The BVH itself is left untouched. */
+		void Refit(FGetRefitBounds GetItemBounds, FRefitBounds& OutRefit) const;
+
+		/** Calls Func(int32 Index) for every item whose bounds overlap the query */
+		template <typename FFunc>
+		void FindElementsWithBoundsTest(const FBoxCenterAndExtent& InBounds, const FFunc& Func) const
+		{
+			const FQueryBox Query(InBounds);
+			Traverse(
+				[&](const int32 Node) { return Intersects(NodeBounds, Node, Query); },
+				[&](const int32 Slot)
+				{
+					if (Intersects(ItemBounds, Slot, Query)) { Func(Items[Slot]); }
+					return true;
+				});
+		}
+
+		/**
+		 * Calls Func(int32 Index) -> bool for every item whose bounds overlap the query, until Func returns false.
+		 * @return false if iteration was stopped early
+		 */
+		template <typename FFunc>
+		bool FindFirstElementWithBoundsTest(const FBoxCenterAndExtent& InBounds, const FFunc& Func) const
+		{
+			const FQueryBox Query(InBounds);
+			return Traverse(
+				[&](const int32 Node) { return Intersects(NodeBounds, Node, Query); },
+				[&](const int32 Slot) { return !Intersects(ItemBounds, Slot, Query) || Func(Items[Slot]); });
+		}
+
+		/** Calls Func(int32 Index) for every item whose refitted bounds overlap the query */
+		template <typename FFunc>
+		void FindElementsWithBoundsTest(const FRefitBounds& InRefit, const FBoxCenterAndExtent& InBounds, const FFunc& Func) const
+		{
+			const FQueryBox Query(InBounds);
+			Traverse(
+				[&](const int32 Node) { return Intersects(InRefit.NodeBounds, Node, Query); },
+				[&](const int32 Slot)
+				{
+					if (Intersects(InRefit.ItemBounds, Slot, Query)) { Func(Items[Slot]); }
+					return true;
+				});
+		}
+
+		/** FindFirstElementWithBoundsTest against refitted bounds */
+		template <typename FFunc>
+		bool FindFirstElementWithBoundsTest(const FRefitBounds& InRefit, const FBoxCenterAndExtent& InBounds, const FFunc& Func) const
+		{
+			const FQueryBox Query(InBounds);
+			return Traverse(
+				[&](const int32 Node) { return Intersects(InRefit.NodeBounds, Node, Query); },
+				[&](const int32 Slot) { return !Intersects(InRefit.ItemBounds, Slot, Query) || Func(Items[Slot]); });
+		}
+
+		/** Calls Func(int32 Index) for every item whose bounds are within Radius of Center */
+		template <typename FFunc>
+		void FindElementsWithinRadius(const FVector& Center, const double Radius, const FFunc& Func) const
+		{
+			const double RadiusSquared = Radius * Radius;
+			const FQueryBox Query(FBox(Center - FVector(Radius), Center + FVector(Radius)));
+			Traverse(
+				[&](const int32 Node) { return Intersects(NodeBounds, Node, Query) && DistSquared(NodeBounds, Node, Center) <= RadiusSquared; },
+				[&](const int32 Slot)
+				{
+					if (DistSquared(ItemBounds, Slot, Center) <= RadiusSquared) { Func(Items[Slot]); }
+					return true;
+				});
+		}
+
+		/**
+		 * Gathers the K items closest to Position, nearest first. Distance is measured to item bounds.
+		 * Items further than MaxDistance are ignored.
+		 */
+		void FindNearest(const FVector& Position, const int32 K, TArray<int32>& OutIndices, const double MaxDistance = MAX_dbl) const;
+
+		/** @return the index of the item closest to Position, or -1 if there is none within MaxDistance */
+		int32 FindNearest(const FVector& Position, double& OutDistSquared, const double MaxDistance = MAX_dbl) const;
+
+	protected:
+		using FFound = TPair<double, int32>; // Squared distance, sorted slot
+
+		TArray<int32> Items;      // Item indices, in Morton order
+		FBoundsSoA ItemBounds;    // Per sorted item
+		FBoundsSoA NodeBounds;    // Every level, leaves first
+		TArray<int32> LevelStart; // Offset of each level inside NodeBounds; last entry is the total node count
+
+		/** Best-first search; Found ends up sorted nearest first, ties broken by item index */
+		void GatherNearest(const FVector& Position, const int32 K, const double MaxDistance, TArray<FFound, TInlineAllocator<16>>& Found) const;
+
+		/** Unions item bounds into every level of node bounds, following LevelStart */
+		void BuildNodeBounds(const FBoundsSoA& InItemBounds, FBoundsSoA& OutNodeBounds) const;
+
+		FORCEINLINE int32 NumLevels() const { return LevelStart.Num() - 1; }
+		FORCEINLINE int32 NumNodes(const int32 Level) const { return LevelStart[Level + 1] - LevelStart[Level]; }
+
+		/**
+		 * Depth-first walk in Morton order.
+		 * NodeTest(int32 GlobalNode) -> bool prunes subtrees, ItemFunc(int32 Slot) -> bool stops the walk when it returns false.
+		 */
+		template <typename FNodeTest, typename FItemFunc>
+		bool Traverse(const FNodeTest& NodeTest, const FItemFunc& ItemFunc) const
+		{
+			if (Items.IsEmpty()) { return true; }
+
+			TArray<uint64, TInlineAllocator<64>> Stack;
+			Stack.Add(static_cast<uint64>(NumLevels() - 1) << 32);
+
+			while (!Stack.IsEmpty())
+			{
+				const uint64 Packed = Stack.Pop(EAllowShrinking::No);
+				const int32 Level = static_cast<int32>(Packed >> 32);
+				const int32 Node = static_cast<int32>(Packed & 0xFFFFFFFF);
+
+				if (!NodeTest(LevelStart[Level] + Node)) { continue; }
+
+				if (Level == 0)
+				{
+					const int32 End = FMath::Min((Node + 1) * LeafSize, Items.Num());
+					for (int32 Slot = Node * LeafSize; Slot < End; Slot++) { if (!ItemFunc(Slot)) { return false; } }
+					continue;
+				}
+
+				// Push children back to front so they're visited in Morton order
+				const uint64 ChildLevel = static_cast<uint64>(Level - 1) << 32;
+				const int32 FirstChild = Node * BranchingFactor;
+				const int32 LastChild = FMath::Min(FirstChild + BranchingFactor, NumNodes(Level - 1)) - 1;
+				for (int32 Child = LastChild; Child >= FirstChild; Child--) { Stack.Add(ChildLevel | static_cast<uint32>(Child)); }
+			}
+
+			return true;
+		}
+	};
+}
@@ -13,6 +13,10 @@ class FPCGExCoreModule final : public IPCGExLegacyModuleInterface
 	PCGEX_MODULE_BODY
 
 public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
 #if WITH_EDITOR
 	virtual void RegisterToEditor(const TSharedPtr<FSlateStyleSet>& InStyle) override;
 #endif
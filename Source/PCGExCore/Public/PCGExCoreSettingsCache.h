@@ -40,6 +40,7 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bCacheClusters = true;
 	bool bDefaultScopedIndexLookupBuild = true;
 	bool bDefaultBuildAndCacheClusters = true;
+	int32 ClusterOutputCacheBudgetMB = 256;
 	EPCGExExecutionPolicy ExecutionPolicy = EPCGExExecutionPolicy::Default;
 
 	int32 SmallPointsSize = 1024;
@@ -50,9 +51,18 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return FMath::Max(In <= -1 ? PointsDefaultBatchChunkSize : In, 1); }
 
+	bool bShareReadBuffers = true;
+
 	int32 ClusterDefaultBatchChunkSize = 512;
 	int32 GetClusterBatchChunkSize(const int32 In = -1) const { return FMath::Max(In <= -1 ? ClusterDefaultBatchChunkSize : In, 1); }
 
+	bool bShareSpatialIndexes = true;
+	int32 SpatialIndexCacheBudgetMB = 512;
+
+	bool bPoolBuffers = true;
+	int32 BufferPoolBudgetMB = 512;
+	double BufferPoolMaxIdleSeconds = 30;
+
 #if WITH_EDITOR
 
 	TMap<FName, FLinearColor> ColorsMap;
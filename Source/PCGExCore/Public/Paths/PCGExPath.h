@@ -9,6 +9,7 @@
 #include "PCGExCoreMacros.h"
 #include "Math/PCGExMath.h"
 #include "Math/PCGExProjectionDetails.h"
+#include "Math/Geo/PCGExPolygonGrid.h"
 #include "Utils/PCGValueRange.h"
 
 class UPCGBasePointData;
@@ -115,6 +116,7 @@ namespace PCGExPaths
 		TArray<FVector2D> ProjectedPoints;
 		FPCGExGeo2DProjectionDetails Projection;
 		FBox2D ProjectedBounds = FBox2D();
+		TUniquePtr<PCGExMath::Geo::FPolygonInclusionGrid> InclusionGrid;
 
 	public:
 		explicit FPath(const bool IsClosed = false);
@@ -238,7 +240,18 @@ namespace PCGExPaths
 
 		const TArray<FVector2D>& GetProjectedPoints() const { return ProjectedPoints; }
 
+		/**
+		 * Builds a point-location grid over the projected polygon so inclusion tests don't walk every edge.
+		 * Skipped for polygons with fewer than MinPoints points, where the plain test is as fast. Projection changes discard the grid.
+		 */
+		bool BuildInclusionGrid(const int32 MinPoints = 32);
+		bool HasInclusionGrid() const { return InclusionGrid.IsValid(); }
+
 		virtual bool IsInsideProjection(const FVector& WorldPosition) const;
+
+		/** Tests every position of the scope against the projection, writing 1 (inside) or 0 in OutInside at the same indices. Returns the inside count. */
+		int32 ClassifyPoints(const TConstPCGValueRange<FTransform>& InPositions, const PCGExMT::FScope& Scope, TArray<int8>& OutInside) const;
+
 		virtual bool Contains(const TConstPCGValueRange<FTransform>& InPositions, const double Tolerance = 0) const;
 
 	protected:
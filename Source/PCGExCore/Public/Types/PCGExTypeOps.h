@@ -155,9 +155,14 @@ namespace PCGExTypeOps
 	// Function pointer type for conversion: void Convert(const void* Src, void* Dst)
 	using FConvertFn = void(*)(const void* Src, void* Dst);
 
+	// Function pointer type for range conversion: void ConvertRange(const TFrom* Src, TTo* Dst, int32 Count)
+	// Both ranges are contiguous, Dst values must already be constructed
+	using FConvertRangeFn = void(*)(const void* Src, void* Dst, int32 Count);
+
 	/**
 	 * Conversion dispatch table.
-	 * 14x14 table of function pointers for all type pair conversions.
+	 * 14x14 table of function pointers for all type pair conversions,
+	 * plus a matching table of span-to-span kernels for bulk conversions.
 	 */
 	class PCGEXCORE_API FConversionTable
 	{
@@ -178,11 +183,28 @@ namespace PCGExTypeOps
 			return Table[static_cast<int32>(FromType)][static_cast<int32>(ToType)];
 		}
 
+		// Convert Count contiguous values between any two supported types, in a single typed loop
+		FORCEINLINE static void ConvertRange(
+			EPCGMetadataTypes FromType, const void* FromValues,
+			EPCGMetadataTypes ToType, void* ToValues, const int32 Count)
+		{
+			if (!bInitialized) { Initialize(); }
+			RangeTable[static_cast<int32>(FromType)][static_cast<int32>(ToType)](FromValues, ToValues, Count);
+		}
+
+		// Get the range conversion function pointer for a specific pair
+		FORCEINLINE static FConvertRangeFn GetRangeConversionFn(EPCGMetadataTypes FromType, EPCGMetadataTypes ToType)
+		{
+			if (!bInitialized) { Initialize(); }
+			return RangeTable[static_cast<int32>(FromType)][static_cast<int32>(ToType)];
+		}
+
 		// Initialize the table (called automatically)
 		static void Initialize();
 
 	private:
 		static FConvertFn Table[PCGExTypes::TypesAllocations][PCGExTypes::TypesAllocations];
+		static FConvertRangeFn RangeTable[PCGExTypes::TypesAllocations][PCGExTypes::TypesAllocations];
 		static bool bInitialized;
 	};
 
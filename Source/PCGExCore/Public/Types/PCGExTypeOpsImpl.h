@@ -233,6 +233,48 @@ namespace PCGExTypeOps
 			else { return &ConvertImpl<TFrom, TTo>; }
 		}
 
+		/**
+		 * Generate a range conversion function from TFrom to TTo
+		 * The per-value conversion is inlined, so numeric pairs compile down to a plain vectorizable loop
+		 */
+		template <typename TFrom, typename TTo>
+		void ConvertRangeImpl(const void* From, void* To, const int32 Count)
+		{
+			const TFrom* RESTRICT Src = static_cast<const TFrom*>(From);
+			TTo* RESTRICT Dst = static_cast<TTo*>(To);
+			for (int32 i = 0; i < Count; i++) { Dst[i] = FTypeOps<TFrom>::template ConvertTo<TTo>(Src[i]); }
+		}
+
+		/**
+		 * Identity range conversion (same type)
+		 */
+		template <typename T>
+		void ConvertRangeIdentity(const void* From, void* To, const int32 Count)
+		{
+			if (From == To || Count <= 0) { return; }
+
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				FMemory::Memcpy(To, From, static_cast<SIZE_T>(Count) * sizeof(T));
+			}
+			else
+			{
+				const T* Src = static_cast<const T*>(From);
+				T* Dst = static_cast<T*>(To);
+				for (int32 i = 0; i < Count; i++) { Dst[i] = Src[i]; }
+			}
+		}
+
+		/**
+		 * Get range conversion function for a type pair
+		 */
+		template <typename TFrom, typename TTo>
+		constexpr FConvertRangeFn GetConvertRangeFunction()
+		{
+			if constexpr (std::is_same_v<TFrom, TTo>) { return &ConvertRangeIdentity<TFrom>; }
+			else { return &ConvertRangeImpl<TFrom, TTo>; }
+		}
+
 		/**
 		 * Row of conversion functions from one source type to all target types
 		 */
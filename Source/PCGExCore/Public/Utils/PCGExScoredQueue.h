@@ -6,6 +6,7 @@
 #include <queue>
 #include <vector>
 #include "CoreMinimal.h"
+#include "Containers/PCGExBufferPool.h"
 
 // Copyright 2026 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
@@ -71,9 +72,18 @@ namespace PCGEx
 
 		explicit FScoredQueue(const int32 InSize)
 		{
-			Heap.Reserve(InSize);
-			HeapIndex.Init(-1, InSize);
-			Scores.Init(MAX_dbl, InSize);
+			PCGEx::FBufferPool& Pool = PCGEx::FBufferPool::Get();
+			Pool.Acquire(Heap, InSize);
+			Pool.Init(HeapIndex, -1, InSize);
+			Pool.Init(Scores, MAX_dbl, InSize);
+		}
+
+		~FScoredQueue()
+		{
+			PCGEx::FBufferPool& Pool = PCGEx::FBufferPool::Get();
+			Pool.Release(Heap);
+			Pool.Release(HeapIndex);
+			Pool.Release(Scores);
 		}
 
 		FORCEINLINE bool IsEmpty() const { return Size == 0; }
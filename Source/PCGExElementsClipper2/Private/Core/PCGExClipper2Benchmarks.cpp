@@ -0,0 +1,60 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Clipper2Lib/clipper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExClipper2
+{
+	// Overlapping 16-gons totalling ~N vertices, in the integer space paths are converted to
+	static PCGExClipper2Lib::Paths64 MakeBenchmarkPaths(const int32 Scale)
+	{
+		constexpr int32 NumSides = 16;
+		const int32 NumPaths = FMath::Max(2, Scale / NumSides);
+
+		FRandomStream Random(1337);
+		PCGExClipper2Lib::Paths64 Paths;
+		Paths.reserve(NumPaths);
+
+		const double Extent = 1000 * FMath::Sqrt(static_cast<double>(NumPaths));
+		for (int32 i = 0; i < NumPaths; i++)
+		{
+			const FVector2D Center(Random.FRandRange(0, Extent), Random.FRandRange(0, Extent));
+			const double Radius = Random.FRandRange(200, 1200);
+
+			PCGExClipper2Lib::Path64& Path = Paths.emplace_back();
+			Path.reserve(NumSides);
+			for (int32 j = 0; j < NumSides; j++)
+			{
+				const double Angle = UE_TWO_PI * j / NumSides;
+				Path.emplace_back(static_cast<int64>((Center.X + FMath::Cos(Angle) * Radius) * 100), static_cast<int64>((Center.Y + FMath::Sin(Angle) * Radius) * 100));
+			}
+		}
+
+		return Paths;
+	}
+
+	static PCGExBenchmark::FRegistrar BenchUnion(
+		TEXT("Clipper2.Union"), TEXT("Union of overlapping 16-gons totalling N vertices"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			return [Paths = MakeBenchmarkPaths(Scale)]()
+			{
+				PCGExClipper2Lib::Union(Paths, PCGExClipper2Lib::FillRule::NonZero);
+			};
+		});
+
+	static PCGExBenchmark::FRegistrar BenchOffset(
+		TEXT("Clipper2.Offset"), TEXT("Round offset of 16-gons totalling N vertices"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			return [Paths = MakeBenchmarkPaths(Scale)]()
+			{
+				PCGExClipper2Lib::InflatePaths(Paths, 5000, PCGExClipper2Lib::JoinType::Round, PCGExClipper2Lib::EndType::Polygon);
+			};
+		});
+}
+
+#endif
@@ -47,6 +47,9 @@ bool FPCGExCopyClustersToPointsElement::Boot(FPCGExContext* InContext) const
 
 	PCGEX_CONTEXT_AND_SETTINGS(CopyClustersToPoints)
 
+	Context->CopyStats.Start();
+	Context->CopyInit = Settings->CopyMode == EPCGExCopyMode::Shared ? PCGExData::EIOInit::Inherit : PCGExData::EIOInit::Duplicate;
+
 	Context->TargetsDataFacade = PCGExData::TryGetSingleFacade(Context, PCGExCommon::Labels::SourceTargetsLabel, false, true);
 	if (!Context->TargetsDataFacade) { return false; }
 
@@ -96,11 +99,19 @@ bool FPCGExCopyClustersToPointsElement::AdvanceWork(FPCGExContext* InContext, co
 	Context->OutputPointsAndEdges();
 	Context->Done();
 
+	if (Settings->bLogCopyStats) { Context->CopyStats.Log(TEXT("Cluster : Copy to Points")); }
+
 	return Context->TryComplete();
 }
 
 namespace PCGExCopyClustersToPoints
 {
+	static void AddCopyStats(FPCGExCopyClustersToPointsContext* Context, const UPCGBasePointData* InPointData)
+	{
+		if (Context->CopyInit == PCGExData::EIOInit::Inherit) { Context->CopyStats.Add(InPointData, EPCGPointNativeProperties::Transform, false); }
+		else { Context->CopyStats.Add(InPointData, InPointData->GetAllocatedProperties(), true); }
+	}
+
 	FProcessor::~FProcessor()
 	{
 	}
@@ -161,14 +172,16 @@ namespace PCGExCopyClustersToPoints
 			}
 
 			// Create an edge copy per target point
-			TSharedPtr<PCGExData::FPointIO> EdgeDupe = Context->MainEdges->Emplace_GetRef(EdgeDataFacade->Source, PCGExData::EIOInit::Duplicate);
+			TSharedPtr<PCGExData::FPointIO> EdgeDupe = Context->MainEdges->Emplace_GetRef(EdgeDataFacade->Source, Context->CopyInit);
 			if (!EdgeDupe) { continue; }
 
 			Copies++;
 			EdgesDupes[i] = EdgeDupe;
 			PCGExClusters::Helpers::MarkClusterEdges(EdgeDupe, *(VtxTag->GetData() + i));
 
-			PCGEX_LAUNCH(PCGExFitting::Tasks::FTransformPointIO, i, Context->TargetsDataFacade->Source, EdgeDupe, &Context->TransformDetails)
+			if (Settings->bLogCopyStats) { AddCopyStats(Context, EdgeDataFacade->GetIn()); }
+
+			PCGEX_LAUNCH(PCGExFitting::Tasks::FTransformPointIO, i, Context->TargetsDataFacade->Source, EdgeDupe, &Context->TransformDetails, Context->CopyInit == PCGExData::EIOInit::Inherit)
 		}
 
 		if (Copies > 0) { FPlatformAtomics::InterlockedAdd(&NumCopies, Copies); }
@@ -256,7 +269,7 @@ namespace PCGExCopyClustersToPoints
 			}
 
 			// Create a vtx copy per target point
-			TSharedPtr<PCGExData::FPointIO> VtxDupe = Context->MainPoints->Emplace_GetRef(VtxDataFacade->Source, PCGExData::EIOInit::Duplicate);
+			TSharedPtr<PCGExData::FPointIO> VtxDupe = Context->MainPoints->Emplace_GetRef(VtxDataFacade->Source, Context->CopyInit);
 			if (!VtxDupe) { continue; }
 
 			NumCopies++;
@@ -267,7 +280,9 @@ namespace PCGExCopyClustersToPoints
 			VtxDupes[i] = VtxDupe;
 			VtxTag[i] = OutId;
 
-			PCGEX_LAUNCH(PCGExFitting::Tasks::FTransformPointIO, i, Context->TargetsDataFacade->Source, VtxDupe, &Context->TransformDetails)
+			if (Settings->bLogCopyStats) { AddCopyStats(Context, VtxDataFacade->GetIn()); }
+
+			PCGEX_LAUNCH(PCGExFitting::Tasks::FTransformPointIO, i, Context->TargetsDataFacade->Source, VtxDupe, &Context->TransformDetails, Context->CopyInit == PCGExData::EIOInit::Inherit)
 
 			Context->TargetsAttributesToClusterTags.Tag(Context->TargetsDataFacade->GetInPoint(i), VtxDupe);
 			Context->TargetsForwardHandler->Forward(i, VtxDupe->GetOut()->Metadata);
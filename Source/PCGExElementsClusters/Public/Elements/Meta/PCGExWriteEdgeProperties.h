@@ -47,6 +47,7 @@ public:
 #endif
 
 	virtual bool SupportsDataStealing() const override { return true; }
+	virtual bool SupportsIncrementalExecution() const override { return true; }
 	virtual bool SupportsEdgeSorting() const override { return DirectionSettings.RequiresSortingRules(); }
 	virtual PCGExData::EIOInit GetMainOutputInitMode() const override;
 	virtual PCGExData::EIOInit GetEdgeOutputInitMode() const override;
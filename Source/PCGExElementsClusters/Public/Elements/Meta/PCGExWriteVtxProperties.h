@@ -41,6 +41,7 @@ protected:
 
 public:
 	virtual bool SupportsDataStealing() const override { return true; }
+	virtual bool SupportsIncrementalExecution() const override { return true; }
 
 	virtual PCGExData::EIOInit GetMainOutputInitMode() const override;
 	virtual PCGExData::EIOInit GetEdgeOutputInitMode() const override;
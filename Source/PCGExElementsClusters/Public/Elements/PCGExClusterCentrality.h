@@ -68,6 +68,7 @@ protected:
 	//~End UPCGSettings
 
 	virtual bool SupportsDataStealing() const override { return true; }
+	virtual bool SupportsIncrementalExecution() const override { return true; }
 
 public:
 	virtual PCGExData::EIOInit GetMainOutputInitMode() const override;
@@ -10,6 +10,7 @@
 #include "Details/PCGExMatchingDetails.h"
 #include "Fitting/PCGExFitting.h"
 #include "Helpers/PCGExDataMatcher.h"
+#include "Helpers/PCGExPointArrayDataHelpers.h"
 
 
 #include "PCGExCopyClustersToPoints.generated.h"
@@ -51,6 +52,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTransformDetails TransformDetails;
 
+	/** How copies are created. Merging isn't supported for clusters, each copy remains its own cluster. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, InvalidEnumValues="Merged"))
+	EPCGExCopyMode CopyMode = EPCGExCopyMode::Duplicate;
+
+	/** If enabled, logs how many copies were made, what they allocated and how long it took. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bLogCopyStats = false;
+
 	/** Copy target point attributes as tags on output clusters. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tagging & Forwarding")
 	FPCGExAttributeToTagDetails TargetsAttributesToClusterTags;
@@ -74,6 +83,9 @@ struct FPCGExCopyClustersToPointsContext final : FPCGExClustersProcessorContext
 	FPCGExAttributeToTagDetails TargetsAttributesToClusterTags;
 	TSharedPtr<PCGExData::FDataForwardHandler> TargetsForwardHandler;
 
+	PCGExData::EIOInit CopyInit = PCGExData::EIOInit::Duplicate;
+	PCGExPointArrayDataHelpers::FCopyStats CopyStats;
+
 protected:
 	PCGEX_ELEMENT_BATCH_EDGE_DECL
 };
@@ -35,6 +35,7 @@ protected:
 	//~End UPCGSettings
 
 	virtual bool SupportsDataStealing() const override { return true; }
+	virtual bool SupportsIncrementalExecution() const override { return true; }
 
 	//~Begin UPCGExPointsProcessorSettings
 public:
@@ -102,7 +102,7 @@ namespace PCGExBuildConvexHull
 		ActivePositions.Empty();
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-		Edges = Delaunay->DelaunayEdges.Array();
+		Edges = MoveTemp(Delaunay->DelaunayEdges);
 
 		GraphBuilder = MakeShared<PCGExGraphs::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 		StartParallelLoopForRange(Edges.Num());
@@ -120,8 +120,8 @@ namespace PCGExBuildConvexHull
 			uint32 A;
 			uint32 B;
 			PCGEx::H64(Edge, A, B);
-			const bool bAIsOnHull = Delaunay->DelaunayHull.Contains(A);
-			const bool bBIsOnHull = Delaunay->DelaunayHull.Contains(B);
+			const bool bAIsOnHull = Delaunay->IsOnHull(A);
+			const bool bBIsOnHull = Delaunay->IsOnHull(B);
 
 			if (!bAIsOnHull || !bBIsOnHull)
 			{
@@ -234,11 +234,9 @@ namespace PCGExBuildDelaunayGraph
 
 		Delaunay = MakeShared<PCGExMath::Geo::TDelaunay3>();
 
-		bool bProcessed = false;
-		if (Settings->bMarkHull) { bProcessed = Delaunay->Process<false, true>(ActivePositions); }
-		else { bProcessed = Delaunay->Process<false, false>(ActivePositions); }
-
-		if (!bProcessed)
+		// Site hull flags come out of the same pass as the point hull
+		const bool bComputeHull = Settings->bMarkHull || (Settings->bOutputSites && Settings->bMarkSiteHull);
+		if (!Delaunay->Process(ActivePositions, false, bComputeHull))
 		{
 			if (!Context->bQuietInvalidInputWarning)
 			{
@@ -277,7 +275,7 @@ namespace PCGExBuildDelaunayGraph
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::BuildDelaunayGraph::ProcessPoints);
 
-		PCGEX_SCOPE_LOOP(Index) { HullMarkPointWriter->SetValue(Index, Delaunay->DelaunayHull.Contains(Index)); }
+		PCGEX_SCOPE_LOOP(Index) { HullMarkPointWriter->SetValue(Index, Delaunay->IsOnHull(Index)); }
 	}
 
 	void FProcessor::CompleteWork()
@@ -347,7 +347,7 @@ namespace PCGExBuildDelaunayGraph2D
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::BuildDelaunayGraph3D::ProcessPoints);
 		const TArray<int32>& OutputIndicesRef = *OutputIndices.Get();
-		PCGEX_SCOPE_LOOP(Index) { HullMarkPointWriter->SetValue(Index, Delaunay->DelaunayHull.Contains(Index)); }
+		PCGEX_SCOPE_LOOP(Index) { HullMarkPointWriter->SetValue(Index, Delaunay->IsOnHull(Index)); }
 	}
 
 	void FProcessor::CompleteWork()
@@ -264,7 +264,7 @@ namespace PCGExBuildVoronoiGraph2D
 		if (Settings->bOutputSites)
 		{
 			IsVtxValid.Init(true, DelaunaySitesNum);
-			for (int i = 0; i < IsVtxValid.Num(); i++) { IsVtxValid[i] = !Voronoi->Delaunay->DelaunayHull.Contains(i); }
+			for (int i = 0; i < IsVtxValid.Num(); i++) { IsVtxValid[i] = !Voronoi->Delaunay->IsOnHull(i); }
 
 			SiteDataFacade = MakeShared<PCGExData::FFacade>(Context->SitesOutput->Pairs[PointDataFacade->Source->IOIndex].ToSharedRef());
 			PCGEX_INIT_IO(SiteDataFacade->Source, PCGExData::EIOInit::Duplicate)
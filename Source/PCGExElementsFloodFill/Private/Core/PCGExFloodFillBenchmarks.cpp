@@ -0,0 +1,72 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Async/ParallelFor.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterBenchmark.h"
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExFloodFill.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Diffusion throughput on grid clusters, e.g. pcgex.Bench.Run Filter=FloodFill.* Scales=100000+1000000
+namespace PCGExFloodFill
+{
+	namespace Benchmark
+	{
+		constexpr int32 NumSeeds = 16;
+
+		// Same growth loop as the parallel processing mode, one capture per diffusion per round, without fill controls
+		static void Diffuse(const TSharedRef<PCGExClusters::FCluster>& Cluster, const TArray<int32>& SeedNodes)
+		{
+			const TArray<TObjectPtr<const UPCGExFillControlsFactoryData>> NoFactories;
+			const TSharedPtr<FFillControlsHandler> Handler = MakeShared<FFillControlsHandler>(nullptr, Cluster, nullptr, nullptr, nullptr, NoFactories);
+
+			Handler->InfluencesCount = MakeShared<TArray<int8>>();
+			// Every grid vtx is a node, so node count covers all point indices
+			Handler->InfluencesCount->Init(0, Cluster->Nodes->Num());
+
+			TArray<TSharedPtr<FDiffusion>> Ongoing;
+			Ongoing.Reserve(SeedNodes.Num());
+			for (const int32 NodeIndex : SeedNodes)
+			{
+				const PCGExClusters::FNode* SeedNode = Cluster->GetNode(NodeIndex);
+				if (*(Handler->InfluencesCount->GetData() + SeedNode->PointIndex)) { continue; }
+
+				TSharedPtr<FDiffusion> Diffusion = MakeShared<FDiffusion>(Handler, Cluster, SeedNode);
+				*(Handler->InfluencesCount->GetData() + SeedNode->PointIndex) = 1;
+				Diffusion->Index = Ongoing.Add(Diffusion);
+			}
+
+			if (!Handler->PrepareForDiffusions(Ongoing, FPCGExFloodFillFlowDetails())) { return; }
+			for (const TSharedPtr<FDiffusion>& Diffusion : Ongoing) { Diffusion->Init(Diffusion->Index); }
+
+			while (!Ongoing.IsEmpty())
+			{
+				ParallelFor(Ongoing.Num(), [&](const int32 i) { Ongoing[i]->Grow(); });
+
+				int32 WriteIndex = 0;
+				for (int32 i = 0; i < Ongoing.Num(); i++) { if (!Ongoing[i]->bStopped) { Ongoing[WriteIndex++] = Ongoing[i]; } }
+				Ongoing.SetNum(WriteIndex);
+			}
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchDiffuse(
+		TEXT("FloodFill.Diffuse"), TEXT("16 diffusions growing in parallel rounds until they fill a grid cluster of N vtx"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			if (Scale < Benchmark::NumSeeds) { return nullptr; }
+
+			TSharedPtr<PCGExClusters::Benchmark::FGridCluster> Grid = PCGExClusters::Benchmark::MakeGridCluster(Scale);
+			if (!Grid->Cluster) { return nullptr; }
+
+			FRandomStream Random(1337);
+			TArray<int32> SeedNodes;
+			for (int32 i = 0; i < Benchmark::NumSeeds; i++) { SeedNodes.Add(Random.RandHelper(Grid->Cluster->Nodes->Num())); }
+
+			return [Grid, SeedNodes = MoveTemp(SeedNodes)]() { Benchmark::Diffuse(Grid->Cluster.ToSharedRef(), SeedNodes); };
+		});
+}
+
+#endif
@@ -17,6 +17,8 @@ MACRO(MaxValue, _TYPE, _TYPE{})\
 MACRO(SetMinValue, _TYPE, _TYPE{})\
 MACRO(SetMaxValue, _TYPE, _TYPE{})\
 MACRO(AverageValue, _TYPE, _TYPE{})\
+MACRO(MedianValue, double, 0)\
+MACRO(PercentileValue, double, 0)\
 MACRO(UniqueValuesNum, int32, 0)\
 MACRO(UniqueSetValuesNum, int32, 0)\
 MACRO(DifferentValuesNum, int32, 0)\
@@ -202,28 +204,46 @@ namespace PCGExAttributeStats
 			});
 		}
 
+		for (const TSharedPtr<IAttributeStats>& S : Stats) { S->Init(PointDataFacade, Settings); }
 
-		PCGEX_ASYNC_GROUP_CHKD(TaskManager, FilterScope)
+		// Filters & stats are evaluated in a single pass; each scope owns its partial accumulators
+		PCGEX_ASYNC_GROUP_CHKD(TaskManager, StatsScope)
 
-		FilterScope->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+		StatsScope->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
 		{
 			PCGEX_ASYNC_THIS
-			This->PointDataFacade->Fetch(Scope);
-			This->FilterScope(Scope);
+			for (const TSharedPtr<IAttributeStats>& S : This->Stats) { S->PrepareScopes(Loops); }
 		};
 
-		FilterScope->StartSubLoops(PointDataFacade->GetNum(), PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
+		StatsScope->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->ProcessScope(Scope);
+		};
+
+		StatsScope->StartSubLoops(PointDataFacade->GetNum(), PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 
 		return true;
 	}
 
+	void FProcessor::ProcessScope(const PCGExMT::FScope& Scope)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExAttributeStats::ProcessScope);
+
+		PointDataFacade->Fetch(Scope);
+		FilterScope(Scope);
+
+		for (const TSharedPtr<IAttributeStats>& S : Stats) { S->ProcessScope(Scope, PointFilterCache); }
+	}
+
 	void FProcessor::CompleteWork()
 	{
+		// Merge partials & write outputs, one attribute per task
 		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, AttributeStatProcessing)
 		AttributeStatProcessing->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 		{
 			PCGEX_ASYNC_THIS
-			This->Stats[Scope.Start]->Process(This->PointDataFacade, This->Context, This->Settings, This->PointFilterCache);
+			This->Stats[Scope.Start]->Complete(This->PointDataFacade, This->Context, This->Settings);
 		};
 
 		AttributeStatProcessing->StartSubLoops(Stats.Num(), 1);
@@ -18,6 +18,9 @@
 #include "Types/PCGExAttributeIdentity.h"
 #include "Types/PCGExTypeOps.h"
 #include "Types/PCGExTypeTraits.h"
+#include "Types/PCGExTypes.h"
+#include "Math/PCGExMathMean.h"
+#include "Math/PCGExMathSketch.h"
 
 #include "PCGExAttributeStats.generated.h"
 
@@ -29,6 +32,13 @@ enum class EPCGExStatsOutputToPoints : uint8
 	Suffix = 2 UMETA(DisplayName = "Suffix", ToolTip="Uss specified name as a suffix to the attribute' name"),
 };
 
+UENUM()
+enum class EPCGExStatsMode : uint8
+{
+	Exact       = 0 UMETA(DisplayName = "Exact", ToolTip="Track every distinct value. Exact results, memory grows with the number of distinct values."),
+	Approximate = 1 UMETA(DisplayName = "Approximate", ToolTip="Use fixed-size sketches (HyperLogLog for distinct counts, KLL for median & percentile). Unique Values Num, Unique Set Values Num, Has only Unique Values and per-unique-value outputs cannot be estimated; enabling any of them keeps exact per-value occurrence counts, which are enabled by default."),
+};
+
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="metadata/analyze/attribute-stats"))
 class UPCGExAttributeStatsSettings : public UPCGExPointsProcessorSettings
 {
@@ -61,6 +71,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExNameFiltersDetails Filters = FPCGExNameFiltersDetails(true);
 
+	/** How distinct counts, median & percentile are computed. Approximate mode keeps memory bounded on very large datasets, but only pays off when Unique Values Num, Unique Set Values Num, Has only Unique Values and per-unique-value outputs are disabled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExStatsMode Mode = EPCGExStatsMode::Exact;
+
+	/** HyperLogLog precision; memory is 2^Precision bytes per scope & attribute. Standard error is ~1.04/sqrt(2^Precision). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, AdvancedDisplay, EditCondition="Mode == EPCGExStatsMode::Approximate", ClampMin=4, ClampMax=16))
+	int32 DistinctPrecision = 12;
+
+	/** Quantile sketch accuracy; higher is more precise. Rank error is ~1.65/Accuracy. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, AdvancedDisplay, EditCondition="Mode == EPCGExStatsMode::Approximate", ClampMin=8))
+	int32 QuantileAccuracy = 200;
+
 	/** Output a separate data collection for each unique value with occurrence counts. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	bool bOutputPerUniqueValuesStats = false;
@@ -129,7 +151,27 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Average", EditCondition="bOutputAverageValue"))
 	FName AverageValueAttributeName = FName(TEXT("Average"));
 
-	/** Write the count of values that appear exactly once. */
+	/** Write the median value. Numeric types only. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bOutputMedianValue = false;
+
+	/** Attribute name for the median value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Median", EditCondition="bOutputMedianValue"))
+	FName MedianValueAttributeName = FName(TEXT("Median"));
+
+	/** Write the value at the given percentile. Numeric types only. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bOutputPercentileValue = false;
+
+	/** Attribute name for the percentile value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Percentile", EditCondition="bOutputPercentileValue"))
+	FName PercentileValueAttributeName = FName(TEXT("Percentile"));
+
+	/** Normalized percentile to output (0.9 = 90th percentile). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = " └─ Percentile", EditCondition="bOutputPercentileValue", ClampMin=0, ClampMax=1))
+	double Percentile = 0.9;
+
+	/** Write the count of values that appear exactly once. Always exact: in Approximate mode, enabling it keeps exact per-value occurrence counts. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bOutputUniqueValuesNum = true;
 
@@ -137,7 +179,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Unique Values Num", EditCondition="bOutputUniqueValuesNum"))
 	FName UniqueValuesNumAttributeName = FName(TEXT("UniqueValues"));
 
-	/** Write the count of non-default values that appear exactly once. */
+	/** Write the count of non-default values that appear exactly once. Always exact: in Approximate mode, enabling it keeps exact per-value occurrence counts. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bOutputUniqueSetValuesNum = true;
 
@@ -185,7 +227,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Has only Set Values", EditCondition="bOutputHasOnlySetValues"))
 	FName HasOnlySetValuesAttributeName = FName(TEXT("HasOnlySetValues"));
 
-	/** Write whether every point has a unique value. */
+	/** Write whether every point has a unique value. Always exact: in Approximate mode, enabling it keeps exact per-value occurrence counts. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bOutputHasOnlyUniqueValues = true;
 
@@ -261,6 +303,34 @@ namespace PCGExAttributeStats
 	const FName OutputAttributeStats = FName("Stats");
 	const FName OutputAttributeUniqueValues = FName("UniqueValues");
 
+	/** Per-scope partial accumulator, merged once all scopes are processed */
+	template <typename T, bool bValidForTMap = PCGEx::IsValidForTMap<T>::value>
+	struct TStatsPartial
+	{
+		T MinValue = T{};
+		T MaxValue = T{};
+		T SetMinValue = T{};
+		T SetMaxValue = T{};
+		T SumValue = T{};
+		int32 NumValues = 0;
+		int32 DefaultValuesNum = 0;
+
+		// Exact mode, or whenever per-value occurrences are required
+		TMap<T, int32> ValuesCount;
+		TMap<T, int32> SetValuesCount;
+		TArray<double> Samples;
+
+		// Approximate mode
+		TSharedPtr<PCGExMath::FHyperLogLog> Distinct;
+		TSharedPtr<PCGExMath::FHyperLogLog> SetDistinct;
+		TSharedPtr<PCGExMath::FQuantileSketch> Quantiles;
+	};
+
+	template <typename T>
+	struct TStatsPartial<T, false>
+	{
+	};
+
 	class IAttributeStats : public TSharedFromThis<IAttributeStats>
 	{
 	public:
@@ -274,7 +344,19 @@ namespace PCGExAttributeStats
 
 		virtual ~IAttributeStats() = default;
 
-		virtual void Process(const TSharedRef<PCGExData::FFacade> InDataFacade, FPCGExAttributeStatsContext* Context, const UPCGExAttributeStatsSettings* Settings, const TArray<int8>& Filter)
+		virtual void Init(const TSharedRef<PCGExData::FFacade>& InDataFacade, const UPCGExAttributeStatsSettings* Settings)
+		{
+		}
+
+		virtual void PrepareScopes(const TArray<PCGExMT::FScope>& Loops)
+		{
+		}
+
+		virtual void ProcessScope(const PCGExMT::FScope& Scope, const TArray<int8>& Filter)
+		{
+		}
+
+		virtual void Complete(const TSharedRef<PCGExData::FFacade>& InDataFacade, FPCGExAttributeStatsContext* Context, const UPCGExAttributeStatsSettings* Settings)
 		{
 		}
 	};
@@ -283,6 +365,19 @@ namespace PCGExAttributeStats
 	class TAttributeStats : public IAttributeStats
 	{
 		using Traits = PCGExTypes::TTraits<T>;
+		using FPartial = TStatsPartial<T>;
+
+		static constexpr bool bNoAverage = std::is_same_v<T, FString> || std::is_same_v<T, FName> || std::is_same_v<T, FSoftObjectPath> || std::is_same_v<T, FSoftClassPath>;
+
+		TSharedPtr<PCGExData::TBuffer<T>> Buffer;
+		const PCGExTypeOps::ITypeOpsBase* TypeOps = nullptr;
+		TArray<FPartial> Partials;
+
+		bool bTrackCounts = true;
+		bool bTrackSamples = false;
+		bool bUseSketches = false;
+		int32 DistinctPrecision = 12;
+		int32 QuantileAccuracy = 200;
 
 	public:
 		T DefaultValue = T{};
@@ -291,9 +386,8 @@ namespace PCGExAttributeStats
 		T SetMinValue = T{};
 		T SetMaxValue = T{};
 		T AverageValue = T{};
-		T AverageSetValue = T{};
-		T MaxUniqueValue = T{};
-		T MinUniqueValue = T{};
+		double MedianValue = 0;
+		double PercentileValue = 0;
 		int32 UniqueValuesNum = 0;
 		int32 UniqueSetValuesNum = 0;
 		int32 DifferentValuesNum = 0;
@@ -305,15 +399,110 @@ namespace PCGExAttributeStats
 		{
 		}
 
-		virtual void Process(const TSharedRef<PCGExData::FFacade> InDataFacade, FPCGExAttributeStatsContext* Context, const UPCGExAttributeStatsSettings* Settings, const TArray<int8>& Filter) override
+		virtual void Init(const TSharedRef<PCGExData::FFacade>& InDataFacade, const UPCGExAttributeStatsSettings* Settings) override
+		{
+			Buffer = InDataFacade->GetReadable<T>(Identity.Identifier);
+			if (!Buffer) { return; }
+
+			TypeOps = PCGExTypeOps::FTypeOpsRegistry::Get<T>();
+			DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
+
+			const bool bWantsQuantiles = Traits::bIsNumeric && (Settings->bOutputMedianValue || Settings->bOutputPercentileValue);
+
+			bUseSketches = Settings->Mode == EPCGExStatsMode::Approximate;
+			DistinctPrecision = Settings->DistinctPrecision;
+			QuantileAccuracy = Settings->QuantileAccuracy;
+
+			// Some outputs can only be answered with exact per-value occurrences
+			bTrackCounts = !bUseSketches
+				|| Settings->bOutputPerUniqueValuesStats
+				|| Settings->bOutputUniqueValuesNum
+				|| Settings->bOutputUniqueSetValuesNum
+				|| Settings->bOutputHasOnlyUniqueValues
+				|| (bNoAverage && Settings->bOutputAverageValue);
+
+			bTrackSamples = !bUseSketches && bWantsQuantiles;
+			if (!bWantsQuantiles) { QuantileAccuracy = 0; }
+		}
+
+		virtual void PrepareScopes(const TArray<PCGExMT::FScope>& Loops) override
+		{
+			if (!Buffer) { return; }
+
+			if constexpr (PCGEx::IsValidForTMap<T>::value)
+			{
+				Partials.SetNum(Loops.Num());
+				for (FPartial& Partial : Partials)
+				{
+					Partial.SetMinValue = Partial.MinValue = Traits::Max();
+					Partial.SetMaxValue = Partial.MaxValue = Traits::Min();
+
+					if (bUseSketches)
+					{
+						Partial.Distinct = MakeShared<PCGExMath::FHyperLogLog>(DistinctPrecision);
+						Partial.SetDistinct = MakeShared<PCGExMath::FHyperLogLog>(DistinctPrecision);
+						if (QuantileAccuracy > 0) { Partial.Quantiles = MakeShared<PCGExMath::FQuantileSketch>(QuantileAccuracy); }
+					}
+				}
+			}
+		}
+
+		virtual void ProcessScope(const PCGExMT::FScope& Scope, const TArray<int8>& Filter) override
+		{
+			if (!Buffer) { return; }
+
+			if constexpr (PCGEx::IsValidForTMap<T>::value)
+			{
+				FPartial& Partial = Partials[Scope.LoopIndex];
+				if (bTrackCounts) { Partial.ValuesCount.Reserve(Scope.Count); }
+				if (bTrackSamples) { Partial.Samples.Reserve(Scope.Count); }
+
+				PCGEX_SCOPE_LOOP(i)
+				{
+					if (!Filter[i]) { continue; }
+					Partial.NumValues++;
+
+					const T& Value = Buffer->Read(i);
+
+					TypeOps->BlendMin(&Value, &Partial.MinValue, &Partial.MinValue);
+					TypeOps->BlendMax(&Value, &Partial.MaxValue, &Partial.MaxValue);
+
+					if constexpr (!bNoAverage) { TypeOps->BlendAdd(&Value, &Partial.SumValue, &Partial.SumValue); }
+
+					if constexpr (Traits::bIsNumeric)
+					{
+						if (bTrackSamples) { Partial.Samples.Add(PCGExTypes::Convert<T, double>(Value)); }
+						else if (Partial.Quantiles) { Partial.Quantiles->Add(PCGExTypes::Convert<T, double>(Value)); }
+					}
+
+					if (bTrackCounts) { Partial.ValuesCount.FindOrAdd(Value, 0)++; }
+
+					const uint64 Hash = bUseSketches ? PCGExMath::FHyperLogLog::MixHash(GetTypeHash(Value)) : 0;
+					if (bUseSketches) { Partial.Distinct->Add(Hash); }
+
+					if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
+					{
+						Partial.DefaultValuesNum++;
+					}
+					else
+					{
+						if (bTrackCounts) { Partial.SetValuesCount.FindOrAdd(Value, 0)++; }
+						if (bUseSketches) { Partial.SetDistinct->Add(Hash); }
+
+						TypeOps->BlendMin(&Value, &Partial.SetMinValue, &Partial.SetMinValue);
+						TypeOps->BlendMax(&Value, &Partial.SetMaxValue, &Partial.SetMaxValue);
+					}
+				}
+			}
+		}
+
+		virtual void Complete(const TSharedRef<PCGExData::FFacade>& InDataFacade, FPCGExAttributeStatsContext* Context, const UPCGExAttributeStatsSettings* Settings) override
 		{
 			UPCGParamData* ParamData = Context->OutputParamsMap[Identity.Identifier.Name];
 
 			FString StrName = Identity.Identifier.Name.ToString();
 			UPCGMetadata* PointsMetadata = nullptr;
 
-			const PCGExTypeOps::ITypeOpsBase* TypeOps = PCGExTypeOps::FTypeOpsRegistry::Get<T>();
-
 			if (Settings->OutputToPoints != EPCGExStatsOutputToPoints::None) { PointsMetadata = InDataFacade->GetOut()->Metadata; }
 
 #define PCGEX_OUTPUT_STAT(_NAME, _TYPE, _VALUE) \
@@ -324,12 +513,6 @@ namespace PCGExAttributeStats
 		if (PointsMetadata->GetConstTypedAttribute<_TYPE>(PrintName)) { PointsMetadata->DeleteAttribute(PrintName); }\
 		PointsMetadata->FindOrCreateAttribute<_TYPE>(PrintName, _VALUE);} }
 
-			TSharedPtr<PCGExData::TBuffer<T>> Buffer = InDataFacade->GetReadable<T>(Identity.Identifier);
-			SetMinValue = MinValue = Traits::Max();
-			SetMinValue = MinValue = Traits::Min();
-
-#define PCGEX_NO_AVERAGE if constexpr (std::is_same_v<T, FString> || std::is_same_v<T, FName> || std::is_same_v<T, FSoftObjectPath> || std::is_same_v<T, FSoftClassPath>)
-
 			if (!Buffer)
 			{
 				// Invalid attribute, type mismatch!
@@ -359,55 +542,56 @@ namespace PCGExAttributeStats
 					InDataFacade->Source->Tags->AddRaw(Identifier);
 				}
 
-				const int32 NumPoints = InDataFacade->GetNum();
-				TMap<T, int32> ValuesCount;
-				TMap<T, int32> SetValuesCount;
-				ValuesCount.Reserve(NumPoints);
-				SetValuesCount.Reserve(NumPoints);
+				////// MERGE
+
+				SetMinValue = MinValue = Traits::Max();
+				SetMaxValue = MaxValue = Traits::Min();
 
-				DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
 				int32 NumValues = 0;
 
-				for (int i = 0; i < NumPoints; i++)
+				for (const FPartial& Partial : Partials)
 				{
-					if (!Filter[i]) { continue; }
-					NumValues++;
+					NumValues += Partial.NumValues;
+					DefaultValuesNum += Partial.DefaultValuesNum;
 
-					const T& Value = Buffer->Read(i);
+					if (!Partial.NumValues) { continue; }
 
-					TypeOps->BlendMin(&Value, &MinValue, &MinValue);
-					TypeOps->BlendMax(&Value, &MaxValue, &MaxValue);
+					TypeOps->BlendMin(&Partial.MinValue, &MinValue, &MinValue);
+					TypeOps->BlendMax(&Partial.MaxValue, &MaxValue, &MaxValue);
 
-					PCGEX_NO_AVERAGE
-					{
-					}
-					else
-					{
-						TypeOps->BlendAdd(&Value, &AverageValue, &AverageValue);
-					}
+					if (Partial.NumValues == Partial.DefaultValuesNum) { continue; }
 
-					int32& Count = ValuesCount.FindOrAdd(Value, 0);
-					++Count;
+					TypeOps->BlendMin(&Partial.SetMinValue, &SetMinValue, &SetMinValue);
+					TypeOps->BlendMax(&Partial.SetMaxValue, &SetMaxValue, &SetMaxValue);
+				}
 
-					if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
-					{
-						DefaultValuesNum++;
-					}
-					else
-					{
-						int32& SetCount = SetValuesCount.FindOrAdd(Value, 0);
-						++SetCount;
+				if (Partials.IsEmpty()) { Partials.Emplace(); }
 
-						TypeOps->BlendMin(&Value, &SetMinValue, &SetMinValue);
-						TypeOps->BlendMax(&Value, &SetMaxValue, &SetMaxValue);
-					}
+				// Fold everything into the first partial, in scope order so results don't depend on scheduling
+				FPartial& Merged = Partials[0];
+				for (int32 p = 1; p < Partials.Num(); p++)
+				{
+					FPartial& Partial = Partials[p];
+
+					if constexpr (!bNoAverage) { TypeOps->BlendAdd(&Partial.SumValue, &Merged.SumValue, &Merged.SumValue); }
+
+					for (const TPair<T, int32>& Pair : Partial.ValuesCount) { Merged.ValuesCount.FindOrAdd(Pair.Key, 0) += Pair.Value; }
+					for (const TPair<T, int32>& Pair : Partial.SetValuesCount) { Merged.SetValuesCount.FindOrAdd(Pair.Key, 0) += Pair.Value; }
+
+					Merged.Samples.Append(Partial.Samples);
+
+					if (Merged.Distinct) { Merged.Distinct->Merge(*Partial.Distinct); }
+					if (Merged.SetDistinct) { Merged.SetDistinct->Merge(*Partial.SetDistinct); }
+					if (Merged.Quantiles) { Merged.Quantiles->Merge(*Partial.Quantiles); }
+
+					Partial = FPartial{};
 				}
 
-				PCGEX_NO_AVERAGE
+				if constexpr (bNoAverage)
 				{
 					// Pick the most present value.
 					int32 Max = -1;
-					for (const TPair<T, int32>& Pair : ValuesCount)
+					for (const TPair<T, int32>& Pair : Merged.ValuesCount)
 					{
 						if (Pair.Value > Max)
 						{
@@ -416,6 +600,10 @@ namespace PCGExAttributeStats
 						}
 					}
 				}
+				else
+				{
+					AverageValue = Merged.SumValue;
+				}
 
 				if (UniqueValuesParamData)
 				{
@@ -423,43 +611,51 @@ namespace PCGExAttributeStats
 					FPCGMetadataAttribute<T>* UValues = UVM->FindOrCreateAttribute<T>(Settings->UniqueValueAttributeName, MinValue);
 					FPCGMetadataAttribute<int32>* UCount = UVM->FindOrCreateAttribute<int32>(Settings->ValueCountAttributeName, 0);
 
-					if (Settings->bOmitDefaultValue)
-					{
-						for (const TPair<T, int32>& Pair : SetValuesCount)
-						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
-						}
-					}
-					else
+					for (const TPair<T, int32>& Pair : (Settings->bOmitDefaultValue ? Merged.SetValuesCount : Merged.ValuesCount))
 					{
-						for (const TPair<T, int32>& Pair : ValuesCount)
-						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
-						}
+						int64 UVKey = UVM->AddEntry();
+						UValues->SetValue(UVKey, Pair.Key);
+						UCount->SetValue(UVKey, Pair.Value);
 					}
 				}
 
 				if (Settings->bOutputUniqueValuesNum)
 				{
 					UniqueValuesNum = 0;
-					for (const TPair<T, int32>& Pair : ValuesCount) { if (Pair.Value == 1) { UniqueValuesNum++; } }
+					for (const TPair<T, int32>& Pair : Merged.ValuesCount) { if (Pair.Value == 1) { UniqueValuesNum++; } }
 				}
 
-				if (Settings->bOutputUniqueSetValuesNum)
+				if (Settings->bOutputUniqueSetValuesNum || Settings->bOutputHasOnlyUniqueValues)
 				{
 					UniqueSetValuesNum = 0;
-					for (const TPair<T, int32>& Pair : SetValuesCount) { if (Pair.Value == 1) { UniqueSetValuesNum++; } }
+					for (const TPair<T, int32>& Pair : Merged.SetValuesCount) { if (Pair.Value == 1) { UniqueSetValuesNum++; } }
 				}
 
-				DifferentValuesNum = ValuesCount.Num();
-				DifferentSetValuesNum = SetValuesCount.Num();
+				if (bTrackCounts)
+				{
+					DifferentValuesNum = Merged.ValuesCount.Num();
+					DifferentSetValuesNum = Merged.SetValuesCount.Num();
+				}
+				else if (Merged.Distinct)
+				{
+					DifferentValuesNum = FMath::Min(NumValues, FMath::RoundToInt32(Merged.Distinct->Estimate()));
+					DifferentSetValuesNum = FMath::Min(NumValues - DefaultValuesNum, FMath::RoundToInt32(Merged.SetDistinct->Estimate()));
+				}
 
-				ValuesCount.Empty();
-				SetValuesCount.Empty();
+				if (bTrackSamples && !Merged.Samples.IsEmpty())
+				{
+					if (Settings->bOutputMedianValue) { MedianValue = PCGExMath::GetMedian(Merged.Samples); }
+					if (Settings->bOutputPercentileValue)
+					{
+						const int32 Rank = FMath::Clamp(FMath::RoundToInt32(Settings->Percentile * (Merged.Samples.Num() - 1)), 0, Merged.Samples.Num() - 1);
+						PercentileValue = PCGExMath::QuickSelect(Merged.Samples, 0, Merged.Samples.Num() - 1, Rank);
+					}
+				}
+				else if (Merged.Quantiles && !Merged.Quantiles->IsEmpty())
+				{
+					MedianValue = Merged.Quantiles->GetQuantile(0.5);
+					PercentileValue = Merged.Quantiles->GetQuantile(Settings->Percentile);
+				}
 
 				////// OUTPUT		
 
@@ -471,6 +667,8 @@ namespace PCGExAttributeStats
 				PCGEX_OUTPUT_STAT(SetMinValue, T, SetMinValue)
 				PCGEX_OUTPUT_STAT(SetMaxValue, T, SetMaxValue)
 				PCGEX_OUTPUT_STAT(AverageValue, T, AverageValue)
+				PCGEX_OUTPUT_STAT(MedianValue, double, MedianValue)
+				PCGEX_OUTPUT_STAT(PercentileValue, double, PercentileValue)
 				PCGEX_OUTPUT_STAT(UniqueValuesNum, int32, UniqueValuesNum)
 				PCGEX_OUTPUT_STAT(UniqueSetValuesNum, int32, UniqueSetValuesNum)
 				PCGEX_OUTPUT_STAT(DifferentValuesNum, int32, DifferentValuesNum)
@@ -482,8 +680,9 @@ namespace PCGExAttributeStats
 				PCGEX_OUTPUT_STAT(Samples, int32, NumValues)
 				PCGEX_OUTPUT_STAT(IsValid, bool, true)
 
+				Partials.Empty();
+
 #undef PCGEX_OUTPUT_STAT
-#undef PCGEX_NO_AVERAGE
 			}
 		}
 	};
@@ -503,6 +702,7 @@ namespace PCGExAttributeStats
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
+		void ProcessScope(const PCGExMT::FScope& Scope);
 		virtual void CompleteWork() override;
 	};
 }
@@ -3,9 +3,11 @@
 
 #include "Core/PCGExPathQuery.h"
 
+#include "PCGExH.h"
 #include "PCGExHeuristicsHandler.h"
 #include "Data/PCGExData.h"
 #include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExHashLookup.h"
 #include "Search/PCGExSearchOperation.h"
 
 namespace PCGExPathfinding
@@ -77,6 +79,26 @@ namespace PCGExPathfinding
 		}
 	}
 
+	bool FPathQuery::AddPathFromTravelStack(const TSharedPtr<PCGEx::FHashLookup>& TravelStack)
+	{
+		int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(Goal.Node->Index));
+		int32 PathEdgeIndex = -1;
+
+		if (PathNodeIndex == -1) { return false; }
+
+		AddPathNode(Goal.Node->Index);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelStack->Get(CurrentIndex), PathNodeIndex, PathEdgeIndex);
+
+			AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+
+		return true;
+	}
+
 	void FPathQuery::FindPath(const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler, const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback)
 	{
 		if (PickResolution != EQueryPickResolution::Success)
@@ -147,4 +169,18 @@ namespace PCGExPathfinding
 		PathNodes.Empty();
 		PathEdges.Empty();
 	}
+
+	void FindSharedSeedPaths(
+		const TArrayView<const TSharedPtr<FPathQuery>> InQueries,
+		const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
+		const TSharedPtr<FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler)
+	{
+		SearchOperation->ResolveSharedSeedQueries(InQueries, Allocations, HeuristicsHandler);
+
+		for (const TSharedPtr<FPathQuery>& Query : InQueries)
+		{
+			Query->SetResolution(Query->HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail);
+		}
+	}
 }
@@ -5,11 +5,18 @@
 
 #include "PCGExH.h"
 #include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExBufferPool.h"
 #include "Containers/PCGExHashLookup.h"
+#include "Search/PCGExSearchOperation.h"
 #include "Utils/PCGExScoredQueue.h"
 
 namespace PCGExPathfinding
 {
+	FSearchAllocations::~FSearchAllocations()
+	{
+		PCGEx::FBufferPool::Get().Release(GScore);
+	}
+
 	void FSearchAllocations::Reset()
 	{
 		if (GScore.Num() == Visited.Num())
@@ -37,4 +44,23 @@ namespace PCGExPathfinding
 		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
 		ScoredQueue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
 	}
+
+	TSharedPtr<FSearchAllocations> FSearchAllocationsPool::Acquire(const FPCGExSearchOperation* InSearchOperation)
+	{
+		{
+			FScopeLock Lock(&PoolLock);
+			if (!Available.IsEmpty()) { return Available.Pop(EAllowShrinking::No); }
+		}
+
+		// Pool is empty, create new allocations
+		return InSearchOperation->NewAllocations();
+	}
+
+	void FSearchAllocationsPool::Release(const TSharedPtr<FSearchAllocations>& InAllocations)
+	{
+		if (!InAllocations) { return; }
+
+		FScopeLock Lock(&PoolLock);
+		Available.Add(InAllocations);
+	}
 }
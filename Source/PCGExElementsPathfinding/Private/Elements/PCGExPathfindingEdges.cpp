@@ -13,6 +13,7 @@
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
 #include "Core/PCGExPathQuery.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Data/Utils/PCGExDataForward.h"
 #include "GoalPickers/PCGExGoalPickerRandom.h"
 #include "Search/PCGExSearchAStar.h"
@@ -203,6 +204,11 @@ bool FPCGExPathfindingEdgesElement::AdvanceWork(FPCGExContext* InContext, const
 
 	PCGEX_CLUSTER_BATCH_PROCESSING(PCGExCommon::States::State_Done)
 
+	if (const int32 NumSavedSearches = Context->NumSavedSearches.load(); NumSavedSearches > 0)
+	{
+		PCGE_LOG(Verbose, LogOnly, FText::Format(FTEXT("Shared seed searches saved {0} explorations."), FText::AsNumber(NumSavedSearches)));
+	}
+
 	Context->OutputPaths->StageOutputs();
 
 	return Context->TryComplete();
@@ -249,6 +255,8 @@ namespace PCGExPathfindingEdges
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
 		if (bForceSingleThreadedProcessRange) { SearchAllocations = SearchOperation->NewAllocations(); }
 
+		bShareSeedSearches = Settings->bShareSeedSearches && SearchOperation->SupportsSharedSeedQueries() && HeuristicsHandler->HasGoalIndependentEdgeScores();
+
 		const int32 NumQueries = Context->SeedGoalPairs.Num();
 		PCGExArrayHelpers::InitArray(Queries, NumQueries);
 		QueriesIO.Init(nullptr, NumQueries);
@@ -273,19 +281,88 @@ namespace PCGExPathfindingEdges
 		{
 			TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
 
-			ON_SCOPE_EXIT { Query->Cleanup(); };
-
 			Query->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
 
+			// Searches are deferred until all picks are resolved & grouped by seed
+			if (bShareSeedSearches) { continue; }
+
+			ON_SCOPE_EXIT { Query->Cleanup(); };
+
 			if (!Query->HasValidEndpoints()) { continue; }
 
 			Query->FindPath(SearchOperation, SearchAllocations, HeuristicsHandler, nullptr);
 
 			if (!Query->IsQuerySuccessful()) { continue; }
 
-			Context->BuildPath(Query, QueriesIO[Query->QueryIndex]);
-			QueriesIO[Query->QueryIndex]->IOIndex = EdgeDataFacade->Source->IOIndex * 100000 + Query->QueryIndex;
+			OutputQuery(Query);
+		}
+	}
+
+	void FProcessor::OnRangeProcessingComplete()
+	{
+		if (!bShareSeedSearches) { return; }
+
+		QueriesBySeed.Reserve(Queries.Num());
+		for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Queries) { if (Query->HasValidEndpoints()) { QueriesBySeed.Add(Query); } }
+
+		if (QueriesBySeed.IsEmpty()) { return; }
+
+		// Stable grouping : by seed node, then by query index
+		QueriesBySeed.Sort(
+			[](const TSharedPtr<PCGExPathfinding::FPathQuery>& A, const TSharedPtr<PCGExPathfinding::FPathQuery>& B)
+			{
+				const int32 SeedA = A->Seed.Node->Index;
+				const int32 SeedB = B->Seed.Node->Index;
+				return SeedA == SeedB ? A->QueryIndex < B->QueryIndex : SeedA < SeedB;
+			});
+
+		int32 GroupStart = 0;
+		for (int i = 1; i <= QueriesBySeed.Num(); i++)
+		{
+			if (i < QueriesBySeed.Num() && QueriesBySeed[i]->Seed.Node->Index == QueriesBySeed[GroupStart]->Seed.Node->Index) { continue; }
+			SeedGroups.Emplace(GroupStart, i - GroupStart, SeedGroups.Num());
+			GroupStart = i;
+		}
+
+		Context->NumSavedSearches += QueriesBySeed.Num() - SeedGroups.Num();
+
+		if (!SearchAllocations) { AllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>(); }
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, SharedSeedSearches)
+
+		SharedSeedSearches->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->ProcessSeedGroups(Scope);
+		};
+
+		SharedSeedSearches->StartSubLoops(SeedGroups.Num(), 1, bForceSingleThreadedProcessRange);
+	}
+
+	void FProcessor::ProcessSeedGroups(const PCGExMT::FScope& Scope)
+	{
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = SearchAllocations ? SearchAllocations : AllocationsPool->Acquire(SearchOperation.Get());
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			const TArrayView<TSharedPtr<PCGExPathfinding::FPathQuery>> Group = SeedGroups[Index].GetView(QueriesBySeed);
+
+			PCGExPathfinding::FindSharedSeedPaths(Group, SearchOperation, Allocations, HeuristicsHandler);
+
+			for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Group)
+			{
+				if (Query->IsQuerySuccessful()) { OutputQuery(Query); }
+				Query->Cleanup();
+			}
 		}
+
+		if (AllocationsPool) { AllocationsPool->Release(Allocations); }
+	}
+
+	void FProcessor::OutputQuery(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query)
+	{
+		Context->BuildPath(Query, QueriesIO[Query->QueryIndex]);
+		QueriesIO[Query->QueryIndex]->IOIndex = EdgeDataFacade->Source->IOIndex * 100000 + Query->QueryIndex;
 	}
 }
 
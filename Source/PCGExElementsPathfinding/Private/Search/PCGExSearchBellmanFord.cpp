@@ -5,6 +5,7 @@
 
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExBufferPool.h"
 #include "Containers/PCGExHashLookup.h"
 #include "Core/PCGExPathfinding.h"
 #include "Core/PCGExPathQuery.h"
@@ -137,7 +138,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationBellmanFord::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations = FPCGExSearchOperation::NewAllocations();
-	NewAllocations->GScore.Init(MAX_dbl, Cluster->Nodes->Num()); // Use MAX_dbl as infinity
+	PCGEx::FBufferPool::Get().Init(NewAllocations->GScore, MAX_dbl, Cluster->Nodes->Num()); // Use MAX_dbl as infinity
 	return NewAllocations;
 }
 
@@ -0,0 +1,223 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExHeuristicsBenchmark.h"
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterBenchmark.h"
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExPathQuery.h"
+#include "Core/PCGExSearchAllocations.h"
+#include "Data/PCGPointArrayData.h"
+#include "Search/PCGExSearchAStar.h"
+#include "Search/PCGExSearchBidirectional.h"
+#include "Search/PCGExSearchDeltaStepping.h"
+#include "Search/PCGExSearchDijkstra.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Search throughput on grid clusters, e.g. pcgex.Bench.Run Filter=Pathfinding.* Scales=100000+1000000
+namespace PCGExPathfinding
+{
+	namespace Benchmark
+	{
+		constexpr int32 NumQueries = 16;
+
+		struct FScene
+		{
+			TSharedPtr<PCGExClusters::Benchmark::FGridCluster> Grid;
+			TSharedPtr<PCGExHeuristics::FHandler> Heuristics;
+			TArray<TSharedPtr<FPathQuery>> Queries;
+		};
+
+		// Seeds & goals are picked at random across the whole grid, so paths span a fair share of it
+		static TSharedPtr<FScene> MakeScene(const int32 NumVtx, const double Jitter, const int32 Seed)
+		{
+			TSharedPtr<FScene> Scene = MakeShared<FScene>();
+
+			Scene->Grid = PCGExClusters::Benchmark::MakeGridCluster(NumVtx, Jitter, Seed);
+			if (!Scene->Grid->Cluster) { return nullptr; }
+
+			const TSharedRef<PCGExClusters::FCluster> Cluster = Scene->Grid->Cluster.ToSharedRef();
+
+			const PCGExHeuristics::Benchmark::EHeuristic Distance[] = {PCGExHeuristics::Benchmark::EHeuristic::Distance};
+			Scene->Heuristics = PCGExHeuristics::Benchmark::MakeHandler(Cluster, EPCGExHeuristicScoreMode::WeightedSum, Distance);
+			if (!Scene->Heuristics) { return nullptr; }
+
+			const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+			const UPCGBasePointData* VtxData = Scene->Grid->VtxData.Get();
+
+			FRandomStream Random(Seed);
+			for (int32 i = 0; i < NumQueries; i++)
+			{
+				const PCGExClusters::FNode* SeedNode = &NodesRef[Random.RandHelper(NodesRef.Num())];
+				const PCGExClusters::FNode* GoalNode = &NodesRef[Random.RandHelper(NodesRef.Num())];
+				if (SeedNode == GoalNode) { continue; }
+
+				TSharedPtr<FPathQuery> Query = MakeShared<FPathQuery>(Cluster, FNodePick(PCGExData::FConstPoint(VtxData, SeedNode->PointIndex)), FNodePick(PCGExData::FConstPoint(VtxData, GoalNode->PointIndex)), Scene->Queries.Num());
+				Query->Seed.Node = SeedNode;
+				Query->Goal.Node = GoalNode;
+				Query->PickResolution = EQueryPickResolution::Success;
+				Scene->Queries.Add(Query);
+			}
+
+			return Scene;
+		}
+
+		static void FindPaths(const FScene& Scene, const TSharedPtr<FPCGExSearchOperation>& SearchOperation)
+		{
+			const TSharedPtr<FSearchAllocations> Allocations = SearchOperation->NewAllocations();
+			for (const TSharedPtr<FPathQuery>& Query : Scene.Queries)
+			{
+				Query->Cleanup();
+				Query->FindPath(SearchOperation, Allocations, Scene.Heuristics, nullptr);
+			}
+		}
+
+		// Sum of edge scores along a resolved path, seed to goal
+		static double GetPathCost(const FScene& Scene, const FPathQuery& Query)
+		{
+			const TArray<PCGExClusters::FNode>& NodesRef = *Scene.Grid->Cluster->Nodes;
+			const TArray<PCGExGraphs::FEdge>& EdgesRef = *Scene.Grid->Cluster->Edges;
+
+			double Cost = 0;
+			for (int32 i = 0; i < Query.PathEdges.Num(); i++)
+			{
+				Cost += Scene.Heuristics->GetEdgeScore(NodesRef[Query.PathNodes[i]], NodesRef[Query.PathNodes[i + 1]], EdgesRef[Query.PathEdges[i]], *Query.Seed.Node, *Query.Goal.Node, nullptr, nullptr);
+			}
+
+			return Cost;
+		}
+
+		template <typename T_SEARCH>
+		static PCGExBenchmark::FKernel MakeSearchKernel(const int32 Scale)
+		{
+			if (Scale < 4) { return nullptr; }
+
+			TSharedPtr<FScene> Scene = MakeScene(Scale, 0.3, 1337);
+			if (!Scene) { return nullptr; }
+
+			TSharedPtr<T_SEARCH> SearchOperation = MakeShared<T_SEARCH>();
+			if constexpr (std::is_same_v<T_SEARCH, FPCGExSearchOperationDeltaStepping>) { SearchOperation->MinNodes = 0; }
+			SearchOperation->PrepareForCluster(Scene->Grid->Cluster.Get());
+
+			return [Scene, SearchOperation]() { FindPaths(*Scene, SearchOperation); };
+		}
+
+		// Auto width, and a width narrow enough to be clamped
+		static TArray<TSharedPtr<FPCGExSearchOperationDeltaStepping>> MakeDeltaSteppings(PCGExBenchmark::FCheckContext& Context, const FScene& Scene)
+		{
+			TArray<TSharedPtr<FPCGExSearchOperationDeltaStepping>> DeltaSteppings;
+			for (const bool bAutoBucketWidth : {true, false})
+			{
+				const TSharedPtr<FPCGExSearchOperationDeltaStepping> DeltaStepping = DeltaSteppings.Add_GetRef(MakeShared<FPCGExSearchOperationDeltaStepping>());
+				DeltaStepping->MinNodes = 0;
+				DeltaStepping->bAutoBucketWidth = bAutoBucketWidth;
+				DeltaStepping->BucketWidth = UE_DOUBLE_SMALL_NUMBER;
+				DeltaStepping->PrepareForCluster(Scene.Grid->Cluster.Get());
+				Context.Test(!DeltaStepping->SupportsSharedSeedQueries(), TEXT("Delta-stepping must not resolve shared seed queries as a single Dijkstra tree"));
+			}
+			return DeltaSteppings;
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchAStar(TEXT("Pathfinding.AStar"), TEXT("16 A* queries across a jittered grid cluster of N vtx, distance heuristic"), &Benchmark::MakeSearchKernel<FPCGExSearchOperationAStar>);
+	static PCGExBenchmark::FRegistrar BenchDijkstra(TEXT("Pathfinding.Dijkstra"), TEXT("16 Dijkstra queries across a jittered grid cluster of N vtx, distance heuristic"), &Benchmark::MakeSearchKernel<FPCGExSearchOperationDijkstra>);
+	static PCGExBenchmark::FRegistrar BenchBidirectional(TEXT("Pathfinding.Bidirectional"), TEXT("16 bidirectional queries across a jittered grid cluster of N vtx, distance heuristic"), &Benchmark::MakeSearchKernel<FPCGExSearchOperationBidirectional>);
+	static PCGExBenchmark::FRegistrar BenchDeltaStepping(TEXT("Pathfinding.DeltaStepping"), TEXT("16 delta-stepping queries across a jittered grid cluster of N vtx, distance heuristic, no small cluster fallback"), &Benchmark::MakeSearchKernel<FPCGExSearchOperationDeltaStepping>);
+
+	static PCGExBenchmark::FCheckRegistrar CheckDeltaStepping(
+		TEXT("Pathfinding.DeltaStepping"), TEXT("Delta-stepping returns Dijkstra's path & cost on jittered grids"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			for (const int32 Seed : {1337, 42})
+			{
+				const TSharedPtr<Benchmark::FScene> Scene = Benchmark::MakeScene(4096, 0.3, Seed);
+				if (!Context.Test(Scene.IsValid(), TEXT("Seed %d : scene setup failed"), Seed)) { continue; }
+
+				const TSharedPtr<FPCGExSearchOperationDijkstra> Dijkstra = MakeShared<FPCGExSearchOperationDijkstra>();
+				Dijkstra->PrepareForCluster(Scene->Grid->Cluster.Get());
+
+				const TArray<TSharedPtr<FPCGExSearchOperationDeltaStepping>> DeltaSteppings = Benchmark::MakeDeltaSteppings(Context, *Scene);
+
+				for (const TSharedPtr<FPathQuery>& Query : Scene->Queries)
+				{
+					Query->Cleanup();
+					Query->FindPath(Dijkstra, nullptr, Scene->Heuristics, nullptr);
+					if (!Context.Test(Query->IsQuerySuccessful(), TEXT("Seed %d : Dijkstra query %d failed"), Seed, Query->QueryIndex)) { continue; }
+
+					const TArray<int32> ExpectedNodes = Query->PathNodes;
+					const double ExpectedCost = Benchmark::GetPathCost(*Scene, *Query);
+
+					for (const TSharedPtr<FPCGExSearchOperationDeltaStepping>& DeltaStepping : DeltaSteppings)
+					{
+						Query->Cleanup();
+						Query->FindPath(DeltaStepping, DeltaStepping->NewAllocations(), Scene->Heuristics, nullptr);
+						if (!Context.Test(Query->IsQuerySuccessful(), TEXT("Seed %d : delta-stepping query %d failed"), Seed, Query->QueryIndex)) { continue; }
+
+						const double Cost = Benchmark::GetPathCost(*Scene, *Query);
+						Context.Test(FMath::IsNearlyEqual(Cost, ExpectedCost, ExpectedCost * UE_DOUBLE_SMALL_NUMBER), TEXT("Seed %d, query %d : cost %f, Dijkstra's is %f"), Seed, Query->QueryIndex, Cost, ExpectedCost);
+						Context.Test(Query->PathNodes == ExpectedNodes, TEXT("Seed %d, query %d : %d nodes path differs from Dijkstra's %d nodes path"), Seed, Query->QueryIndex, Query->PathNodes.Num(), ExpectedNodes.Num());
+					}
+				}
+
+				for (const TSharedPtr<FPCGExSearchOperationDeltaStepping>& DeltaStepping : DeltaSteppings)
+				{
+					Context.Test(DeltaStepping->NumDeferredQueries == 0, TEXT("Seed %d : %d queries were handed over to Dijkstra"), Seed, DeltaStepping->NumDeferredQueries.load());
+				}
+			}
+		});
+
+	static PCGExBenchmark::FCheckRegistrar CheckDeltaSteppingLattice(
+		TEXT("Pathfinding.DeltaStepping.Lattice"), TEXT("On uniform grids full of equally short paths, delta-stepping resolves every query itself, at Dijkstra's cost, and picks the same path whatever the bucket width or run"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			for (const int32 Seed : {1337, 42})
+			{
+				const TSharedPtr<Benchmark::FScene> Scene = Benchmark::MakeScene(4096, 0, Seed);
+				if (!Context.Test(Scene.IsValid(), TEXT("Seed %d : scene setup failed"), Seed)) { continue; }
+
+				const TSharedPtr<FPCGExSearchOperationDijkstra> Dijkstra = MakeShared<FPCGExSearchOperationDijkstra>();
+				Dijkstra->PrepareForCluster(Scene->Grid->Cluster.Get());
+
+				const TArray<TSharedPtr<FPCGExSearchOperationDeltaStepping>> DeltaSteppings = Benchmark::MakeDeltaSteppings(Context, *Scene);
+
+				// Allocations are reused across queries, as the pathfinding nodes do
+				TArray<TSharedPtr<FSearchAllocations>> Allocations;
+				for (const TSharedPtr<FPCGExSearchOperationDeltaStepping>& DeltaStepping : DeltaSteppings) { Allocations.Add(DeltaStepping->NewAllocations()); }
+
+				for (const TSharedPtr<FPathQuery>& Query : Scene->Queries)
+				{
+					Query->Cleanup();
+					Query->FindPath(Dijkstra, nullptr, Scene->Heuristics, nullptr);
+					if (!Context.Test(Query->IsQuerySuccessful(), TEXT("Seed %d : Dijkstra query %d failed"), Seed, Query->QueryIndex)) { continue; }
+
+					const double ExpectedCost = Benchmark::GetPathCost(*Scene, *Query);
+
+					TArray<int32> ExpectedNodes;
+					for (int32 d = 0; d < DeltaSteppings.Num(); d++)
+					{
+						for (int32 Run = 0; Run < 2; Run++)
+						{
+							Query->Cleanup();
+							Query->FindPath(DeltaSteppings[d], Allocations[d], Scene->Heuristics, nullptr);
+							if (!Context.Test(Query->IsQuerySuccessful(), TEXT("Seed %d : delta-stepping query %d failed"), Seed, Query->QueryIndex)) { continue; }
+
+							const double Cost = Benchmark::GetPathCost(*Scene, *Query);
+							Context.Test(FMath::IsNearlyEqual(Cost, ExpectedCost, ExpectedCost * UE_DOUBLE_SMALL_NUMBER), TEXT("Seed %d, query %d : cost %f, Dijkstra's is %f"), Seed, Query->QueryIndex, Cost, ExpectedCost);
+
+							if (ExpectedNodes.IsEmpty()) { ExpectedNodes = Query->PathNodes; }
+							else { Context.Test(Query->PathNodes == ExpectedNodes, TEXT("Seed %d, query %d : width %d, run %d picked another of the equally short paths"), Seed, Query->QueryIndex, d, Run); }
+						}
+					}
+				}
+
+				for (const TSharedPtr<FPCGExSearchOperationDeltaStepping>& DeltaStepping : DeltaSteppings)
+				{
+					Context.Test(DeltaStepping->NumDeferredQueries == 0, TEXT("Seed %d : %d lattice queries were handed over to Dijkstra"), Seed, DeltaStepping->NumDeferredQueries.load());
+				}
+			}
+		});
+}
+
+#endif
@@ -9,17 +9,24 @@
 #include "Core/PCGExPathfinding.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExSearchAllocations.h"
+#include "Containers/PCGExBufferPool.h"
 #include "Utils/PCGExScoredQueue.h"
 
 namespace PCGExPathfinding
 {
+	FBidirectionalSearchAllocations::~FBidirectionalSearchAllocations()
+	{
+		PCGEx::FBufferPool::Get().Release(GScoreBackward);
+	}
+
 	void FBidirectionalSearchAllocations::Init(const PCGExClusters::FCluster* InCluster)
 	{
 		FSearchAllocations::Init(InCluster);
 
-		GScore.Init(-1, NumNodes);
+		PCGEx::FBufferPool& Pool = PCGEx::FBufferPool::Get();
+		Pool.Init(GScore, -1.0, NumNodes);
 		VisitedBackward.Init(false, NumNodes);
-		GScoreBackward.Init(-1, NumNodes);
+		Pool.Init(GScoreBackward, -1.0, NumNodes);
 		TravelStackBackward = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
 		ScoredQueueBackward = MakeShared<PCGEx::FScoredQueue>(NumNodes);
 	}
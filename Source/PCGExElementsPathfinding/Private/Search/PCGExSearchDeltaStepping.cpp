@@ -0,0 +1,337 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Search/PCGExSearchDeltaStepping.h"
+
+#include "PCGExH.h"
+#include "PCGExHeuristicsHandler.h"
+#include "Algo/Unique.h"
+#include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExHashLookup.h"
+#include "Core/PCGExMTCommon.h"
+#include "Core/PCGExPathfinding.h"
+#include "Core/PCGExPathQuery.h"
+#include "Core/PCGExSearchAllocations.h"
+
+namespace PCGExDeltaStepping
+{
+	constexpr int32 RelaxChunkSize = 1024;
+	constexpr double MaxBucketSpan = 65536;
+
+	FORCEINLINE static bool AtomicMin(std::atomic<double>& Target, const double Value)
+	{
+		double Current = Target.load(std::memory_order_relaxed);
+		while (Value < Current)
+		{
+			if (Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed)) { return true; }
+		}
+		return false;
+	}
+}
+
+void FPCGExSearchOperationDeltaStepping::PrepareForCluster(PCGExClusters::FCluster* InCluster)
+{
+	FPCGExSearchOperationDijkstra::PrepareForCluster(InCluster);
+
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+
+	LinkOffsets.SetNumUninitialized(NodesRef.Num() + 1);
+	int32 Offset = 0;
+	for (int i = 0; i < NodesRef.Num(); i++)
+	{
+		LinkOffsets[i] = Offset;
+		Offset += NodesRef[i].Links.Num();
+	}
+	LinkOffsets[NodesRef.Num()] = Offset;
+
+	FWriteScopeLock WriteScopeLock(WeightsLock);
+	LinkWeights.Empty();
+	WeightsOwner = nullptr;
+	bValidWeights = false;
+}
+
+bool FPCGExSearchOperationDeltaStepping::PrepareWeights(const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics, const PCGExClusters::FNode& SeedNode, const PCGExClusters::FNode& GoalNode) const
+{
+	{
+		FReadScopeLock ReadScopeLock(WeightsLock);
+		if (WeightsOwner == Heuristics.Get()) { return bValidWeights; }
+	}
+
+	FWriteScopeLock WriteScopeLock(WeightsLock);
+	if (WeightsOwner == Heuristics.Get()) { return bValidWeights; }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationDeltaStepping::PrepareWeights);
+
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+	const int32 NumNodes = NodesRef.Num();
+
+	// Edge scores are goal-independent at this point, seed & goal are only passed along for API compliance
+	LinkWeights.SetNumUninitialized(LinkOffsets[NumNodes]);
+	PCGEX_PARALLEL_FOR(
+		NumNodes,
+		const PCGExClusters::FNode& Node = NodesRef[i];
+		double* Weights = LinkWeights.GetData() + LinkOffsets[i];
+		for (int l = 0; l < Node.Links.Num(); l++)
+		{
+			const PCGExGraphs::FLink Lk = Node.Links[l];
+			Weights[l] = Heuristics->GetEdgeScore(Node, NodesRef[Lk.Node], EdgesRef[Lk.Edge], SeedNode, GoalNode, nullptr, nullptr);
+		}
+	)
+
+	WeightsOwner = Heuristics.Get();
+	bValidWeights = !LinkWeights.IsEmpty();
+
+	double Sum = 0;
+	double MinPositive = MAX_dbl;
+	double MaxWeight = 0;
+	for (const double W : LinkWeights)
+	{
+		if (W < 0 || !FMath::IsFinite(W))
+		{
+			// Negative or infinite scores break bucket ordering
+			bValidWeights = false;
+			break;
+		}
+
+		Sum += W;
+		MaxWeight = FMath::Max(MaxWeight, W);
+		if (W > 0) { MinPositive = FMath::Min(MinPositive, W); }
+	}
+
+	if (!bValidWeights) { return false; }
+
+	if (bAutoBucketWidth)
+	{
+		// Average edge score is a good balance between the number of buckets and re-relaxations within a bucket
+		LightWeightThreshold = Sum / LinkWeights.Num();
+		if (LightWeightThreshold <= 0) { LightWeightThreshold = MinPositive == MAX_dbl ? 1 : MinPositive; }
+	}
+	else
+	{
+		LightWeightThreshold = BucketWidth;
+	}
+
+	// Pending nodes never sit further than the heaviest edge past the current bucket, so buckets are reused cyclically.
+	// Bucket width is clamped so that window stays small no matter how narrow the requested width is.
+	LightWeightThreshold = FMath::Max3(LightWeightThreshold, MaxWeight / PCGExDeltaStepping::MaxBucketSpan, UE_DOUBLE_KINDA_SMALL_NUMBER);
+	NumBuckets = FMath::FloorToInt32(MaxWeight / LightWeightThreshold) + 2;
+
+	return true;
+}
+
+bool FPCGExSearchOperationDeltaStepping::ResolveQuery(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+	const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const
+{
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
+	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
+
+	const int32 NumNodes = NodesRef.Num();
+
+	if (NumNodes < MinNodes || LocalFeedback ||
+		!Heuristics->HasGoalIndependentEdgeScores() || Heuristics->HasTravelDependentOperations() ||
+		!PrepareWeights(Heuristics, SeedNode, GoalNode))
+	{
+		++NumDeferredQueries;
+		return FPCGExSearchOperationDijkstra::ResolveQuery(InQuery, Allocations, Heuristics, LocalFeedback);
+	}
+
+	TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = Allocations;
+	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
+	else { LocalAllocations->Reset(); }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationDeltaStepping::FindPath);
+
+	const double Delta = LightWeightThreshold;
+	const double InvDelta = 1 / Delta;
+
+	TArray<std::atomic<double>>& Distances = LocalAllocations->SharedGScore;
+
+	// Distance at which a node last relaxed its light edges, so stale or duplicate bucket entries are skipped.
+	// Relaxations read it rather than the live distance, so what a phase computes doesn't depend on thread timing.
+	TArray<double>& RelaxedAt = LocalAllocations->RelaxedGScore;
+
+	// Light phase during which a node last relaxed, orders the walk back across equally distant nodes
+	TArray<int32>& RelaxedPhase = LocalAllocations->RelaxedPhase;
+
+	if (Distances.Num() != NumNodes)
+	{
+		Distances.SetNum(NumNodes);
+		RelaxedAt.SetNumUninitialized(NumNodes);
+		RelaxedPhase.SetNumUninitialized(NumNodes);
+	}
+
+	PCGEX_PARALLEL_FOR(
+		NumNodes,
+		Distances[i].store(MAX_dbl, std::memory_order_relaxed);
+		RelaxedAt[i] = MAX_dbl;
+		RelaxedPhase[i] = MAX_int32;
+	)
+
+	// Cyclic buckets, bucket ids are 64 bits since long paths over narrow buckets overflow 32 bits
+	TArray<TArray<int32>> Buckets;
+	Buckets.SetNum(NumBuckets);
+	int32 NumPending = 0;
+
+	auto GetBucketId = [&](const double Distance) { return FMath::FloorToInt64(Distance * InvDelta); };
+	auto AddToBucket = [&](const int32 NodeIndex)
+	{
+		Buckets[static_cast<int32>(GetBucketId(Distances[NodeIndex].load(std::memory_order_relaxed)) % NumBuckets)].Add(NodeIndex);
+		NumPending++;
+	};
+
+	// Relax either light or heavy links of the given nodes in parallel, then bucket improved nodes in a deterministic order
+	TArray<TArray<int32>> ChunkImproved;
+	auto Relax = [&](const TArray<int32>& InNodes, const bool bLight)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(InNodes.Num(), PCGExDeltaStepping::RelaxChunkSize);
+		ChunkImproved.SetNum(NumChunks, EAllowShrinking::No);
+
+		PCGEX_PARALLEL_FOR_THRESHOLD(
+			NumChunks, 2,
+			TArray<int32>& Improved = ChunkImproved[i];
+			Improved.Reset();
+
+			const int32 Start = i * PCGExDeltaStepping::RelaxChunkSize;
+			const int32 End = FMath::Min(Start + PCGExDeltaStepping::RelaxChunkSize, InNodes.Num());
+
+			for (int32 n = Start; n < End; n++)
+			{
+				const int32 NodeIndex = InNodes[n];
+				const double NodeDistance = RelaxedAt[NodeIndex];
+				const PCGExClusters::FNode& Node = NodesRef[NodeIndex];
+				const double* Weights = LinkWeights.GetData() + LinkOffsets[NodeIndex];
+
+				for (int l = 0; l < Node.Links.Num(); l++)
+				{
+					const double W = Weights[l];
+					if ((W <= Delta) != bLight) { continue; }
+
+					const int32 NeighborIndex = Node.Links[l].Node;
+					if (PCGExDeltaStepping::AtomicMin(Distances[NeighborIndex], NodeDistance + W)) { Improved.Add(NeighborIndex); }
+				}
+			}
+		)
+
+		for (int32 c = 0; c < NumChunks; c++) { for (const int32 NodeIndex : ChunkImproved[c]) { AddToBucket(NodeIndex); } }
+	};
+
+	Distances[SeedNode.Index].store(0, std::memory_order_relaxed);
+	AddToBucket(SeedNode.Index);
+
+	TArray<int32> Frontier;
+	TArray<int32> Settled;
+	int32 Phase = 0;
+
+	for (int64 CurrentBucket = 0; NumPending > 0; CurrentBucket++)
+	{
+		TArray<int32>& Bucket = Buckets[static_cast<int32>(CurrentBucket % NumBuckets)];
+		if (Bucket.IsEmpty()) { continue; }
+
+		// Every node left has a distance >= CurrentBucket * Delta, goal distance is final
+		if (bEarlyExit && Distances[GoalNode.Index].load(std::memory_order_relaxed) < CurrentBucket * Delta) { break; }
+
+		Settled.Reset();
+
+		while (!Bucket.IsEmpty())
+		{
+			Frontier = MoveTemp(Bucket);
+			Bucket.Reset();
+			NumPending -= Frontier.Num();
+
+			Frontier.Sort();
+
+			int32 WriteIndex = 0;
+			for (int32 i = 0; i < Frontier.Num(); i++)
+			{
+				const int32 NodeIndex = Frontier[i];
+				if (i > 0 && Frontier[i - 1] == NodeIndex) { continue; }
+
+				// Entries left behind by a later improvement are skipped
+				const double NodeDistance = Distances[NodeIndex].load(std::memory_order_relaxed);
+				if (NodeDistance >= RelaxedAt[NodeIndex] || GetBucketId(NodeDistance) != CurrentBucket) { continue; }
+
+				RelaxedAt[NodeIndex] = NodeDistance;
+				RelaxedPhase[NodeIndex] = Phase;
+				Frontier[WriteIndex++] = NodeIndex;
+			}
+			Frontier.SetNum(WriteIndex, EAllowShrinking::No);
+
+			if (Frontier.IsEmpty()) { break; }
+
+			Settled.Append(Frontier);
+			Relax(Frontier, true);
+			Phase++;
+		}
+
+		if (Settled.IsEmpty()) { continue; }
+
+		// Heavy links always land in later buckets, relax them once per settled node
+		Settled.Sort();
+		Settled.SetNum(Algo::Unique(Settled), EAllowShrinking::No);
+		Relax(Settled, false);
+	}
+
+	const double GoalDistance = Distances[GoalNode.Index].load(std::memory_order_relaxed);
+	if (GoalDistance == MAX_dbl) { return false; }
+
+	// Distances are the exact same sums Dijkstra computes, and Dijkstra keeps the first node that reached a neighbor's final distance,
+	// i.e. the closest of its tight links (Distance[From] + Score == Distance[To]). Walk back from goal along that link, breaking ties
+	// on the lowest node index so equally short paths resolve the same way no matter the bucket width or thread count.
+	// A tight link between equally distant nodes (zero score) is only followed toward a node that relaxed in an earlier phase;
+	// every step then gets strictly closer to the seed, or stays as close but earlier, so the walk can't loop.
+
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
+
+	int32 ToIndex = GoalNode.Index;
+	while (ToIndex != SeedNode.Index)
+	{
+		const PCGExClusters::FNode& To = NodesRef[ToIndex];
+		const double ToDistance = Distances[ToIndex].load(std::memory_order_relaxed);
+		const double Tolerance = FMath::Max(1.0, ToDistance) * UE_DOUBLE_SMALL_NUMBER;
+
+		int32 PrevIndex = -1;
+		int32 PrevEdge = -1;
+		double PrevDistance = MAX_dbl;
+
+		for (const PCGExGraphs::FLink Lk : To.Links)
+		{
+			const double FromDistance = Distances[Lk.Node].load(std::memory_order_relaxed);
+			if (FromDistance == MAX_dbl || FromDistance > ToDistance) { continue; }
+			if (FromDistance == ToDistance && RelaxedPhase[Lk.Node] >= RelaxedPhase[ToIndex]) { continue; }
+			if (FromDistance > PrevDistance || (FromDistance == PrevDistance && Lk.Node > PrevIndex)) { continue; }
+
+			const double Score = Heuristics->GetEdgeScore(NodesRef[Lk.Node], To, EdgesRef[Lk.Edge], SeedNode, GoalNode, nullptr, nullptr);
+			if (FMath::Abs(FromDistance + Score - ToDistance) > Tolerance) { continue; }
+
+			PrevIndex = Lk.Node;
+			PrevEdge = Lk.Edge;
+			PrevDistance = FromDistance;
+		}
+
+		if (PrevIndex == -1) { return false; }
+
+		TravelStack->Set(ToIndex, PCGEx::NH64(PrevIndex, PrevEdge));
+		ToIndex = PrevIndex;
+	}
+
+	return InQuery->AddPathFromTravelStack(TravelStack);
+}
+
+void UPCGExSearchDeltaStepping::CopySettingsFrom(const UPCGExInstancedFactory* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchDeltaStepping* TypedOther = Cast<UPCGExSearchDeltaStepping>(Other))
+	{
+		bAutoBucketWidth = TypedOther->bAutoBucketWidth;
+		BucketWidth = TypedOther->BucketWidth;
+		MinNodes = TypedOther->MinNodes;
+	}
+}
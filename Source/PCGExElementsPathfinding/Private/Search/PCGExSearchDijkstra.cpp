@@ -100,3 +100,78 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 	return bSuccess;
 }
+
+void FPCGExSearchOperationDijkstra::ResolveSharedSeedQueries(
+	const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const
+{
+	if (InQueries.IsEmpty()) { return; }
+
+	TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = Allocations;
+	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
+	else { LocalAllocations->Reset(); }
+
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExClusters::FNode& SeedNode = *InQueries[0]->Seed.Node;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindSharedSeedPaths);
+
+	// Flag goals so the exploration can stop as soon as all of them are settled.
+	// Edge scores are goal-independent, so the shortest-path tree is the same one each query would have built on its own.
+
+	TBitArray<> PendingGoals;
+	PendingGoals.Init(false, NodesRef.Num());
+
+	int32 NumPendingGoals = 0;
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		const int32 GoalIndex = Query->Goal.Node->Index;
+		if (PendingGoals[GoalIndex]) { continue; }
+		PendingGoals[GoalIndex] = true;
+		NumPendingGoals++;
+	}
+
+	TBitArray<>& Visited = LocalAllocations->Visited;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
+	const TSharedPtr<PCGEx::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
+	ScoredQueue->Enqueue(SeedNode.Index, 0);
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		if (PendingGoals[CurrentNodeIndex])
+		{
+			PendingGoals[CurrentNodeIndex] = false;
+			if (--NumPendingGoals == 0) { break; } // All goals settled
+		}
+
+		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		if (Visited[CurrentNodeIndex]) { continue; }
+		Visited[CurrentNodeIndex] = true;
+
+		for (const PCGExGraphs::FLink Lk : Current.Links)
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			if (Visited[NeighborIndex]) { continue; }
+
+			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
+
+			// Goal is irrelevant to edge scores here, seed is passed in its place
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, SeedNode, nullptr, TravelStack);
+			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
+			{
+				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			}
+		}
+	}
+
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries) { Query->AddPathFromTravelStack(TravelStack); }
+}
@@ -19,6 +19,14 @@ bool FPCGExSearchOperation::ResolveQuery(
 	return false;
 }
 
+void FPCGExSearchOperation::ResolveSharedSeedQueries(
+	const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const
+{
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries) { ResolveQuery(Query, Allocations, Heuristics); }
+}
+
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperation::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FSearchAllocations>();
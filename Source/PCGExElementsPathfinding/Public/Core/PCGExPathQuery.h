@@ -30,6 +30,11 @@ namespace PCGExHeuristics
 	class FLocalFeedbackHandler;
 }
 
+namespace PCGEx
+{
+	class FHashLookup;
+}
+
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
@@ -66,6 +71,9 @@ namespace PCGExPathfinding
 		void AddPathNode(const int32 InNodeIndex, const int32 InEdgeIndex = -1);
 		void SetResolution(const EPathfindingResolution InResolution);
 
+		/** Walk back from the goal through a resolved travel stack, adding path nodes in reverse order. */
+		bool AddPathFromTravelStack(const TSharedPtr<PCGEx::FHashLookup>& TravelStack);
+
 		void FindPath(
 			const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
 			const TSharedPtr<FSearchAllocations>& Allocations,
@@ -78,4 +86,14 @@ namespace PCGExPathfinding
 
 		void Cleanup();
 	};
+
+	/**
+	 * Resolve a group of queries sharing the same seed node with a single exploration when the search supports it.
+	 * Only valid when heuristics edge scores are goal-independent (see FHandler::HasGoalIndependentEdgeScores).
+	 */
+	PCGEXELEMENTSPATHFINDING_API void FindSharedSeedPaths(
+		const TArrayView<const TSharedPtr<FPathQuery>> InQueries,
+		const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
+		const TSharedPtr<FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler);
 }
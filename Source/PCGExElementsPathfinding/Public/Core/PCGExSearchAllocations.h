@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include "CoreMinimal.h"
 
+class FPCGExSearchOperation;
+
 namespace PCGExClusters
 {
 	class FCluster;
@@ -25,13 +28,33 @@ namespace PCGExPathfinding
 
 	public:
 		FSearchAllocations() = default;
+		virtual ~FSearchAllocations();
 
 		TBitArray<> Visited;
 		TArray<double> GScore;
 		TSharedPtr<PCGEx::FHashLookup> TravelStack;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueue;
 
+		// Parallel relaxation state (delta-stepping), sized on first use and reset by the search itself
+		TArray<std::atomic<double>> SharedGScore;
+		TArray<double> RelaxedGScore;
+		TArray<int32> RelaxedPhase;
+
 		void Init(const PCGExClusters::FCluster* InCluster);
 		void Reset();
 	};
+
+	/** Thread-safe pool of search allocations, so parallel searches on the same cluster don't each allocate their own buffers. */
+	class PCGEXELEMENTSPATHFINDING_API FSearchAllocationsPool : public TSharedFromThis<FSearchAllocationsPool>
+	{
+	protected:
+		FCriticalSection PoolLock;
+		TArray<TSharedPtr<FSearchAllocations>> Available;
+
+	public:
+		FSearchAllocationsPool() = default;
+
+		TSharedPtr<FSearchAllocations> Acquire(const FPCGExSearchOperation* InSearchOperation);
+		void Release(const TSharedPtr<FSearchAllocations>& InAllocations);
+	};
 }
@@ -14,6 +14,7 @@
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
+	class FSearchAllocationsPool;
 	class FPathQuery;
 }
 
@@ -114,6 +115,10 @@ public:
 	/** If disabled, will share memory allocations between queries, forcing them to execute one after another. Much slower, but very conservative for memory.  Using global feedback forces this behavior under the hood.*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bGreedyQueries = true;
+
+	/** If enabled, queries sharing the same seed are resolved from a single exploration when the search algorithm supports it and heuristics edge scores don't depend on the goal (i.e no feedback or azimuth). Results are identical. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bShareSeedSearches = true;
 };
 
 struct FPCGExPathfindingEdgesContext final : FPCGExClustersProcessorContext
@@ -136,6 +141,8 @@ struct FPCGExPathfindingEdgesContext final : FPCGExClustersProcessorContext
 
 	TArray<uint64> SeedGoalPairs;
 
+	std::atomic<int32> NumSavedSearches{0};
+
 	void BuildPath(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query, const TSharedPtr<PCGExData::FPointIO>& PathIO);
 
 protected:
@@ -159,6 +166,11 @@ namespace PCGExPathfindingEdges
 		TArray<TSharedPtr<PCGExData::FPointIO>> QueriesIO;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
 
+		bool bShareSeedSearches = false;
+		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> QueriesBySeed;
+		TArray<PCGExMT::FScope> SeedGroups;
+		TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> AllocationsPool;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -172,5 +184,10 @@ namespace PCGExPathfindingEdges
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
+		virtual void OnRangeProcessingComplete() override;
+
+	protected:
+		void ProcessSeedGroups(const PCGExMT::FScope& Scope);
+		void OutputQuery(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query);
 	};
 }
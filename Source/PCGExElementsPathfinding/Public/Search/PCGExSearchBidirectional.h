@@ -34,6 +34,8 @@ namespace PCGExPathfinding
 		TSharedPtr<PCGEx::FHashLookup> TravelStackBackward;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueueBackward;
 
+		virtual ~FBidirectionalSearchAllocations() override;
+
 		void Init(const PCGExClusters::FCluster* InCluster);
 		void Reset();
 	};
@@ -0,0 +1,85 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+#include "CoreMinimal.h"
+#include "PCGExSearchDijkstra.h"
+#include "Factories/PCGExFactoryData.h"
+#include "UObject/Object.h"
+#include "PCGExSearchDeltaStepping.generated.h"
+
+/**
+ * Delta-stepping search operation.
+ * Distances are bucketed by a fixed width and every bucket is relaxed in parallel; the resulting distances match Dijkstra's.
+ * The path is walked back along the closest tight link of each node, which is the one Dijkstra keeps; equally close links resolve to the lowest node index.
+ * Falls back to Dijkstra on small clusters, or when edge scores depend on the goal, the path history or feedback.
+ */
+class FPCGExSearchOperationDeltaStepping : public FPCGExSearchOperationDijkstra
+{
+public:
+	bool bAutoBucketWidth = true;
+	double BucketWidth = 1;
+	int32 MinNodes = 50000;
+
+	// Queries handed over to Dijkstra so far
+	mutable std::atomic<int32> NumDeferredQueries{0};
+
+	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster) override;
+
+	virtual bool ResolveQuery(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+
+	// Shared seed queries would build a single Dijkstra tree, skipping the parallel relaxation entirely
+	virtual bool SupportsSharedSeedQueries() const override { return false; }
+
+protected:
+	// Flat, per-link edge scores (CSR layout, indexed by LinkOffsets[Node] + link index)
+	TArray<int32> LinkOffsets;
+
+	mutable FRWLock WeightsLock;
+	mutable TArray<double> LinkWeights;
+	mutable const PCGExHeuristics::FHandler* WeightsOwner = nullptr;
+	mutable double LightWeightThreshold = 0;
+	mutable int32 NumBuckets = 0;
+	mutable bool bValidWeights = false;
+
+	bool PrepareWeights(const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics, const PCGExClusters::FNode& SeedNode, const PCGExClusters::FNode& GoalNode) const;
+};
+
+/**
+ * 
+ */
+UCLASS(MinimalAPI, meta=(DisplayName = "Delta-Stepping", ToolTip ="Parallel delta-stepping search. Same paths as Dijkstra, but relaxes many nodes at once. Meant for very large clusters.", PCGExNodeLibraryDoc="pathfinding/algorithms/search-delta-stepping"))
+class UPCGExSearchDeltaStepping : public UPCGExSearchInstancedFactory
+{
+	GENERATED_BODY()
+
+public:
+	/** If enabled, bucket width is derived from the cluster's edge scores. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	bool bAutoBucketWidth = true;
+
+	/** Width of a distance bucket, in edge score units. Smaller values expose less parallelism, larger values waste more relaxations. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="!bAutoBucketWidth", ClampMin=0.0001))
+	double BucketWidth = 1;
+
+	/** Clusters with fewer nodes than this are searched using regular Dijkstra. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0))
+	int32 MinNodes = 50000;
+
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
+	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
+	{
+		PCGEX_FACTORY_NEW_OPERATION(SearchOperationDeltaStepping)
+		NewOperation->bAutoBucketWidth = bAutoBucketWidth;
+		NewOperation->BucketWidth = BucketWidth;
+		NewOperation->MinNodes = MinNodes;
+		return NewOperation;
+	}
+};
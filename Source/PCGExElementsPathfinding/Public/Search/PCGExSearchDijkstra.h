@@ -19,6 +19,13 @@ public:
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+
+	virtual bool SupportsSharedSeedQueries() const override { return true; }
+
+	virtual void ResolveSharedSeedQueries(
+		const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const override;
 };
 
 /**
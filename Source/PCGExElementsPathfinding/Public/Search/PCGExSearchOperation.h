@@ -45,6 +45,18 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
 
+	/** Whether this search can resolve a group of queries sharing the same seed node from a single exploration. */
+	virtual bool SupportsSharedSeedQueries() const { return false; }
+
+	/**
+	 * Resolve a group of queries that all share the same seed node.
+	 * Default implementation resolves queries one after another.
+	 */
+	virtual void ResolveSharedSeedQueries(
+		const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const;
+
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const;
 };
 
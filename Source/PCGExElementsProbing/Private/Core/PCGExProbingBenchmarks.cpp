@@ -0,0 +1,79 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExOctree.h"
+#include "Core/PCGExBenchmark.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExDataBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+#include "Probes/PCGExGlobalProbeTheta.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Global probe throughput, e.g. pcgex.Bench.Run Filter=Probing.* Scales=10000+100000
+namespace PCGExProbing
+{
+	namespace Benchmark
+	{
+		constexpr double Extent = 10000;
+
+		// Members are released in reverse order, the context goes last
+		struct FScene
+		{
+			TSharedPtr<PCGExData::Benchmark::FContextFixture> Fixture;
+			TSharedPtr<PCGExData::FFacade> Facade;
+			TArray<FVector> Positions;
+			TArray<int8> CanGenerate;
+			TArray<int8> AcceptConnections;
+			TUniquePtr<PCGExOctree::FItemOctree> Octree;
+			TSharedPtr<FPCGExProbeOperation> Operation;
+		};
+
+		// Flat point cloud, search radius catching ~32 neighbors per point, same octree the connect points element builds
+		template <bool bYao>
+		static PCGExBenchmark::FKernel MakeThetaKernel(const int32 Scale)
+		{
+			if (Scale < 2) { return nullptr; }
+
+			TSharedPtr<FScene> Scene = MakeShared<FScene>();
+			Scene->Fixture = MakeShared<PCGExData::Benchmark::FContextFixture>();
+
+			PCGExBenchmark::MakePositions(Scene->Positions, Scale, false, Extent);
+			const TSharedPtr<PCGExData::FPointIO> PointIO = Scene->Fixture->MakePointIO(Scene->Fixture->MakePointData(Scene->Positions));
+			if (!PointIO) { return nullptr; }
+
+			Scene->Facade = MakeShared<PCGExData::FFacade>(PointIO.ToSharedRef());
+			Scene->CanGenerate.Init(1, Scale);
+			Scene->AcceptConnections.Init(1, Scale);
+
+			const FBox Bounds(Scene->Positions);
+			Scene->Octree = MakeUnique<PCGExOctree::FItemOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length());
+			for (int32 i = 0; i < Scale; i++) { Scene->Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(Scene->Positions[i], FVector::ZeroVector, 0))); }
+
+			const TStrongObjectPtr<UPCGExProbeFactoryTheta> Factory(NewObject<UPCGExProbeFactoryTheta>());
+			Factory->Config.bUseYaoVariant = bYao;
+			Factory->Config.SearchRadiusConstant = Extent * FMath::Sqrt(32 / (PI * Scale));
+
+			Scene->Operation = Factory->CreateOperation(Scene->Fixture->Get());
+			Scene->Operation->PrimaryDataFacade = Scene->Facade;
+			Scene->Operation->WorkingPositions = &Scene->Positions;
+			Scene->Operation->CanGenerate = &Scene->CanGenerate;
+			Scene->Operation->AcceptConnections = &Scene->AcceptConnections;
+			Scene->Operation->Octree = Scene->Octree.Get();
+			if (!Scene->Operation->Prepare(Scene->Fixture->Get())) { return nullptr; }
+
+			return [Scene]()
+			{
+				TSet<uint64> Edges;
+				Scene->Operation->ProcessAll(Edges);
+			};
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchTheta(TEXT("Probing.Theta"), TEXT("Theta graph over N flat points, 6 cones, ~32 points within the search radius"), &Benchmark::MakeThetaKernel<false>);
+	static PCGExBenchmark::FRegistrar BenchYao(TEXT("Probing.Yao"), TEXT("Yao graph over N flat points, 6 cones, ~32 points within the search radius"), &Benchmark::MakeThetaKernel<true>);
+}
+
+#endif
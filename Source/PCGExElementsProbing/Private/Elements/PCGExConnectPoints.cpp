@@ -178,8 +178,6 @@ namespace PCGExConnectPoints
 		NumDirectOps = DirectOperations.Num();
 		NumGlobalOps = GlobalOperations.Num();
 
-		if (!RadiusSources.IsEmpty()) { bWantsOctree = true; }
-
 		bOnlyGlobalOps = RadiusSources.IsEmpty() && DirectOperations.IsEmpty();
 
 		if (bOnlyGlobalOps && GlobalOperations.IsEmpty()) { return false; }
@@ -203,7 +201,7 @@ namespace PCGExConnectPoints
 
 		if (bWantsOctree)
 		{
-			// If we have search probes, build the octree
+			// Some global probes query the octree directly
 			const FBox B = PointDataFacade->GetIn()->GetBounds();
 			Octree = MakeUnique<PCGExOctree::FItemOctree>(bUseProjection ? ProjectionDetails.ProjectFlat(B.GetCenter()) : B.GetCenter(), B.GetExtent().Length());
 		}
@@ -253,26 +251,26 @@ namespace PCGExConnectPoints
 			WorkingPositions[i] = OriginalTransforms[i].GetLocation();
 			})
 
-		if (bWantsOctree)
-		{
-			constexpr double PPRefRadius = 0.05;
-			const FVector PPRefExtents = FVector(PPRefRadius);
+		constexpr double PPRefRadius = 0.05;
+		const FVector PPRefExtents = FVector(PPRefRadius);
 
-			if (bUseProjection)
-			{
-				for (int i = 0; i < NumPoints; i++)
+		if (!RadiusSources.IsEmpty())
+		{
+			RadiusBVH.Build(
+				NumPoints, [&](const int32 Index, FBox& OutBounds)
 				{
-					if (!AcceptConnections[i]) { continue; }
-					Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(WorkingPositions[i], PPRefExtents, PPRefRadius)));
-				}
-			}
-			else
+					if (!AcceptConnections[Index]) { return false; }
+					OutBounds = FBox(WorkingPositions[Index] - PPRefExtents, WorkingPositions[Index] + PPRefExtents);
+					return true;
+				});
+		}
+
+		if (bWantsOctree)
+		{
+			for (int i = 0; i < NumPoints; i++)
 			{
-				for (int i = 0; i < NumPoints; i++)
-				{
-					if (!AcceptConnections[i]) { continue; }
-					Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(WorkingPositions[i], PPRefExtents, PPRefRadius)));
-				}
+				if (!AcceptConnections[i]) { continue; }
+				Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(WorkingPositions[i], PPRefExtents, PPRefRadius)));
 			}
 
 			for (const TSharedPtr<FPCGExProbeOperation>& Operation : AllOperations) { Operation->Octree = Octree.Get(); }
@@ -343,9 +341,8 @@ namespace PCGExConnectPoints
 		FVector Origin = FVector::ZeroVector;
 		int32 CurrentIndex = 0;
 
-		auto ProcessPoint = [&](const PCGExOctree::FItem& InPositionRef)
+		auto ProcessPoint = [&](const int32 OtherPointIndex)
 		{
-			const int32 OtherPointIndex = InPositionRef.Index;
 			if (OtherPointIndex == CurrentIndex) { return; }
 
 			const FVector Position = WorkingPositions[OtherPointIndex];
@@ -396,7 +393,7 @@ namespace PCGExConnectPoints
 				Origin = WorkingPositions[Index];
 
 				// Find candidates within radius
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
+				RadiusBVH.FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
 				Candidates.Sort([&](const PCGExProbing::FCandidate& A, const PCGExProbing::FCandidate& B) { return A.Distance < B.Distance; });
 
 				for (int i = 0; i < NumChainedOps; i++)
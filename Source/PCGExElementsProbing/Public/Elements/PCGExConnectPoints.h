@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExBVH.h"
 #include "PCGExOctree.h"
 #include "Clusters/PCGExClusterCommon.h"
 #include "Core/PCGExPointsProcessor.h"
@@ -127,7 +128,8 @@ namespace PCGExConnectPoints
 
 		TArray<int8> CanGenerate;
 		TArray<int8> AcceptConnections;
-		TUniquePtr<PCGExOctree::FItemOctree> Octree;
+		TUniquePtr<PCGExOctree::FItemOctree> Octree;       // Only for probes that query it themselves
+		PCGExBVH::FItemBVH RadiusBVH;                       // Radius candidates lookup
 
 		TArray<FTransform> WorkingTransforms;
 		TArray<FVector> WorkingPositions;
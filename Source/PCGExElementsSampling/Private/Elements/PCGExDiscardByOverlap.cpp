@@ -72,11 +72,39 @@ TSharedPtr<PCGExDiscardByOverlap::FOverlap> FPCGExDiscardByOverlapContext::Regis
 	}
 }
 
-void FPCGExDiscardByOverlapContext::UpdateScores(const TArray<PCGExDiscardByOverlap::FProcessor*>& InStack)
+const PCGExOctree::FItemOctree* FPCGExDiscardByOverlapContext::GetDatasetOctree(const TSharedPtr<PCGExPointsMT::IBatch>& InBatch)
 {
-	MaxScores.ResetMin();
-	for (const PCGExDiscardByOverlap::FProcessor* C : InStack) { MaxScores.Max(C->RawScores); }
-	for (PCGExDiscardByOverlap::FProcessor* C : InStack) { C->UpdateWeight(MaxScores); }
+	{
+		FReadScopeLock ReadScopeLock(DatasetLock);
+		if (DatasetOctree) { return DatasetOctree.Get(); }
+	}
+
+	FWriteScopeLock WriteScopeLock(DatasetLock);
+	if (DatasetOctree) { return DatasetOctree.Get(); }
+
+	const TArray<TSharedRef<PCGExData::FFacade>>& ProcessorFacades = InBatch->ProcessorFacades;
+	AllProcessors.Init(nullptr, ProcessorFacades.Num());
+
+	// Invalid bounds still go in as-is, they used to be tested like any other
+	FBox OctreeBounds(ForceInit);
+	for (int i = 0; i < ProcessorFacades.Num(); i++)
+	{
+		const TSharedRef<PCGExPointsMT::IProcessor>* Processor = InBatch->SubProcessorMap->Find(&ProcessorFacades[i]->Source.Get());
+		if (!Processor) { continue; }
+
+		AllProcessors[i] = static_cast<PCGExDiscardByOverlap::FProcessor*>(&Processor->Get());
+		OctreeBounds += AllProcessors[i]->GetBounds().Min;
+		OctreeBounds += AllProcessors[i]->GetBounds().Max;
+	}
+
+	DatasetOctree = MakeUnique<PCGExOctree::FItemOctree>(OctreeBounds.GetCenter(), OctreeBounds.GetExtent().Length() + 1);
+	for (int i = 0; i < AllProcessors.Num(); i++)
+	{
+		if (!AllProcessors[i]) { continue; }
+		DatasetOctree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(AllProcessors[i]->GetBounds())));
+	}
+
+	return DatasetOctree.Get();
 }
 
 void FPCGExDiscardByOverlapContext::Prune()
@@ -94,33 +122,17 @@ void FPCGExDiscardByOverlapContext::Prune()
 		else { PCGEX_INIT_IO_VOID(P->PointDataFacade->Source, PCGExData::EIOInit::Forward) }
 	}
 
-	UpdateScores(OverlapsStack);
+	PCGExDiscardByOverlap::FPruneQueue Queue(this, Settings->Logic);
+	Queue.Init(OverlapsStack);
 
-	while (!OverlapsStack.IsEmpty())
+	while (!Queue.IsEmpty())
 	{
-		// Sort remaining overlaps...
+		PCGExDiscardByOverlap::FProcessor* Candidate = Queue.Pop();
 
-		if (Settings->Logic == EPCGExOverlapPruningLogic::LowFirst)
-		{
-			OverlapsStack.Sort([](const PCGExDiscardByOverlap::FProcessor& A, const PCGExDiscardByOverlap::FProcessor& B)
-			{
-				return A.Weight == B.Weight ? A.PointDataFacade->Source->IOIndex > B.PointDataFacade->Source->IOIndex : A.Weight > B.Weight;
-			});
-		}
-		else
-		{
-			OverlapsStack.Sort([](const PCGExDiscardByOverlap::FProcessor& A, const PCGExDiscardByOverlap::FProcessor& B)
-			{
-				return A.Weight == B.Weight ? A.PointDataFacade->Source->IOIndex > B.PointDataFacade->Source->IOIndex : A.Weight < B.Weight;
-			});
-		}
-
-		PCGExDiscardByOverlap::FProcessor* Candidate = OverlapsStack.Pop();
-
-		if (Candidate->HasOverlaps()) { Candidate->Pruned(OverlapsStack); }
+		if (Candidate->HasOverlaps()) { Candidate->Pruned(Queue); }
 		else { PCGEX_INIT_IO_VOID(Candidate->PointDataFacade->Source, PCGExData::EIOInit::Forward) }
 
-		UpdateScores(OverlapsStack);
+		Queue.Refresh();
 	}
 }
 
@@ -184,6 +196,203 @@ bool FPCGExDiscardByOverlapElement::AdvanceWork(FPCGExContext* InContext, const
 
 namespace PCGExDiscardByOverlap
 {
+	namespace Scores
+	{
+		static double FPCGExOverlapScoresWeighting::* const Fields[FPruneQueue::NumScores] = {
+			&FPCGExOverlapScoresWeighting::OverlapCount,
+			&FPCGExOverlapScoresWeighting::OverlapSubCount,
+			&FPCGExOverlapScoresWeighting::OverlapVolume,
+			&FPCGExOverlapScoresWeighting::OverlapVolumeDensity,
+			&FPCGExOverlapScoresWeighting::NumPoints,
+			&FPCGExOverlapScoresWeighting::Volume,
+			&FPCGExOverlapScoresWeighting::VolumeDensity,
+			&FPCGExOverlapScoresWeighting::CustomTagScore,
+			&FPCGExOverlapScoresWeighting::DataScore
+		};
+	}
+
+	FPruneQueue::FPruneQueue(FPCGExDiscardByOverlapContext* InContext, const EPCGExOverlapPruningLogic InLogic)
+		: Context(InContext), bLowFirst(InLogic == EPCGExOverlapPruningLogic::LowFirst)
+	{
+	}
+
+	void FPruneQueue::Init(const TArray<FProcessor*>& InProcessors)
+	{
+		Heap = InProcessors;
+		for (int32 i = 0; i < NumScores; i++) { RescanMax(i); }
+		for (FProcessor* P : Heap) { P->UpdateWeight(Context->MaxScores); }
+		Heapify();
+	}
+
+	FProcessor* FPruneQueue::Pop()
+	{
+		FProcessor* Top = Heap[0];
+		RemoveAt(0);
+		Untrack(Top->RawScores);
+		return Top;
+	}
+
+	void FPruneQueue::Remove(FProcessor* InProcessor)
+	{
+		if (InProcessor->QueueIndex == INDEX_NONE) { return; }
+		RemoveAt(InProcessor->QueueIndex);
+		Untrack(InProcessor->RawScores);
+	}
+
+	void FPruneQueue::OnScoresChanged(FProcessor* InProcessor, const FPCGExOverlapScoresWeighting& InPreviousScores)
+	{
+		Untrack(InPreviousScores);
+		Track(InProcessor->RawScores);
+		Dirty.Add(InProcessor);
+	}
+
+	void FPruneQueue::Refresh()
+	{
+		FPCGExOverlapScoresWeighting& MaxScores = Context->MaxScores;
+
+		for (int32 i = 0; i < NumScores; i++)
+		{
+			if (!bStaleMax[i]) { continue; }
+
+			const double PreviousMax = MaxScores.*Scores::Fields[i];
+			RescanMax(i);
+			if (MaxScores.*Scores::Fields[i] != PreviousMax) { bMaxChanged = true; }
+		}
+
+		if (bMaxChanged)
+		{
+			// Every weight is relative to the maxes
+			for (FProcessor* P : Heap) { P->UpdateWeight(MaxScores); }
+			Heapify();
+			bMaxChanged = false;
+		}
+		else
+		{
+			for (FProcessor* P : Dirty)
+			{
+				if (P->QueueIndex == INDEX_NONE) { continue; }
+				P->UpdateWeight(MaxScores);
+				SiftDown(SiftUp(P->QueueIndex));
+			}
+		}
+
+		Dirty.Reset();
+	}
+
+	bool FPruneQueue::Precedes(const FProcessor* A, const FProcessor* B) const
+	{
+		// Same order as the former sort; the lowest IOIndex goes first among equal weights
+		if (A->Weight != B->Weight) { return bLowFirst ? A->Weight < B->Weight : A->Weight > B->Weight; }
+		return A->PointDataFacade->Source->IOIndex < B->PointDataFacade->Source->IOIndex;
+	}
+
+	void FPruneQueue::Place(const int32 Index, FProcessor* InProcessor)
+	{
+		Heap[Index] = InProcessor;
+		InProcessor->QueueIndex = Index;
+	}
+
+	int32 FPruneQueue::SiftUp(int32 Index)
+	{
+		FProcessor* P = Heap[Index];
+		while (Index > 0)
+		{
+			const int32 Parent = (Index - 1) >> 1;
+			if (!Precedes(P, Heap[Parent])) { break; }
+			Place(Index, Heap[Parent]);
+			Index = Parent;
+		}
+		Place(Index, P);
+		return Index;
+	}
+
+	void FPruneQueue::SiftDown(int32 Index)
+	{
+		FProcessor* P = Heap[Index];
+		const int32 Num = Heap.Num();
+		while (true)
+		{
+			int32 Child = (Index << 1) + 1;
+			if (Child >= Num) { break; }
+			if (Child + 1 < Num && Precedes(Heap[Child + 1], Heap[Child])) { Child++; }
+			if (!Precedes(Heap[Child], P)) { break; }
+			Place(Index, Heap[Child]);
+			Index = Child;
+		}
+		Place(Index, P);
+	}
+
+	void FPruneQueue::RemoveAt(const int32 Index)
+	{
+		Heap[Index]->QueueIndex = INDEX_NONE;
+		FProcessor* Last = Heap.Pop(EAllowShrinking::No);
+		if (Index >= Heap.Num()) { return; }
+
+		Place(Index, Last);
+		SiftDown(SiftUp(Index));
+	}
+
+	void FPruneQueue::Heapify()
+	{
+		for (int32 i = 0; i < Heap.Num(); i++) { Heap[i]->QueueIndex = i; }
+		for (int32 i = Heap.Num() / 2 - 1; i >= 0; i--) { SiftDown(i); }
+	}
+
+	void FPruneQueue::Track(const FPCGExOverlapScoresWeighting& InScores)
+	{
+		FPCGExOverlapScoresWeighting& MaxScores = Context->MaxScores;
+		for (int32 i = 0; i < NumScores; i++)
+		{
+			const double Value = InScores.*Scores::Fields[i];
+			double& Max = MaxScores.*Scores::Fields[i];
+
+			if (Value > Max)
+			{
+				Max = Value;
+				MaxCounts[i] = 1;
+				bStaleMax[i] = false;
+				bMaxChanged = true;
+			}
+			else if (Value == Max)
+			{
+				MaxCounts[i]++;
+			}
+		}
+	}
+
+	void FPruneQueue::Untrack(const FPCGExOverlapScoresWeighting& InScores)
+	{
+		const FPCGExOverlapScoresWeighting& MaxScores = Context->MaxScores;
+		for (int32 i = 0; i < NumScores; i++)
+		{
+			if (!MaxCounts[i] || InScores.*Scores::Fields[i] != MaxScores.*Scores::Fields[i]) { continue; }
+			if (--MaxCounts[i] == 0) { bStaleMax[i] = true; } // Last holder of that max is gone
+		}
+	}
+
+	void FPruneQueue::RescanMax(const int32 Score)
+	{
+		// Same floor as FPCGExOverlapScoresWeighting::ResetMin
+		double& Max = Context->MaxScores.*Scores::Fields[Score];
+		Max = MIN_dbl;
+		MaxCounts[Score] = 0;
+		bStaleMax[Score] = false;
+
+		for (const FProcessor* P : Heap)
+		{
+			const double Value = P->RawScores.*Scores::Fields[Score];
+			if (Value > Max)
+			{
+				Max = Value;
+				MaxCounts[Score] = 1;
+			}
+			else if (Value == Max)
+			{
+				MaxCounts[Score]++;
+			}
+		}
+	}
+
 	FOverlap::FOverlap(FProcessor* InManager, FProcessor* InManaged, const FBox& InIntersection)
 		: Intersection(InIntersection), Manager(InManager), Managed(InManaged)
 	{
@@ -198,7 +407,7 @@ namespace PCGExDiscardByOverlap
 		Overlaps.Add(Overlap);
 	}
 
-	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& RemaininStack)
+	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, FPruneQueue& InQueue)
 	{
 		Overlaps.Remove(InOverlap);
 
@@ -206,20 +415,24 @@ namespace PCGExDiscardByOverlap
 		{
 			// Remove from stack & output.
 			PCGEX_INIT_IO_VOID(PointDataFacade->Source, PCGExData::EIOInit::Forward)
-			RemaininStack.Remove(this);
+			InQueue.Remove(this);
 			return;
 		}
 
+		const FPCGExOverlapScoresWeighting PreviousScores = RawScores;
+
 		Stats.Remove(InOverlap->Stats, NumPoints, TotalVolume);
 		UpdateWeightValues();
+
+		InQueue.OnScoresChanged(this, PreviousScores);
 	}
 
-	void FProcessor::Pruned(TArray<FProcessor*>& RemaininStack)
+	void FProcessor::Pruned(FPruneQueue& InQueue)
 	{
 		// Remove self from the stack
 		for (const TSharedPtr<FOverlap>& Overlap : Overlaps)
 		{
-			Overlap->GetOther(this)->RemoveOverlap(Overlap, RemaininStack);
+			Overlap->GetOther(this)->RemoveOverlap(Overlap, InQueue);
 		}
 
 		Overlaps.Empty();
@@ -298,20 +511,24 @@ namespace PCGExDiscardByOverlap
 	{
 		// 2 - Find overlaps between large bounds, we'll be searching only there.
 
-		const TSharedPtr<PCGExPointsMT::IBatch> LocalParent = ParentBatch.Pin();
-		const TArray<TSharedRef<PCGExData::FFacade>>& ProcessorFacades = ParentBatch.Pin()->ProcessorFacades;
-		const int32 NumOtherProcessors = ProcessorFacades.Num();
-		for (int i = 0; i < NumOtherProcessors; i++)
+		const PCGExOctree::FItemOctree* DatasetOctree = Context->GetDatasetOctree(ParentBatch.Pin());
+
+		TArray<int32> Candidates;
+		DatasetOctree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Bounds.ExpandBy(UE_KINDA_SMALL_NUMBER)), [&](const PCGExOctree::FItem& Item) { Candidates.Add(Item.Index); });
+
+		// Register in dataset order, so overlaps are listed (and later summed) the same way whatever the octree layout
+		Candidates.Sort();
+
+		for (const int32 i : Candidates)
 		{
-			const TSharedPtr<PCGExData::FFacade> OtherFacade = LocalParent->ProcessorFacades[i];
-			if (PointDataFacade == OtherFacade) { continue; } // Skip self
+			FProcessor* OtherProcessor = Context->AllProcessors[i];
+			if (OtherProcessor == this) { continue; } // Skip self
 
-			const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*LocalParent->SubProcessorMap->Find(&OtherFacade->Source.Get()));
 			const FBox Intersection = Bounds.Overlap(OtherProcessor->GetBounds());
 
 			if (!Intersection.IsValid) { continue; } // No overlap
 
-			RegisterOverlap(&OtherProcessor.Get(), Intersection);
+			RegisterOverlap(OtherProcessor, Intersection);
 		}
 
 		if (Settings->TestMode == EPCGExOverlapTestMode::Fast)
@@ -227,6 +227,7 @@ namespace PCGExSampleInsidePath
 
 		Path = MakeShared<PCGExPaths::FPolyPath>(PointDataFacade, Settings->ProjectionDetails, 1, Settings->HeightInclusion);
 		Path->OffsetProjection(Settings->InclusionOffset);
+		Path->BuildInclusionGrid();
 
 		// Allocate edge native properties
 
@@ -12,6 +12,7 @@
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
+#include "Data/PCGExSpatialIndexRegistry.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Helpers/PCGExAsyncHelpers.h"
 #include "Helpers/PCGExDataMatcher.h"
@@ -104,19 +105,29 @@ bool FPCGExSampleNearestBoundsElement::Boot(FPCGExContext* InContext) const
 
 	{
 		PCGExAsyncHelpers::FAsyncExecutionScope CollectionBuildingTasks(Context->NumMaxTargets);
+
+		// Sized upfront, tasks write their own slot concurrently
+		Context->Collections.Init(nullptr, Context->TargetsHandler->Num());
+		int32 CollectionIndex = 0;
+
 		Context->TargetsHandler->ForEachPreloader([&](PCGExData::FFacadePreloader& Preloader)
 		{
-			// Build OBB collection from facade data
+			// Build OBB collection from facade data, or reuse the one another node already built over the same data
 			auto Facade = Preloader.GetDataFacade();
-			auto Collection = MakeShared<PCGExMath::OBB::FCollection>();
-			Collection->CloudIndex = Context->Collections.Num();
-			Context->Collections.Add(Collection);
 
 			CollectionBuildingTasks.Execute(
-				[CtxHandle = Context->GetOrCreateHandle(), Collection, Facade, BoundsSource = Settings->BoundsSource]()
+				[CtxHandle = Context->GetOrCreateHandle(), Index = CollectionIndex++, Facade, BoundsSource = Settings->BoundsSource]()
 				{
-					PCGEX_SHARED_CONTEXT_VOID(CtxHandle);
-					Collection->BuildFrom(Facade->Source, BoundsSource);
+					PCGEX_SHARED_TCONTEXT_VOID(SampleNearestBounds, CtxHandle)
+
+					SharedContext.Get()->Collections[Index] = PCGExData::FSpatialIndexRegistry::Get().FindOrBuild<PCGExMath::OBB::FCollection>(
+						Facade->GetIn(), PCGExData::ESpatialIndexKind::OrientedBounds, static_cast<uint32>(BoundsSource), [&](int64& OutMemoryBytes)
+						{
+							auto Collection = MakeShared<PCGExMath::OBB::FCollection>();
+							Collection->BuildFrom(Facade->Source, BoundsSource);
+							OutMemoryBytes = static_cast<int64>(Collection->Num()) * (sizeof(PCGExMath::OBB::FBounds) + sizeof(PCGExMath::OBB::FOrientation) + sizeof(PCGExOctree::FItem));
+							return Collection;
+						});
 				});
 
 			PCGExBlending::RegisterBuffersDependencies_SourceA(Context, Preloader, Context->BlendingFactories);
@@ -399,8 +410,8 @@ namespace PCGExSampleNearestBounds
 
 			Context->TargetsHandler->FindTargetsWithBoundsTest(BCAE, [&](const PCGExOctree::FItem& Target)
 			{
-				const TSharedPtr<PCGExMath::OBB::FCollection>& Collection = Context->Collections[Target.Index];
-				PCGExOctree::FItemOctree* CollectionOctree = Collection->GetOctree();
+				const TSharedPtr<const PCGExMath::OBB::FCollection>& Collection = Context->Collections[Target.Index];
+				const PCGExOctree::FItemOctree* CollectionOctree = Collection->GetOctree();
 				check(CollectionOctree)
 
 				CollectionOctree->FindElementsWithBoundsTest(BCAE, [&](const PCGExOctree::FItem& NearbyItem)
@@ -0,0 +1,120 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExCommon.h"
+#include "Async/ParallelFor.h"
+#include "Core/PCGExBenchmark.h"
+#include "Data/PCGExDataBenchmark.h"
+#include "Data/PCGExPointElements.h"
+#include "Data/PCGPointArrayData.h"
+#include "Helpers/PCGExTargetsHandler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Nearest point sampling throughput, e.g. pcgex.Bench.Run Filter=Sampling.* Scales=100000+1000000
+namespace PCGExSampleNearestPoint
+{
+	namespace Benchmark
+	{
+		const FName TargetsPin = FName("Targets");
+		constexpr int32 NumTargetDatas = 4;
+		constexpr double Extent = 10000;
+
+		// Members are released in reverse order, the context goes last
+		struct FScene
+		{
+			TSharedPtr<PCGExData::Benchmark::FContextFixture> Fixture;
+			UPCGPointArrayData* Queries = nullptr; // Managed by the fixture context
+			TSharedPtr<PCGExMatching::FTargetsHandler> TargetsHandler;
+			double Range = 0;
+		};
+
+		// N query points against N targets split across 4 datas, range catching ~8 targets per query
+		static TSharedPtr<FScene> MakeScene(const int32 InNum)
+		{
+			TSharedPtr<FScene> Scene = MakeShared<FScene>();
+			Scene->Fixture = MakeShared<PCGExData::Benchmark::FContextFixture>();
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, InNum, true, Extent);
+			Scene->Queries = Scene->Fixture->MakePointData(Positions);
+
+			const int32 NumPerData = FMath::Max(1, InNum / NumTargetDatas);
+			for (int32 i = 0; i < NumTargetDatas; i++)
+			{
+				PCGExBenchmark::MakePositions(Positions, NumPerData, true, Extent, 7 + i);
+				Scene->Fixture->AddInput(Scene->Fixture->MakePointData(Positions), TargetsPin);
+			}
+
+			Scene->TargetsHandler = MakeShared<PCGExMatching::FTargetsHandler>();
+			if (!Scene->TargetsHandler->Init(Scene->Fixture->Get(), TargetsPin)) { return nullptr; }
+			Scene->TargetsHandler->SetDistances(EPCGExDistance::Center, EPCGExDistance::Center, false);
+
+			// Volume of a sphere holding 8 targets at the overall target density
+			const double Density = (NumPerData * NumTargetDatas) / FMath::Cube(Extent);
+			Scene->Range = FMath::Pow(8 / (Density * 4 / 3.0 * PI), 1 / 3.0);
+
+			return Scene;
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchWithinRange(
+		TEXT("Sampling.NearestPoint.Range"), TEXT("Distance weighted sampling of all targets within range, N queries against N targets split across 4 datas"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			if (Scale < Benchmark::NumTargetDatas) { return nullptr; }
+
+			TSharedPtr<Benchmark::FScene> Scene = Benchmark::MakeScene(Scale);
+			if (!Scene) { return nullptr; }
+
+			return [Scene, Scale]()
+			{
+				const double RangeSquared = FMath::Square(Scene->Range);
+				ParallelFor(
+					Scale, [&](const int32 Index)
+					{
+						const PCGExData::FConstPoint Point(Scene->Queries, Index);
+						const FVector Origin = Point.GetLocation();
+
+						double TotalWeight = 0;
+						FVector WeightedLocation = FVector::ZeroVector;
+
+						Scene->TargetsHandler->FindElementsWithBoundsTest(
+							FBoxCenterAndExtent(Origin, FVector(Scene->Range)), [&](const PCGExData::FConstPoint& Target)
+							{
+								const double DistSquared = Scene->TargetsHandler->GetDistSquared(Point, Target);
+								if (DistSquared > RangeSquared) { return; }
+
+								const double Weight = 1 - DistSquared / RangeSquared;
+								WeightedLocation += Target.GetLocation() * Weight;
+								TotalWeight += Weight;
+							});
+
+						if (TotalWeight > 0) { WeightedLocation /= TotalWeight; }
+					});
+			};
+		});
+
+	static PCGExBenchmark::FRegistrar BenchClosest(
+		TEXT("Sampling.NearestPoint.Closest"), TEXT("Closest target lookup without range, N queries against N targets split across 4 datas"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			if (Scale < Benchmark::NumTargetDatas) { return nullptr; }
+
+			TSharedPtr<Benchmark::FScene> Scene = Benchmark::MakeScene(Scale);
+			if (!Scene) { return nullptr; }
+
+			return [Scene, Scale]()
+			{
+				ParallelFor(
+					Scale, [&](const int32 Index)
+					{
+						PCGExData::FConstPoint Closest;
+						double DistSquared = MAX_dbl;
+						Scene->TargetsHandler->FindClosestTarget(PCGExData::FConstPoint(Scene->Queries, Index), Closest, DistSquared);
+					});
+			};
+		});
+}
+
+#endif
@@ -3,13 +3,15 @@
 
 #include "Elements/PCGExSelfPruning.h"
 
+#include "PCGExBVH.h"
 #include "Helpers/PCGExRandomHelpers.h"
+#include "Containers/PCGExScopedContainers.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
+#include "Data/PCGExSpatialIndexRegistry.h"
 #include "Data/PCGPointData.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Helpers/PCGExArrayHelpers.h"
-#include "Math/OBB/PCGExOBBTests.h"
 #include "Sorting/PCGExPointSorter.h"
 #include "Sorting/PCGExSortingDetails.h"
 
@@ -152,9 +154,12 @@ namespace PCGExSelfPruning
 
 		for (int32 i = 0; i < NumPoints; i++) { Priority[Order[i]] = i; }
 
-		// Only force single-threaded for Prune mode (Mask is shared state)
+		bParallelPrune = Settings->Mode == EPCGExSelfPruningMode::Prune && Settings->bParallelPrune;
+		if (bParallelPrune) { States.Init(EPruneState::Undecided, NumPoints); }
+
+		// Only force single-threaded for sequential Prune mode (Mask is shared state)
 		// WriteResult mode can run in parallel since each candidate's overlap count is independent
-		bForceSingleThreadedProcessRange = (Settings->Mode == EPCGExSelfPruningMode::Prune);
+		bForceSingleThreadedProcessRange = (Settings->Mode == EPCGExSelfPruningMode::Prune && !bParallelPrune);
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
 		return true;
@@ -209,10 +214,11 @@ namespace PCGExSelfPruning
 				PCGEX_SCOPE_LOOP(Index)
 				{
 					const FTransform& T = Transforms[Index];
-					SecondaryOBBs[Index] = PCGExMath::OBB::Factory::FromTransform(
-						T,
-						GetLocalBounds(Index, T),
-						Index);
+					SecondaryOBBs.Set(
+						Index, PCGExMath::OBB::Factory::FromTransform(
+							T,
+							GetLocalBounds(Index, T),
+							Index));
 				}
 			}
 			else
@@ -220,10 +226,11 @@ namespace PCGExSelfPruning
 				PCGEX_SCOPE_LOOP(Index)
 				{
 					const FTransform& T = Transforms[Index];
-					SecondaryOBBs[Index] = PCGExMath::OBB::Factory::FromTransform(
-						T,
-						GetLocalBounds(Index, T).ExpandBy(SecondaryExpansion->Read(Index)),
-						Index);
+					SecondaryOBBs.Set(
+						Index, PCGExMath::OBB::Factory::FromTransform(
+							T,
+							GetLocalBounds(Index, T).ExpandBy(SecondaryExpansion->Read(Index)),
+							Index));
 				}
 			}
 
@@ -259,17 +266,143 @@ namespace PCGExSelfPruning
 		Candidates.Sort([&](const FCandidateInfos& A, const FCandidateInfos& B) { return Priority[A.Index] > Priority[B.Index]; });
 		LastCandidatesCount = Candidates.Num();
 
+		// Each node of the shared BVH grows by exactly the secondary boxes under it, so a query only visits points whose own box
+		// overlaps it, no matter how uneven box sizes are. Hits are still re-tested against BoxSecondary in double precision.
+		PointBVH = PCGExData::FSpatialIndexRegistry::Get().GetPointBVH(PointDataFacade->GetIn());
+		SecondaryBounds = MakeShared<PCGExBVH::FRefitBounds>();
+		PointBVH->Refit([&](const int32 Index) { return BoxSecondary[Index]; }, *SecondaryBounds);
+
+		bBuildingOverlapGraph = bParallelPrune;
 		StartParallelLoopForRange(Candidates.Num());
 	}
 
+	FBox FProcessor::GetPrimaryBounds(const UPCGBasePointData* InData, const int32 Index, const FTransform& Transform) const
+	{
+		switch (Settings->PrimaryMode)
+		{
+		case EPCGExSelfPruningExpandOrder::Before:
+			return InData->GetLocalBounds(Index).ExpandBy(PrimaryExpansion->Read(Index)).TransformBy(Transform);
+		case EPCGExSelfPruningExpandOrder::After:
+			return InData->GetLocalBounds(Index).TransformBy(Transform).ExpandBy(PrimaryExpansion->Read(Index));
+		default:
+		case EPCGExSelfPruningExpandOrder::None:
+			return InData->GetLocalBounds(Index).TransformBy(Transform);
+		}
+	}
+
+	void FProcessor::FilterPrecise(const int32 Index, TArray<int32>& InOutOthers, TArray<uint8>& OutScratch) const
+	{
+		if (InOutOthers.IsEmpty()) { return; }
+
+		// Same SAT as the scalar test, with a bounding sphere early-out; the store holds secondaries, so the primary is the query
+		OutScratch.SetNumUninitialized(InOutOthers.Num(), EAllowShrinking::No);
+		SecondaryOBBs.TestOverlaps(PrimaryOBBs[Index], InOutOthers, OutScratch.GetData());
+
+		int32 WriteIndex = 0;
+		for (int32 i = 0; i < InOutOthers.Num(); i++) { if (OutScratch[i]) { InOutOthers[WriteIndex++] = InOutOthers[i]; } }
+		InOutOthers.SetNum(WriteIndex, EAllowShrinking::No);
+	}
+
+	void FProcessor::PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops)
+	{
+		if (bBuildingOverlapGraph) { ScopedOverlaps = MakeShared<PCGExMT::TScopedArray<int32>>(Loops); }
+	}
+
+	void FProcessor::GatherOverlaps(const PCGExMT::FScope& Scope)
+	{
+		const UPCGBasePointData* InData = PointDataFacade->GetIn();
+		TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
+
+		TArray<int32>& LocalOverlaps = ScopedOverlaps->Get_Ref(Scope);
+		LocalOverlaps.Reserve(Scope.Count * 4);
+
+		TArray<int32> Others;
+		TArray<uint8> Scratch;
+
+		PCGEX_SCOPE_LOOP(i)
+		{
+			FCandidateInfos& Candidate = Candidates[i];
+			Candidate.Overlaps = 0;
+			Candidate.bPrune = false;
+
+			const int32 Index = Candidate.Index;
+
+			// Points that can't overlap are kept and never prune anything
+			if (!PointFilterCache[Index])
+			{
+				Candidate.bSkip = true;
+				continue;
+			}
+
+			const int32 CurrentPriority = Priority[Index];
+			const FBox Box = GetPrimaryBounds(InData, Index, Transforms[Index]);
+
+			// Same tests as the sequential pass, minus the mask which isn't known yet
+			Others.Reset();
+			PointBVH->FindElementsWithBoundsTest(*SecondaryBounds, FBoxCenterAndExtent(Box), [&](const int32 OtherIndex)
+			{
+				if (OtherIndex == Index || !PointFilterCache[OtherIndex]) { return; }
+				if (Priority[OtherIndex] < CurrentPriority) { return; }
+				if (Box.Intersect(BoxSecondary[OtherIndex])) { Others.Add(OtherIndex); }
+			});
+
+			if (Settings->bPreciseTest) { FilterPrecise(Index, Others, Scratch); }
+
+			LocalOverlaps.Append(Others);
+			Candidate.Overlaps = Others.Num();
+
+			// Nothing of higher priority in the way, kept right away
+			Candidate.bSkip = Candidate.Overlaps == 0;
+		}
+	}
+
+	void FProcessor::OnOverlapsGathered()
+	{
+		bBuildingOverlapGraph = false;
+
+		// Scopes are collapsed in loop order, which is candidate order
+		ScopedOverlaps->Collapse(OverlapGraph);
+		ScopedOverlaps.Reset();
+
+		int32 FirstOverlap = 0;
+		for (FCandidateInfos& Candidate : Candidates)
+		{
+			Candidate.FirstOverlap = FirstOverlap;
+			FirstOverlap += Candidate.Overlaps;
+		}
+	}
+
+	void FProcessor::ResolvePruning(const PCGExMT::FScope& Scope)
+	{
+		// States are only written once the whole round is done, so every candidate sees the previous round regardless of scheduling
+		PCGEX_SCOPE_LOOP(i)
+		{
+			FCandidateInfos& Candidate = Candidates[i];
+
+			bool bPrune = false;
+			Candidate.bSkip = SettleCandidate(TConstArrayView<int32>(OverlapGraph.GetData() + Candidate.FirstOverlap, Candidate.Overlaps), States, bPrune);
+			Candidate.bPrune = bPrune;
+		}
+	}
+
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::SelfPruning::ProcessRange);
 
+		if (bParallelPrune)
+		{
+			if (bBuildingOverlapGraph) { GatherOverlaps(Scope); }
+			else { ResolvePruning(Scope); }
+			return;
+		}
+
 		const UPCGBasePointData* InData = PointDataFacade->GetIn();
-		const PCGPointOctree::FPointOctree& Octree = InData->GetPointOctree();
 		TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
 
+		// Precise tests gather every AABB hit first, then run the batched OBB kernel over them
+		TArray<int32> Others;
+		TArray<uint8> Scratch;
+
 		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult)
 		{
 			PCGEX_SCOPE_LOOP(i)
@@ -278,42 +411,18 @@ namespace PCGExSelfPruning
 				Candidate.bSkip = true;
 
 				const int32 Index = Candidate.Index;
-				const FTransform& Transform = Transforms[Index];
-
-				FBox BoxA = InData->GetLocalBounds(Index);
-				FBox Box = FBox(NoInit);
-				if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::Before)
-				{
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-					Box = BoxA.TransformBy(Transform);
-				}
-				else if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::After)
-				{
-					Box = BoxA.TransformBy(Transform).ExpandBy(PrimaryExpansion->Read(Index));
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-				}
-				else
-				{
-					Box = BoxA.TransformBy(Transform);
-				}
+				const FBox Box = GetPrimaryBounds(InData, Index, Transforms[Index]);
 
-				Octree.FindElementsWithBoundsTest(Box, [&](const PCGPointOctree::FPointRef& Other)
+				Others.Reset();
+				PointBVH->FindElementsWithBoundsTest(*SecondaryBounds, FBoxCenterAndExtent(Box), [&](const int32 OtherIndex)
 				{
-					const int32 OtherIndex = Other.Index;
-
 					// Ignore self
 					if (OtherIndex == Index || !PointFilterCache[OtherIndex]) { return; }
-					if (Box.Intersect(BoxSecondary[Other.Index]))
-					{
-						if (Settings->bPreciseTest)
-						{
-							// Use pre-built OBBs instead of constructing them each time
-							if (!PCGExMath::OBB::SATOverlap(PrimaryOBBs[Index], SecondaryOBBs[OtherIndex])) { return; }
-						}
-
-						Candidate.Overlaps++;
-					}
+					if (Box.Intersect(BoxSecondary[OtherIndex])) { Others.Add(OtherIndex); }
 				});
+
+				if (Settings->bPreciseTest) { FilterPrecise(Index, Others, Scratch); }
+				Candidate.Overlaps = Others.Num();
 			}
 		}
 		else
@@ -328,50 +437,37 @@ namespace PCGExSelfPruning
 				if (!PointFilterCache[Index]) { continue; }
 
 				const int32 CurrentPriority = Priority[Index];
-				const FTransform& Transform = Transforms[Index];
-
+				const FBox Box = GetPrimaryBounds(InData, Index, Transforms[Index]);
 
-				FBox BoxA = InData->GetLocalBounds(Index);
-				FBox Box = FBox(NoInit);
-				if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::Before)
+				auto IsCandidate = [&](const int32 OtherIndex)
 				{
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-					Box = BoxA.TransformBy(Transform);
-				}
-				else if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::After)
-				{
-					Box = BoxA.TransformBy(Transform).ExpandBy(PrimaryExpansion->Read(Index));
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-				}
-				else
-				{
-					Box = BoxA.TransformBy(Transform);
-				}
-
-				Octree.FindFirstElementWithBoundsTest(Box, [&](const PCGPointOctree::FPointRef& Other)
-				{
-					const int32 OtherIndex = Other.Index;
-
 					// Ignore self
-					if (OtherIndex == Index || !PointFilterCache[OtherIndex] || !Mask[OtherIndex]) { return true; }
+					if (OtherIndex == Index || !PointFilterCache[OtherIndex] || !Mask[OtherIndex]) { return false; }
 
 					// Ignore lower priorities, those will be pruned by this candidate when their turn comes
-					if (Priority[OtherIndex] < CurrentPriority) { return true; }
+					if (Priority[OtherIndex] < CurrentPriority) { return false; }
 
-					if (Box.Intersect(BoxSecondary[OtherIndex]))
+					return Box.Intersect(BoxSecondary[OtherIndex]);
+				};
+
+				if (!Settings->bPreciseTest)
+				{
+					PointBVH->FindFirstElementWithBoundsTest(*SecondaryBounds, FBoxCenterAndExtent(Box), [&](const int32 OtherIndex)
 					{
-						if (Settings->bPreciseTest)
-						{
-							// Use pre-built OBBs instead of constructing them each time
-							if (!PCGExMath::OBB::SATOverlap(PrimaryOBBs[Index], SecondaryOBBs[OtherIndex])) { return true; }
-						}
+						if (!IsCandidate(OtherIndex)) { return true; }
 
 						Mask[Index] = false;
 						return false;
-					}
+					});
 
-					return true;
-				});
+					continue;
+				}
+
+				Others.Reset();
+				PointBVH->FindElementsWithBoundsTest(*SecondaryBounds, FBoxCenterAndExtent(Box), [&](const int32 OtherIndex) { if (IsCandidate(OtherIndex)) { Others.Add(OtherIndex); } });
+
+				FilterPrecise(Index, Others, Scratch);
+				if (!Others.IsEmpty()) { Mask[Index] = false; }
 			}
 		}
 	}
@@ -406,6 +502,19 @@ namespace PCGExSelfPruning
 			return;
 		}
 
+		if (bParallelPrune)
+		{
+			if (bBuildingOverlapGraph) { OnOverlapsGathered(); }
+
+			// Settle this round's decisions before compaction drops them
+			for (const FCandidateInfos& Candidate : Candidates)
+			{
+				if (!Candidate.bSkip) { continue; }
+				States[Candidate.Index] = Candidate.bPrune ? EPruneState::Pruned : EPruneState::Kept;
+				if (Candidate.bPrune) { Mask[Candidate.Index] = false; }
+			}
+		}
+
 		int32 WriteIndex = 0;
 		for (int32 i = 0; i < Candidates.Num(); i++)
 		{
@@ -0,0 +1,197 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExBVH.h"
+#include "Async/ParallelFor.h"
+#include "Core/PCGExBenchmark.h"
+#include "Elements/PCGExSelfPruning.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Sequential against parallel pruning, e.g. pcgex.Bench.Run Filter=SelfPruning.* Scales=5000000 Iterations=3
+namespace PCGExSelfPruning
+{
+	namespace Benchmark
+	{
+		// Randomly sized boxes at a constant density, each point overlapping a handful of others, and a shuffled priority
+		struct FScene
+		{
+			TArray<FBox> Boxes;
+			TArray<int32> Priority;
+			TArray<int32> Order; // Highest priority first
+			TSharedPtr<PCGExBVH::FItemBVH> BVH;
+		};
+
+		static TSharedPtr<FScene> MakeScene(const int32 InNum, const int32 InSeed)
+		{
+			TSharedPtr<FScene> Scene = MakeShared<FScene>();
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, InNum, true, 100 * FMath::Pow(static_cast<double>(InNum), 1 / 3.0), InSeed);
+
+			FRandomStream Random(InSeed);
+			Scene->Boxes.SetNumUninitialized(InNum);
+			for (int32 i = 0; i < InNum; i++) { Scene->Boxes[i] = FBox(Positions[i], Positions[i]).ExpandBy(FVector(Random.FRandRange(20, 60), Random.FRandRange(20, 60), Random.FRandRange(20, 60))); }
+
+			Scene->Order.SetNumUninitialized(InNum);
+			for (int32 i = 0; i < InNum; i++) { Scene->Order[i] = i; }
+			for (int32 i = InNum - 1; i > 0; i--) { Scene->Order.Swap(i, Random.RandRange(0, i)); }
+
+			Scene->Priority.SetNumUninitialized(InNum);
+			for (int32 i = 0; i < InNum; i++) { Scene->Priority[Scene->Order[i]] = InNum - i; }
+
+			Scene->BVH = MakeShared<PCGExBVH::FItemBVH>();
+			Scene->BVH->Build(
+				InNum, [&](const int32 Index, FBox& OutBounds)
+				{
+					OutBounds = Scene->Boxes[Index];
+					return true;
+				});
+
+			return Scene;
+		}
+
+		// Sequential pass: a point is kept unless a kept, higher priority point overlaps it
+		static void PruneSequential(const FScene& Scene, TArray<EPruneState>& OutStates)
+		{
+			OutStates.Init(EPruneState::Undecided, Scene.Boxes.Num());
+
+			for (const int32 Index : Scene.Order)
+			{
+				const FBox& Box = Scene.Boxes[Index];
+				const int32 CurrentPriority = Scene.Priority[Index];
+
+				const bool bKept = Scene.BVH->FindFirstElementWithBoundsTest(
+					FBoxCenterAndExtent(Box), [&](const int32 OtherIndex)
+					{
+						if (OtherIndex == Index || Scene.Priority[OtherIndex] < CurrentPriority) { return true; }
+						return OutStates[OtherIndex] != EPruneState::Kept || !Box.Intersect(Scene.Boxes[OtherIndex]);
+					});
+
+				OutStates[Index] = bKept ? EPruneState::Kept : EPruneState::Pruned;
+			}
+		}
+
+		// Parallel pass: gathers each point's higher priority overlaps, then settles points in rounds with SettleCandidate
+		static bool PruneParallel(const FScene& Scene, TArray<EPruneState>& OutStates)
+		{
+			constexpr int32 ChunkSize = 4096;
+
+			const int32 NumPoints = Scene.Boxes.Num();
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumPoints, ChunkSize);
+
+			TArray<int32> Counts;
+			Counts.SetNumZeroed(NumPoints);
+
+			TArray<TArray<int32>> ChunkOverlaps;
+			ChunkOverlaps.SetNum(NumChunks);
+
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					TArray<int32>& Overlaps = ChunkOverlaps[Chunk];
+					const int32 End = FMath::Min(NumPoints, (Chunk + 1) * ChunkSize);
+					for (int32 Index = Chunk * ChunkSize; Index < End; Index++)
+					{
+						const FBox& Box = Scene.Boxes[Index];
+						const int32 CurrentPriority = Scene.Priority[Index];
+
+						Scene.BVH->FindElementsWithBoundsTest(
+							FBoxCenterAndExtent(Box), [&](const int32 OtherIndex)
+							{
+								if (OtherIndex == Index || Scene.Priority[OtherIndex] < CurrentPriority || !Box.Intersect(Scene.Boxes[OtherIndex])) { return; }
+								Overlaps.Add(OtherIndex);
+								Counts[Index]++;
+							});
+					}
+				});
+
+			TArray<int32> Offsets;
+			Offsets.SetNumUninitialized(NumPoints + 1);
+			Offsets[0] = 0;
+			for (int32 i = 0; i < NumPoints; i++) { Offsets[i + 1] = Offsets[i] + Counts[i]; }
+
+			TArray<int32> Graph;
+			Graph.Reserve(Offsets[NumPoints]);
+			for (const TArray<int32>& Overlaps : ChunkOverlaps) { Graph.Append(Overlaps); }
+			ChunkOverlaps.Empty();
+
+			OutStates.Init(EPruneState::Undecided, NumPoints);
+
+			TArray<int32> Pending;
+			Pending.SetNumUninitialized(NumPoints);
+			for (int32 i = 0; i < NumPoints; i++) { Pending[i] = i; }
+
+			TArray<int8> Settled;
+			TArray<int8> Pruned;
+
+			while (!Pending.IsEmpty())
+			{
+				Settled.SetNumUninitialized(Pending.Num());
+				Pruned.SetNumUninitialized(Pending.Num());
+
+				ParallelFor(
+					Pending.Num(), [&](const int32 i)
+					{
+						const int32 Index = Pending[i];
+						bool bPrune = false;
+						Settled[i] = SettleCandidate(TConstArrayView<int32>(Graph.GetData() + Offsets[Index], Counts[Index]), OutStates, bPrune);
+						Pruned[i] = bPrune;
+					});
+
+				int32 WriteIndex = 0;
+				for (int32 i = 0; i < Pending.Num(); i++)
+				{
+					if (Settled[i]) { OutStates[Pending[i]] = Pruned[i] ? EPruneState::Pruned : EPruneState::Kept; }
+					else { Pending[WriteIndex++] = Pending[i]; }
+				}
+
+				if (WriteIndex == Pending.Num()) { return false; }
+				Pending.SetNum(WriteIndex);
+			}
+
+			return true;
+		}
+	}
+
+	static PCGExBenchmark::FPairRegistrar BenchPrune(
+		TEXT("SelfPruning.Prune"), TEXT("Priority pruning of N overlapping boxes, BVH queries included"),
+		{TEXT("Sequential"), TEXT("single-threaded")}, {TEXT("Parallel"), TEXT("round-based over an overlap graph")},
+		[](const int32 Scale, const bool bParallel) -> PCGExBenchmark::FKernel
+		{
+			return [Scene = Benchmark::MakeScene(Scale, 1337), bParallel]()
+			{
+				TArray<EPruneState> States;
+				if (bParallel) { Benchmark::PruneParallel(*Scene, States); }
+				else { Benchmark::PruneSequential(*Scene, States); }
+			};
+		});
+
+	static PCGExBenchmark::FCheckRegistrar CheckParallelPrune(
+		TEXT("SelfPruning.ParallelPrune"), TEXT("Parallel pruning keeps exactly the points the sequential pass keeps, for fixed seeds"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			for (const int32 Seed : {1337, 42, 7})
+			{
+				const TSharedPtr<Benchmark::FScene> Scene = Benchmark::MakeScene(50000, Seed);
+
+				TArray<EPruneState> Sequential;
+				Benchmark::PruneSequential(*Scene, Sequential);
+
+				TArray<EPruneState> Parallel;
+				if (!Context.Test(Benchmark::PruneParallel(*Scene, Parallel), TEXT("Seed %d : parallel rounds stopped making progress"), Seed)) { continue; }
+
+				int32 NumKept = 0;
+				for (int32 i = 0; i < Sequential.Num(); i++)
+				{
+					NumKept += Sequential[i] == EPruneState::Kept;
+					Context.Test(Sequential[i] == Parallel[i], TEXT("Seed %d : point %d is %s sequentially but %s in parallel"), Seed, i, Sequential[i] == EPruneState::Kept ? TEXT("kept") : TEXT("pruned"), Parallel[i] == EPruneState::Kept ? TEXT("kept") : TEXT("pruned"));
+				}
+
+				// Guards against a scene too sparse or too dense to prove anything
+				Context.Test(NumKept > 0 && NumKept < Sequential.Num(), TEXT("Seed %d : %d of %d points kept"), Seed, NumKept, Sequential.Num());
+			}
+		});
+}
+
+#endif
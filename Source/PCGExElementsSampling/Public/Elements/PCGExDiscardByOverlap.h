@@ -105,6 +105,7 @@ namespace PCGExDiscardByOverlap
 	struct FOverlapStats;
 	class FOverlap;
 	class FProcessor;
+	class FPruneQueue;
 }
 
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="sampling/discard-by-overlap"))
@@ -177,7 +178,12 @@ struct FPCGExDiscardByOverlapContext final : FPCGExPointsProcessorContext
 	FPCGExOverlapScoresWeighting Weights;
 	FPCGExOverlapScoresWeighting MaxScores;
 	TArray<PCGExDiscardByOverlap::FProcessor*> AllProcessors;
-	void UpdateScores(const TArray<PCGExDiscardByOverlap::FProcessor*>& InStack);
+
+	mutable FRWLock DatasetLock;
+	TUniquePtr<PCGExOctree::FItemOctree> DatasetOctree;
+
+	/** Octree of every processor's overall bounds, item indices match the batch' ProcessorFacades & AllProcessors. Built once, by the first caller. */
+	const PCGExOctree::FItemOctree* GetDatasetOctree(const TSharedPtr<PCGExPointsMT::IBatch>& InBatch);
 
 	void Prune();
 
@@ -272,6 +278,52 @@ namespace PCGExDiscardByOverlap
 
 	PCGEX_OCTREE_SEMANTICS(FPointBounds, { return Element->Bounds; }, { return A->Point == B->Point; })
 
+	/**
+	 * Indexed binary heap of the processors left to prune, popping them in the exact order the sorted stack did.
+	 * Keeps track of the max of each score over the remaining processors : as long as none of these maxes move,
+	 * only the processors whose scores changed get their weight updated; otherwise all weights are refreshed and the heap rebuilt.
+	 */
+	class PCGEXELEMENTSSAMPLING_API FPruneQueue
+	{
+	public:
+		static constexpr int32 NumScores = 9;
+
+		FPruneQueue(FPCGExDiscardByOverlapContext* InContext, const EPCGExOverlapPruningLogic InLogic);
+
+		void Init(const TArray<FProcessor*>& InProcessors);
+
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+
+		FProcessor* Pop();
+		void Remove(FProcessor* InProcessor);
+		void OnScoresChanged(FProcessor* InProcessor, const FPCGExOverlapScoresWeighting& InPreviousScores);
+
+		/** Bring weights & heap up to date with the score changes since the last refresh */
+		void Refresh();
+
+	protected:
+		FPCGExDiscardByOverlapContext* Context = nullptr;
+		bool bLowFirst = false;
+
+		TArray<FProcessor*> Heap;
+		TArray<FProcessor*> Dirty;
+
+		int32 MaxCounts[NumScores] = {};
+		bool bStaleMax[NumScores] = {};
+		bool bMaxChanged = false;
+
+		bool Precedes(const FProcessor* A, const FProcessor* B) const;
+		void Place(const int32 Index, FProcessor* InProcessor);
+		int32 SiftUp(int32 Index);
+		void SiftDown(int32 Index);
+		void RemoveAt(const int32 Index);
+		void Heapify();
+
+		void Track(const FPCGExOverlapScoresWeighting& InScores);
+		void Untrack(const FPCGExOverlapScoresWeighting& InScores);
+		void RescanMax(const int32 Score);
+	};
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExDiscardByOverlapContext, UPCGExDiscardByOverlapSettings>
 	{
 		friend struct FPCGExDiscardByOverlapContext;
@@ -299,6 +351,8 @@ namespace PCGExDiscardByOverlap
 		double DynamicWeight = 0;
 		double Weight = 0;
 
+		int32 QueueIndex = INDEX_NONE;
+
 		FOverlapStats Stats;
 
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
@@ -313,8 +367,8 @@ namespace PCGExDiscardByOverlap
 		FORCEINLINE bool HasOverlaps() const { return !Overlaps.IsEmpty(); }
 
 		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
-		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& RemaininStack);
-		void Pruned(TArray<FProcessor*>& RemaininStack);
+		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, FPruneQueue& InQueue);
+		void Pruned(FPruneQueue& InQueue);
 		void RegisterPointBounds(const int32 Index, const TSharedPtr<FPointBounds>& InPointBounds);
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
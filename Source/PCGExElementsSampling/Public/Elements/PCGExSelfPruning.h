@@ -7,7 +7,7 @@
 #include "PCGExFilterCommon.h"
 #include "Factories/PCGExFactories.h"
 #include "Math/PCGExMathMean.h"
-#include "Math/OBB/PCGExOBB.h"
+#include "Math/OBB/PCGExOBBBatch.h"
 #include "Core/PCGExPointsProcessor.h"
 #include "Data/PCGExDataHelpers.h"
 #include "Details/PCGExSettingsMacros.h"
@@ -21,6 +21,18 @@ namespace PCGExData
 	class TBuffer;
 }
 
+namespace PCGExMT
+{
+	template <typename T>
+	class TScopedArray;
+}
+
+namespace PCGExBVH
+{
+	class FItemBVH;
+	struct FRefitBounds;
+}
+
 UENUM()
 enum class EPCGExSelfPruningMode : uint8
 {
@@ -87,6 +99,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName="   └─ OneMinus", EditCondition="Mode == EPCGExSelfPruningMode::WriteResult && Units == EPCGExMeanMeasure::Relative", EditConditionHides))
 	bool bOutputOneMinusOverlap = false;
 
+	/** Experimental. Prune in parallel rounds over a pre-built overlap graph instead of a single-threaded pass. Same result, checked against the sequential pass by the SelfPruning.ParallelPrune check case; much faster on large inputs, at the cost of storing every overlap. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="Mode == EPCGExSelfPruningMode::Prune", EditConditionHides))
+	bool bParallelPrune = false;
+
 	/** If enabled, does very precise and EXPENSIVE spatial tests. Only supported for pruning. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Expansion", meta=(PCG_NotOverridable))
 	bool bPreciseTest = false;
@@ -155,8 +171,44 @@ namespace PCGExSelfPruning
 		int32 Index = -1;
 		int32 Overlaps = 0;
 		int8 bSkip = 0;
+
+		// Parallel prune only; higher priority overlaps are Overlaps entries starting at FirstOverlap in the overlap graph
+		int32 FirstOverlap = 0;
+		int8 bPrune = 0;
+	};
+
+	enum class EPruneState : int8
+	{
+		Undecided = 0,
+		Kept,
+		Pruned,
 	};
 
+	/**
+	 * One parallel prune round for a candidate, given its higher priority overlaps and the states settled by previous rounds.
+	 * A candidate is pruned as soon as one of them is kept, and kept once all of them are pruned.
+	 * @return true if the candidate is settled this round, bOutPrune telling how
+	 */
+	FORCEINLINE bool SettleCandidate(const TConstArrayView<int32> HigherOverlaps, const TArray<EPruneState>& States, bool& bOutPrune)
+	{
+		bool bPending = false;
+		bOutPrune = false;
+
+		for (const int32 Other : HigherOverlaps)
+		{
+			const EPruneState OtherState = States[Other];
+			if (OtherState == EPruneState::Kept)
+			{
+				bOutPrune = true;
+				return true;
+			}
+
+			if (OtherState == EPruneState::Undecided) { bPending = true; }
+		}
+
+		return !bPending;
+	}
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExSelfPruningContext, UPCGExSelfPruningSettings>
 	{
 	protected:
@@ -168,12 +220,34 @@ namespace PCGExSelfPruning
 		TArray<FCandidateInfos> Candidates;
 		TArray<FBox> BoxSecondary;
 
+		// Shared point-center index, refitted to the secondary boxes so primary boxes can be queried as-is
+		TSharedPtr<const PCGExBVH::FItemBVH> PointBVH;
+		TSharedPtr<PCGExBVH::FRefitBounds> SecondaryBounds;
+
 		// Pre-built OBBs for precise testing (only allocated when bPreciseTest is true)
+		// Secondaries are stored for the batched kernels, each primary is tested against all of its candidates at once
 		TArray<PCGExMath::OBB::FOBB> PrimaryOBBs;
-		TArray<PCGExMath::OBB::FOBB> SecondaryOBBs;
+		PCGExMath::OBB::FBatchStore SecondaryOBBs;
 
 		int32 LastCandidatesCount = 0;
 
+		// Parallel prune: a point is kept if none of its higher priority overlaps are, which is what the sequential pass computes.
+		// The first range loop gathers each candidate's higher priority overlaps, the following ones settle every point whose overlaps are all settled.
+		bool bParallelPrune = false;
+		bool bBuildingOverlapGraph = false;
+		TSharedPtr<PCGExMT::TScopedArray<int32>> ScopedOverlaps;
+		TArray<int32> OverlapGraph;
+		TArray<EPruneState> States;
+
+		FBox GetPrimaryBounds(const UPCGBasePointData* InData, const int32 Index, const FTransform& Transform) const;
+
+		/** Keeps the secondaries whose OBB overlaps the primary OBB of Index, in order */
+		void FilterPrecise(const int32 Index, TArray<int32>& InOutOthers, TArray<uint8>& OutScratch) const;
+
+		void GatherOverlaps(const PCGExMT::FScope& Scope);
+		void ResolvePruning(const PCGExMT::FScope& Scope);
+		void OnOverlapsGathered();
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -189,6 +263,7 @@ namespace PCGExSelfPruning
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void OnPointsProcessingComplete() override;
 
+		virtual void PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
 
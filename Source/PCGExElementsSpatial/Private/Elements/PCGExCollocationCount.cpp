@@ -5,6 +5,7 @@
 
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
+#include "Math/PCGExToleranceGrid.h"
 
 
 #define LOCTEXT_NAMESPACE "PCGExCollocationCountElement"
@@ -73,7 +74,13 @@ namespace PCGExCollocationCount
 			LinearOccurencesWriter = PointDataFacade->GetWritable(Settings->LinearOccurencesAttributeName, 0, true, PCGExData::EBufferInit::New);
 		}
 
-		Octree = &PointDataFacade->Source->GetIn()->GetPointOctree();
+		// Neighbor counts for every point at once, only comparing points in adjacent tolerance cells
+		PCGExMath::FToleranceGrid Grid(FVector(ToleranceConstant));
+		Grid.Build(PointDataFacade->GetIn());
+
+		Counts.SetNumUninitialized(PointDataFacade->GetNum());
+		if (LinearOccurencesWriter) { LowerCounts.SetNumUninitialized(PointDataFacade->GetNum()); }
+		Grid.CountNeighbors(Counts, LowerCounts);
 
 		StartParallelLoopForPoints();
 
@@ -84,38 +91,11 @@ namespace PCGExCollocationCount
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::CollocationCount::ProcessPoints);
 
-		TConstPCGValueRange<FTransform> Transforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
-
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const FVector Center = Transforms[Index].GetLocation();
-			const double Tolerance = ToleranceConstant;
-
-			CollocationWriter->SetValue(Index, 0);
-
-			if (LinearOccurencesWriter)
-			{
-				LinearOccurencesWriter->SetValue(Index, 0);
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Center, FVector(Tolerance)), [&](const PCGPointOctree::FPointRef& PointRef)
-				{
-					if (PointRef.Index == Index) { return; }
-					if (FVector::Dist(Center, Transforms[PointRef.Index].GetLocation()) > Tolerance) { return; }
-
-					CollocationWriter->SetValue(Index, 1);
-
-					if (PointRef.Index < Index) { LinearOccurencesWriter->SetValue(Index, 1); }
-				});
-			}
-			else
-			{
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Center, FVector(Tolerance)), [&](const PCGPointOctree::FPointRef& PointRef)
-				{
-					if (PointRef.Index == Index) { return; }
-					if (FVector::Dist(Center, Transforms[PointRef.Index].GetLocation()) > Tolerance) { return; }
-
-					CollocationWriter->SetValue(Index, 1);
-				});
-			}
+			// Attributes are collocated flags, not neighbor counts
+			CollocationWriter->SetValue(Index, Counts[Index] > 0 ? 1 : 0);
+			if (LinearOccurencesWriter) { LinearOccurencesWriter->SetValue(Index, LowerCounts[Index] > 0 ? 1 : 0); }
 		}
 	}
 
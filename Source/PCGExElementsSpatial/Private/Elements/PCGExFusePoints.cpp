@@ -4,11 +4,14 @@
 #include "Elements/PCGExFusePoints.h"
 
 
+#include "PCGExBVH.h"
 #include "Data/PCGExPointIO.h"
 #include "Blenders/PCGExUnionBlender.h"
 #include "Async/ParallelFor.h"
 #include "Clusters/PCGExClusterCommon.h"
 #include "Data/PCGExData.h"
+#include "Data/PCGExSpatialIndexRegistry.h"
+#include "Math/PCGExToleranceGrid.h"
 #include "PCGExGraphs/Public/Graphs/Union/PCGExIntersections.h"
 
 #define LOCTEXT_NAMESPACE "PCGExFusePointsElement"
@@ -102,6 +105,23 @@ namespace PCGExFusePoints
 
 		PointDataFacade->CreateReadables(SourceAttributes);
 
+		const FPCGExFuseDetails& FuseDetails = UnionGraph->FuseDetails;
+		if (FuseDetails.FuseMethod == EPCGExFuseMethod::Octree && FuseDetails.ToleranceInput == EPCGExInputValueType::Constant
+			&& FuseDetails.SourceDistance == EPCGExDistance::Center && FuseDetails.TargetDistance == EPCGExDistance::Center)
+		{
+			// Center to center with a constant tolerance only depends on positions;
+			// resolve the same greedy insertion on a tolerance grid, in parallel, instead of one point at a time.
+			// Exact distance ties between two leaders go to the lowest leader index rather than the first one the octree visits.
+			PCGExMath::FToleranceGrid Grid(FuseDetails.Tolerances, FuseDetails.bComponentWiseTolerance, false);
+			Grid.Build(PointDataFacade->GetIn());
+
+			TArray<int32> Leaders;
+			Grid.Fuse(Leaders);
+
+			UnionGraph->InsertFusedPoints(PointDataFacade->Source, Leaders);
+			return true;
+		}
+
 		bForceSingleThreadedProcessPoints = true; // Sequential insertion for deterministic node ordering
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
@@ -167,23 +187,11 @@ namespace PCGExFusePoints
 		if (Settings->Mode == EPCGExFusedPointOutput::MostCentral)
 		{
 			TArray<int32>& IdxMapping = PointDataFacade->Source->GetIdxMapping(NumUnionNodes);
-			const PCGPointOctree::FPointOctree& Octree = PointDataFacade->GetIn()->GetPointOctree();
-			const TConstPCGValueRange<FTransform> OutTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+			const TSharedPtr<const PCGExBVH::FItemBVH> PointBVH = PCGExData::FSpatialIndexRegistry::Get().GetPointBVH(PointDataFacade->GetIn());
 			ParallelFor(NumUnionNodes, [&](int32 Index)
 			{
-				const FVector Center = UnionGraph->Nodes[Index]->GetCenter();
 				double BestDist = MAX_dbl;
-				int32 BestIndex = -1;
-
-				Octree.FindNearbyElements(Center, [&](const PCGPointOctree::FPointRef& PointRef)
-				{
-					const double Dist = FVector::DistSquared(Center, OutTransforms[PointRef.Index].GetLocation());
-					if (Dist < BestDist)
-					{
-						BestDist = Dist;
-						BestIndex = PointRef.Index;
-					}
-				});
+				int32 BestIndex = PointBVH->FindNearest(UnionGraph->Nodes[Index]->GetCenter(), BestDist);
 
 				if (BestIndex == -1) { BestIndex = UnionGraph->Nodes[Index]->Point.Index; }
 				IdxMapping[Index] = BestIndex;
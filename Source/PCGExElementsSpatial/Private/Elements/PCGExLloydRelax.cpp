@@ -81,13 +81,23 @@ namespace PCGExLloydRelax
 		{
 			NumIterations--;
 
-			TUniquePtr<PCGExMath::Geo::TDelaunay3> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay3>();
+			TSharedPtr<PCGExMath::Geo::TDelaunay3> Delaunay = Processor->Delaunay;
 			TArray<FVector>& Positions = Processor->ActivePositions;
 
+			// Only sites are needed, skip edges & adjacency
 			const TArrayView<FVector> View = MakeArrayView(Positions);
-			if (!Delaunay->Process<false, false>(View)) { return; }
+			if (!Delaunay->Process(View, false, false, false))
+			{
+				Processor->Delaunay.Reset();
+				return;
+			}
 
 			const int32 NumPoints = Positions.Num();
+			const TArray<PCGExMath::Geo::FDelaunaySite3>& Sites = Delaunay->Sites;
+
+			TArray<FVector> Centroids;
+			Centroids.SetNumUninitialized(Sites.Num());
+			PCGEX_PARALLEL_FOR(Sites.Num(), PCGExMath::Geo::GetCentroid(Positions, Sites[i].Vtx, Centroids[i]);)
 
 			TArray<FVector> Sum;
 			Sum.Append(Processor->ActivePositions);
@@ -95,14 +105,12 @@ namespace PCGExLloydRelax
 			TArray<double> Counts;
 			Counts.Init(1, NumPoints);
 
-			FVector Centroid;
-			for (const PCGExMath::Geo::FDelaunaySite3& Site : Delaunay->Sites)
+			for (int32 s = 0; s < Sites.Num(); s++)
 			{
-				PCGExMath::Geo::GetCentroid(Positions, Site.Vtx, Centroid);
-				for (const int32 PtIndex : Site.Vtx)
+				for (const int32 PtIndex : Sites[s].Vtx)
 				{
 					Counts[PtIndex] += 1;
-					Sum[PtIndex] += Centroid;
+					Sum[PtIndex] += Centroids[s];
 				}
 			}
 
@@ -111,7 +119,7 @@ namespace PCGExLloydRelax
 				PCGEX_PARALLEL_FOR(NumPoints, Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i));)
 			}
 
-			Delaunay.Reset();
+			if (NumIterations <= 0) { Processor->Delaunay.Reset(); }
 
 			if (NumIterations > 0)
 			{
@@ -133,6 +141,7 @@ namespace PCGExLloydRelax
 		if (!InfluenceDetails.Init(ExecutionContext, PointDataFacade)) { return false; }
 
 		PCGExPointArrayDataHelpers::PointsToPositions(PointDataFacade->GetIn(), ActivePositions);
+		Delaunay = MakeShared<PCGExMath::Geo::TDelaunay3>();
 
 		PCGEX_SHARED_THIS_DECL
 		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
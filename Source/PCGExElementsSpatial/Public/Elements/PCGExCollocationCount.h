@@ -5,7 +5,6 @@
 
 #include "CoreMinimal.h"
 #include "Core/PCGExPointsProcessor.h"
-#include "Utils/PCGPointOctree.h"
 
 
 #include "PCGExCollocationCount.generated.h"
@@ -79,7 +78,8 @@ namespace PCGExCollocationCount
 		TSharedPtr<PCGExData::TBuffer<int32>> CollocationWriter;
 		TSharedPtr<PCGExData::TBuffer<int32>> LinearOccurencesWriter;
 
-		const PCGPointOctree::FPointOctree* Octree = nullptr;
+		TArray<int32> Counts;
+		TArray<int32> LowerCounts;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
@@ -12,6 +12,11 @@
 
 #include "PCGExLloydRelax.generated.h"
 
+namespace PCGExMath::Geo
+{
+	class TDelaunay3;
+}
+
 /**
  * 
  */
@@ -69,6 +74,9 @@ namespace PCGExLloydRelax
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
 
+		// Kept across iterations so the insertion order is only computed once
+		TSharedPtr<PCGExMath::Geo::TDelaunay3> Delaunay;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
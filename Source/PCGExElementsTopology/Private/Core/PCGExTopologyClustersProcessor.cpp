@@ -194,7 +194,7 @@ namespace PCGExTopologyEdges
 		FPlatformAtomics::InterlockedAdd(&ConstrainedEdgesNum, LocalConstrainedEdgesNum);
 	}
 
-	void IProcessor::ApplyPointData()
+	void IProcessor::ApplyPointData(TArray<int32>&& InVertexPointIndices)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(TopologyClustersProcessor::ApplyPointData);
 
@@ -219,8 +219,8 @@ namespace PCGExTopologyEdges
 			UE::Geometry::FDynamicMeshColorOverlay* Colors = InMesh.Attributes()->PrimaryColors();
 			UE::Geometry::FDynamicMeshMaterialAttribute* MaterialID = InMesh.Attributes()->GetMaterialID();
 
-			TArray<int32> VtxIDs;
-			VtxIDs.Init(-1, VtxCount);
+			TArray<int32> VtxIDs = MoveTemp(InVertexPointIndices);
+			if (VtxIDs.Num() != VtxCount) { VtxIDs.Init(-1, VtxCount); }
 
 			TArray<int32> ElemIDs;
 			ElemIDs.SetNum(VtxCount);
@@ -229,14 +229,18 @@ namespace PCGExTopologyEdges
 
 			ParallelFor(VtxCount, [&](int32 i)
 			{
-				const int32* WP = HashMapRef.Find(PCGEx::GH2(InMesh.GetVertex(i), CWTolerance));
-				if (WP)
+				int32 PointIndex = VtxIDs[i];
+				if (PointIndex == -1)
 				{
-					const int32 PointIndex = *WP;
+					const int32* WP = HashMapRef.Find(PCGEx::GH2(InMesh.GetVertex(i), CWTolerance));
+					if (!WP) { return; }
+
+					PointIndex = *WP;
 					VtxIDs[i] = PointIndex;
-					InMesh.SetVertex(i, Transform.InverseTransformPosition(InTransforms[PointIndex].GetLocation()));
-					Colors->SetElement(ElemIDs[i], FVector4f(InColors[PointIndex]));
 				}
+
+				InMesh.SetVertex(i, Transform.InverseTransformPosition(InTransforms[PointIndex].GetLocation()));
+				Colors->SetElement(ElemIDs[i], FVector4f(InColors[PointIndex]));
 			});
 
 			TArray<int32> TriangleIDs;
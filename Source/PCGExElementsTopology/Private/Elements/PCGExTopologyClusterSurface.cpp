@@ -3,10 +3,16 @@
 
 #include "Elements/PCGExTopologyClusterSurface.h"
 
+#include "UDynamicMesh.h"
 #include "Data/PCGExData.h"
+#include "CompGeom/Delaunay2.h"
+#include "CompGeom/PolygonTriangulation.h"
+#include "Curve/GeneralPolygon2.h"
+#include "DynamicMesh/DynamicMesh3.h"
 #include "GeometryScript/PolygonFunctions.h"
 #include "GeometryScript/MeshPrimitiveFunctions.h"
 #include "Clusters/PCGExCluster.h"
+#include "Core/PCGExBenchmark.h"
 #include "Clusters/Artifacts/PCGExCellDetails.h"
 #include "Clusters/Artifacts/PCGExPlanarFaceEnumerator.h"
 
@@ -68,40 +74,202 @@ namespace PCGExTopologyClusterSurface
 		return true;
 	}
 
+	/** Triangulates a cell into OutTriangles, as node indices. Unused trailing triangles are left invalid. */
+	static bool TriangulateCell(const PCGExClusters::FCell& InCell, const EPCGExCellTriangulation Method, const bool bFlip, TArrayView<UE::Geometry::FIndex3i> OutTriangles)
+	{
+		// Collapse consecutive duplicates, from leaf points
+		TArray<int32> Nodes;
+		TArray<FVector2d> Positions;
+		Nodes.Reserve(InCell.Nodes.Num());
+		Positions.Reserve(InCell.Nodes.Num());
+
+		for (int32 i = 0; i < InCell.Nodes.Num(); i++)
+		{
+			if (!Nodes.IsEmpty() && Nodes.Last() == InCell.Nodes[i]) { continue; }
+			Nodes.Add(InCell.Nodes[i]);
+			Positions.Add(InCell.Polygon[i]);
+		}
+
+		if (Nodes.Num() > 1 && Nodes.Last() == Nodes[0])
+		{
+			Nodes.Pop();
+			Positions.Pop();
+		}
+
+		if (Nodes.Num() < 3) { return false; }
+
+		TArray<UE::Geometry::FIndex3i> Local;
+		if (Method == EPCGExCellTriangulation::ConstrainedDelaunay)
+		{
+			Local = UE::Geometry::ConstrainedDelaunayTriangulate<double>(UE::Geometry::FGeneralPolygon2d(UE::Geometry::FPolygon2d(Positions)));
+		}
+
+		// Ear clipping is also the fallback when delaunay gives up, usually on cells with collinear or duplicate points
+		if (Local.IsEmpty()) { PolygonTriangulation::TriangulateSimplePolygon<double>(Positions, Local, false); }
+		if (Local.IsEmpty()) { return false; }
+
+		int32 Count = 0;
+		for (const UE::Geometry::FIndex3i& Tri : Local)
+		{
+			if (Count >= OutTriangles.Num()) { return false; }
+
+			UE::Geometry::FIndex3i Triangle(Nodes[Tri.A], Nodes[Tri.B], Nodes[Tri.C]);
+
+			// Zero-area triangles around nodes visited twice by the cell outline
+			if (Triangle.A == Triangle.B || Triangle.B == Triangle.C || Triangle.C == Triangle.A) { continue; }
+
+			// Clockwise in projected space, like the polygon-list triangulation this replaces
+			const FVector2d AB = Positions[Tri.B] - Positions[Tri.A];
+			const FVector2d AC = Positions[Tri.C] - Positions[Tri.A];
+			if ((AB.X * AC.Y - AB.Y * AC.X > 0) != bFlip) { Swap(Triangle.B, Triangle.C); }
+
+			OutTriangles[Count++] = Triangle;
+		}
+
+		return Count > 0;
+	}
+
+	/**
+	 * Triangulates cells in parallel, each into its own slice of a flat buffer, then appends them to an empty mesh.
+	 * Vertices are welded through node indices; OutVertexNodes maps each vertex ID to its node.
+	 * @return the number of cells that could not be fully triangulated
+	 */
+	static int32 TriangulateCells(
+		UE::Geometry::FDynamicMesh3& InMesh,
+		const int32 NumNodes,
+		const TArray<TSharedPtr<PCGExClusters::FCell>>& Cells,
+		const EPCGExCellTriangulation Method,
+		const FGeometryScriptPrimitiveOptions& PrimitiveOptions,
+		TArray<int32>& OutVertexNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::TriangulateCells);
+
+		const int32 NumCells = Cells.Num();
+
+		// A simple polygon of N points never needs more than N-2 triangles
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumCells + 1);
+		Offsets[0] = 0;
+		for (int32 i = 0; i < NumCells; i++) { Offsets[i + 1] = Offsets[i] + FMath::Max(0, Cells[i]->Nodes.Num() - 2); }
+
+		TArray<UE::Geometry::FIndex3i> Triangles;
+		Triangles.Init(UE::Geometry::FIndex3i::Invalid(), Offsets[NumCells]);
+
+		TArray<int8> Failed;
+		Failed.Init(0, NumCells);
+
+		PCGEX_PARALLEL_FOR(
+			NumCells,
+			const TArrayView<UE::Geometry::FIndex3i> Slice(Triangles.GetData() + Offsets[i], Offsets[i + 1] - Offsets[i]);
+			if (!TriangulateCell(*Cells[i], Method, PrimitiveOptions.bFlipOrientation, Slice)) { Failed[i] = 1; }
+		)
+
+		// Weld on node indices, in node order so vertex IDs don't depend on scheduling
+		TArray<int32> NodeVertex;
+		NodeVertex.Init(-1, NumNodes);
+		for (const UE::Geometry::FIndex3i& Triangle : Triangles)
+		{
+			if (Triangle.A == -1) { continue; }
+			NodeVertex[Triangle.A] = NodeVertex[Triangle.B] = NodeVertex[Triangle.C] = 0;
+		}
+
+		OutVertexNodes.Reset();
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			if (NodeVertex[i] == -1) { continue; }
+			NodeVertex[i] = InMesh.AppendVertex(FVector3d::ZeroVector);
+			OutVertexNodes.Add(i);
+		}
+
+		InMesh.EnableTriangleGroups();
+
+		const bool bSingleGroup = PrimitiveOptions.PolyGroupMode == EGeometryScriptPrimitivePolygroupMode::SingleGroup;
+		for (int32 i = 0; i < NumCells; i++)
+		{
+			const int32 GroupID = bSingleGroup ? 0 : i;
+			for (int32 t = Offsets[i]; t < Offsets[i + 1]; t++)
+			{
+				const UE::Geometry::FIndex3i& Triangle = Triangles[t];
+				if (Triangle.A == -1) { break; }
+
+				if (InMesh.AppendTriangle(NodeVertex[Triangle.A], NodeVertex[Triangle.B], NodeVertex[Triangle.C], GroupID) < 0) { Failed[i] = 1; }
+			}
+		}
+
+		int32 NumFailed = 0;
+		for (const int8 bFailed : Failed) { NumFailed += bFailed; }
+		return NumFailed;
+	}
+
 	void FProcessor::CompleteWork()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::CompleteWork);
 
-		// Build polygons from enumerated cells
-		FGeometryScriptGeneralPolygonList ClusterPolygonList;
-		ClusterPolygonList.Reset();
-
-		TArray<FGeometryScriptSimplePolygon> Polygons;
-		Polygons.Reserve(ValidCells.Num() + 1);
+		TArray<TSharedPtr<PCGExClusters::FCell>> Cells;
+		Cells.Reserve(ValidCells.Num() + 1);
 
 		for (const TSharedPtr<PCGExClusters::FCell>& Cell : ValidCells)
 		{
 			if (!Cell || Cell->Polygon.IsEmpty()) { continue; }
-
-			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
-			Polygon.Reset(Cell->Polygon.Num());
-			Polygon.Vertices->Append(Cell->Polygon);
+			Cells.Add(Cell);
 		}
 
 		// Handle wrapper cell as sole path if needed
-		if (Polygons.IsEmpty() && CellsConstraints->WrapperCell && Settings->Constraints.bKeepWrapperIfSolePath)
+		if (Cells.IsEmpty() && CellsConstraints->WrapperCell && Settings->Constraints.bKeepWrapperIfSolePath)
 		{
-			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
-			Polygon.Reset(CellsConstraints->WrapperCell->Polygon.Num());
-			Polygon.Vertices->Append(CellsConstraints->WrapperCell->Polygon);
+			Cells.Add(CellsConstraints->WrapperCell);
 		}
 
-		if (Polygons.IsEmpty())
+		if (Cells.IsEmpty())
 		{
 			bIsProcessorValid = false;
 			return;
 		}
 
+		// Custom triangulation options only apply to the geometry script polygon list, keep it whenever they are set
+		const FGeometryScriptPolygonsTriangulationOptions DefaultTriangulationOptions;
+		if (!FGeometryScriptPolygonsTriangulationOptions::StaticStruct()->CompareScriptStruct(&Settings->Topology.TriangulationOptions, &DefaultTriangulationOptions, PPF_None))
+		{
+			AppendPolygonList(Cells);
+			return;
+		}
+
+		int32 NumFailed = 0;
+		TArray<int32> VertexPointIndices;
+
+		GetInternalMesh()->EditMesh([&](FDynamicMesh3& InMesh)
+		{
+			NumFailed = TriangulateCells(InMesh, Cluster->Nodes->Num(), Cells, Settings->Triangulation, Settings->Topology.PrimitiveOptions, VertexPointIndices);
+		}, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+		if (NumFailed > 0 && !Settings->Topology.bQuietTriangulationError)
+		{
+			PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FText::Format(FTEXT("Triangulation error on {0} cells."), FText::AsNumber(NumFailed)));
+		}
+
+		// Vertex -> node -> point
+		for (int32& Index : VertexPointIndices) { Index = Cluster->GetNodePointIndex(Index); }
+
+		ApplyPointData(MoveTemp(VertexPointIndices));
+	}
+
+	void FProcessor::AppendPolygonList(const TArray<TSharedPtr<PCGExClusters::FCell>>& InCells)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::AppendPolygonList);
+
+		TArray<FGeometryScriptSimplePolygon> Polygons;
+		Polygons.Reserve(InCells.Num());
+
+		for (const TSharedPtr<PCGExClusters::FCell>& Cell : InCells)
+		{
+			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
+			Polygon.Reset(Cell->Polygon.Num());
+			Polygon.Vertices->Append(Cell->Polygon);
+		}
+
+		FGeometryScriptGeneralPolygonList ClusterPolygonList;
+		ClusterPolygonList.Reset();
+
 		UGeometryScriptLibrary_PolygonListFunctions::AppendPolygonList(
 			ClusterPolygonList,
 			UGeometryScriptLibrary_PolygonListFunctions::CreatePolygonListFromSimplePolygons(Polygons));
@@ -130,5 +298,104 @@ namespace PCGExTopologyClusterSurface
 	}
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExTopologyClusterSurface
+{
+	namespace Benchmark
+	{
+		// Jittered grid of octagonal cells; every cell is a quad with a node in the middle of each side, shared with its neighbors
+		struct FCellGrid
+		{
+			TSharedPtr<PCGExClusters::FCellConstraints> Constraints;
+			TArray<FVector2D> NodePositions;
+			TArray<TSharedPtr<PCGExClusters::FCell>> Cells;
+			TArray<FGeometryScriptSimplePolygon> Polygons;
+		};
+
+		static TSharedPtr<FCellGrid> MakeCellGrid(const int32 NumCells)
+		{
+			TSharedPtr<FCellGrid> Grid = MakeShared<FCellGrid>();
+
+			const int32 CellsPerRow = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<double>(NumCells))));
+			const int32 NodesPerRow = CellsPerRow * 2 + 1;
+
+			FRandomStream Random(1337);
+			Grid->NodePositions.SetNumUninitialized(NodesPerRow * NodesPerRow);
+			for (int32 y = 0; y < NodesPerRow; y++)
+			{
+				for (int32 x = 0; x < NodesPerRow; x++) { Grid->NodePositions[y * NodesPerRow + x] = FVector2D(x * 50 + Random.FRandRange(-10, 10), y * 50 + Random.FRandRange(-10, 10)); }
+			}
+
+			Grid->Constraints = MakeShared<PCGExClusters::FCellConstraints>(FPCGExCellConstraintsDetails());
+
+			static const FIntPoint Ring[8] = {{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
+
+			Grid->Cells.Reserve(NumCells);
+			Grid->Polygons.Reserve(NumCells);
+
+			for (int32 c = 0; c < NumCells; c++)
+			{
+				const int32 X = (c % CellsPerRow) * 2;
+				const int32 Y = (c / CellsPerRow) * 2;
+
+				const TSharedPtr<PCGExClusters::FCell> Cell = MakeShared<PCGExClusters::FCell>(Grid->Constraints.ToSharedRef());
+				FGeometryScriptSimplePolygon& Polygon = Grid->Polygons.Emplace_GetRef();
+				Polygon.Reset(8);
+
+				for (const FIntPoint& Offset : Ring)
+				{
+					const int32 Node = (Y + Offset.Y) * NodesPerRow + X + Offset.X;
+					Cell->Nodes.Add(Node);
+					Cell->Polygon.Add(Grid->NodePositions[Node]);
+					Polygon.Vertices->Add(Grid->NodePositions[Node]);
+				}
+
+				Grid->Cells.Add(Cell);
+			}
+
+			return Grid;
+		}
+
+		template <EPCGExCellTriangulation Method>
+		static PCGExBenchmark::FKernel MakeTriangulationKernel(const int32 Scale)
+		{
+			return [Grid = MakeCellGrid(Scale)]()
+			{
+				UE::Geometry::FDynamicMesh3 Mesh;
+				TArray<int32> VertexNodes;
+				TriangulateCells(Mesh, Grid->NodePositions.Num(), Grid->Cells, Method, FGeometryScriptPrimitiveOptions(), VertexNodes);
+			};
+		}
+	}
+
+	// Cells per second, e.g. pcgex.Bench.Run Filter=Topology.ClusterSurface* Scales=10000+50000
+	static PCGExBenchmark::FRegistrar BenchTriangulateDelaunay(
+		TEXT("Topology.ClusterSurface.Delaunay"), TEXT("Parallel constrained delaunay triangulation of N octagonal cells"),
+		&Benchmark::MakeTriangulationKernel<EPCGExCellTriangulation::ConstrainedDelaunay>);
+
+	static PCGExBenchmark::FRegistrar BenchTriangulateEarClipping(
+		TEXT("Topology.ClusterSurface.EarClipping"), TEXT("Parallel ear clipping triangulation of N octagonal cells"),
+		&Benchmark::MakeTriangulationKernel<EPCGExCellTriangulation::EarClipping>);
+
+	static PCGExBenchmark::FRegistrar BenchTriangulatePolygonList(
+		TEXT("Topology.ClusterSurface.PolygonList"), TEXT("Geometry script polygon list triangulation of N octagonal cells, what this node used to do"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			return [Grid = Benchmark::MakeCellGrid(Scale)]()
+			{
+				FGeometryScriptGeneralPolygonList PolygonList;
+				PolygonList.Reset();
+				UGeometryScriptLibrary_PolygonListFunctions::AppendPolygonList(PolygonList, UGeometryScriptLibrary_PolygonListFunctions::CreatePolygonListFromSimplePolygons(Grid->Polygons));
+
+				bool bTriangulationError = false;
+				UDynamicMesh* ScriptMesh = NewObject<UDynamicMesh>();
+				UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendPolygonListTriangulation(ScriptMesh, FGeometryScriptPrimitiveOptions(), FTransform::Identity, PolygonList, FGeometryScriptPolygonsTriangulationOptions(), bTriangulationError);
+			};
+		});
+}
+
+#endif
+
 #undef LOCTEXT_NAMESPACE
 #undef PCGEX_NAMESPACE
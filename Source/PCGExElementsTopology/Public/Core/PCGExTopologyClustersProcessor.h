@@ -134,7 +134,11 @@ namespace PCGExTopologyEdges
 
 	protected:
 		void FilterConstrainedEdgeScope(const PCGExMT::FScope& Scope);
-		void ApplyPointData();
+		/**
+		 * Moves mesh vertices onto their source points & writes point attributes to the mesh.
+		 * Vertices are matched to points through their projected position, unless InVertexPointIndices already maps each vertex ID to a point index.
+		 */
+		void ApplyPointData(TArray<int32>&& InVertexPointIndices = TArray<int32>());
 	};
 
 	template <typename TContext, typename TSettings>
@@ -11,6 +11,13 @@
 
 #include "PCGExTopologyClusterSurface.generated.h"
 
+UENUM()
+enum class EPCGExCellTriangulation : uint8
+{
+	ConstrainedDelaunay = 0 UMETA(DisplayName = "Constrained Delaunay", ToolTip="Delaunay triangulation constrained to the cell outline. Better shaped triangles."),
+	EarClipping         = 1 UMETA(DisplayName = "Ear Clipping", ToolTip="Ear clipping. Faster, but can produce slivers."),
+};
+
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Clusters", meta=(Keywords = "collision"), meta=(PCGExNodeLibraryDoc="topology/topology-cluster-surface"))
 class UPCGExTopologyClusterSurfaceSettings : public UPCGExTopologyClustersProcessorSettings
 {
@@ -26,6 +33,12 @@ protected:
 	virtual FPCGElementPtr CreateElement() const override;
 	//~End UPCGSettings
 
+public:
+	/** How each cell is triangulated. Cells are triangulated in parallel, and share vertices with adjacent cells.
+	 * Ignored when Topology Triangulation Options differ from their defaults: cells then go through the serial geometry script polygon list triangulation instead. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExCellTriangulation Triangulation = EPCGExCellTriangulation::ConstrainedDelaunay;
+
 private:
 	friend class FPCGExTopologyClustersProcessorElement;
 };
@@ -69,6 +82,10 @@ namespace PCGExTopologyClusterSurface
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void CompleteWork() override;
+
+	protected:
+		/** Serial geometry script polygon list triangulation, the only path that honors Topology.TriangulationOptions */
+		void AppendPolygonList(const TArray<TSharedPtr<PCGExClusters::FCell>>& InCells);
 	};
 
 	class FBatch final : public PCGExTopologyEdges::TBatch<FProcessor>
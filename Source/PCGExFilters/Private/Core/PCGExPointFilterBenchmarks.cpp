@@ -0,0 +1,74 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Core/PCGExPointFilter.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExDataBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+#include "Filters/Points/PCGExNumericCompareFilter.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Point filter stack throughput, e.g. pcgex.Bench.Run Filter=Filters.* Scales=100000+1000000
+namespace PCGExPointFilter
+{
+	namespace Benchmark
+	{
+		constexpr double Extent = 10000;
+
+		// Members are released in reverse order, the context goes last
+		struct FScene
+		{
+			TSharedPtr<PCGExData::Benchmark::FContextFixture> Fixture;
+			TSharedPtr<PCGExData::FPointIO> PointIO;
+			TArray<TStrongObjectPtr<UPCGExNumericCompareFilterFactory>> Factories;
+		};
+
+		static void AddCompare(FScene& Scene, const TCHAR* InOperandA, const EPCGExComparison InComparison, const double InOperandB)
+		{
+			UPCGExNumericCompareFilterFactory* Factory = NewObject<UPCGExNumericCompareFilterFactory>();
+			Factory->Config.OperandA.Update(InOperandA);
+			Factory->Config.Comparison = InComparison;
+			Factory->Config.OperandBConstant = InOperandB;
+			Factory->Init(Scene.Fixture->Get());
+			Scene.Factories.Emplace(Factory);
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchNumericCompare(
+		TEXT("Filters.NumericCompare"), TEXT("Parallel test of N points against a stack of 3 numeric compare filters on point properties, facade & buffers included"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			TSharedPtr<Benchmark::FScene> Scene = MakeShared<Benchmark::FScene>();
+			Scene->Fixture = MakeShared<PCGExData::Benchmark::FContextFixture>();
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, Scale, true, Benchmark::Extent);
+			Scene->PointIO = Scene->Fixture->MakePointIO(Scene->Fixture->MakePointData(Positions));
+			if (!Scene->PointIO) { return nullptr; }
+
+			// Each filter keeps ~3/4 of the points, so most points go through the whole stack
+			Benchmark::AddCompare(*Scene, TEXT("$Position.X"), EPCGExComparison::StrictlyGreater, Benchmark::Extent * 0.25);
+			Benchmark::AddCompare(*Scene, TEXT("$Position.Y"), EPCGExComparison::StrictlySmaller, Benchmark::Extent * 0.75);
+			Benchmark::AddCompare(*Scene, TEXT("$Density"), EPCGExComparison::EqualOrSmaller, 1);
+
+			TArray<TObjectPtr<const UPCGExPointFilterFactoryData>> Factories;
+			for (const TStrongObjectPtr<UPCGExNumericCompareFilterFactory>& Factory : Scene->Factories) { Factories.Add(Factory.Get()); }
+
+			return [Scene, Factories = MoveTemp(Factories)]()
+			{
+				const TSharedPtr<PCGExData::FFacade> Facade = MakeShared<PCGExData::FFacade>(Scene->PointIO.ToSharedRef());
+				const TSharedPtr<FManager> Manager = MakeShared<FManager>(Facade.ToSharedRef());
+				if (!Manager->Init(Scene->Fixture->Get(), Factories)) { return; }
+
+				TArray<int8> Results;
+				Results.SetNumUninitialized(Facade->GetNum());
+				Manager->Test(PCGExMT::FScope(0, Results.Num()), Results, true);
+			};
+		});
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "Filters/Points/PCGExInclusionFilter.h"
 
 
+#include "Core/PCGExMT.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 #include "Paths/PCGExPath.h"
@@ -15,6 +16,11 @@
 #define LOCTEXT_NAMESPACE "PCGExInclusionFilterDefinition"
 #define PCGEX_NAMESPACE PCGExInclusionFilterDefinition
 
+namespace PCGExInclusionFilter
+{
+	constexpr int32 ClassifyChunkSize = 4096;
+}
+
 bool UPCGExInclusionFilterFactory::SupportsCollectionEvaluation() const
 {
 	return Config.bCheckAgainstDataBounds;
@@ -102,6 +108,26 @@ namespace PCGExPointFilter
 			InPointDataFacade->Source->GetDataAsProxyPoint(ProxyPoint);
 			bCollectionTestResult = Test(ProxyPoint);
 		}
+		else if (!InverseMatcher && Handler->IsFastCheck())
+		{
+			// Inclusion only depends on projected polygons, classify all points up front so each path is tested once per chunk
+			const int32 NumPoints = InTransforms.Num();
+			PointFlags.SetNumUninitialized(NumPoints);
+			PointInclusionCounts.SetNumUninitialized(NumPoints);
+
+			TArray<int8> InsideScratch;
+			InsideScratch.SetNumUninitialized(NumPoints);
+
+			TArray<PCGExMT::FScope> Loops;
+			PCGExMT::SubLoopScopes(Loops, NumPoints, PCGExInclusionFilter::ClassifyChunkSize);
+
+			const bool bClosestOnly = TypedFilterFactory->Config.Pick == EPCGExSplineFilterPick::Closest;
+			const UPCGData* ParentData = InPointDataFacade->Source->GetIn();
+			PCGEX_PARALLEL_FOR(
+				Loops.Num(),
+				Handler->GetInclusionFlags(InTransforms, Loops[i], bClosestOnly, ParentData, PointFlags, PointInclusionCounts, InsideScratch);
+			)
+		}
 
 		return true;
 	}
@@ -136,7 +162,17 @@ namespace PCGExPointFilter
 		}
 
 		int32 InclusionsCount = 0;
-		PCGExPathInclusion::EFlags Flags = Handler->GetInclusionFlags(InTransforms[PointIndex].GetLocation(), InclusionsCount, TypedFilterFactory->Config.Pick == EPCGExSplineFilterPick::Closest, PointDataFacade->Source->GetIn(), AdditionalExclude);
+		PCGExPathInclusion::EFlags Flags;
+
+		if (!PointFlags.IsEmpty())
+		{
+			InclusionsCount = PointInclusionCounts[PointIndex];
+			Flags = static_cast<PCGExPathInclusion::EFlags>(PointFlags[PointIndex]);
+		}
+		else
+		{
+			Flags = Handler->GetInclusionFlags(InTransforms[PointIndex].GetLocation(), InclusionsCount, TypedFilterFactory->Config.Pick == EPCGExSplineFilterPick::Closest, PointDataFacade->Source->GetIn(), AdditionalExclude);
+		}
 
 		PCGEX_CHECK_MAX
 		PCGEX_CHECK_MIN
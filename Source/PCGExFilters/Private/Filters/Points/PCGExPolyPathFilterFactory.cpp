@@ -165,6 +165,7 @@ PCGExFactories::EPreparationResult UPCGExPolyPathFilterFactory::Prepare(FPCGExCo
 
 		if (Path)
 		{
+			Path->BuildInclusionGrid();
 			if (bBuildEdgeOctree) { Path->BuildEdgeOctree(); }
 			TempPolyPaths[Index] = Path;
 			TSharedPtr<PCGExData::FTags> Tags = MakeShared<PCGExData::FTags>(TempTargets[Index].Tags);
@@ -386,6 +387,53 @@ namespace PCGExPathInclusion
 		return static_cast<EFlags>(OutFlags);
 	}
 
+	void FHandler::GetInclusionFlags(const TConstPCGValueRange<FTransform>& InPositions, const PCGExMT::FScope& Scope, const bool bClosestOnly, const UPCGData* InParentData, TArray<int8>& OutFlags, TArray<int32>& OutInclusionCounts, TArray<int8>& InsideScratch) const
+	{
+		check(bFastCheck)
+
+		const auto* DataArray = Datas->GetData();
+		const auto* PathArray = Paths->GetData();
+
+		FBox ScopeBounds = FBox(ForceInit);
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			ScopeBounds += InPositions[Index].GetLocation();
+			OutFlags[Index] = None;
+			OutInclusionCounts[Index] = 0;
+		}
+
+		if (!ScopeBounds.IsValid) { return; }
+
+		// A sub-query of the tree visits elements in the same relative order a per-position query does,
+		// which matters when only the last path visited is kept
+		TArray<PCGExOctree::FItem, TInlineAllocator<16>> Candidates;
+		Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(ScopeBounds.ExpandBy(1)), [&](const PCGExOctree::FItem& Item)
+		{
+			if (bIgnoreSelf && DataArray[Item.Index].Data == InParentData) { return; }
+			if (!MatchIgnoreList.IsEmpty() && MatchIgnoreList.Contains(DataArray[Item.Index].Data)) { return; }
+			Candidates.Add(Item);
+		});
+
+		for (const PCGExOctree::FItem& Item : Candidates)
+		{
+			PathArray[Item.Index]->ClassifyPoints(InPositions, Scope, InsideScratch);
+
+			const FBoxCenterAndExtent ItemBounds(Item.Bounds);
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				// Same overlap test as a per-position query
+				if (!Intersect(FBoxCenterAndExtent(InPositions[Index].GetLocation(), FVector::OneVector), ItemBounds)) { continue; }
+
+				const bool bInside = InsideScratch[Index] != 0;
+				OutInclusionCounts[Index] += bInside;
+				const EFlags Flag = bInside ? Inside : Outside;
+				OutFlags[Index] = static_cast<int8>(bClosestOnly ? Flag : OutFlags[Index] | Flag);
+			}
+		}
+
+		PCGEX_SCOPE_LOOP(Index) { if (OutFlags[Index] == None) { OutFlags[Index] = Outside; } }
+	}
+
 	PCGExMath::FClosestPosition FHandler::FindClosestIntersection(const PCGExMath::FSegment& Segment, const FPCGExPathIntersectionDetails& InDetails, const UPCGData* InParentData, const TSet<const UPCGData*>* InAdditionalExclude) const
 	{
 		PCGExMath::FClosestPosition ClosestIntersection;
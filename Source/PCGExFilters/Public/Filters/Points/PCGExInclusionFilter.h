@@ -145,6 +145,10 @@ namespace PCGExPointFilter
 		bool bCheckAgainstDataBounds = false;
 		TConstPCGValueRange<FTransform> InTransforms;
 
+		// Fast check flags & counts of every point, classified in bulk during Init; empty when points are tested one by one
+		TArray<int8> PointFlags;
+		TArray<int32> PointInclusionCounts;
+
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
@@ -183,6 +183,9 @@ namespace PCGExPathInclusion
 
 		void Init(const EPCGExSplineCheckType InCheckType);
 
+		/** Whether inclusion only depends on projected polygons, i.e positions can be classified in bulk */
+		bool IsFastCheck() const { return bFastCheck; }
+
 		FORCEINLINE bool TestFlags(const EFlags InFlags) const
 		{
 			bool bPass = (InFlags & BadFlags) == 0; // None of the bad flags
@@ -197,6 +200,13 @@ namespace PCGExPathInclusion
 		}
 
 		EFlags GetInclusionFlags(const FVector& WorldPosition, int32& InclusionCount, const bool bClosestOnly, const UPCGData* InParentData = nullptr, const TSet<const UPCGData*>* InAdditionalExclude = nullptr) const;
+
+		/**
+		 * Fast check only. Same flags & counts as the per-position overload for a whole scope of positions, each candidate path
+		 * classifying the scope at once through FPath::ClassifyPoints. Out arrays & scratch are indexed like the positions;
+		 * concurrent calls may share them as long as their scopes don't overlap.
+		 */
+		void GetInclusionFlags(const TConstPCGValueRange<FTransform>& InPositions, const PCGExMT::FScope& Scope, const bool bClosestOnly, const UPCGData* InParentData, TArray<int8>& OutFlags, TArray<int32>& OutInclusionCounts, TArray<int8>& InsideScratch) const;
 		PCGExMath::FClosestPosition FindClosestIntersection(const PCGExMath::FSegment& Segment, const FPCGExPathIntersectionDetails& InDetails, const UPCGData* InParentData = nullptr, const TSet<const UPCGData*>* InAdditionalExclude = nullptr) const;
 	};
 }
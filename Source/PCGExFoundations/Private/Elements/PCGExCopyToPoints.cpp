@@ -9,6 +9,7 @@
 #include "Fitting/PCGExFittingTasks.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Helpers/PCGExMatchingHelpers.h"
+#include "Utils/PCGExPointIOMerger.h"
 
 #define LOCTEXT_NAMESPACE "PCGExCopyToPointsElement"
 #define PCGEX_NAMESPACE CopyToPoints
@@ -38,6 +39,14 @@ bool FPCGExCopyToPointsElement::Boot(FPCGExContext* InContext) const
 
 	PCGEX_CONTEXT_AND_SETTINGS(CopyToPoints)
 
+	Context->CopyStats.Start();
+
+	if (Settings->CopyMode == EPCGExCopyMode::Merged)
+	{
+		PCGEX_VALIDATE_NAME(Settings->InstanceIndexAttributeName)
+		Context->CarryOverDetails.Init();
+	}
+
 	Context->TargetsDataFacade = PCGExData::TryGetSingleFacade(Context, PCGExCommon::Labels::SourceTargetsLabel, false, true);
 	if (!Context->TargetsDataFacade) { return false; }
 
@@ -70,6 +79,7 @@ bool FPCGExCopyToPointsElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry) { return true; },
 			[&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
 			{
+				NewBatch->bRequiresWriteStep = Settings->CopyMode == EPCGExCopyMode::Merged;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not find any points to process."));
@@ -80,6 +90,8 @@ bool FPCGExCopyToPointsElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 
 	Context->MainPoints->StageOutputs();
 
+	if (Settings->bLogCopyStats) { Context->CopyStats.Log(TEXT("Copy to Points")); }
+
 	return Context->TryComplete();
 }
 
@@ -96,7 +108,8 @@ namespace PCGExCopyToPoints
 		const UPCGBasePointData* Targets = Context->TargetsDataFacade->GetIn();
 		const int32 NumTargets = Targets->GetNumPoints();
 
-		PCGExArrayHelpers::InitArray(Dupes, NumTargets);
+		if (Settings->CopyMode == EPCGExCopyMode::Merged) { PCGExArrayHelpers::InitArray(Matches, NumTargets); }
+		else { PCGExArrayHelpers::InitArray(Dupes, NumTargets); }
 
 		StartParallelLoopForRange(NumTargets, 32);
 
@@ -108,13 +121,29 @@ namespace PCGExCopyToPoints
 		int32 Copies = 0;
 		FPCGExTaggedData AsCandidate = PointDataFacade->Source->GetTaggedData();
 
+		if (Settings->CopyMode == EPCGExCopyMode::Merged)
+		{
+			// Only record matches, the merged output is sized once they're all known
+			PCGEX_SCOPE_LOOP(i)
+			{
+				Matches[i] = Context->DataMatcher->Test(Context->TargetsDataFacade->GetInPoint(i), AsCandidate, MatchScope);
+				if (Matches[i]) { Copies++; }
+			}
+
+			if (Copies > 0) { FPlatformAtomics::InterlockedAdd(&NumCopies, Copies); }
+			return;
+		}
+
+		const bool bShared = Settings->CopyMode == EPCGExCopyMode::Shared;
+		const UPCGBasePointData* InPointData = PointDataFacade->GetIn();
+
 		PCGEX_SCOPE_LOOP(i)
 		{
 			Dupes[i] = nullptr;
 
 			if (!Context->DataMatcher->Test(Context->TargetsDataFacade->GetInPoint(i), AsCandidate, MatchScope)) { continue; }
 
-			TSharedPtr<PCGExData::FPointIO> Dupe = Context->MainPoints->Emplace_GetRef(PointDataFacade->Source, PCGExData::EIOInit::Duplicate);
+			TSharedPtr<PCGExData::FPointIO> Dupe = Context->MainPoints->Emplace_GetRef(PointDataFacade->Source, bShared ? PCGExData::EIOInit::Inherit : PCGExData::EIOInit::Duplicate);
 			if (!Dupe) { continue; }
 
 			Copies++;
@@ -122,18 +151,86 @@ namespace PCGExCopyToPoints
 
 			Dupes[i] = Dupe;
 
-			PCGEX_LAUNCH(PCGExFitting::Tasks::FTransformPointIO, i, Context->TargetsDataFacade->Source, Dupe, &Context->TransformDetails)
+			if (Settings->bLogCopyStats)
+			{
+				if (bShared) { Context->CopyStats.Add(InPointData, EPCGPointNativeProperties::Transform, false); }
+				else { Context->CopyStats.Add(InPointData, InPointData->GetAllocatedProperties(), true); }
+			}
+
+			PCGEX_LAUNCH(PCGExFitting::Tasks::FTransformPointIO, i, Context->TargetsDataFacade->Source, Dupe, &Context->TransformDetails, bShared)
 		}
 
 		if (Copies > 0) { FPlatformAtomics::InterlockedAdd(&NumCopies, Copies); }
 	}
 
+	void FProcessor::OnRangeProcessingComplete()
+	{
+		if (Settings->CopyMode != EPCGExCopyMode::Merged || NumCopies == 0) { return; }
+
+		Instances.Reserve(NumCopies);
+		for (int32 i = 0; i < Matches.Num(); i++) { if (Matches[i]) { Instances.Add(i); } }
+
+		const TSharedPtr<PCGExData::FPointIO> MergedIO = Context->MainPoints->Emplace_GetRef(PointDataFacade->Source, PCGExData::EIOInit::New);
+		if (!MergedIO)
+		{
+			bIsProcessorValid = false;
+			return;
+		}
+
+		MergedDataFacade = MakeShared<PCGExData::FFacade>(MergedIO.ToSharedRef());
+
+		// Every copy is a consecutive block of the output, filled in parallel by the merger
+		Merger = MakeShared<FPCGExPointIOMerger>(MergedDataFacade.ToSharedRef());
+		for (int32 i = 0; i < Instances.Num(); i++) { Merger->Append(PointDataFacade->Source); }
+		Merger->MergeAsync(TaskManager, &Context->CarryOverDetails);
+
+		if (Settings->bLogCopyStats)
+		{
+			const UPCGBasePointData* InPointData = PointDataFacade->GetIn();
+			Context->CopyStats.Add(InPointData, InPointData->GetAllocatedProperties() | EPCGPointNativeProperties::MetadataEntry, true, Instances.Num());
+		}
+	}
+
 	void FProcessor::CompleteWork()
 	{
 		if (Settings->DataMatching.bSplitUnmatched && NumCopies == 0)
 		{
 			(void)Context->DataMatcher->HandleUnmatchedOutput(PointDataFacade, true);
 		}
+
+		if (!MergedDataFacade) { return; }
+
+		const int32 NumSourcePoints = PointDataFacade->GetNum();
+		const FBox FittingBounds = PCGExFitting::GetFittingBounds(PointDataFacade->GetIn(), Context->TransformDetails);
+
+		UPCGBasePointData* OutPointData = MergedDataFacade->GetOut();
+		OutPointData->AllocateProperties(EPCGPointNativeProperties::Transform);
+		TPCGValueRange<FTransform> OutTransforms = OutPointData->GetTransformValueRange(false);
+
+		const TSharedPtr<PCGExData::TBuffer<int32>> InstanceIndexWriter = MergedDataFacade->GetWritable<int32>(Settings->InstanceIndexAttributeName, -1, false, PCGExData::EBufferInit::New);
+
+		PCGEX_PARALLEL_FOR(
+			Instances.Num(),
+			const int32 TargetIndex = Instances[i];
+			const int32 Start = i * NumSourcePoints;
+			PCGExFitting::TransformRange(Context->TransformDetails, TargetIndex, FittingBounds, OutTransforms, Start, NumSourcePoints);
+			for (int32 j = Start; j < Start + NumSourcePoints; j++) { InstanceIndexWriter->SetValue(j, TargetIndex); }
+		)
+
+		if (!Context->TargetsForwardHandler->IsEmpty())
+		{
+			TArray<int32> Indices;
+			for (int32 i = 0; i < Instances.Num(); i++)
+			{
+				PCGExArrayHelpers::ArrayOfIndices(Indices, NumSourcePoints, i * NumSourcePoints);
+				Context->TargetsForwardHandler->Forward(Instances[i], MergedDataFacade, Indices);
+			}
+		}
+	}
+
+	void FProcessor::Write()
+	{
+		if (MergedDataFacade) { MergedDataFacade->WriteFastest(TaskManager); }
 	}
 }
 
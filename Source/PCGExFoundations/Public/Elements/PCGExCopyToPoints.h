@@ -6,14 +6,18 @@
 #include "CoreMinimal.h"
 #include "Utils/PCGExCompare.h"
 #include "Core/PCGExPointsProcessor.h"
+#include "Data/Utils/PCGExDataFilterDetails.h"
 #include "Data/Utils/PCGExDataForwardDetails.h"
 
 #include "Details/PCGExMatchingDetails.h"
 #include "Fitting/PCGExFitting.h"
 #include "Helpers/PCGExDataMatcher.h"
+#include "Helpers/PCGExPointArrayDataHelpers.h"
 
 #include "PCGExCopyToPoints.generated.h"
 
+class FPCGExPointIOMerger;
+
 namespace PCGExMatching
 {
 	class FDataMatcher;
@@ -48,6 +52,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTransformDetails TransformDetails = FPCGExTransformDetails(true, true);
 
+	/** How copies are created. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
+	EPCGExCopyMode CopyMode = EPCGExCopyMode::Duplicate;
+
+	/** Name of the attribute that stores the index of the target point each point was copied to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="CopyMode == EPCGExCopyMode::Merged", EditConditionHides))
+	FName InstanceIndexAttributeName = FName("InstanceIndex");
+
+	/** If enabled, logs how many copies were made, what they allocated and how long it took. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bLogCopyStats = false;
+
 	/** Target attributes to copy as tags onto output points. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tagging & Forwarding")
 	FPCGExAttributeToTagDetails TargetsAttributesToCopyTags;
@@ -71,6 +87,9 @@ struct FPCGExCopyToPointsContext final : FPCGExPointsProcessorContext
 	FPCGExAttributeToTagDetails TargetsAttributesToCopyTags;
 	TSharedPtr<PCGExData::FDataForwardHandler> TargetsForwardHandler;
 
+	FPCGExCarryOverDetails CarryOverDetails;
+	PCGExPointArrayDataHelpers::FCopyStats CopyStats;
+
 protected:
 	PCGEX_ELEMENT_BATCH_POINT_DECL
 };
@@ -93,6 +112,12 @@ namespace PCGExCopyToPoints
 		int32 NumCopies = 0;
 		PCGExMatching::FScope MatchScope;
 
+		// Merged mode
+		TArray<int8> Matches;
+		TArray<int32> Instances; // Target index of each copy, in output order
+		TSharedPtr<PCGExData::FFacade> MergedDataFacade;
+		TSharedPtr<FPCGExPointIOMerger> Merger;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -105,6 +130,8 @@ namespace PCGExCopyToPoints
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
+		virtual void OnRangeProcessingComplete() override;
 		virtual void CompleteWork() override;
+		virtual void Write() override;
 	};
 }
@@ -0,0 +1,248 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExClusterOutputCache.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "Engine/World.h"
+#include "Clusters/PCGExClusterCommon.h"
+#include "Core/PCGExClustersProcessor.h"
+#include "Core/PCGExContext.h"
+#include "Core/PCGExDiagnostics.h"
+#include "Data/PCGBasePointData.h"
+#include "Data/PCGExDataTags.h"
+#include "Data/PCGExPointIO.h"
+
+namespace PCGExClusterMT
+{
+	namespace
+	{
+		FORCEINLINE void Mix(uint64& Hash, const uint32 Value)
+		{
+			// FNV-1a step over 32bit words; keys are 64bit so unrelated clusters don't collide in a large cache
+			Hash = (Hash ^ Value) * 0x100000001B3ull;
+		}
+
+		void MixData(uint64& Hash, const UPCGData* InData)
+		{
+			Mix(Hash, InData ? InData->GetOrComputeCrc(true).GetValue() : 0);
+		}
+
+		void MixTags(uint64& Hash, const TSet<FString>& InTags)
+		{
+			// Cluster ids are regenerated from object ids every execution; pairing is already covered by hashing vtx & edges together
+			TArray<FString> Sorted;
+			Sorted.Reserve(InTags.Num());
+			for (const FString& Tag : InTags) { if (!Tag.StartsWith(PCGExClusters::Labels::TagStr_PCGExCluster)) { Sorted.Add(Tag); } }
+			Sorted.Sort();
+
+			Mix(Hash, Sorted.Num());
+			for (const FString& Tag : Sorted) { Mix(Hash, FCrc::StrCrc32(*Tag)); }
+		}
+
+		void MixIO(uint64& Hash, const TSharedRef<PCGExData::FPointIO>& InIO)
+		{
+			MixData(Hash, InIO->GetIn());
+			MixTags(Hash, InIO->Tags->Flatten());
+		}
+	}
+
+	FOutputCache& FOutputCache::Get()
+	{
+		static FOutputCache Instance;
+		return Instance;
+	}
+
+	uint64 FOutputCache::ComputeNodeKey(const FPCGExContext* InContext, const UPCGExClustersProcessorSettings* InSettings)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FOutputCache::ComputeNodeKey);
+
+		uint64 Hash = 0xCBF29CE484222325ull;
+
+		Mix(Hash, GetTypeHash(InSettings->GetClass()->GetFName()));
+		Mix(Hash, InSettings->GetSettingsCrc().GetValue());
+
+		const FName VtxPin = InSettings->GetMainInputPin();
+		for (const FPCGTaggedData& TaggedData : InContext->InputData.TaggedData)
+		{
+			if (TaggedData.Pin == VtxPin || TaggedData.Pin == PCGExClusters::Labels::SourceEdgesLabel) { continue; }
+
+			Mix(Hash, GetTypeHash(TaggedData.Pin));
+			MixData(Hash, TaggedData.Data);
+			MixTags(Hash, TaggedData.Tags);
+		}
+
+		return Hash;
+	}
+
+	uint64 FOutputCache::ComputeClusterKey(const uint64 NodeKey, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<const TSharedRef<PCGExData::FPointIO>> InEdges)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FOutputCache::ComputeClusterKey);
+
+		uint64 Hash = NodeKey;
+
+		MixIO(Hash, InVtx);
+		Mix(Hash, InEdges.Num());
+		for (const TSharedRef<PCGExData::FPointIO>& Edges : InEdges) { MixIO(Hash, Edges); }
+
+		return Hash;
+	}
+
+	bool FOutputCache::TryRestore(const uint64 Key, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<const TSharedRef<PCGExData::FPointIO>> InEdges)
+	{
+		TSharedPtr<FEntry> Entry;
+
+		{
+			FWriteScopeLock WriteLock(Lock);
+
+			const TSharedPtr<FEntry>* Found = Entries.Find(Key);
+			if (!Found || (*Found)->Edges.Num() != InEdges.Num())
+			{
+				NumMisses++;
+				return false;
+			}
+
+			Entry = *Found;
+			Entry->LastAccess = ++AccessCounter;
+			NumHits++;
+		}
+
+		auto Restore = [](const FCachedIO& InCached, const TSharedRef<PCGExData::FPointIO>& InIO)
+		{
+			InIO->ReuseOutput(InCached.Data.Get());
+			InIO->Tags->Reset();
+			InIO->Tags->Append(InCached.Tags);
+			if (InCached.bEnabled) { InIO->Enable(); }
+			else { InIO->Disable(); }
+		};
+
+		Restore(Entry->Vtx, InVtx);
+		for (int i = 0; i < InEdges.Num(); i++) { Restore(Entry->Edges[i], InEdges[i]); }
+
+		return true;
+	}
+
+	void FOutputCache::Store(const uint64 Key, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<const TSharedRef<PCGExData::FPointIO>> InEdges)
+	{
+		TSharedPtr<FEntry> NewEntry = MakeShared<FEntry>();
+
+		auto Capture = [&](FCachedIO& OutCached, const TSharedRef<PCGExData::FPointIO>& InIO)
+		{
+			UPCGBasePointData* Data = InIO->GetOut();
+			if (!Data) { return false; }
+
+			OutCached.Data.Reset(Data);
+			OutCached.StealGuard.Reset(Data);
+			OutCached.Tags = InIO->Tags->Flatten();
+			OutCached.bEnabled = InIO->IsEnabled();
+
+			// Forwarded & reused data is already alive elsewhere but may outlive its source because of us
+			NewEntry->MemoryBytes += static_cast<int64>(Data->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
+			return true;
+		};
+
+		if (!Capture(NewEntry->Vtx, InVtx)) { return; }
+
+		NewEntry->Edges.SetNum(InEdges.Num());
+		for (int i = 0; i < InEdges.Num(); i++) { if (!Capture(NewEntry->Edges[i], InEdges[i])) { return; } }
+
+		FWriteScopeLock WriteLock(Lock);
+
+		NumStores++;
+		NewEntry->LastAccess = ++AccessCounter;
+
+		if (const TSharedPtr<FEntry>* Existing = Entries.Find(Key)) { MemoryBytes -= (*Existing)->MemoryBytes; }
+
+		Entries.Add(Key, NewEntry);
+		MemoryBytes += NewEntry->MemoryBytes;
+
+		TrimUnsafe(static_cast<int64>(PCGEX_CORE_SETTINGS.ClusterOutputCacheBudgetMB) * 1024 * 1024);
+	}
+
+	void FOutputCache::TrimUnsafe(const int64 InBudget)
+	{
+		if (MemoryBytes <= InBudget) { return; }
+
+		TArray<TPair<uint64, uint64>> Candidates;
+		Candidates.Reserve(Entries.Num());
+		for (const TPair<uint64, TSharedPtr<FEntry>>& Pair : Entries) { Candidates.Emplace(Pair.Value->LastAccess, Pair.Key); }
+
+		Candidates.Sort([](const TPair<uint64, uint64>& A, const TPair<uint64, uint64>& B) { return A.Key < B.Key; });
+
+		for (const TPair<uint64, uint64>& Candidate : Candidates)
+		{
+			if (MemoryBytes <= InBudget) { break; }
+
+			TSharedPtr<FEntry> Removed;
+			if (!Entries.RemoveAndCopyValue(Candidate.Value, Removed)) { continue; }
+
+			MemoryBytes -= Removed->MemoryBytes;
+			NumEvictions++;
+		}
+	}
+
+	void FOutputCache::Trim()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		TrimUnsafe(static_cast<int64>(PCGEX_CORE_SETTINGS.ClusterOutputCacheBudgetMB) * 1024 * 1024);
+	}
+
+	void FOutputCache::Flush()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		NumEvictions += Entries.Num();
+		Entries.Empty();
+		MemoryBytes = 0;
+	}
+
+	void FOutputCache::RegisterDelegates()
+	{
+		if (WorldCleanupHandle.IsValid()) { return; }
+
+		// Preview & inactive worlds come and go all the time in editor, only let go of outputs with a level or a play session
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda(
+			[this](UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+			{
+				if (!InWorld || !(InWorld->IsGameWorld() || InWorld->WorldType == EWorldType::Editor)) { return; }
+				Flush();
+			});
+	}
+
+	void FOutputCache::UnregisterDelegates()
+	{
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+		WorldCleanupHandle.Reset();
+
+		// Strong references must not outlive UObjects
+		Flush();
+	}
+
+	FOutputCacheStats FOutputCache::GetStats() const
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		FOutputCacheStats Stats;
+		Stats.NumEntries = Entries.Num();
+		Stats.NumHits = NumHits;
+		Stats.NumMisses = NumMisses;
+		Stats.NumStores = NumStores;
+		Stats.NumEvictions = NumEvictions;
+		Stats.MemoryBytes = MemoryBytes;
+		return Stats;
+	}
+
+	FString FOutputCache::GetStatsSummary() const
+	{
+		const FOutputCacheStats Stats = GetStats();
+		const int64 NumLookups = Stats.NumHits + Stats.NumMisses;
+		return FString::Printf(
+			TEXT("%d entries (~%.2f MB), %lld hits / %lld misses (%.1f%% hit rate), %lld stores, %lld evictions."),
+			Stats.NumEntries, static_cast<double>(Stats.MemoryBytes) / (1024.0 * 1024.0), Stats.NumHits, Stats.NumMisses,
+			NumLookups ? 100.0 * static_cast<double>(Stats.NumHits) / static_cast<double>(NumLookups) : 0.0, Stats.NumStores, Stats.NumEvictions);
+	}
+
+	static PCGExDiagnostics::FRegistrar DiagnosticsClusterCache(
+		TEXT("ClusterCache"), TEXT("Cluster outputs cached by Incremental Execution; flushing makes the next execution recompute everything"),
+		[]() { return FOutputCache::Get().GetStatsSummary(); },
+		[]() { FOutputCache::Get().Flush(); });
+}
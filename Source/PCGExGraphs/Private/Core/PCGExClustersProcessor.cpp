@@ -3,9 +3,11 @@
 
 #include "Core/PCGExClustersProcessor.h"
 
+#include "PCGExLog.h"
 #include "PCGExHeuristicsCommon.h"
 #include "Clusters/PCGExClusterDataLibrary.h"
 #include "Clusters/PCGExClustersHelpers.h"
+#include "Core/PCGExClusterOutputCache.h"
 #include "Data/PCGBasePointData.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -126,7 +128,17 @@ TSharedPtr<PCGExClusterMT::IBatch> FPCGExClustersProcessorContext::CreateEdgeBat
 
 bool FPCGExClustersProcessorContext::ProcessClusters(const PCGExCommon::ContextState NextStateId)
 {
-	if (!bBatchProcessingEnabled) { return true; }
+	if (!bBatchProcessingEnabled)
+	{
+		if (bCompleteWithoutBatches)
+		{
+			// Every cluster was restored from the incremental cache, nothing to process
+			bCompleteWithoutBatches = false;
+			if (NextStateId == PCGExCommon::States::State_Done) { Done(); }
+			SetState(NextStateId);
+		}
+		return true;
+	}
 
 	if (bDaisyChainClusterBatches)
 	{
@@ -232,6 +244,11 @@ bool FPCGExClustersProcessorContext::StartProcessingClusters(FBatchProcessingVal
 	bBatchProcessingEnabled = false;
 	bSkipClusterBatchCompletionStep = false;
 	bDoClusterBatchWritingStep = false;
+	bCompleteWithoutBatches = false;
+
+	NumReusedClusters = 0;
+	PendingClusterOutputs.Empty();
+	PCGExClusterMT::FOutputCache* OutputCache = bIncrementalExecution ? &PCGExClusterMT::FOutputCache::Get() : nullptr;
 
 	Batches.Reserve(MainPoints->Pairs.Num());
 
@@ -252,6 +269,18 @@ bool FPCGExClustersProcessorContext::StartProcessingClusters(FBatchProcessingVal
 
 		if (!ValidateEntries(TaggedEdges)) { continue; }
 
+		if (OutputCache)
+		{
+			const uint64 Key = PCGExClusterMT::FOutputCache::ComputeClusterKey(IncrementalNodeKey, CurrentIO.ToSharedRef(), TaggedEdges->Entries);
+			if (OutputCache->TryRestore(Key, CurrentIO.ToSharedRef(), TaggedEdges->Entries))
+			{
+				NumReusedClusters++;
+				continue;
+			}
+
+			PendingClusterOutputs.Emplace(FPendingClusterOutput{Key, CurrentIO.ToSharedRef(), TaggedEdges->Entries});
+		}
+
 		const TSharedPtr<PCGExClusterMT::IBatch> NewBatch = CreateEdgeBatchInstance(CurrentIO.ToSharedRef(), TaggedEdges->Entries);
 		InitBatch(NewBatch);
 
@@ -272,7 +301,16 @@ bool FPCGExClustersProcessorContext::StartProcessingClusters(FBatchProcessingVal
 		Batches.Add(NewBatch);
 	}
 
-	if (Batches.IsEmpty()) { return false; }
+	if (OutputCache)
+	{
+		UE_LOG(LogPCGEx, Verbose, TEXT("Incremental execution: %d cluster(s) reused, %d to process."), NumReusedClusters, Batches.Num());
+	}
+
+	if (Batches.IsEmpty())
+	{
+		bCompleteWithoutBatches = NumReusedClusters > 0;
+		return bCompleteWithoutBatches;
+	}
 
 	bBatchProcessingEnabled = true;
 
@@ -289,6 +327,18 @@ bool FPCGExClustersProcessorContext::StartProcessingClusters(FBatchProcessingVal
 	return true;
 }
 
+void FPCGExClustersProcessorContext::OnComplete()
+{
+	FPCGExPointsProcessorContext::OnComplete();
+
+	if (PendingClusterOutputs.IsEmpty()) { return; }
+
+	// Outputs are final & consumable attributes cleaned up once staged, store them as they were handed to PCG
+	PCGExClusterMT::FOutputCache& OutputCache = PCGExClusterMT::FOutputCache::Get();
+	for (const FPendingClusterOutput& Pending : PendingClusterOutputs) { OutputCache.Store(Pending.Key, Pending.Vtx, Pending.Edges); }
+	PendingClusterOutputs.Empty();
+}
+
 void FPCGExClustersProcessorContext::ClusterProcessing_InitialProcessingDone()
 {
 }
@@ -360,6 +410,9 @@ bool FPCGExClustersProcessorElement::Boot(FPCGExContext* InContext) const
 
 	Context->bQuietMissingClusterPairElement = Settings->bQuietMissingClusterPairElement;
 
+	Context->bIncrementalExecution = Settings->WantsIncrementalExecution();
+	if (Context->bIncrementalExecution) { Context->IncrementalNodeKey = PCGExClusterMT::FOutputCache::ComputeNodeKey(Context, Settings); }
+
 	Context->bHasValidHeuristics = PCGExFactories::GetInputFactories(Context, PCGExHeuristics::Labels::SourceHeuristicsLabel, Context->HeuristicsFactories, {PCGExFactories::EType::Heuristics}, false);
 
 	Context->ClusterDataLibrary = MakeShared<PCGExClusters::FDataLibrary>(true);
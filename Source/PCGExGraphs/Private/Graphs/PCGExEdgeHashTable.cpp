@@ -0,0 +1,129 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graphs/PCGExEdgeHashTable.h"
+
+namespace PCGExGraphs
+{
+	void FEdgeHashTable::Reserve(const int32 InNum)
+	{
+		// Keep the load factor at or below 1/2 so probe sequences stay short
+		const int32 Capacity = static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Max(16, InNum * 2)));
+		if (Capacity > Keys.Num()) { Rehash(Capacity); }
+	}
+
+	void FEdgeHashTable::Empty()
+	{
+		Keys.Empty();
+		Values.Empty();
+		Mask = 0;
+		NumEntries = 0;
+	}
+
+	SIZE_T FEdgeHashTable::GetAllocatedSize() const
+	{
+		return Keys.GetAllocatedSize() + Values.GetAllocatedSize();
+	}
+
+	const int32* FEdgeHashTable::Find(const uint64 Key) const
+	{
+		if (!NumEntries) { return nullptr; }
+
+		const int64 K = static_cast<int64>(Key);
+		uint64 Index = Mix(Key) & Mask;
+
+		while (true)
+		{
+			const int64 Current = Keys[Index];
+			if (Current == K) { return Values.GetData() + Index; }
+			if (Current == 0) { return nullptr; }
+			Index = (Index + 1) & Mask;
+		}
+	}
+
+	bool FEdgeHashTable::Add(const uint64 Key, const int32 Value)
+	{
+		check(Key != 0)
+
+		if ((NumEntries + 1) * 2 > Keys.Num()) { Rehash(FMath::Max(16, Keys.Num() * 2)); }
+
+		const int64 K = static_cast<int64>(Key);
+		uint64 Index = Mix(Key) & Mask;
+
+		while (true)
+		{
+			const int64 Current = Keys[Index];
+			if (Current == K) { return false; }
+			if (Current == 0)
+			{
+				Keys[Index] = K;
+				Values[Index] = Value;
+				NumEntries++;
+				return true;
+			}
+			Index = (Index + 1) & Mask;
+		}
+	}
+
+	int32 FEdgeHashTable::Claim_Concurrent(const uint64 Key, const int32 Order)
+	{
+		const int64 K = static_cast<int64>(Key);
+		uint64 Index = Mix(Key) & Mask;
+
+		while (true)
+		{
+			int64* Slot = Keys.GetData() + Index;
+			int64 Current = FPlatformAtomics::AtomicRead(Slot);
+
+			if (Current == 0)
+			{
+				Current = FPlatformAtomics::InterlockedCompareExchange(Slot, K, 0);
+				if (Current == 0)
+				{
+					FPlatformAtomics::InterlockedIncrement(&NumEntries);
+					Current = K;
+				}
+			}
+
+			if (Current == K)
+			{
+				// Atomic max; pending orders are negative so pre-existing edge indices always win
+				int32* Value = Values.GetData() + Index;
+				const int32 Desired = PendingOrder(Order);
+				int32 Seen = FPlatformAtomics::AtomicRead(Value);
+				while (Seen < Desired)
+				{
+					const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(Value, Desired, Seen);
+					if (Previous == Seen) { break; }
+					Seen = Previous;
+				}
+
+				return static_cast<int32>(Index);
+			}
+
+			Index = (Index + 1) & Mask;
+		}
+	}
+
+	void FEdgeHashTable::Rehash(const int32 NewCapacity)
+	{
+		TArray<int64> OldKeys = MoveTemp(Keys);
+		TArray<int32> OldValues = MoveTemp(Values);
+
+		Keys.Init(0, NewCapacity);
+		Values.Init(MIN_int32, NewCapacity);
+		Mask = static_cast<uint64>(NewCapacity - 1);
+
+		for (int32 i = 0; i < OldKeys.Num(); i++)
+		{
+			const int64 K = OldKeys[i];
+			if (K == 0) { continue; }
+
+			uint64 Index = Mix(static_cast<uint64>(K)) & Mask;
+			while (Keys[Index] != 0) { Index = (Index + 1) & Mask; }
+
+			Keys[Index] = K;
+			Values[Index] = OldValues[i];
+		}
+	}
+}
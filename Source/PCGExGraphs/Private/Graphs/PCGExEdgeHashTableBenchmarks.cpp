@@ -0,0 +1,94 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExH.h"
+#include "Async/ParallelFor.h"
+#include "Core/PCGExBenchmark.h"
+#include "Graphs/PCGExEdgeHashTable.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Lock-free edge deduplication against the locked TMap FGraph used to rely on, e.g. pcgex.Bench.Run Filter=Graphs.EdgeDedup* Scales=1000000+10000000
+namespace PCGExGraphs
+{
+	namespace EdgeHashTableBenchmark
+	{
+		// Short-range pairs over a limited node range, so a good share of edges are duplicates, as when neighbors probe each other
+		static void MakeHashes(TArray<uint64>& OutHashes, const int32 NumEdges)
+		{
+			const uint32 NumNodes = static_cast<uint32>(FMath::Max(2, NumEdges / 3));
+
+			FRandomStream Random(1337);
+			OutHashes.SetNumUninitialized(NumEdges);
+			for (uint64& H : OutHashes)
+			{
+				const uint32 A = static_cast<uint32>(Random.RandHelper(static_cast<int32>(NumNodes)));
+				const uint32 B = (A + 1 + static_cast<uint32>(Random.RandHelper(32))) % NumNodes;
+				H = PCGEx::H64U(A, B == A ? (A + 1) % NumNodes : B);
+			}
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchEdgeDedup(
+		TEXT("Graphs.EdgeDedup"), TEXT("Concurrent lock-free deduplication of N edge hashes, a third of them duplicates"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			TArray<uint64> Hashes;
+			EdgeHashTableBenchmark::MakeHashes(Hashes, Scale);
+
+			return [Hashes = MoveTemp(Hashes)]()
+			{
+				FEdgeHashTable Table;
+				Table.Reserve(Hashes.Num());
+				ParallelFor(Hashes.Num(), [&](const int32 i) { Table.Claim_Concurrent(Hashes[i], i); }, EParallelForFlags::Unbalanced);
+			};
+		});
+
+	static PCGExBenchmark::FRegistrar BenchEdgeDedupLockedMap(
+		TEXT("Graphs.EdgeDedup.LockedMap"), TEXT("Concurrent deduplication of N edge hashes into a locked TMap, reference for Graphs.EdgeDedup"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			TArray<uint64> Hashes;
+			EdgeHashTableBenchmark::MakeHashes(Hashes, Scale);
+
+			return [Hashes = MoveTemp(Hashes)]()
+			{
+				TMap<uint64, int32> Map;
+				Map.Reserve(Hashes.Num());
+				FRWLock MapLock;
+
+				ParallelFor(
+					Hashes.Num(), [&](const int32 i)
+					{
+						FWriteScopeLock WriteLock(MapLock);
+						if (!Map.Contains(Hashes[i])) { Map.Add(Hashes[i], i); }
+					}, EParallelForFlags::Unbalanced);
+			};
+		});
+
+	static PCGExBenchmark::FCheckRegistrar CheckEdgeDedup(
+		TEXT("Graphs.EdgeDedup"), TEXT("Concurrent claims keep every unique edge once, owned by its first occurrence"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			TArray<uint64> Hashes;
+			EdgeHashTableBenchmark::MakeHashes(Hashes, 100000);
+
+			TMap<uint64, int32> FirstOccurrence;
+			for (int32 i = 0; i < Hashes.Num(); i++) { FirstOccurrence.FindOrAdd(Hashes[i], i); }
+
+			FEdgeHashTable Table;
+			Table.Reserve(Hashes.Num());
+			ParallelFor(Hashes.Num(), [&](const int32 i) { Table.Claim_Concurrent(Hashes[i], i); }, EParallelForFlags::Unbalanced);
+
+			Context.Test(Table.Num() == FirstOccurrence.Num(), TEXT("%d unique edges claimed, expected %d"), Table.Num(), FirstOccurrence.Num());
+
+			for (const TPair<uint64, int32>& Pair : FirstOccurrence)
+			{
+				const int32* Value = Table.Find(Pair.Key);
+				Context.Test(Value != nullptr, TEXT("Edge %llu is missing"), Pair.Key);
+				if (Value) { Context.Test(*Value == FEdgeHashTable::PendingOrder(Pair.Value), TEXT("Edge %llu owned by %d, expected %d"), Pair.Key, *Value, FEdgeHashTable::PendingOrder(Pair.Value)); }
+			}
+		});
+}
+
+#endif
@@ -94,28 +94,20 @@ namespace PCGExGraphs
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges)
 
 		FWriteScopeLock WriteLock(GraphLock);
-		uint32 A;
-		uint32 B;
 
-		UniqueEdges.Reserve(UniqueEdges.Num() + UniqueEdges.Num());
-		Edges.Reserve(Edges.Num() + InEdges.Num());
-
-		for (const uint64 E : InEdges)
-		{
-			if (UniqueEdges.Contains(E)) { continue; }
-
-			PCGEx::H64(E, A, B);
-
-			check(A != B)
-
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B, -1, InIOIndex);
+		AppendUniqueEdges_Unsafe(
+			InEdges.Num(),
+			[&](const int32 Candidate) { return InEdges[Candidate]; },
+			[&](const int32 Candidate, FEdge& OutEdge)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(InEdges[Candidate], A, B);
 
-			UniqueEdges.Add(E, EdgeIndex);
-			Nodes[A].LinkEdge(EdgeIndex);
-			Nodes[B].LinkEdge(EdgeIndex);
-		}
+				check(A != B)
 
-		UniqueEdges.Shrink();
+				OutEdge = FEdge(-1, A, B, -1, InIOIndex);
+			});
 	}
 
 	int32 FGraph::InsertEdges(const TArray<FEdge>& InEdges)
@@ -123,13 +115,11 @@ namespace PCGExGraphs
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges)
 
 		FWriteScopeLock WriteLock(GraphLock);
-		const int32 StartIndex = Edges.Num();
-
-		UniqueEdges.Reserve(UniqueEdges.Num() + InEdges.Num());
-		Edges.Reserve(Edges.Num() + InEdges.Num());
 
-		for (const FEdge& E : InEdges) { InsertEdge_Unsafe(E); }
-		return StartIndex;
+		return AppendUniqueEdges_Unsafe(
+			InEdges.Num(),
+			[&](const int32 Candidate) { return InEdges[Candidate].H64U(); },
+			[&](const int32 Candidate, FEdge& OutEdge) { OutEdge = InEdges[Candidate]; });
 	}
 
 	void FGraph::AdoptEdges(TArray<FEdge>& InEdges)
@@ -143,10 +133,15 @@ namespace PCGExGraphs
 
 		UniqueEdges.Reserve(NumEdges);
 
+		// Edges are known to be unique, only the table needs building
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			UniqueEdges.GetValueAt(UniqueEdges.Claim_Concurrent(Edges[i].H64U(), i)) = i;
+		)
+
 		for (int32 i = 0; i < NumEdges; i++)
 		{
-			FEdge& Edge = Edges[i];
-			UniqueEdges.Add(Edge.H64U(), i);
+			const FEdge& Edge = Edges[i];
 			Nodes[Edge.Start].LinkEdge(i);
 			Nodes[Edge.End].LinkEdge(i);
 		}
@@ -155,6 +150,60 @@ namespace PCGExGraphs
 		EdgeMetadata.SetNum(NumEdges);
 	}
 
+	int32 FGraph::AppendUniqueEdges_Unsafe(const int32 NumCandidates, TFunctionRef<uint64(const int32 Candidate)> GetHash, TFunctionRef<void(const int32 Candidate, FEdge& OutEdge)> InitEdge)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::AppendUniqueEdges);
+
+		const int32 StartIndex = Edges.Num();
+		if (NumCandidates <= 0) { return StartIndex; }
+
+		UniqueEdges.Reserve(UniqueEdges.Num() + NumCandidates);
+
+		// Lock-free dedup; each new hash ends up owned by the first candidate that carries it
+		TArray<int32> Slots;
+		Slots.SetNumUninitialized(NumCandidates);
+
+		PCGEX_PARALLEL_FOR(
+			NumCandidates,
+			Slots[i] = UniqueEdges.Claim_Concurrent(GetHash(i), i);
+		)
+
+		// Owners get consecutive edge indices in candidate order, same as inserting them one by one
+		TArray<int32> EdgeIndices;
+		EdgeIndices.SetNumUninitialized(NumCandidates);
+
+		int32 NumNewEdges = 0;
+		for (int32 i = 0; i < NumCandidates; i++)
+		{
+			EdgeIndices[i] = UniqueEdges.GetValueAt(Slots[i]) == FEdgeHashTable::PendingOrder(i) ? StartIndex + NumNewEdges++ : -1;
+		}
+
+		if (!NumNewEdges) { return StartIndex; }
+
+		Edges.SetNumUninitialized(StartIndex + NumNewEdges);
+
+		PCGEX_PARALLEL_FOR(
+			NumCandidates,
+			const int32 EdgeIndex = EdgeIndices[i];
+			if (EdgeIndex < 0) { return; }
+
+			FEdge& Edge = Edges[EdgeIndex];
+			InitEdge(i, Edge);
+			Edge.Index = EdgeIndex;
+			UniqueEdges.GetValueAt(Slots[i]) = EdgeIndex;
+		)
+
+		// Node links aren't thread-safe
+		for (int32 i = StartIndex; i < Edges.Num(); i++)
+		{
+			const FEdge& Edge = Edges[i];
+			Nodes[Edge.Start].LinkEdge(i);
+			Nodes[Edge.End].LinkEdge(i);
+		}
+
+		return StartIndex;
+	}
+
 	FEdge* FGraph::FindEdge_Unsafe(const uint64 Hash)
 	{
 		const int32* Index = UniqueEdges.Find(Hash);
@@ -203,26 +252,21 @@ namespace PCGExGraphs
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges_Unsafe);
 
-		uint32 A;
-		uint32 B;
-
-		UniqueEdges.Reserve(UniqueEdges.Num() + InEdges.Num());
-		Edges.Reserve(UniqueEdges.Num() + InEdges.Num());
-
-		for (const uint64& E : InEdges)
-		{
-			if (UniqueEdges.Contains(E)) { continue; }
+		const TArray<uint64> Hashes = InEdges.Array();
 
-			PCGEx::H64(E, A, B);
+		AppendUniqueEdges_Unsafe(
+			Hashes.Num(),
+			[&](const int32 Candidate) { return Hashes[Candidate]; },
+			[&](const int32 Candidate, FEdge& OutEdge)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Hashes[Candidate], A, B);
 
-			check(A != B)
+				check(A != B)
 
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			UniqueEdges.Add(E, EdgeIndex);
-			Nodes[A].LinkEdge(EdgeIndex);
-			Nodes[B].LinkEdge(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
-		}
+				OutEdge = FEdge(-1, A, B, -1, InIOIndex);
+			});
 	}
 
 	void FGraph::InsertEdges(const TSet<uint64>& InEdges, const int32 InIOIndex)
@@ -250,6 +294,58 @@ namespace PCGExGraphs
 		return MakeArrayView(Nodes.GetData() + OutStartIndex, NumNewNodes);
 	}
 
+	namespace Components
+	{
+		FORCEINLINE int32 Find(TArray<int32>& Parent, int32 X)
+		{
+			int32* Data = Parent.GetData();
+			while (true)
+			{
+				const int32 P = FPlatformAtomics::AtomicRead(Data + X);
+				if (P == X) { return X; }
+
+				// Path halving; losing the race is harmless, it means someone else already shortened it
+				const int32 G = FPlatformAtomics::AtomicRead(Data + P);
+				if (P != G) { FPlatformAtomics::InterlockedCompareExchange(Data + X, G, P); }
+
+				X = G;
+			}
+		}
+
+		FORCEINLINE void Union(TArray<int32>& Parent, int32 A, int32 B)
+		{
+			int32* Data = Parent.GetData();
+			while (true)
+			{
+				A = Find(Parent, A);
+				B = Find(Parent, B);
+				if (A == B) { return; }
+
+				// Always hook the larger root under the smaller one, so every set ends up rooted at its smallest index
+				if (A < B) { Swap(A, B); }
+				if (FPlatformAtomics::InterlockedCompareExchange(Data + A, B, A) == A) { return; }
+			}
+		}
+
+		/**
+		 * Counting sort. Every i with Group[i] >= 0 is written in its group range inside OutSorted,
+		 * in ascending order within each group. OutStart ends up with NumGroups + 1 offsets.
+		 * Groups are dense root indices, so one count per group & a single scatter pass are enough.
+		 */
+		void GroupBy(const TArray<int32>& Group, const int32 NumGroups, TArray<int32>& OutStart, TArray<int32>& OutSorted)
+		{
+			OutStart.Init(0, NumGroups + 1);
+			for (const int32 G : Group) { if (G >= 0) { OutStart[G + 1]++; } }
+			for (int32 g = 0; g < NumGroups; g++) { OutStart[g + 1] += OutStart[g]; }
+
+			// Indices are visited in order, so each group range is filled in ascending index order
+			TArray<int32> Cursor(OutStart.GetData(), NumGroups);
+			OutSorted.SetNumUninitialized(OutStart[NumGroups]);
+
+			for (int32 i = 0; i < Group.Num(); i++) { if (const int32 G = Group[i]; G >= 0) { OutSorted[Cursor[G]++] = i; } }
+		}
+	}
+
 	void FGraph::BuildSubGraphs(const FPCGExGraphBuilderDetails& Limits, TArray<int32>& OutValidNodes)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
@@ -257,90 +353,110 @@ namespace PCGExGraphs
 		const int32 NumNodes = Nodes.Num();
 		const int32 NumEdges = Edges.Num();
 
-		TArray<bool> VisitedNodes;
-		VisitedNodes.Init(false, NumNodes);
-		TArray<bool> VisitedEdges;
-		VisitedEdges.Init(false, NumEdges);
+		// Roaming nodes can't be part of any subgraph
+		TArray<int32> Parent;
+		Parent.SetNumUninitialized(NumNodes);
 
-		int32 VisitedNodesNum = 0;
-		int32 VisitedEdgesNum = 0;
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			FNode& Node = Nodes[i];
+			if (Node.IsEmpty()) { Node.bValid = false; }
+			Parent[i] = i;
+		)
 
-		TArray<int32> Stack;
-		Stack.Reserve(NumNodes);
-		OutValidNodes.Reserve(NumNodes);
+		// Union across every edge that connects two valid nodes.
+		// Temporarily store the edge start node, or -1 if the edge is not part of any subgraph.
+		TArray<int32> EdgeComponent;
+		EdgeComponent.SetNumUninitialized(NumEdges);
 
-		for (int32 i = 0; i < NumNodes; i++)
-		{
-			FNode& CurrentNode = Nodes[i];
-			if (VisitedNodes[i])
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			const FEdge& Edge = Edges[i];
+			if (Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid)
 			{
-				continue;
+				EdgeComponent[i] = static_cast<int32>(Edge.Start);
+				Components::Union(Parent, static_cast<int32>(Edge.Start), static_cast<int32>(Edge.End));
 			}
-
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty())
+			else
 			{
-				CurrentNode.bValid = false;
-				continue;
+				EdgeComponent[i] = -1;
 			}
+		)
 
-			Stack.Reset();
-			Stack.Add(i);
-			VisitedNodes[i] = true;
-			VisitedNodesNum++;
+		TArray<int32> NodeComponent;
+		NodeComponent.SetNumUninitialized(NumNodes);
 
-			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
-			SubGraph->WeakParentGraph = SharedThis(this);
-			SubGraph->Nodes.Reserve(NumNodes - VisitedNodesNum);
-			SubGraph->Edges.Reserve(NumEdges - VisitedEdgesNum);
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			NodeComponent[i] = Nodes[i].bValid ? Components::Find(Parent, i) : -1;
+		)
 
-			while (!Stack.IsEmpty())
-			{
-				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
-				SubGraph->Nodes.Add(NodeIndex);
-				FNode& Node = Nodes[NodeIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const FLink& Lk : Node.Links)
-				{
-					const int32 E = Lk.Edge;
-					if (VisitedEdges[E]) { continue; }
-
-					VisitedEdges[E] = true;
-					VisitedEdgesNum++;
-
-					FEdge& Edge = Edges[E];
-					if (!Edge.bValid) { continue; }
-
-					const int32 OtherIndex = Edge.Other(NodeIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
-
-					SubGraph->Add(Edge);
-
-					if (!VisitedNodes[OtherIndex])
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNodesNum++;
-						Stack.Add(OtherIndex);
-					}
-				}
-			}
+		// Sets are rooted at their smallest node index; numbering roots in ascending order
+		// yields the same subgraph order as a sequential flood starting from each unvisited node in turn
+		int32 NumComponents = 0;
+		for (int32 i = 0; i < NumNodes; i++) { if (NodeComponent[i] == i) { Parent[i] = NumComponents++; } }
 
-			if (!Limits.IsValid(SubGraph->Nodes.Num(), SubGraph->Edges.Num()))
-			{
-				for (const int32 j : SubGraph->Nodes) { Nodes[j].bValid = false; }
-				for (const PCGEx::FIndexKey j : SubGraph->Edges) { Edges[j.Index].bValid = false; }
-			}
-			else if (!SubGraph->Edges.IsEmpty())
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			if (const int32 Root = NodeComponent[i]; Root >= 0) { NodeComponent[i] = Parent[Root]; }
+		)
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			if (const int32 Start = EdgeComponent[i]; Start >= 0) { EdgeComponent[i] = NodeComponent[Start]; }
+		)
+
+		Parent.Empty();
+
+		TArray<int32> NodeStart;
+		TArray<int32> SortedNodes;
+		Components::GroupBy(NodeComponent, NumComponents, NodeStart, SortedNodes);
+
+		TArray<int32> EdgeStart;
+		TArray<int32> SortedEdges;
+		Components::GroupBy(EdgeComponent, NumComponents, EdgeStart, SortedEdges);
+
+		const TWeakPtr<FGraph> WeakThis = SharedThis(this);
+
+		TArray<TSharedPtr<FSubGraph>> Candidates;
+		Candidates.SetNum(NumComponents);
+
+		PCGEX_PARALLEL_FOR(
+			NumComponents,
+			const TArrayView<const int32> SubNodes = MakeArrayView(SortedNodes.GetData() + NodeStart[i], NodeStart[i + 1] - NodeStart[i]);
+			const TArrayView<const int32> SubEdges = MakeArrayView(SortedEdges.GetData() + EdgeStart[i], EdgeStart[i + 1] - EdgeStart[i]);
+
+			for (const int32 j : SubNodes) { Nodes[j].NumExportedEdges = 0; }
+
+			if (!Limits.IsValid(SubNodes.Num(), SubEdges.Num()))
 			{
-				OutValidNodes.Append(SubGraph->Nodes);
-				SubGraph->Shrink();
-				SubGraphs.Add(SubGraph.ToSharedRef());
+				for (const int32 j : SubNodes) { Nodes[j].bValid = false; }
+				for (const int32 j : SubEdges) { Edges[j].bValid = false; }
+				return;
 			}
+
+			if (SubEdges.IsEmpty()) { return; }
+
+			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
+			SubGraph->WeakParentGraph = WeakThis;
+			SubGraph->Nodes.Append(SubNodes.GetData(), SubNodes.Num());
+			SubGraph->Edges.Reserve(SubEdges.Num());
+			for (const int32 j : SubEdges) { SubGraph->Add(Edges[j]); }
+			SubGraph->Shrink();
+
+			Candidates[i] = SubGraph;
+		)
+
+		OutValidNodes.Reserve(OutValidNodes.Num() + SortedNodes.Num());
+
+		for (const TSharedPtr<FSubGraph>& SubGraph : Candidates)
+		{
+			if (!SubGraph) { continue; }
+			OutValidNodes.Append(SubGraph->Nodes);
+			SubGraphs.Add(SubGraph.ToSharedRef());
 		}
 
 		// Recompute NumExportedEdges deterministically based on actual edge connections.
-		// The BFS traversal order affects which node "claims" each shared edge, making
-		// NumExportedEdges non-deterministic when Node.Links order varies (parallel insertion).
 		// Count valid edges per node directly from Links - parallelizable and cache-friendly.
 		PCGEX_PARALLEL_FOR(
 			OutValidNodes.Num(), 
@@ -0,0 +1,212 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExH.h"
+#include "Core/PCGExBenchmark.h"
+#include "Graphs/PCGExGraph.h"
+#include "Graphs/PCGExGraphDetails.h"
+#include "Graphs/PCGExSubGraph.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Graph build & partition, e.g. pcgex.Bench.Run Filter=Graphs.InsertAndPartition Scales=1000000
+namespace PCGExGraphs
+{
+	namespace Benchmark
+	{
+		// NumEdges short-range edge hashes (with duplicates) between NumNodes nodes
+		static void MakeEdgeHashes(TArray<uint64>& OutHashes, const uint32 NumNodes, const int32 NumEdges, const int32 Seed = 1337)
+		{
+			FRandomStream Random(Seed);
+			OutHashes.SetNumUninitialized(NumEdges);
+			for (uint64& H : OutHashes)
+			{
+				const uint32 A = static_cast<uint32>(Random.RandHelper(static_cast<int32>(NumNodes)));
+				const uint32 B = (A + 1 + static_cast<uint32>(Random.RandHelper(8))) % NumNodes;
+				H = PCGEx::H64U(A, B == A ? (A + 1) % NumNodes : B);
+			}
+		}
+
+		struct FComponent
+		{
+			TArray<int32> Nodes;
+			TArray<int32> Edges;
+		};
+
+		// Sequential flood fill BuildSubGraphs used to run, as reference; leaves the graph untouched
+		// OutDropped collects the nodes of components rejected by the limits
+		static void FloodComponents(const FGraph& Graph, const FPCGExGraphBuilderDetails& Limits, TArray<FComponent>& OutComponents, TArray<int32>& OutDropped)
+		{
+			TArray<bool> VisitedNodes;
+			VisitedNodes.Init(false, Graph.Nodes.Num());
+			TArray<bool> VisitedEdges;
+			VisitedEdges.Init(false, Graph.Edges.Num());
+
+			TArray<int32> Stack;
+			for (int32 i = 0; i < Graph.Nodes.Num(); i++)
+			{
+				if (VisitedNodes[i] || !Graph.Nodes[i].bValid || Graph.Nodes[i].IsEmpty()) { continue; }
+
+				FComponent Component;
+				Stack.Add(i);
+				VisitedNodes[i] = true;
+
+				while (!Stack.IsEmpty())
+				{
+					const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+					Component.Nodes.Add(NodeIndex);
+
+					for (const FLink& Lk : Graph.Nodes[NodeIndex].Links)
+					{
+						if (VisitedEdges[Lk.Edge]) { continue; }
+						VisitedEdges[Lk.Edge] = true;
+
+						const FEdge& Edge = Graph.Edges[Lk.Edge];
+						if (!Edge.bValid) { continue; }
+
+						const int32 OtherIndex = Edge.Other(NodeIndex);
+						if (!Graph.Nodes[OtherIndex].bValid) { continue; }
+
+						Component.Edges.Add(Lk.Edge);
+
+						if (!VisitedNodes[OtherIndex])
+						{
+							VisitedNodes[OtherIndex] = true;
+							Stack.Add(OtherIndex);
+						}
+					}
+				}
+
+				if (!Limits.IsValid(Component.Nodes.Num(), Component.Edges.Num()))
+				{
+					OutDropped.Append(Component.Nodes);
+					continue;
+				}
+
+				if (Component.Edges.IsEmpty()) { continue; }
+
+				Component.Nodes.Sort();
+				Component.Edges.Sort();
+				OutComponents.Add(MoveTemp(Component));
+			}
+		}
+
+		// Inserts the hashes, then invalidates a few nodes & edges so the partition has to skip them
+		static TSharedPtr<FGraph> MakeGraph(const TArray<uint64>& Hashes, const uint32 NumNodes)
+		{
+			TSharedPtr<FGraph> Graph = MakeShared<FGraph>(NumNodes);
+			Graph->InsertEdges(Hashes, -1);
+
+			for (int32 i = 0; i < Graph->Nodes.Num(); i += 97) { Graph->Nodes[i].bValid = false; }
+			for (int32 i = 0; i < Graph->Edges.Num(); i += 13) { Graph->Edges[i].bValid = false; }
+
+			return Graph;
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchGraphBuild(
+		TEXT("Graphs.InsertAndPartition"), TEXT("Inserts ~N short-range edges (with duplicates) into a graph of N nodes, then builds its subgraphs"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			const uint32 NumNodes = static_cast<uint32>(FMath::Max(2, Scale));
+
+			TArray<uint64> Hashes;
+			Benchmark::MakeEdgeHashes(Hashes, NumNodes, Scale);
+
+			return [Hashes = MoveTemp(Hashes), NumNodes]()
+			{
+				const TSharedPtr<FGraph> Graph = MakeShared<FGraph>(NumNodes);
+				Graph->InsertEdges(Hashes, -1);
+
+				TArray<int32> ValidNodes;
+				Graph->BuildSubGraphs(FPCGExGraphBuilderDetails(), ValidNodes);
+			};
+		});
+
+	static PCGExBenchmark::FCheckRegistrar CheckSubGraphs(
+		TEXT("Graphs.SubGraphs"), TEXT("Union-find subgraphs hold the same nodes & edges as a sequential flood fill, in the same order, run after run"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			// Sparse enough to split into many components, large enough to run the passes in parallel
+			constexpr uint32 NumNodes = 20000;
+
+			TArray<uint64> Hashes;
+			Benchmark::MakeEdgeHashes(Hashes, NumNodes, NumNodes / 2);
+
+			FPCGExGraphBuilderDetails Unlimited;
+
+			FPCGExGraphBuilderDetails Limited;
+			Limited.bRemoveSmallClusters = true;
+			Limited.MinVtxCount = 3;
+			Limited.MinEdgeCount = 2;
+			Limited.bRemoveBigClusters = true;
+			Limited.MaxVtxCount = 12;
+			Limited.MaxEdgeCount = 20;
+
+			for (const FPCGExGraphBuilderDetails* Limits : {&Unlimited, &Limited})
+			{
+				const TCHAR* Label = Limits == &Unlimited ? TEXT("Unlimited") : TEXT("Limited");
+
+				TArray<TSharedPtr<FGraph>> Runs;
+				TArray<TArray<int32>> RunValidNodes;
+
+				for (int32 Run = 0; Run < 2; Run++)
+				{
+					const TSharedPtr<FGraph> Graph = Benchmark::MakeGraph(Hashes, NumNodes);
+
+					TArray<Benchmark::FComponent> Expected;
+					TArray<int32> Dropped;
+					Benchmark::FloodComponents(*Graph, *Limits, Expected, Dropped);
+
+					TArray<int32>& ValidNodes = RunValidNodes.AddDefaulted_GetRef();
+					Graph->BuildSubGraphs(*Limits, ValidNodes);
+					Runs.Add(Graph);
+
+					if (!Context.Test(Graph->SubGraphs.Num() == Expected.Num(), TEXT("%s: %d subgraphs, flood fill found %d"), Label, Graph->SubGraphs.Num(), Expected.Num())) { continue; }
+
+					TArray<int32> ExpectedValidNodes;
+					int32 NumMismatches = 0;
+
+					for (int32 s = 0; s < Expected.Num(); s++)
+					{
+						const FSubGraph& SubGraph = *Graph->SubGraphs[s];
+						ExpectedValidNodes.Append(Expected[s].Nodes);
+
+						TArray<int32> Edges;
+						for (const PCGEx::FIndexKey& Edge : SubGraph.Edges) { Edges.Add(Edge.Index); }
+
+						// Subgraphs follow the flood order, and hold their nodes & edges in ascending index order
+						if (SubGraph.Nodes != Expected[s].Nodes || Edges != Expected[s].Edges) { NumMismatches++; }
+					}
+
+					Context.Test(NumMismatches == 0, TEXT("%s: %d of %d subgraphs differ from the flood fill components"), Label, NumMismatches, Expected.Num());
+					Context.Test(ValidNodes == ExpectedValidNodes, TEXT("%s: valid nodes don't follow the flood fill components"), Label);
+
+					// Nodes of components rejected by the limits are invalidated, kept ones stay valid
+					int32 NumBadFlags = 0;
+					for (const int32 j : ValidNodes) { if (!Graph->Nodes[j].bValid) { NumBadFlags++; } }
+					for (const int32 j : Dropped) { if (Graph->Nodes[j].bValid) { NumBadFlags++; } }
+
+					Context.Test(NumBadFlags == 0, TEXT("%s: %d nodes invalid inside a subgraph, or still valid in a rejected component"), Label, NumBadFlags);
+					if (Limits == &Limited) { Context.Test(!Dropped.IsEmpty(), TEXT("Limits didn't reject any component, the fixture doesn't cover them")); }
+				}
+
+				if (Runs.Num() != 2 || Runs[0]->SubGraphs.Num() != Runs[1]->SubGraphs.Num()) { continue; }
+
+				int32 NumDiffering = 0;
+				for (int32 s = 0; s < Runs[0]->SubGraphs.Num(); s++)
+				{
+					const FSubGraph& A = *Runs[0]->SubGraphs[s];
+					const FSubGraph& B = *Runs[1]->SubGraphs[s];
+
+					bool bSame = A.Nodes == B.Nodes && A.Edges.Num() == B.Edges.Num();
+					for (int32 j = 0; bSame && j < A.Edges.Num(); j++) { bSame = A.Edges[j].Index == B.Edges[j].Index && A.Edges[j].Key == B.Edges[j].Key; }
+					if (!bSame) { NumDiffering++; }
+				}
+
+				Context.Test(NumDiffering == 0 && RunValidNodes[0] == RunValidNodes[1], TEXT("%s: %d subgraphs differ between two runs over the same edges"), Label, NumDiffering);
+			}
+		});
+}
+
+#endif
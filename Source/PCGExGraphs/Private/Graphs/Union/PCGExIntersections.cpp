@@ -132,6 +132,56 @@ namespace PCGExGraphs
 		}
 	}
 
+	void FUnionGraph::InsertFusedPoints(const TSharedPtr<PCGExData::FPointIO>& InSource, const TArray<int32>& Leaders)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::InsertFusedPoints);
+
+		FWriteScopeLock WriteLock(UnionLock);
+
+		const int32 NumPoints = Leaders.Num();
+		const int32 FirstNode = Nodes.Num();
+		TConstPCGValueRange<FTransform> Transforms = InSource->GetIn()->GetConstTransformValueRange();
+
+		// Leaders become nodes in index order, like they would through InsertPoint
+		TArray<int32> NodeIndices;
+		NodeIndices.Init(INDEX_NONE, NumPoints);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (Leaders[i] != i) { continue; }
+
+			const PCGExData::FConstPoint Point = InSource->GetInPoint(i);
+			NodeIndices[i] = Nodes.Num();
+			NodesUnion->NewEntry_Unsafe(Point);
+			Nodes.Add(MakeShared<FUnionNode>(Point, Transforms[i].GetLocation(), Nodes.Num()));
+		}
+
+		const int32 NumNewNodes = Nodes.Num() - FirstNode;
+
+		// Group followers per node, still in index order, then fill nodes in parallel
+		TArray<int32> Starts;
+		Starts.Init(0, NumNewNodes + 1);
+		for (int32 i = 0; i < NumPoints; i++) { if (Leaders[i] != i) { Starts[NodeIndices[Leaders[i]] - FirstNode + 1]++; } }
+		for (int32 i = 0; i < NumNewNodes; i++) { Starts[i + 1] += Starts[i]; }
+
+		TArray<int32> Followers;
+		Followers.SetNumUninitialized(Starts.Last());
+
+		TArray<int32> WriteIndices(Starts);
+		for (int32 i = 0; i < NumPoints; i++) { if (Leaders[i] != i) { Followers[WriteIndices[NodeIndices[Leaders[i]] - FirstNode]++] = i; } }
+
+		ParallelFor(NumNewNodes, [&](const int32 i)
+		{
+			const TSharedPtr<FUnionNode>& Node = Nodes[FirstNode + i];
+			for (int32 f = Starts[i]; f < Starts[i + 1]; f++)
+			{
+				const int32 Index = Followers[f];
+				NodesUnion->Append_Unsafe(Node->Index, InSource->GetInPoint(Index));
+				Node->Accumulate(Transforms[Index].GetLocation());
+			}
+		});
+	}
+
 	void FUnionGraph::InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(IUnionData::InsertEdge);
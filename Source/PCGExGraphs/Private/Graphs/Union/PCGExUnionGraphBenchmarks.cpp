@@ -0,0 +1,110 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+#include "Graphs/Union/PCGExIntersections.h"
+#include "Math/PCGExToleranceGrid.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Point & edge fusing into a union graph, e.g. pcgex.Bench.Run Filter=Graphs.Fuse.* Scales=100000+1000000
+namespace PCGExGraphs
+{
+	namespace UnionBenchmark
+	{
+		constexpr double Tolerance = 10;
+
+		// Two copies of the same random polyline, the second one moved by less than the tolerance so every point & edge fuses with its twin
+		struct FScene
+		{
+			TStrongObjectPtr<UPCGPointArrayData> Data;
+			TSharedPtr<PCGExData::FPointIO> PointIO;
+			FBox Bounds = FBox(ForceInit);
+		};
+
+		static TSharedPtr<FScene> MakeScene(const int32 InNum)
+		{
+			const int32 NumUnique = FMath::Max(1, InNum / 2);
+
+			TArray<FVector> Positions;
+			PCGExBenchmark::MakePositions(Positions, NumUnique, true, 100 * FMath::Pow(static_cast<double>(NumUnique), 1 / 3.0));
+
+			TSharedPtr<FScene> Scene = MakeShared<FScene>();
+			Scene->Data.Reset(NewObject<UPCGPointArrayData>());
+			Scene->Data->SetNumPoints(NumUnique * 2);
+			Scene->Data->AllocateProperties(EPCGPointNativeProperties::Transform);
+
+			FRandomStream Random(42);
+			TPCGValueRange<FTransform> Transforms = Scene->Data->GetTransformValueRange(false);
+			for (int32 i = 0; i < NumUnique; i++)
+			{
+				Transforms[i].SetLocation(Positions[i]);
+				Transforms[NumUnique + i].SetLocation(Positions[i] + Random.VRand() * Random.FRandRange(0, Tolerance * 0.25));
+				Scene->Bounds += Positions[i];
+			}
+
+			Scene->Bounds = Scene->Bounds.ExpandBy(Tolerance);
+			Scene->PointIO = MakeShared<PCGExData::FPointIO>(TWeakPtr<FPCGContextHandle>(), Scene->Data.Get());
+
+			return Scene;
+		}
+
+		static TSharedPtr<FUnionGraph> MakeUnionGraph(const FScene& Scene, const EPCGExFuseMethod InMethod)
+		{
+			FPCGExFuseDetails FuseDetails(false, Tolerance);
+			FuseDetails.FuseMethod = InMethod;
+
+			TSharedPtr<FUnionGraph> UnionGraph = MakeShared<FUnionGraph>(FuseDetails, Scene.Bounds);
+			UnionGraph->Init(nullptr);
+			UnionGraph->Reserve(Scene.Data->GetNumPoints() / 2, -1);
+
+			return UnionGraph;
+		}
+
+		template <EPCGExFuseMethod Method>
+		static PCGExBenchmark::FKernel MakeInsertEdgesKernel(const int32 Scale)
+		{
+			if (Scale < 4) { return nullptr; }
+
+			return [Scene = MakeScene(Scale)]()
+			{
+				const TSharedPtr<FUnionGraph> UnionGraph = MakeUnionGraph(*Scene, Method);
+				const int32 NumUnique = Scene->Data->GetNumPoints() / 2;
+
+				FUnionGraph::FBatchInserter Inserter(*UnionGraph);
+				for (int32 i = 0; i < Scene->Data->GetNumPoints() - 1; i++)
+				{
+					if (i == NumUnique - 1) { continue; }
+					Inserter.InsertEdge(Scene->PointIO->GetInPoint(i), Scene->PointIO->GetInPoint(i + 1));
+				}
+			};
+		}
+	}
+
+	static PCGExBenchmark::FRegistrar BenchFuseVoxel(TEXT("Graphs.Fuse.Edges.Voxel"), TEXT("Sequential insertion of two overlapping copies of an N/2 points polyline, voxel fuse"), &UnionBenchmark::MakeInsertEdgesKernel<EPCGExFuseMethod::Voxel>);
+	static PCGExBenchmark::FRegistrar BenchFuseOctree(TEXT("Graphs.Fuse.Edges.Octree"), TEXT("Sequential insertion of two overlapping copies of an N/2 points polyline, octree fuse"), &UnionBenchmark::MakeInsertEdgesKernel<EPCGExFuseMethod::Octree>);
+
+	static PCGExBenchmark::FRegistrar BenchFusePointsGrid(
+		TEXT("Graphs.Fuse.Points.Grid"), TEXT("Tolerance grid fuse of N points followed by a bulk union graph insertion"),
+		[](const int32 Scale) -> PCGExBenchmark::FKernel
+		{
+			if (Scale < 2) { return nullptr; }
+
+			return [Scene = UnionBenchmark::MakeScene(Scale)]()
+			{
+				PCGExMath::FToleranceGrid Grid(FVector(UnionBenchmark::Tolerance), false, false);
+				Grid.Build(Scene->Data.Get());
+
+				TArray<int32> Leaders;
+				Grid.Fuse(Leaders);
+
+				const TSharedPtr<FUnionGraph> UnionGraph = UnionBenchmark::MakeUnionGraph(*Scene, EPCGExFuseMethod::Octree);
+				UnionGraph->InsertFusedPoints(Scene->PointIO, Leaders);
+			};
+		});
+}
+
+#endif
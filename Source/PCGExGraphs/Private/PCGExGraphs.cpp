@@ -4,6 +4,7 @@
 #include "PCGExGraphs.h"
 
 #include "Clusters/PCGExClusterCache.h"
+#include "Core/PCGExClusterOutputCache.h"
 #include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
 #include "Clusters/Artifacts/PCGExCachedChain.h"
 
@@ -27,6 +28,8 @@ void FPCGExGraphsModule::StartupModule()
 		MakeShared<PCGExClusters::FFaceEnumeratorCacheFactory>());
 	PCGExClusters::FClusterCacheRegistry::Get().Register(
 		MakeShared<PCGExClusters::FChainCacheFactory>());
+
+	PCGExClusterMT::FOutputCache::Get().RegisterDelegates();
 }
 
 void FPCGExGraphsModule::ShutdownModule()
@@ -37,6 +40,8 @@ void FPCGExGraphsModule::ShutdownModule()
 	PCGExClusters::FClusterCacheRegistry::Get().Unregister(
 		PCGExClusters::FChainCacheFactory::CacheKey);
 
+	PCGExClusterMT::FOutputCache::Get().UnregisterDelegates();
+
 	IPCGExLegacyModuleInterface::ShutdownModule();
 }
 
@@ -0,0 +1,100 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Data/PCGExPointIO.h"
+
+class UPCGBasePointData;
+class UPCGExClustersProcessorSettings;
+struct FPCGExContext;
+
+namespace PCGExClusterMT
+{
+	struct PCGEXGRAPHS_API FOutputCacheStats
+	{
+		int32 NumEntries = 0;
+		int64 NumHits = 0;
+		int64 NumMisses = 0;
+		int64 NumStores = 0;
+		int64 NumEvictions = 0;
+		int64 MemoryBytes = 0;
+	};
+
+	/**
+	 * Outputs of cluster processors, kept across executions so clusters whose inputs didn't change can skip processing.
+	 * An entry covers one vtx group and all its edges, keyed on the content CRC of that data, the node settings
+	 * and every other input the node reads. Only nodes that opt-in through UPCGExSettings::SupportsIncrementalExecution
+	 * are cached; their output must be fully determined by their inputs.
+	 *
+	 * Entries hold strong references to the output data and are evicted LRU-first past the memory budget.
+	 * They are all released when an editor or game world is cleaned up, and when the module shuts down.
+	 * Cached data is handed out as-is on every hit, so it is guarded against downstream nodes stealing it.
+	 */
+	class PCGEXGRAPHS_API FOutputCache
+	{
+		struct FCachedIO
+		{
+			TStrongObjectPtr<UPCGBasePointData> Data;
+			PCGExData::FStealGuard StealGuard;
+			TSet<FString> Tags;
+			bool bEnabled = true;
+		};
+
+		struct FEntry
+		{
+			FCachedIO Vtx;
+			TArray<FCachedIO> Edges;
+			int64 MemoryBytes = 0;
+			uint64 LastAccess = 0;
+		};
+
+	public:
+		static FOutputCache& Get();
+
+		/** Hash of everything a node reads besides the clusters themselves: settings, and data on pins other than vtx & edges */
+		static uint64 ComputeNodeKey(const FPCGExContext* InContext, const UPCGExClustersProcessorSettings* InSettings);
+
+		/** Hash of a single vtx group & its edges, as seen by a node. Must be computed before that node modifies any of them. */
+		static uint64 ComputeClusterKey(const uint64 NodeKey, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<const TSharedRef<PCGExData::FPointIO>> InEdges);
+
+		/** Restores the outputs stored under Key onto the given IOs. @return false on a miss, in which case the IOs are left untouched. */
+		bool TryRestore(const uint64 Key, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<const TSharedRef<PCGExData::FPointIO>> InEdges);
+
+		/** Stores the current outputs of the given IOs under Key. Must be called once those outputs are final. */
+		void Store(const uint64 Key, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<const TSharedRef<PCGExData::FPointIO>> InEdges);
+
+		/** Drop least recently used entries until the memory budget is respected */
+		void Trim();
+
+		/** Drop every entry */
+		void Flush();
+
+		/** Flush on world cleanup; called by the module on startup, undone on shutdown */
+		void RegisterDelegates();
+		void UnregisterDelegates();
+
+		FOutputCacheStats GetStats() const;
+		FString GetStatsSummary() const;
+
+	private:
+		FOutputCache() = default;
+
+		void TrimUnsafe(const int64 InBudget);
+
+		TMap<uint64, TSharedPtr<FEntry>> Entries;
+		mutable FRWLock Lock;
+
+		FDelegateHandle WorldCleanupHandle;
+
+		uint64 AccessCounter = 0;
+		int64 NumHits = 0;
+		int64 NumMisses = 0;
+		int64 NumStores = 0;
+		int64 NumEvictions = 0;
+		int64 MemoryBytes = 0;
+	};
+}
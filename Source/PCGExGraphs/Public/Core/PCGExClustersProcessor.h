@@ -113,6 +113,9 @@ struct PCGEXGRAPHS_API FPCGExClustersProcessorContext : FPCGExPointsProcessorCon
 
 	void OutputBatches() const;
 
+	/** Number of clusters whose outputs were restored from a previous execution instead of being processed. See UPCGExSettings::IncrementalExecution */
+	int32 NumReusedClusters = 0;
+
 protected:
 	virtual TSharedPtr<PCGExClusterMT::IBatch> CreateEdgeBatchInstance(const TSharedRef<PCGExData::FPointIO>& InVtx, TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges) const;
 	TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>> HeuristicsFactories;
@@ -141,6 +144,20 @@ protected:
 
 	bool StartProcessingClusters(FBatchProcessingValidateEntries&& ValidateEntries, FBatchProcessingInitEdgeBatch&& InitBatch, const bool bDaisyChain = false);
 
+	struct FPendingClusterOutput
+	{
+		uint64 Key = 0;
+		TSharedRef<PCGExData::FPointIO> Vtx;
+		TArray<TSharedRef<PCGExData::FPointIO>> Edges;
+	};
+
+	bool bIncrementalExecution = false;
+	bool bCompleteWithoutBatches = false;
+	uint64 IncrementalNodeKey = 0;
+	TArray<FPendingClusterOutput> PendingClusterOutputs;
+
+	virtual void OnComplete() override;
+
 	virtual void ClusterProcessing_InitialProcessingDone();
 	virtual void ClusterProcessing_WorkComplete();
 	virtual void ClusterProcessing_WritingDone();
@@ -0,0 +1,70 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGraphs
+{
+	/**
+	 * Open-addressing edge hash -> edge index table, keyed on PCGEx::H64U edge hashes.
+	 * A key of 0 marks an empty slot, which is safe since an edge never connects a node to itself.
+	 *
+	 * Single-threaded use mirrors the TMap API it replaces (Add/Find/Contains).
+	 * Claim_Concurrent lets many threads deduplicate a batch of edges at once without locking,
+	 * as long as enough capacity was reserved beforehand; the table never grows during concurrent claims.
+	 */
+	class PCGEXGRAPHS_API FEdgeHashTable
+	{
+	public:
+		/** Value of a slot claimed during a concurrent batch, until the batch owner resolves it into an edge index */
+		static constexpr int32 PendingOrder(const int32 Order) { return -Order - 1; }
+
+		FEdgeHashTable() = default;
+
+		/** Makes room for InNum entries in total without rehashing. Not thread-safe. */
+		void Reserve(const int32 InNum);
+		void Empty();
+
+		FORCEINLINE int32 Num() const { return NumEntries; }
+		SIZE_T GetAllocatedSize() const;
+
+		const int32* Find(const uint64 Key) const;
+		FORCEINLINE int32* Find(const uint64 Key) { return const_cast<int32*>(const_cast<const FEdgeHashTable*>(this)->Find(Key)); }
+		FORCEINLINE bool Contains(const uint64 Key) const { return Find(Key) != nullptr; }
+
+		/** @return false if the key already exists, in which case its value is left untouched. Not thread-safe. */
+		bool Add(const uint64 Key, const int32 Value);
+
+		/**
+		 * Lock-free insert-or-find. Returns the slot that holds Key.
+		 * If Key wasn't there before the batch, the slot value ends up as PendingOrder() of the smallest Order
+		 * among all threads that claimed it, so the batch can tell which candidate owns it regardless of scheduling.
+		 * Values of keys that existed before the batch are left untouched.
+		 */
+		int32 Claim_Concurrent(const uint64 Key, const int32 Order);
+
+		FORCEINLINE int32& GetValueAt(const int32 Slot) { return Values[Slot]; }
+		FORCEINLINE int32 GetValueAt(const int32 Slot) const { return Values[Slot]; }
+
+	protected:
+		TArray<int64> Keys;
+		TArray<int32> Values;
+		uint64 Mask = 0;
+		int32 NumEntries = 0;
+
+		static FORCEINLINE uint64 Mix(uint64 Key)
+		{
+			// Murmur3 finalizer, edge hashes are two packed indices and cluster badly otherwise
+			Key ^= Key >> 33;
+			Key *= 0xFF51AFD7ED558CCDull;
+			Key ^= Key >> 33;
+			Key *= 0xC4CEB9FE1A85EC53ull;
+			Key ^= Key >> 33;
+			return Key;
+		}
+
+		void Rehash(const int32 NewCapacity);
+	};
+}
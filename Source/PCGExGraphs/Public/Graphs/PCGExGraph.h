@@ -7,6 +7,7 @@
 #include "PCGExGraphMetadata.h"
 #include "Clusters/PCGExEdge.h"
 #include "Graphs/PCGExGraphDetails.h"
+#include "Graphs/PCGExEdgeHashTable.h"
 #include "Clusters/PCGExNode.h"
 
 namespace PCGEx
@@ -42,7 +43,7 @@ namespace PCGExGraphs
 		TArray<FGraphEdgeMetadata> EdgeMetadata;
 		bool bHasAnyEdgeMetadata = false;
 
-		TMap<uint64, int32> UniqueEdges;
+		FEdgeHashTable UniqueEdges;
 
 		TArray<TSharedRef<FSubGraph>> SubGraphs;
 		TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup;
@@ -129,5 +130,14 @@ namespace PCGExGraphs
 		~FGraph() = default;
 
 		void GetConnectedNodes(int32 FromIndex, TArray<int32>& OutIndices, int32 SearchDepth) const;
+
+	protected:
+		/**
+		 * Bulk insertion core. Candidates are deduplicated against existing edges & each other in parallel,
+		 * then new edges are appended in candidate order, exactly as a sequential insertion would.
+		 * InitEdge must fully initialize the edge; its Index is set afterward.
+		 * @return the index of the first appended edge
+		 */
+		int32 AppendUniqueEdges_Unsafe(const int32 NumCandidates, TFunctionRef<uint64(const int32 Candidate)> GetHash, TFunctionRef<void(const int32 Candidate, FEdge& OutEdge)> InitEdge);
 	};
 }
@@ -112,6 +112,12 @@ namespace PCGExGraphs
 
 		int32 InsertPoint(const PCGExData::FConstPoint& Point);
 
+		/**
+		 * Inserts every point of InSource from a precomputed leader per point (see PCGExMath::FToleranceGrid::Fuse).
+		 * Nodes and unions are the same as inserting the points one by one in index order; the octree is left untouched.
+		 */
+		void InsertFusedPoints(const TSharedPtr<PCGExData::FPointIO>& InSource, const TArray<int32>& Leaders);
+
 		void InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
 
 		void WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const;
@@ -0,0 +1,82 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExHeuristicsBenchmark.h"
+
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Heuristics/PCGExHeuristicAzimuth.h"
+#include "Heuristics/PCGExHeuristicDistance.h"
+#include "Heuristics/PCGExHeuristicInertia.h"
+#include "Heuristics/PCGExHeuristicNodeCount.h"
+#include "Heuristics/PCGExHeuristicSteepness.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExHeuristics::Benchmark
+{
+	template <typename T_FACTORY, typename FSetupFn>
+	static void AddFactory(TArray<TStrongObjectPtr<UPCGExHeuristicsFactoryData>>& OutFactories, FSetupFn&& Setup)
+	{
+		T_FACTORY* NewFactory = NewObject<T_FACTORY>();
+		NewFactory->Config.bUseLocalCurve = true;
+		Setup(NewFactory->Config);
+
+		NewFactory->WeightFactor = NewFactory->Config.WeightFactor;
+		NewFactory->Config.Init();
+		NewFactory->ConfigBase = NewFactory->Config;
+
+		OutFactories.Emplace(NewFactory);
+	}
+
+	TSharedPtr<FHandler> MakeHandler(const TSharedRef<PCGExClusters::FCluster>& Cluster, const EPCGExHeuristicScoreMode ScoreMode, const TConstArrayView<EHeuristic> Heuristics, const bool bPrecombineStaticScores)
+	{
+		// Rooted until the handler has created its operations
+		TArray<TStrongObjectPtr<UPCGExHeuristicsFactoryData>> Factories;
+
+		for (const EHeuristic Heuristic : Heuristics)
+		{
+			switch (Heuristic)
+			{
+			case EHeuristic::Distance:
+				AddFactory<UPCGExHeuristicsFactoryShortestDistance>(Factories, [](FPCGExHeuristicConfigShortestDistance& Config) {});
+				break;
+			case EHeuristic::LeastNodes:
+				AddFactory<UPCGExHeuristicsFactoryLeastNodes>(Factories, [](FPCGExHeuristicConfigLeastNodes& Config) {});
+				break;
+			case EHeuristic::Steepness:
+				AddFactory<UPCGExHeuristicsFactorySteepness>(Factories, [](FPCGExHeuristicConfigSteepness& Config) {});
+				break;
+			case EHeuristic::SteepnessAccumulated:
+				AddFactory<UPCGExHeuristicsFactorySteepness>(
+					Factories, [](FPCGExHeuristicConfigSteepness& Config)
+					{
+						Config.bAccumulateScore = true;
+						Config.AccumulationSamples = 3;
+					});
+				break;
+			case EHeuristic::Azimuth:
+				AddFactory<UPCGExHeuristicsFactoryAzimuth>(Factories, [](FPCGExHeuristicConfigAzimuth& Config) {});
+				break;
+			case EHeuristic::Inertia:
+				AddFactory<UPCGExHeuristicsFactoryInertia>(Factories, [](FPCGExHeuristicConfigInertia& Config) { Config.Samples = 2; });
+				break;
+			}
+		}
+
+		TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>> FactoryPtrs;
+		for (const TStrongObjectPtr<UPCGExHeuristicsFactoryData>& Factory : Factories) { FactoryPtrs.Add(Factory.Get()); }
+
+		TSharedPtr<FHandler> Handler = FHandler::CreateHandler(ScoreMode, nullptr, nullptr, nullptr, FactoryPtrs);
+		if (!Handler->IsValidHandler()) { return nullptr; }
+
+		Handler->bPrecombineStaticScores = bPrecombineStaticScores;
+		Handler->PrepareForCluster(Cluster);
+		Handler->CompleteClusterPreparation();
+
+		return Handler;
+	}
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "PCGExHeuristicsHandler.h"
 
 #include "Clusters/PCGExCluster.h"
+#include "Core/PCGExMTCommon.h"
 #include "Heuristics/PCGExHeuristicFeedback.h"
 #include "Core/PCGExHeuristicOperation.h"
 
@@ -149,6 +150,96 @@ namespace PCGExHeuristics
 				break;
 			}
 		}
+
+		PrepareStaticScores();
+	}
+
+	void FHandler::PrepareStaticScores()
+	{
+		StaticEdgeScores.Reset();
+		StaticGlobalScores.Reset();
+		bPrecombinedEdgeScores = false;
+		bPrecombinedGlobalScores = false;
+
+		TArray<TSharedPtr<FPCGExHeuristicOperation>> StaticEdgeOps;
+		TArray<TSharedPtr<FPCGExHeuristicOperation>> StaticGlobalOps;
+
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		{
+			// Dynamic weights rescale every operation per edge at query time, so edge scores can't be folded ahead
+			if (bPrecombineStaticScores && !bUseDynamicWeight && Op->HasStaticEdgeScore()) { StaticEdgeOps.Add(Op); }
+			else { CategorizedOps.RuntimeEdge.Add(Op); }
+
+			if (bPrecombineStaticScores && Op->HasStaticGlobalScore()) { StaticGlobalOps.Add(Op); }
+			else { CategorizedOps.RuntimeGlobal.Add(Op); }
+		}
+
+		const double Identity = GetFoldIdentity();
+
+		if (!StaticEdgeOps.IsEmpty())
+		{
+			const TArray<PCGExGraphs::FEdge>& Edges = *Cluster->Edges;
+			bPrecombinedEdgeScores = CategorizedOps.RuntimeEdge.IsEmpty() && !HasLocalFeedback();
+
+			StaticEdgeScores.SetNumUninitialized(Edges.Num() * 2);
+			PCGEX_PARALLEL_FOR(
+				Edges.Num(),
+				const PCGExGraphs::FEdge& Edge = Edges[i];
+				const PCGExClusters::FNode& Start = *Cluster->GetEdgeStart(Edge);
+				const PCGExClusters::FNode& End = *Cluster->GetEdgeEnd(Edge);
+
+				// Static scores ignore Seed & Goal, the edge endpoints stand in for them
+				double Forward = Identity;
+				double Backward = Identity;
+				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : StaticEdgeOps)
+				{
+					Forward = FoldScore(Forward, *Op, Op->GetEdgeScore(Start, End, Edge, Start, End, nullptr));
+					Backward = FoldScore(Backward, *Op, Op->GetEdgeScore(End, Start, Edge, End, Start, nullptr));
+				}
+
+				StaticEdgeScores[GetDirectedEdgeIndex(Start, Edge)] = bPrecombinedEdgeScores ? FinalizeScore(Forward) : Forward;
+				StaticEdgeScores[GetDirectedEdgeIndex(End, Edge)] = bPrecombinedEdgeScores ? FinalizeScore(Backward) : Backward;
+			)
+		}
+
+		if (!StaticGlobalOps.IsEmpty())
+		{
+			const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes;
+			bPrecombinedGlobalScores = CategorizedOps.RuntimeGlobal.IsEmpty() && !HasLocalFeedback();
+
+			StaticGlobalScores.SetNumUninitialized(Nodes.Num());
+			PCGEX_PARALLEL_FOR(
+				Nodes.Num(),
+				const PCGExClusters::FNode& Node = Nodes[i];
+
+				double Score = Identity;
+				for (const TSharedPtr<FPCGExHeuristicOperation>& Op : StaticGlobalOps) { Score = FoldScore(Score, *Op, Op->GetGlobalScore(Node, Node, Node)); }
+
+				StaticGlobalScores[Node.Index] = bPrecombinedGlobalScores ? FinalizeScore(Score) : Score;
+			)
+		}
+	}
+
+	FORCEINLINE int32 FHandler::GetDirectedEdgeIndex(const PCGExClusters::FNode& From, const PCGExGraphs::FEdge& Edge)
+	{
+		return Edge.Index * 2 + (Edge.Start != static_cast<uint32>(From.PointIndex));
+	}
+
+	FORCEINLINE double FHandler::GetStaticEdgeScore(const PCGExClusters::FNode& From, const PCGExGraphs::FEdge& Edge, const double Identity) const
+	{
+		return StaticEdgeScores.IsEmpty() ? Identity : StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)];
+	}
+
+	FORCEINLINE double FHandler::GetStaticGlobalScore(const PCGExClusters::FNode& From, const double Identity) const
+	{
+		return StaticGlobalScores.IsEmpty() ? Identity : StaticGlobalScores[From.Index];
+	}
+
+	bool FHandler::HasGoalIndependentEdgeScores() const
+	{
+		if (HasAnyFeedback()) { return false; }
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { if (!Op->HasGoalIndependentEdgeScore()) { return false; } }
+		return true;
 	}
 
 	void FHandler::FeedbackPointScore(const PCGExClusters::FNode& Node)
@@ -268,10 +359,12 @@ namespace PCGExHeuristics
 
 	double FHandlerWeightedAverage::GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback) const
 	{
-		double GScore = 0;
+		if (bPrecombinedGlobalScores) { return StaticGlobalScores[From.Index]; }
+
+		double GScore = GetStaticGlobalScore(From, 0);
 		double TotalWeight = TotalStaticWeight;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { GScore += Op->GetGlobalScore(From, Seed, Goal); }
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeGlobal) { GScore += Op->GetGlobalScore(From, Seed, Goal); }
 		if (LocalFeedback)
 		{
 			GScore += LocalFeedback->GetGlobalScore(From, Seed, Goal);
@@ -288,7 +381,10 @@ namespace PCGExHeuristics
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
+			if (bPrecombinedEdgeScores) { return StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)]; }
+
+			EScore = GetStaticEdgeScore(From, Edge, 0);
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeEdge) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
 
 			if (LocalFeedback)
 			{
@@ -317,6 +413,16 @@ namespace PCGExHeuristics
 		return TotalWeight > 0 ? EScore / TotalWeight : 0;
 	}
 
+	double FHandlerWeightedAverage::FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const
+	{
+		return Accumulator + Score;
+	}
+
+	double FHandlerWeightedAverage::FinalizeScore(const double Accumulator) const
+	{
+		return TotalStaticWeight > 0 ? Accumulator / TotalStaticWeight : 0;
+	}
+
 #pragma endregion
 
 #pragma region FHandlerGeometricMean
@@ -327,10 +433,12 @@ namespace PCGExHeuristics
 		// To avoid log(0), we clamp scores to a small minimum
 		constexpr double MinScore = 1e-10;
 
-		double WeightedLogSum = 0;
+		if (bPrecombinedGlobalScores) { return StaticGlobalScores[From.Index]; }
+
+		double WeightedLogSum = GetStaticGlobalScore(From, 0);
 		double TotalWeight = TotalStaticWeight;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeGlobal)
 		{
 			const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
 			// Score already includes WeightFactor via ReferenceWeight, so we use WeightFactor for the exponent
@@ -356,7 +464,10 @@ namespace PCGExHeuristics
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			if (bPrecombinedEdgeScores) { return StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)]; }
+
+			WeightedLogSum = GetStaticEdgeScore(From, Edge, 0);
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeEdge)
 			{
 				const double Score = FMath::Max(MinScore, Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack));
 				WeightedLogSum += Op->WeightFactor * FMath::Loge(Score / Op->WeightFactor);
@@ -393,15 +504,28 @@ namespace PCGExHeuristics
 		return TotalWeight > 0 ? FMath::Exp(WeightedLogSum / TotalWeight) : 0;
 	}
 
+	double FHandlerGeometricMean::FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const
+	{
+		constexpr double MinScore = 1e-10;
+		return Accumulator + Op.WeightFactor * FMath::Loge(FMath::Max(MinScore, Score) / Op.WeightFactor);
+	}
+
+	double FHandlerGeometricMean::FinalizeScore(const double Accumulator) const
+	{
+		return TotalStaticWeight > 0 ? FMath::Exp(Accumulator / TotalStaticWeight) : 0;
+	}
+
 #pragma endregion
 
 #pragma region FHandlerWeightedSum
 
 	double FHandlerWeightedSum::GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback) const
 	{
-		double GScore = 0;
+		if (bPrecombinedGlobalScores) { return StaticGlobalScores[From.Index]; }
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { GScore += Op->GetGlobalScore(From, Seed, Goal); }
+		double GScore = GetStaticGlobalScore(From, 0);
+
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeGlobal) { GScore += Op->GetGlobalScore(From, Seed, Goal); }
 		if (LocalFeedback)
 		{
 			GScore += LocalFeedback->GetGlobalScore(From, Seed, Goal);
@@ -417,7 +541,10 @@ namespace PCGExHeuristics
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
+			if (bPrecombinedEdgeScores) { return StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)]; }
+
+			EScore = GetStaticEdgeScore(From, Edge, 0);
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeEdge) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
 
 			if (LocalFeedback)
 			{
@@ -442,6 +569,16 @@ namespace PCGExHeuristics
 		return EScore;
 	}
 
+	double FHandlerWeightedSum::FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const
+	{
+		return Accumulator + Score;
+	}
+
+	double FHandlerWeightedSum::FinalizeScore(const double Accumulator) const
+	{
+		return Accumulator;
+	}
+
 #pragma endregion
 
 #pragma region FHandlerHarmonicMean
@@ -452,10 +589,12 @@ namespace PCGExHeuristics
 		// Heavily emphasizes low scores - a single low score dominates the result
 		constexpr double MinScore = 1e-10;
 
-		double WeightedInverseSum = 0;
+		if (bPrecombinedGlobalScores) { return StaticGlobalScores[From.Index]; }
+
+		double WeightedInverseSum = GetStaticGlobalScore(From, 0);
 		double TotalWeight = TotalStaticWeight;
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeGlobal)
 		{
 			const double Score = FMath::Max(MinScore, Op->GetGlobalScore(From, Seed, Goal));
 			// Normalize score by weight first, then compute inverse
@@ -481,7 +620,10 @@ namespace PCGExHeuristics
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			if (bPrecombinedEdgeScores) { return StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)]; }
+
+			WeightedInverseSum = GetStaticEdgeScore(From, Edge, 0);
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeEdge)
 			{
 				const double Score = FMath::Max(MinScore, Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack));
 				WeightedInverseSum += Op->WeightFactor / (Score / Op->WeightFactor);
@@ -518,6 +660,17 @@ namespace PCGExHeuristics
 		return WeightedInverseSum > 0 ? TotalWeight / WeightedInverseSum : 0;
 	}
 
+	double FHandlerHarmonicMean::FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const
+	{
+		constexpr double MinScore = 1e-10;
+		return Accumulator + Op.WeightFactor / (FMath::Max(MinScore, Score) / Op.WeightFactor);
+	}
+
+	double FHandlerHarmonicMean::FinalizeScore(const double Accumulator) const
+	{
+		return Accumulator > 0 ? TotalStaticWeight / Accumulator : 0;
+	}
+
 #pragma endregion
 
 #pragma region FHandlerMin
@@ -526,9 +679,11 @@ namespace PCGExHeuristics
 	{
 		// Min: returns the lowest score (normalized by weight)
 		// Most permissive - any heuristic can allow passage
-		double MinScore = TNumericLimits<double>::Max();
+		if (bPrecombinedGlobalScores) { return StaticGlobalScores[From.Index]; }
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		double MinScore = GetStaticGlobalScore(From, TNumericLimits<double>::Max());
+
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeGlobal)
 		{
 			const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor; // Normalize
 			MinScore = FMath::Min(MinScore, Score);
@@ -549,7 +704,10 @@ namespace PCGExHeuristics
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			if (bPrecombinedEdgeScores) { return StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)]; }
+
+			MinScore = GetStaticEdgeScore(From, Edge, TNumericLimits<double>::Max());
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeEdge)
 			{
 				const double Score = Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack) / Op->WeightFactor;
 				MinScore = FMath::Min(MinScore, Score);
@@ -585,6 +743,16 @@ namespace PCGExHeuristics
 		return MinScore == TNumericLimits<double>::Max() ? 0 : MinScore;
 	}
 
+	double FHandlerMin::FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const
+	{
+		return FMath::Min(Accumulator, Score / Op.WeightFactor);
+	}
+
+	double FHandlerMin::FinalizeScore(const double Accumulator) const
+	{
+		return Accumulator == TNumericLimits<double>::Max() ? 0 : Accumulator;
+	}
+
 #pragma endregion
 
 #pragma region FHandlerMax
@@ -593,9 +761,11 @@ namespace PCGExHeuristics
 	{
 		// Max: returns the highest score (normalized by weight)
 		// Most restrictive - any heuristic can block passage
-		double MaxScore = TNumericLimits<double>::Lowest();
+		if (bPrecombinedGlobalScores) { return StaticGlobalScores[From.Index]; }
 
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+		double MaxScore = GetStaticGlobalScore(From, TNumericLimits<double>::Lowest());
+
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeGlobal)
 		{
 			const double Score = Op->GetGlobalScore(From, Seed, Goal) / Op->WeightFactor; // Normalize
 			MaxScore = FMath::Max(MaxScore, Score);
@@ -616,7 +786,10 @@ namespace PCGExHeuristics
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
+			if (bPrecombinedEdgeScores) { return StaticEdgeScores[GetDirectedEdgeIndex(From, Edge)]; }
+
+			MaxScore = GetStaticEdgeScore(From, Edge, TNumericLimits<double>::Lowest());
+			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : CategorizedOps.RuntimeEdge)
 			{
 				const double Score = Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack) / Op->WeightFactor;
 				MaxScore = FMath::Max(MaxScore, Score);
@@ -652,6 +825,16 @@ namespace PCGExHeuristics
 		return MaxScore == TNumericLimits<double>::Lowest() ? 0 : MaxScore;
 	}
 
+	double FHandlerMax::FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const
+	{
+		return FMath::Max(Accumulator, Score / Op.WeightFactor);
+	}
+
+	double FHandlerMax::FinalizeScore(const double Accumulator) const
+	{
+		return Accumulator == TNumericLimits<double>::Lowest() ? 0 : Accumulator;
+	}
+
 #pragma endregion
 }
 
@@ -0,0 +1,104 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExHeuristicsBenchmark.h"
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterBenchmark.h"
+#include "Core/PCGExBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Precombined static scores against per-query evaluation, e.g. pcgex.Bench.Check Filter=Heuristics.*
+namespace PCGExHeuristics
+{
+	namespace HandlerBenchmark
+	{
+		constexpr int32 NumQueries = 4;
+
+		FORCEINLINE static bool IsSameScore(const double A, const double B)
+		{
+			return FMath::IsNearlyEqual(A, B, FMath::Max(1.0, FMath::Abs(B)) * UE_DOUBLE_SMALL_NUMBER);
+		}
+
+		static const TCHAR* GetModeName(const EPCGExHeuristicScoreMode ScoreMode)
+		{
+			switch (ScoreMode)
+			{
+			case EPCGExHeuristicScoreMode::WeightedAverage: return TEXT("WeightedAverage");
+			case EPCGExHeuristicScoreMode::GeometricMean: return TEXT("GeometricMean");
+			case EPCGExHeuristicScoreMode::WeightedSum: return TEXT("WeightedSum");
+			case EPCGExHeuristicScoreMode::HarmonicMean: return TEXT("HarmonicMean");
+			case EPCGExHeuristicScoreMode::Min: return TEXT("Min");
+			case EPCGExHeuristicScoreMode::Max: return TEXT("Max");
+			default: return TEXT("Unknown");
+			}
+		}
+	}
+
+	static PCGExBenchmark::FCheckRegistrar CheckPrecombinedScores(
+		TEXT("Heuristics.PrecombinedScores"), TEXT("Precombined static edge & global scores equal the ones evaluated at query time, in every score mode"),
+		[](PCGExBenchmark::FCheckContext& Context)
+		{
+			using Benchmark::EHeuristic;
+
+			// Static operations only, so scores are fully precombined, then mixed with goal-dependent ones, so they're partially folded
+			const EHeuristic StaticOnly[] = {EHeuristic::Distance, EHeuristic::LeastNodes, EHeuristic::Steepness};
+			const EHeuristic Mixed[] = {EHeuristic::Distance, EHeuristic::LeastNodes, EHeuristic::Steepness, EHeuristic::Azimuth};
+
+			const TSharedPtr<PCGExClusters::Benchmark::FGridCluster> Grid = PCGExClusters::Benchmark::MakeGridCluster(1024, 0.3);
+			if (!Context.Test(Grid->Cluster.IsValid(), TEXT("Grid cluster setup failed"))) { return; }
+
+			const TSharedRef<PCGExClusters::FCluster> Cluster = Grid->Cluster.ToSharedRef();
+			const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+			const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+
+			for (const EPCGExHeuristicScoreMode ScoreMode : {
+				     EPCGExHeuristicScoreMode::WeightedSum, EPCGExHeuristicScoreMode::WeightedAverage, EPCGExHeuristicScoreMode::GeometricMean,
+				     EPCGExHeuristicScoreMode::HarmonicMean, EPCGExHeuristicScoreMode::Min, EPCGExHeuristicScoreMode::Max})
+			{
+				const TCHAR* ModeName = HandlerBenchmark::GetModeName(ScoreMode);
+
+				for (const TConstArrayView<EHeuristic> Heuristics : {MakeConstArrayView(StaticOnly), MakeConstArrayView(Mixed)})
+				{
+					const bool bStaticOnly = Heuristics.Num() == UE_ARRAY_COUNT(StaticOnly);
+					const TCHAR* SetName = bStaticOnly ? TEXT("static") : TEXT("mixed");
+
+					const TSharedPtr<FHandler> Precombined = Benchmark::MakeHandler(Cluster, ScoreMode, Heuristics, true);
+					const TSharedPtr<FHandler> Runtime = Benchmark::MakeHandler(Cluster, ScoreMode, Heuristics, false);
+					if (!Context.Test(Precombined && Runtime, TEXT("%s, %s : handler setup failed"), ModeName, SetName)) { continue; }
+
+					// Guards against a handler that silently stopped precombining, which would make the comparison moot
+					Context.Test(!Runtime->bPrecombinedEdgeScores && Runtime->StaticEdgeScores.IsEmpty(), TEXT("%s, %s : runtime handler precombined its edge scores"), ModeName, SetName);
+					Context.Test(!Precombined->StaticEdgeScores.IsEmpty(), TEXT("%s, %s : no static edge scores were precombined"), ModeName, SetName);
+					if (bStaticOnly) { Context.Test(Precombined->bPrecombinedEdgeScores, TEXT("%s, %s : edge scores aren't final"), ModeName, SetName); }
+
+					FRandomStream Random(1337);
+					for (int32 q = 0; q < HandlerBenchmark::NumQueries; q++)
+					{
+						const PCGExClusters::FNode& Seed = NodesRef[Random.RandHelper(NodesRef.Num())];
+						const PCGExClusters::FNode& Goal = NodesRef[Random.RandHelper(NodesRef.Num())];
+
+						for (const PCGExClusters::FNode& From : NodesRef)
+						{
+							const double ExpectedGlobal = Runtime->GetGlobalScore(From, Seed, Goal);
+							const double Global = Precombined->GetGlobalScore(From, Seed, Goal);
+							Context.Test(HandlerBenchmark::IsSameScore(Global, ExpectedGlobal), TEXT("%s, %s : node %d global score %f, %f at query time"), ModeName, SetName, From.Index, Global, ExpectedGlobal);
+
+							for (const PCGExGraphs::FLink Lk : From.Links)
+							{
+								const PCGExClusters::FNode& To = NodesRef[Lk.Node];
+								const PCGExGraphs::FEdge& Edge = EdgesRef[Lk.Edge];
+
+								const double Expected = Runtime->GetEdgeScore(From, To, Edge, Seed, Goal);
+								const double Score = Precombined->GetEdgeScore(From, To, Edge, Seed, Goal);
+								Context.Test(HandlerBenchmark::IsSameScore(Score, Expected), TEXT("%s, %s : edge %d from node %d score %f, %f at query time"), ModeName, SetName, Edge.Index, From.Index, Score, Expected);
+							}
+						}
+					}
+				}
+			}
+		});
+}
+
+#endif
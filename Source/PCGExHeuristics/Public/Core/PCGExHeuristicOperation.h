@@ -61,6 +61,19 @@ public:
 	/** Returns the category of this heuristic for optimization purposes */
 	virtual EPCGExHeuristicCategory GetCategory() const { return EPCGExHeuristicCategory::GoalDependent; }
 
+	/** Whether GetEdgeScore ignores Seed & Goal, so a single exploration from a seed can serve many goals */
+	virtual bool HasGoalIndependentEdgeScore() const
+	{
+		const EPCGExHeuristicCategory Category = GetCategory();
+		return Category == EPCGExHeuristicCategory::FullyStatic || Category == EPCGExHeuristicCategory::TravelDependent;
+	}
+
+	/** Whether GetEdgeScore only depends on From, To & Edge, so the handler can precompute it once per directed edge */
+	virtual bool HasStaticEdgeScore() const { return GetCategory() == EPCGExHeuristicCategory::FullyStatic; }
+
+	/** Whether GetGlobalScore only depends on From, so the handler can precompute it once per node */
+	virtual bool HasStaticGlobalScore() const { return false; }
+
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster);
 
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const;
@@ -64,6 +64,7 @@ class FPCGExHeuristicAttribute : public FPCGExHeuristicOperation
 {
 public:
 	virtual EPCGExHeuristicCategory GetCategory() const override { return EPCGExHeuristicCategory::FullyStatic; }
+	virtual bool HasStaticGlobalScore() const override { return true; }
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
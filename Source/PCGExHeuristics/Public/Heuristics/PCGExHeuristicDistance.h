@@ -29,6 +29,8 @@ class FPCGExHeuristicDistance : public FPCGExHeuristicOperation
 {
 public:
 	virtual EPCGExHeuristicCategory GetCategory() const override { return EPCGExHeuristicCategory::GoalDependent; }
+	virtual bool HasGoalIndependentEdgeScore() const override { return true; }
+	virtual bool HasStaticEdgeScore() const override { return true; }
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
@@ -26,6 +26,7 @@ class FPCGExHeuristicNodeCount : public FPCGExHeuristicDistance
 {
 public:
 	virtual EPCGExHeuristicCategory GetCategory() const override { return EPCGExHeuristicCategory::FullyStatic; }
+	virtual bool HasStaticGlobalScore() const override { return true; }
 
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const override;
 
@@ -45,7 +45,7 @@ class FPCGExHeuristicSteepness : public FPCGExHeuristicOperation
 	friend class UPCGExHeuristicsFactorySteepness;
 
 public:
-	virtual EPCGExHeuristicCategory GetCategory() const override { return bAccumulate ? EPCGExHeuristicCategory::TravelDependent : EPCGExHeuristicCategory::GoalDependent; }
+	virtual EPCGExHeuristicCategory GetCategory() const override { return bAccumulate ? EPCGExHeuristicCategory::TravelDependent : EPCGExHeuristicCategory::FullyStatic; }
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
@@ -0,0 +1,38 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExHeuristicsCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExHeuristics
+{
+	class FHandler;
+
+	namespace Benchmark
+	{
+		/** Heuristics a benchmark handler can be built from, each at weight 1 over a linear local score curve */
+		enum class EHeuristic : uint8
+		{
+			Distance,
+			LeastNodes,
+			Steepness,
+			SteepnessAccumulated,
+			Azimuth,
+			Inertia,
+		};
+
+		/** Builds & prepares a handler for the given cluster without any context, for benchmark & check cases */
+		PCGEXHEURISTICS_API TSharedPtr<FHandler> MakeHandler(const TSharedRef<PCGExClusters::FCluster>& Cluster, const EPCGExHeuristicScoreMode ScoreMode, const TConstArrayView<EHeuristic> Heuristics, const bool bPrecombineStaticScores = true);
+	}
+}
+
+#endif
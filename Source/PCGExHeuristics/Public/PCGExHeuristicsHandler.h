@@ -32,6 +32,10 @@ namespace PCGExHeuristics
 		TArray<TSharedPtr<FPCGExHeuristicOperation>> TravelDependent;
 		// Note: Feedback operations are stored separately in Feedbacks array
 
+		// Operations left to evaluate at query time, once static scores are folded into the handler's precomputed scores
+		TArray<TSharedPtr<FPCGExHeuristicOperation>> RuntimeEdge;
+		TArray<TSharedPtr<FPCGExHeuristicOperation>> RuntimeGlobal;
+
 		double FullyStaticWeight = 0;
 		double GoalDependentWeight = 0;
 		double TravelDependentWeight = 0;
@@ -43,6 +47,8 @@ namespace PCGExHeuristics
 			FullyStatic.Empty();
 			GoalDependent.Empty();
 			TravelDependent.Empty();
+			RuntimeEdge.Empty();
+			RuntimeGlobal.Empty();
 			FullyStaticWeight = 0;
 			GoalDependentWeight = 0;
 			TravelDependentWeight = 0;
@@ -107,12 +113,28 @@ namespace PCGExHeuristics
 		/** Categorized operations for fast-path optimizations */
 		FCategorizedOperations CategorizedOps;
 
+		/**
+		 * Static operation scores folded per directed edge (see GetDirectedEdgeIndex) and per node, in the score mode's
+		 * accumulation space; empty when no operation has a static score.
+		 * When nothing is left to evaluate at query time, they hold final scores instead, and a query is a single read.
+		 */
+		TArray<double> StaticEdgeScores;
+		TArray<double> StaticGlobalScores;
+		bool bPrecombinedEdgeScores = false;
+		bool bPrecombinedGlobalScores = false;
+
+		/** When disabled, every operation is evaluated at query time; set before CompleteClusterPreparation. Reference for the precombined path. */
+		bool bPrecombineStaticScores = true;
+
 		bool IsValidHandler() const { return bIsValidHandler; }
 		bool HasTravelDependentOperations() const { return CategorizedOps.bHasTravelDependent; }
 		bool HasGlobalFeedback() const { return !Feedbacks.IsEmpty(); };
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
 
+		/** True if edge scores don't depend on the query goal & won't change between queries, i.e a single exploration can resolve many goals */
+		bool HasGoalIndependentEdgeScores() const;
+
 		FHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		virtual ~FHandler();
 
@@ -152,6 +174,21 @@ namespace PCGExHeuristics
 			const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 
 	protected:
+		/** Accumulator of a score mode before any operation is folded in */
+		virtual double GetFoldIdentity() const { return 0; }
+
+		/** Folds one operation score into an accumulator, the way the score mode's GetEdgeScore & GetGlobalScore do */
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const = 0;
+
+		/** Turns an accumulator of every operation into the final score */
+		virtual double FinalizeScore(const double Accumulator) const = 0;
+
+		void PrepareStaticScores();
+
+		static int32 GetDirectedEdgeIndex(const PCGExClusters::FNode& From, const PCGExGraphs::FEdge& Edge);
+		double GetStaticEdgeScore(const PCGExClusters::FNode& From, const PCGExGraphs::FEdge& Edge, const double Identity) const;
+		double GetStaticGlobalScore(const PCGExClusters::FNode& From, const double Identity) const;
+
 		PCGExClusters::FNode* RoamingSeedNode = nullptr;
 		PCGExClusters::FNode* RoamingGoalNode = nullptr;
 
@@ -172,6 +209,10 @@ namespace PCGExHeuristics
 
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const override;
 		virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr, const TSharedPtr<PCGEx::FHashLookup>& TravelStack = nullptr) const override;
+
+	protected:
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const override;
+		virtual double FinalizeScore(const double Accumulator) const override;
 	};
 
 	/** Geometric mean: product(score^weight)^(1/sum(weight)) */
@@ -182,6 +223,10 @@ namespace PCGExHeuristics
 
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const override;
 		virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr, const TSharedPtr<PCGEx::FHashLookup>& TravelStack = nullptr) const override;
+
+	protected:
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const override;
+		virtual double FinalizeScore(const double Accumulator) const override;
 	};
 
 	/** Weighted sum: sum(score × weight) - no normalization */
@@ -192,6 +237,10 @@ namespace PCGExHeuristics
 
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const override;
 		virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr, const TSharedPtr<PCGEx::FHashLookup>& TravelStack = nullptr) const override;
+
+	protected:
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const override;
+		virtual double FinalizeScore(const double Accumulator) const override;
 	};
 
 	/** Harmonic mean: sum(weight) / sum(weight/score) - heavily emphasizes low scores */
@@ -202,6 +251,10 @@ namespace PCGExHeuristics
 
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const override;
 		virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr, const TSharedPtr<PCGEx::FHashLookup>& TravelStack = nullptr) const override;
+
+	protected:
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const override;
+		virtual double FinalizeScore(const double Accumulator) const override;
 	};
 
 	/** Minimum: returns the lowest weighted score - most permissive */
@@ -212,6 +265,11 @@ namespace PCGExHeuristics
 
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const override;
 		virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr, const TSharedPtr<PCGEx::FHashLookup>& TravelStack = nullptr) const override;
+
+	protected:
+		virtual double GetFoldIdentity() const override { return TNumericLimits<double>::Max(); }
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const override;
+		virtual double FinalizeScore(const double Accumulator) const override;
 	};
 
 	/** Maximum: returns the highest weighted score - most restrictive */
@@ -222,5 +280,10 @@ namespace PCGExHeuristics
 
 		virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr) const override;
 		virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const FLocalFeedbackHandler* LocalFeedback = nullptr, const TSharedPtr<PCGEx::FHashLookup>& TravelStack = nullptr) const override;
+
+	protected:
+		virtual double GetFoldIdentity() const override { return TNumericLimits<double>::Lowest(); }
+		virtual double FoldScore(const double Accumulator, const FPCGExHeuristicOperation& Op, const double Score) const override;
+		virtual double FinalizeScore(const double Accumulator) const override;
 	};
 }
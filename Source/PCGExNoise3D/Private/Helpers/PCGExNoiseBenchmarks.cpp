@@ -0,0 +1,36 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExBenchmark.h"
+#include "Noises/PCGExNoisePerlin.h"
+#include "Noises/PCGExNoiseSimplex.h"
+#include "Noises/PCGExNoiseWorley.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExNoise3D
+{
+	template <typename T>
+	static PCGExBenchmark::FKernel MakeNoiseKernel(const int32 Scale)
+	{
+		TArray<FVector> Positions;
+		PCGExBenchmark::MakePositions(Positions, Scale);
+
+		const TSharedPtr<T> Noise = MakeShared<T>();
+		Noise->Frequency = 0.001;
+		Noise->Octaves = 4;
+
+		return [Noise, Positions = MoveTemp(Positions)]()
+		{
+			TArray<double> Results;
+			Results.SetNumUninitialized(Positions.Num());
+			Noise->Generate(Positions, Results);
+		};
+	}
+
+	static PCGExBenchmark::FRegistrar BenchPerlin(TEXT("Noise.Perlin"), TEXT("4-octave Perlin noise at N positions"), &MakeNoiseKernel<FPCGExNoisePerlin>);
+	static PCGExBenchmark::FRegistrar BenchSimplex(TEXT("Noise.Simplex"), TEXT("4-octave Simplex noise at N positions"), &MakeNoiseKernel<FPCGExNoiseSimplex>);
+	static PCGExBenchmark::FRegistrar BenchWorley(TEXT("Noise.Worley"), TEXT("4-octave Worley F1 noise at N positions"), &MakeNoiseKernel<FPCGExNoiseWorley>);
+}
+
+#endif
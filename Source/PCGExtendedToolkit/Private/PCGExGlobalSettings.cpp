@@ -51,11 +51,20 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bCacheClusters)
 	PCGEX_PUSH_SETTING(Core, bDefaultScopedIndexLookupBuild)
 	PCGEX_PUSH_SETTING(Core, bDefaultBuildAndCacheClusters)
+	PCGEX_PUSH_SETTING(Core, ClusterOutputCacheBudgetMB)
 
 	PCGEX_PUSH_SETTING(Core, SmallPointsSize)
 	PCGEX_PUSH_SETTING(Core, SmallClusterSize)
 	PCGEX_PUSH_SETTING(Core, PointsDefaultBatchChunkSize)
 	PCGEX_PUSH_SETTING(Core, ClusterDefaultBatchChunkSize)
+	PCGEX_PUSH_SETTING(Core, bShareReadBuffers)
+
+	PCGEX_PUSH_SETTING(Core, bShareSpatialIndexes)
+	PCGEX_PUSH_SETTING(Core, SpatialIndexCacheBudgetMB)
+
+	PCGEX_PUSH_SETTING(Core, bPoolBuffers)
+	PCGEX_PUSH_SETTING(Core, BufferPoolBudgetMB)
+	PCGEX_PUSH_SETTING(Core, BufferPoolMaxIdleSeconds)
 
 #if WITH_EDITOR
 
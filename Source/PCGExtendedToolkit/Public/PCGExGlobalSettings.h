@@ -70,6 +70,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Memory budget for cluster outputs kept by nodes using Incremental Execution. Least recently used ones are evicted first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=0))
+	int32 ClusterOutputCacheBudgetMB = 256;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -78,6 +82,30 @@ public:
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** Buffers reading the same attribute of the same input data share a single copy of its values, across nodes, instead of each reading their own. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points")
+	bool bShareReadBuffers = true;
+
+	/** Share spatial indexes (octrees, OBB collections) built over the same data between nodes, instead of rebuilding them in every node. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Spatial")
+	bool bShareSpatialIndexes = true;
+
+	/** Memory budget for shared spatial indexes no node is currently using. Least recently used ones are evicted first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Spatial", meta=(ClampMin=0, EditCondition="bShareSpatialIndexes"))
+	int32 SpatialIndexCacheBudgetMB = 512;
+
+	/** Recycle the storage of large buffers & scratch arrays between nodes instead of freeing and re-allocating it every time. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Memory")
+	bool bPoolBuffers = true;
+
+	/** Memory budget for buffer storage kept around for reuse. Least recently released buffers are freed first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Memory", meta=(ClampMin=0, EditCondition="bPoolBuffers"))
+	int32 BufferPoolBudgetMB = 512;
+
+	/** Pooled buffer storage that hasn't been reused for that many seconds is freed. 0 keeps it until the budget is exceeded. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Memory", meta=(ClampMin=0, EditCondition="bPoolBuffers"))
+	double BufferPoolMaxIdleSeconds = 30;
+
 	/** If enabled, debug generated by PCG will not be transient. (Pre-5.6 behavior) (Requires restarting the editor.)*/
 	UPROPERTY(EditAnywhere, config, Category = "Debug")
 	bool bPersistentDebug = false;